@@ -2,6 +2,7 @@ TEMPLATE = app
 
 CONFIG += console
 CONFIG += c++11
+CONFIG += thread
 CONFIG -= app_bundle
 CONFIG -= qt
 
@@ -47,27 +47,10 @@ size_t connected_components
 	comps = vector<size_t>(N, N);
 	// the label of each connected component
 	size_t label = 0;
-	// how many vertices have label 'label'
-	size_t count = 0;
-
-	bfs_terminate term = [](const uxgraph *, node, const vector<bool>&) -> bool {
-		// the BFS algorithm will terminate by its own accord
-		// when it can't find more neighbours to expand the
-		// search to.
-		return false;
-	};
-	bfs_process_current proc_cur =
-	[&](const uxgraph *, node u, const vector<bool>&) -> void
-	{
-		// assign to vertex u the current label
-		comps[u] = label;
-		// increment the number of vertices in this component
-		++count;
-	};
-	bfs_process_neighbour proc_neigh =
-	[](const uxgraph *, node, node, const vector<bool>&) -> void {
-		// no need to do anything
-	};
+
+	// memory shared by all traversals: each one only
+	// resets the nodes visited by the previous one
+	traversal::workspace<> ws;
 
 	for (node u = 0; u < g.n_nodes(); ++u) {
 		// if a node has already been processed, skip
@@ -75,17 +58,24 @@ size_t connected_components
 			continue;
 		}
 
-		// launch the BSF traversal starting at node u.
-		BFS(&g, u, term, proc_cur, proc_neigh);
-
-		// the traversal has found a whole new component
-		// -> increment label
-		++label;
-		// append information to bins, reset count
+		// launch the BSF traversal starting at node u. The algorithm
+		// will terminate by its own accord when it can't find more
+		// neighbours to expand the search to. The graph is undirected:
+		// the in-neighbours needed by the bottom-up steps of the
+		// traversal are the neighbours.
+		direction_optimizing_BFS(&g, &g, u, ws);
+
+		// the traversal has found a whole new component:
+		// assign to its vertices the current label
+		for (node v : ws.visited_nodes()) {
+			comps[v] = label;
+		}
+		// append information to bins
 		if (bins != nullptr) {
-			bins->push_back(count);
+			bins->push_back(ws.visited_nodes().size());
 		}
-		count = 0;
+		// -> increment label
+		++label;
 	}
 
 	return label;
@@ -84,11 +84,8 @@ void boolean_path<T>::set_length(const T& l) {
 template<class T>
 void boolean_path<T>::concatenate(const boolean_path<T>& bp) {
 	if (bp.size() > 0) {
-		for (size_t i = 0; i < bp.potential_length(); ++i) {
-			if (bp.nodes_in_path[i]) {
-				add_node(i);
-			}
-		}
+		nodes_in_path |= bp.nodes_in_path;
+		n_nodes = nodes_in_path.count();
 		add_length(bp.path_length);
 	}
 }
@@ -125,6 +122,16 @@ size_t boolean_path<T>::potential_length() const {
 	return nodes_in_path.size();
 }
 
+template<class T>
+void boolean_path<T>::get_nodes(std::vector<node>& w) const {
+	w.clear();
+	w.reserve(n_nodes);
+	const size_t n = nodes_in_path.size();
+	for (size_t u = nodes_in_path.find_first(); u < n; u = nodes_in_path.find_next(u)) {
+		w.push_back(u);
+	}
+}
+
 template<class T>
 bool boolean_path<T>::closest_next(const xxgraph *G, node prev, node curr, node& next) const {
 	assert(G != nullptr);
@@ -177,6 +177,12 @@ class boolean_path {
 		 */
 		size_t potential_length() const;
 
+		/**
+		 * @brief Returns the nodes in this path.
+		 * @param[out] w The nodes in this path, sorted increasingly.
+		 */
+		void get_nodes(std::vector<node>& w) const;
+
 		/**
 		 * @brief Looks for the next node in this path taking as a reference the
 		 * @e previous and @e current nodes.
@@ -0,0 +1,166 @@
+/*********************************************************************
+ * lgraph
+ * Copyright (C) 2018-2019 Lluís Alemany Puig
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ * 
+ * Contact: Lluís Alemany Puig (lluis.alemany.puig@gmail.com)
+ * 
+ ********************************************************************/
+
+
+
+#include <lgraph/data_structures/contraction_hierarchy.hpp>
+
+// C includes
+#include <assert.h>
+
+// C++ includes
+#include <utility>
+
+namespace lgraph {
+
+// PRIVATE
+
+template<class T>
+const typename contraction_hierarchy<T>::edge *
+contraction_hierarchy<T>::find_edge(node u, node v) const {
+	// an edge from a node to one of higher rank is upward at the
+	// source, and an edge to one of lower rank is downward at the target
+	const bool upward = m_rank[u] < m_rank[v];
+	const edge *begin = (upward ? up_begin(u) : down_begin(v));
+	const edge *end = (upward ? up_end(u) : down_end(v));
+	const node w = (upward ? v : u);
+
+	for (const edge *e = begin; e != end; ++e) {
+		if (e->neighbour == w) {
+			return e;
+		}
+	}
+	return nullptr;
+}
+
+// PUBLIC
+
+template<class T>
+contraction_hierarchy<T>::contraction_hierarchy() : m_directed(false) { }
+
+template<class T>
+contraction_hierarchy<T>::~contraction_hierarchy() { }
+
+template<class T>
+void contraction_hierarchy<T>::init(
+	bool directed, std::vector<size_t>&& rank,
+	std::vector<size_t>&& up_offsets, std::vector<edge>&& up,
+	std::vector<size_t>&& down_offsets, std::vector<edge>&& down
+)
+{
+	assert(up_offsets.size() == rank.size() + 1);
+	assert(directed ? down_offsets.size() == up_offsets.size() : down_offsets.empty());
+	assert(directed or down.empty());
+
+	m_directed = directed;
+	m_rank = std::move(rank);
+	m_up_offsets = std::move(up_offsets);
+	m_up = std::move(up);
+	m_down_offsets = std::move(down_offsets);
+	m_down = std::move(down);
+}
+
+template<class T>
+size_t contraction_hierarchy<T>::n_nodes() const {
+	return m_rank.size();
+}
+
+template<class T>
+bool contraction_hierarchy<T>::is_directed() const {
+	return m_directed;
+}
+
+template<class T>
+size_t contraction_hierarchy<T>::rank(node u) const {
+	assert(u < n_nodes());
+	return m_rank[u];
+}
+
+template<class T>
+size_t contraction_hierarchy<T>::n_edges() const {
+	return m_up.size() + m_down.size();
+}
+
+template<class T>
+size_t contraction_hierarchy<T>::n_shortcuts() const {
+	size_t s = 0;
+	for (const edge& e : m_up) {
+		s += (e.middle != n_nodes());
+	}
+	for (const edge& e : m_down) {
+		s += (e.middle != n_nodes());
+	}
+	return s;
+}
+
+template<class T>
+const typename contraction_hierarchy<T>::edge *
+contraction_hierarchy<T>::up_begin(node u) const {
+	assert(u < n_nodes());
+	return m_up.data() + m_up_offsets[u];
+}
+
+template<class T>
+const typename contraction_hierarchy<T>::edge *
+contraction_hierarchy<T>::up_end(node u) const {
+	assert(u < n_nodes());
+	return m_up.data() + m_up_offsets[u + 1];
+}
+
+template<class T>
+const typename contraction_hierarchy<T>::edge *
+contraction_hierarchy<T>::down_begin(node u) const {
+	assert(u < n_nodes());
+	return (m_directed ? m_down.data() + m_down_offsets[u] : up_begin(u));
+}
+
+template<class T>
+const typename contraction_hierarchy<T>::edge *
+contraction_hierarchy<T>::down_end(node u) const {
+	assert(u < n_nodes());
+	return (m_directed ? m_down.data() + m_down_offsets[u + 1] : up_end(u));
+}
+
+template<class T>
+void contraction_hierarchy<T>::unpack(node u, node v, node_path<T>& p) const {
+	// edges still to unpack, the next one at the back
+	std::vector<std::pair<node, node> > pending;
+	pending.push_back(std::make_pair(u, v));
+
+	while (not pending.empty()) {
+		const node a = pending.back().first;
+		const node b = pending.back().second;
+		pending.pop_back();
+
+		const edge *e = find_edge(a, b);
+		assert(e != nullptr);
+		if (e->middle == n_nodes()) {
+			p.add_node(b);
+		}
+		else {
+			// the shortcut (a,b) is the edge (a,m) followed by (m,b)
+			pending.push_back(std::make_pair(e->middle, b));
+			pending.push_back(std::make_pair(a, e->middle));
+		}
+	}
+}
+
+} // -- namespace lgraph
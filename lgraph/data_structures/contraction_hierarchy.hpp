@@ -0,0 +1,163 @@
+/*********************************************************************
+ * lgraph
+ * Copyright (C) 2018-2019 Lluís Alemany Puig
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ * 
+ * Contact: Lluís Alemany Puig (lluis.alemany.puig@gmail.com)
+ * 
+ ********************************************************************/
+
+
+
+#pragma once
+
+// C++ includes
+#include <vector>
+
+// lgraph includes
+#include <lgraph/data_structures/node_path.hpp>
+#include <lgraph/utils/definitions.hpp>
+
+namespace lgraph {
+
+/**
+ * @brief Contraction hierarchy of a weighted graph.
+ *
+ * Preprocessed data for exact shortest-path queries in a static graph,
+ * following [1]. The nodes are contracted one at a time: a contracted
+ * node is removed from the graph, and a shortcut (u,x) of weight
+ * w(u,v) + w(v,x) is added for every pair of edges (u,v), (v,x) through
+ * the node contracted @e v whose path is the only shortest one from
+ * @e u to @e x. The position of a node in the order of contraction is
+ * its rank.
+ *
+ * The hierarchy keeps the edges of the graph and the shortcuts split in
+ * two: the upward edges of @e u go from @e u to nodes of higher rank, and
+ * the downward edges of @e u come to @e u from nodes of higher rank.
+ * Every shortest path of the graph has a counterpart of the same length
+ * that first goes up and then down the hierarchy. Thus, the distance
+ * from @e s to @e t is found by a search from @e s on the upward edges
+ * and a search from @e t on the downward edges, which meet at the node of
+ * highest rank of the path, and which reach very few nodes in graphs with
+ * a hierarchical structure, such as road networks. In undirected graphs
+ * the downward edges of a node are its upward edges.
+ *
+ * Every shortcut records the node @e v whose contraction created it, so
+ * that the paths with shortcuts are unpacked into paths of the graph.
+ *
+ * [1] Geisberger, R., Sanders, P., Schultes, D. and Delling, D.,
+ * "Contraction hierarchies: faster and simpler hierarchical routing in
+ * road networks", WEA, 2008.
+ *
+ * @param T The type of the weights of the graph.
+ */
+template<class T>
+class contraction_hierarchy {
+	public:
+		/// An edge of the hierarchy.
+		struct edge {
+			/// The other endpoint of the edge.
+			node neighbour;
+			/// The weight of the edge.
+			T weight;
+			/// The node bypassed by a shortcut. The number of nodes if the edge is in the graph.
+			node middle;
+		};
+
+	public:
+		/// Empty constructor.
+		contraction_hierarchy();
+		/// Destructor.
+		~contraction_hierarchy();
+
+		/**
+		 * @brief Initialises the hierarchy.
+		 *
+		 * The vectors are moved into the hierarchy.
+		 *
+		 * @param directed Is the graph directed?
+		 * @param rank The rank of every node.
+		 * @param up_offsets Position in @e up of the first upward edge of
+		 * every node. It has one more element than @e rank.
+		 * @param up The upward edges of every node, those of node @e u
+		 * being in the positions [@e up_offsets[u], @e up_offsets[u+1]).
+		 * @param down_offsets Same as @e up_offsets for the downward edges.
+		 * Empty if the graph is undirected.
+		 * @param down The downward edges of every node, in the same layout as
+		 * @e up. The neighbour of a downward edge of @e u is its source.
+		 * Empty if the graph is undirected.
+		 */
+		void init(
+			bool directed, std::vector<size_t>&& rank,
+			std::vector<size_t>&& up_offsets, std::vector<edge>&& up,
+			std::vector<size_t>&& down_offsets, std::vector<edge>&& down
+		);
+
+		/// Returns the number of nodes of the graph.
+		size_t n_nodes() const;
+		/// Returns true if the graph is directed.
+		bool is_directed() const;
+		/// Returns the position of @e u in the order of contraction.
+		size_t rank(node u) const;
+		/**
+		 * @brief Returns the number of edges of the hierarchy.
+		 *
+		 * In undirected graphs every edge is both an upward and a
+		 * downward edge, and is counted once.
+		 */
+		size_t n_edges() const;
+		/// Returns the number of edges that are shortcuts.
+		size_t n_shortcuts() const;
+
+		/// Returns a pointer to the first upward edge of @e u.
+		const edge *up_begin(node u) const;
+		/// Returns a pointer past the last upward edge of @e u.
+		const edge *up_end(node u) const;
+		/// Returns a pointer to the first downward edge of @e u.
+		const edge *down_begin(node u) const;
+		/// Returns a pointer past the last downward edge of @e u.
+		const edge *down_end(node u) const;
+
+		/**
+		 * @brief Unpacks an edge of the hierarchy.
+		 *
+		 * Adds to @e p the nodes of the path of the graph that the edge
+		 * from @e u to @e v stands for, except @e u.
+		 * @pre There is an edge from @e u to @e v in the hierarchy.
+		 */
+		void unpack(node u, node v, node_path<T>& p) const;
+
+	private:
+		/// The edge of the hierarchy from @e u to @e v, if any.
+		const edge *find_edge(node u, node v) const;
+
+	private:
+		/// Is the graph directed?
+		bool m_directed;
+		/// Rank of every node.
+		std::vector<size_t> m_rank;
+		/// Position of the first upward edge of every node in @ref m_up.
+		std::vector<size_t> m_up_offsets;
+		/// Upward edges of all nodes.
+		std::vector<edge> m_up;
+		/// Position of the first downward edge of every node in @ref m_down.
+		std::vector<size_t> m_down_offsets;
+		/// Downward edges of all nodes (directed graphs).
+		std::vector<edge> m_down;
+};
+
+} // -- namespace lgraph
+
+#include <lgraph/data_structures/contraction_hierarchy.cpp>
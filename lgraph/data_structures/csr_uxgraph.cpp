@@ -0,0 +1,120 @@
+/*********************************************************************
+ * lgraph
+ * Copyright (C) 2018-2019 Lluís Alemany Puig
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ * 
+ * Contact: Lluís Alemany Puig (lluis.alemany.puig@gmail.com)
+ * 
+ ********************************************************************/
+
+
+#include <lgraph/data_structures/csr_uxgraph.hpp>
+
+// C++ includes
+#include <vector>
+
+// Counting sort of the edges of G by their head: 'offsets' and 'neighbours'
+// become the CSR arrays of the reverse of G. Since the tails are scanned
+// in increasing order, the neighbourhoods of the reverse are sorted.
+template<class G_t>
+inline void reverse_adjacency
+(
+	const G_t *G,
+	std::vector<size_t>& offsets, std::vector<lgraph::node>& neighbours
+)
+{
+	const size_t N = G->n_nodes();
+
+	// first pass: in-degree of every node
+	offsets.assign(N + 1, 0);
+	for (lgraph::node u = 0; u < N; ++u) {
+		for (lgraph::node v : G->get_neighbours(u)) {
+			++offsets[v + 1];
+		}
+	}
+	for (lgraph::node u = 0; u < N; ++u) {
+		offsets[u + 1] += offsets[u];
+	}
+
+	// second pass: place every tail in its head's neighbourhood
+	neighbours.resize(offsets[N]);
+	std::vector<size_t> next(offsets.begin(), offsets.end() - 1);
+	for (lgraph::node u = 0; u < N; ++u) {
+		for (lgraph::node v : G->get_neighbours(u)) {
+			neighbours[next[v]++] = u;
+		}
+	}
+}
+
+namespace lgraph {
+
+// PUBLIC
+
+csr_uxgraph::csr_uxgraph() : csr_xxgraph() { }
+
+csr_uxgraph::csr_uxgraph(const uxgraph *G) : csr_xxgraph() {
+	init(G);
+}
+
+csr_uxgraph::~csr_uxgraph() { }
+
+void csr_uxgraph::init(const uxgraph *G) {
+	clear();
+	initialise_parent_graph(G);
+}
+
+void csr_uxgraph::init
+(
+	size_t n_nodes, const size_t *offsets, const node *neighbours,
+	size_t n_edges, bool directed, bool sorted,
+	const std::shared_ptr<const void>& storage
+)
+{
+	clear();
+	initialise_parent_view
+	(n_nodes, offsets, neighbours, n_edges, directed, sorted, storage);
+}
+
+void csr_uxgraph::init_reverse(const uxgraph *G) {
+	clear();
+	reverse_adjacency(G, m_offsets, m_neighbours);
+
+	m_offsets_data = m_offsets.data();
+	m_neighbours_data = m_neighbours.data();
+	m_n_nodes = G->n_nodes();
+	m_n_edges = G->n_edges();
+	m_directed = G->is_directed();
+	m_sorted_adjacency = true;
+}
+
+void csr_uxgraph::init_reverse(const csr_uxgraph *G) {
+	clear();
+	reverse_adjacency(G, m_offsets, m_neighbours);
+
+	m_offsets_data = m_offsets.data();
+	m_neighbours_data = m_neighbours.data();
+	m_n_nodes = G->n_nodes();
+	m_n_edges = G->n_edges();
+	m_directed = G->is_directed();
+	m_sorted_adjacency = true;
+}
+
+// GETTERS
+
+bool csr_uxgraph::is_weighted() const {
+	return false;
+}
+
+} // -- namespace lgraph
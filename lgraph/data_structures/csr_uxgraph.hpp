@@ -0,0 +1,115 @@
+/*********************************************************************
+ * lgraph
+ * Copyright (C) 2018-2019 Lluís Alemany Puig
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ * 
+ * Contact: Lluís Alemany Puig (lluis.alemany.puig@gmail.com)
+ * 
+ ********************************************************************/
+
+
+#pragma once
+
+// lgraph includes
+#include <lgraph/data_structures/csr_xxgraph.hpp>
+#include <lgraph/data_structures/uxgraph.hpp>
+
+namespace lgraph {
+
+/**
+ * @brief Compressed (CSR) unweighted graph.
+ *
+ * Read-only compressed version of an unweighted graph, either
+ * directed (@ref udgraph) or undirected (@ref uugraph). See
+ * @ref csr_xxgraph for details on the representation.
+ */
+class csr_uxgraph : public csr_xxgraph {
+	public:
+		/// Default constructor.
+		csr_uxgraph();
+		/**
+		 * @brief Constructor with graph.
+		 * @param G The graph to be compressed.
+		 */
+		csr_uxgraph(const uxgraph *G);
+		/// Destructor.
+		~csr_uxgraph();
+
+		/**
+		 * @brief Initialises this graph with the contents of @e G.
+		 *
+		 * First, it clears all the memory allocated so far. Then, copies
+		 * the neighbourhood of every node of @e G.
+		 *
+		 * @param G The graph to be compressed.
+		 */
+		void init(const uxgraph *G);
+
+		/**
+		 * @brief Initialises this graph as a view of existing arrays.
+		 *
+		 * First, it clears all the memory allocated so far. Then, the
+		 * graph uses the arrays in the CSR layout described in
+		 * @ref csr_xxgraph. The graph does not copy the arrays: it only
+		 * points to them. They must stay valid while this graph uses
+		 * them, which is guaranteed if they belong to @e storage, since
+		 * the graph keeps a reference to it.
+		 *
+		 * @param n_nodes The number of nodes.
+		 * @param offsets The @e n_nodes + 1 offsets of the neighbourhoods.
+		 * @param neighbours The neighbourhoods of all nodes.
+		 * @param n_edges The number of edges.
+		 * @param directed Is the graph directed?
+		 * @param sorted Are the neighbourhoods sorted?
+		 * @param storage Owner of the memory of the arrays.
+		 */
+		void init
+		(
+			size_t n_nodes, const size_t *offsets, const node *neighbours,
+			size_t n_edges, bool directed, bool sorted,
+			const std::shared_ptr<const void>& storage
+		);
+
+		/**
+		 * @brief Initialises this graph with the reverse of @e G.
+		 *
+		 * First, it clears all the memory allocated so far. Then, for
+		 * every edge (u,v) of @e G adds the edge (v,u), so that the
+		 * neighbours of a node in this graph are its in-neighbours in
+		 * @e G. The neighbourhoods are always sorted. The reverse of an
+		 * undirected graph is the graph itself.
+		 *
+		 * Costs O(n + m) time, where n and m are the number of nodes and
+		 * edges of @e G.
+		 *
+		 * @param G The graph to be reversed.
+		 */
+		void init_reverse(const uxgraph *G);
+		/**
+		 * @brief Initialises this graph with the reverse of @e G.
+		 *
+		 * See @ref init_reverse(const uxgraph*).
+		 *
+		 * @param G The graph to be reversed.
+		 */
+		void init_reverse(const csr_uxgraph *G);
+
+		// GETTERS
+
+		/// Returns whether this graph is weighted or not (returns false).
+		bool is_weighted() const;
+};
+
+} // -- namespace lgraph
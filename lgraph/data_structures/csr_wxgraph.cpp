@@ -0,0 +1,183 @@
+/*********************************************************************
+ * lgraph
+ * Copyright (C) 2018-2019 Lluís Alemany Puig
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ * 
+ * Contact: Lluís Alemany Puig (lluis.alemany.puig@gmail.com)
+ * 
+ ********************************************************************/
+
+
+#include <lgraph/data_structures/csr_wxgraph.hpp>
+
+// C includes
+#include <assert.h>
+
+// C++ includes
+#include <algorithm>
+#include <vector>
+
+namespace lgraph {
+
+// PROTECTED
+
+template<class T>
+template<class G_t>
+void csr_wxgraph<T>::initialise_reverse(const G_t *G) {
+	const size_t N = G->n_nodes();
+
+	// counting sort of the edges by their head: since the tails are
+	// scanned in increasing order, the neighbourhoods are sorted
+
+	// first pass: in-degree of every node
+	m_offsets.assign(N + 1, 0);
+	for (node u = 0; u < N; ++u) {
+		for (node v : G->get_neighbours(u)) {
+			++m_offsets[v + 1];
+		}
+	}
+	for (node u = 0; u < N; ++u) {
+		m_offsets[u + 1] += m_offsets[u];
+	}
+
+	// second pass: place every tail, and the weight of
+	// its edge, in its head's neighbourhood
+	m_neighbours.resize(m_offsets[N]);
+	m_weights.resize(m_offsets[N]);
+	std::vector<size_t> next(m_offsets.begin(), m_offsets.end() - 1);
+	for (node u = 0; u < N; ++u) {
+		const auto& Nu = G->get_neighbours(u);
+		const auto& wu = G->get_weights(u);
+		for (size_t i = 0; i < Nu.size(); ++i) {
+			const size_t p = next[Nu[i]]++;
+			m_neighbours[p] = u;
+			m_weights[p] = wu[i];
+		}
+	}
+
+	m_offsets_data = m_offsets.data();
+	m_neighbours_data = m_neighbours.data();
+	m_weights_data = m_weights.data();
+	m_n_nodes = N;
+	m_n_edges = G->n_edges();
+	m_directed = G->is_directed();
+	m_sorted_adjacency = true;
+}
+
+// PUBLIC
+
+template<class T>
+csr_wxgraph<T>::csr_wxgraph() : csr_xxgraph(), m_weights_data(nullptr) { }
+
+template<class T>
+csr_wxgraph<T>::csr_wxgraph(const wxgraph<T> *G) : csr_xxgraph(), m_weights_data(nullptr) {
+	init(G);
+}
+
+template<class T>
+csr_wxgraph<T>::csr_wxgraph(const csr_wxgraph<T>& G) : csr_xxgraph() {
+	*this = G;
+}
+
+template<class T>
+csr_wxgraph<T>::~csr_wxgraph() { }
+
+template<class T>
+csr_wxgraph<T>& csr_wxgraph<T>::operator= (const csr_wxgraph<T>& G) {
+	csr_xxgraph::operator= (G);
+	m_weights = G.m_weights;
+	m_weights_data = (m_storage != nullptr ? G.m_weights_data : m_weights.data());
+	return *this;
+}
+
+template<class T>
+void csr_wxgraph<T>::init(const wxgraph<T> *G) {
+	clear();
+	initialise_parent_graph(G);
+
+	m_weights.resize(m_neighbours.size());
+	for (node u = 0; u < n_nodes(); ++u) {
+		const weight_list<T>& wu = G->get_weights(u);
+		std::copy(wu.begin(), wu.end(), m_weights.begin() + m_offsets[u]);
+	}
+	m_weights_data = m_weights.data();
+}
+
+template<class T>
+void csr_wxgraph<T>::init
+(
+	size_t n_nodes, const size_t *offsets, const node *neighbours,
+	const T *weights, size_t n_edges, bool directed, bool sorted,
+	const std::shared_ptr<const void>& storage
+)
+{
+	clear();
+	initialise_parent_view
+	(n_nodes, offsets, neighbours, n_edges, directed, sorted, storage);
+	m_weights_data = weights;
+}
+
+template<class T>
+void csr_wxgraph<T>::init_reverse(const wxgraph<T> *G) {
+	clear();
+	initialise_reverse(G);
+}
+
+template<class T>
+void csr_wxgraph<T>::init_reverse(const csr_wxgraph<T> *G) {
+	clear();
+	initialise_reverse(G);
+}
+
+template<class T>
+void csr_wxgraph<T>::clear() {
+	csr_xxgraph::clear();
+	m_weights.clear();
+	m_weights_data = nullptr;
+}
+
+// GETTERS
+
+template<class T>
+bool csr_wxgraph<T>::is_weighted() const {
+	return true;
+}
+
+template<class T>
+csr_range<T> csr_wxgraph<T>::get_weights(node u) const {
+	assert(has_node(u));
+
+	const T *base = m_weights_data;
+	return csr_range<T>(base + m_offsets_data[u], base + m_offsets_data[u + 1]);
+}
+
+template<class T>
+T csr_wxgraph<T>::edge_weight(node u, node v) const {
+	assert(has_edge(u, v));
+
+	const csr_range<node> Nu = get_neighbours(u);
+	size_t i = (m_sorted_adjacency ?
+		std::lower_bound(Nu.begin(), Nu.end(), v) - Nu.begin() :
+		std::find(Nu.begin(), Nu.end(), v) - Nu.begin()
+	);
+	return m_weights_data[m_offsets_data[u] + i];
+}
+
+template<class T>
+const T *csr_wxgraph<T>::weights() const {
+	return m_weights_data;
+}
+
+} // -- namespace lgraph
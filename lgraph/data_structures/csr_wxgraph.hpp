@@ -0,0 +1,169 @@
+/*********************************************************************
+ * lgraph
+ * Copyright (C) 2018-2019 Lluís Alemany Puig
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ * 
+ * Contact: Lluís Alemany Puig (lluis.alemany.puig@gmail.com)
+ * 
+ ********************************************************************/
+
+
+#pragma once
+
+// C++ includes
+#include <vector>
+
+// lgraph includes
+#include <lgraph/data_structures/csr_xxgraph.hpp>
+#include <lgraph/data_structures/wxgraph.hpp>
+
+namespace lgraph {
+
+/**
+ * @brief Compressed (CSR) weighted graph.
+ *
+ * Read-only compressed version of a weighted graph, either
+ * directed (@ref wdgraph) or undirected (@ref wugraph). See
+ * @ref csr_xxgraph for details on the representation. The weights
+ * are stored in a single contiguous array parallel to the array
+ * of neighbours.
+ *
+ * @param T Parameter that indicates the type of the edge weights
+ */
+template<class T>
+class csr_wxgraph : public csr_xxgraph {
+	public:
+		/// Default constructor.
+		csr_wxgraph();
+		/**
+		 * @brief Constructor with graph.
+		 * @param G The graph to be compressed.
+		 */
+		csr_wxgraph(const wxgraph<T> *G);
+		/// Copy constructor.
+		csr_wxgraph(const csr_wxgraph<T>& G);
+		/// Destructor.
+		~csr_wxgraph();
+
+		/// Copy assignment operator.
+		csr_wxgraph<T>& operator= (const csr_wxgraph<T>& G);
+
+		/**
+		 * @brief Initialises this graph with the contents of @e G.
+		 *
+		 * First, it clears all the memory allocated so far. Then, copies
+		 * the neighbourhood of every node of @e G and the weights of
+		 * its edges.
+		 *
+		 * @param G The graph to be compressed.
+		 */
+		void init(const wxgraph<T> *G);
+
+		/**
+		 * @brief Initialises this graph as a view of existing arrays.
+		 *
+		 * Same as @ref csr_uxgraph::init(size_t, const size_t*, const node*, size_t, bool, bool, const std::shared_ptr<const void>&)
+		 * with the weights of the edges, parallel to the neighbours.
+		 *
+		 * @param n_nodes The number of nodes.
+		 * @param offsets The @e n_nodes + 1 offsets of the neighbourhoods.
+		 * @param neighbours The neighbourhoods of all nodes.
+		 * @param weights The weights of the edges.
+		 * @param n_edges The number of edges.
+		 * @param directed Is the graph directed?
+		 * @param sorted Are the neighbourhoods sorted?
+		 * @param storage Owner of the memory of the arrays.
+		 */
+		void init
+		(
+			size_t n_nodes, const size_t *offsets, const node *neighbours,
+			const T *weights, size_t n_edges, bool directed, bool sorted,
+			const std::shared_ptr<const void>& storage
+		);
+
+		/**
+		 * @brief Initialises this graph with the reverse of @e G.
+		 *
+		 * Same as @ref csr_uxgraph::init_reverse(const uxgraph*): the
+		 * edge (v,u) added for every edge (u,v) of @e G has the same
+		 * weight.
+		 *
+		 * @param G The graph to be reversed.
+		 */
+		void init_reverse(const wxgraph<T> *G);
+		/**
+		 * @brief Initialises this graph with the reverse of @e G.
+		 *
+		 * See @ref init_reverse(const wxgraph<T>*).
+		 *
+		 * @param G The graph to be reversed.
+		 */
+		void init_reverse(const csr_wxgraph<T> *G);
+
+		/**
+		 * @brief Deletes all memory used by the graph.
+		 *
+		 * The graph is left with no nodes and no edges.
+		 */
+		void clear();
+
+		// GETTERS
+
+		/// Returns whether this graph is weighted or not (returns true).
+		bool is_weighted() const;
+
+		/**
+		 * @brief Returns the weights of the edges incident to @e u.
+		 *
+		 * The @e i-th weight is the weight of the edge between @e u
+		 * and the @e i-th node of @ref get_neighbours(@e u).
+		 *
+		 * @param u The node whose weights we want.
+		 * @pre @e u must be a node from the graph.
+		 */
+		csr_range<T> get_weights(node u) const;
+
+		/**
+		 * @brief Returns the weight of an edge.
+		 * @param u The fist node of the edge.
+		 * @param v The second node of the edge.
+		 * @pre The edge (@e u, @e v) must be in the graph.
+		 */
+		T edge_weight(node u, node v) const;
+
+		/// The weights of all edges, parallel to @ref neighbours().
+		const T *weights() const;
+
+	protected:
+		/**
+		 * @brief Builds the reverse of @e G.
+		 *
+		 * See @ref init_reverse(const wxgraph<T>*).
+		 *
+		 * @param G The graph to be reversed.
+		 */
+		template<class G_t>
+		void initialise_reverse(const G_t *G);
+
+	protected:
+		/// Storage of the weights when they are owned by this graph.
+		std::vector<T> m_weights;
+		/// The weights: either @ref m_weights or external memory.
+		const T *m_weights_data;
+};
+
+} // -- namespace lgraph
+
+#include <lgraph/data_structures/csr_wxgraph.cpp>
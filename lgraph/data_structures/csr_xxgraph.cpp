@@ -0,0 +1,177 @@
+/*********************************************************************
+ * lgraph
+ * Copyright (C) 2018-2019 Lluís Alemany Puig
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ * 
+ * Contact: Lluís Alemany Puig (lluis.alemany.puig@gmail.com)
+ * 
+ ********************************************************************/
+
+
+#include <lgraph/data_structures/csr_xxgraph.hpp>
+
+// C includes
+#include <assert.h>
+
+// C++ includes
+#include <algorithm>
+
+namespace lgraph {
+
+// PUBLIC
+
+csr_xxgraph::csr_xxgraph()
+	: m_offsets_data(nullptr), m_neighbours_data(nullptr), m_n_nodes(0),
+	  m_n_edges(0), m_directed(false), m_sorted_adjacency(false)
+{ }
+
+csr_xxgraph::csr_xxgraph(const csr_xxgraph& G) {
+	*this = G;
+}
+
+csr_xxgraph::~csr_xxgraph() { }
+
+csr_xxgraph& csr_xxgraph::operator= (const csr_xxgraph& G) {
+	m_offsets = G.m_offsets;
+	m_neighbours = G.m_neighbours;
+	m_storage = G.m_storage;
+
+	// views of external memory can be shared,
+	// but owned arrays must point to our copy
+	if (m_storage != nullptr) {
+		m_offsets_data = G.m_offsets_data;
+		m_neighbours_data = G.m_neighbours_data;
+	}
+	else {
+		m_offsets_data = m_offsets.data();
+		m_neighbours_data = m_neighbours.data();
+	}
+
+	m_n_nodes = G.m_n_nodes;
+	m_n_edges = G.m_n_edges;
+	m_directed = G.m_directed;
+	m_sorted_adjacency = G.m_sorted_adjacency;
+	return *this;
+}
+
+void csr_xxgraph::clear() {
+	m_offsets.clear();
+	m_neighbours.clear();
+	m_storage.reset();
+	m_offsets_data = nullptr;
+	m_neighbours_data = nullptr;
+	m_n_nodes = 0;
+	m_n_edges = 0;
+	m_directed = false;
+	m_sorted_adjacency = false;
+}
+
+// GETTERS
+
+bool csr_xxgraph::has_node(node u) const {
+	return u < n_nodes();
+}
+
+bool csr_xxgraph::has_edge(node u, node v) const {
+	assert(has_node(u));
+	assert(has_node(v));
+
+	const csr_range<node> Nu = get_neighbours(u);
+	if (m_sorted_adjacency) {
+		return std::binary_search(Nu.begin(), Nu.end(), v);
+	}
+	return std::find(Nu.begin(), Nu.end(), v) != Nu.end();
+}
+
+size_t csr_xxgraph::n_nodes() const {
+	return m_n_nodes;
+}
+
+size_t csr_xxgraph::n_edges() const {
+	return m_n_edges;
+}
+
+csr_range<node> csr_xxgraph::get_neighbours(node u) const {
+	assert(has_node(u));
+
+	const node *base = m_neighbours_data;
+	return csr_range<node>(base + m_offsets_data[u], base + m_offsets_data[u + 1]);
+}
+
+size_t csr_xxgraph::degree(node u) const {
+	assert(has_node(u));
+	return m_offsets_data[u + 1] - m_offsets_data[u];
+}
+
+bool csr_xxgraph::is_directed() const {
+	return m_directed;
+}
+
+bool csr_xxgraph::is_adjacency_sorted() const {
+	return m_sorted_adjacency;
+}
+
+const size_t *csr_xxgraph::offsets() const {
+	return m_offsets_data;
+}
+
+const node *csr_xxgraph::neighbours() const {
+	return m_neighbours_data;
+}
+
+// PROTECTED
+
+void csr_xxgraph::initialise_parent_graph(const xxgraph *G) {
+	const size_t N = G->n_nodes();
+
+	// first pass: compute the offsets from the degrees
+	m_offsets.resize(N + 1);
+	m_offsets[0] = 0;
+	for (node u = 0; u < N; ++u) {
+		m_offsets[u + 1] = m_offsets[u] + G->degree(u);
+	}
+
+	// second pass: copy the neighbourhoods
+	m_neighbours.resize(m_offsets[N]);
+	for (node u = 0; u < N; ++u) {
+		const neighbourhood& Nu = G->get_neighbours(u);
+		std::copy(Nu.begin(), Nu.end(), m_neighbours.begin() + m_offsets[u]);
+	}
+
+	m_offsets_data = m_offsets.data();
+	m_neighbours_data = m_neighbours.data();
+	m_n_nodes = N;
+	m_n_edges = G->n_edges();
+	m_directed = G->is_directed();
+	m_sorted_adjacency = G->is_adjacency_sorted();
+}
+
+void csr_xxgraph::initialise_parent_view
+(
+	size_t n_nodes, const size_t *offsets, const node *neighbours,
+	size_t n_edges, bool directed, bool sorted,
+	const std::shared_ptr<const void>& storage
+)
+{
+	m_storage = storage;
+	m_offsets_data = offsets;
+	m_neighbours_data = neighbours;
+	m_n_nodes = n_nodes;
+	m_n_edges = n_edges;
+	m_directed = directed;
+	m_sorted_adjacency = sorted;
+}
+
+} // -- namespace lgraph
@@ -0,0 +1,224 @@
+/*********************************************************************
+ * lgraph
+ * Copyright (C) 2018-2019 Lluís Alemany Puig
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ * 
+ * Contact: Lluís Alemany Puig (lluis.alemany.puig@gmail.com)
+ * 
+ ********************************************************************/
+
+
+#pragma once
+
+// C++ includes
+#include <memory>
+#include <vector>
+
+// lgraph includes
+#include <lgraph/data_structures/xxgraph.hpp>
+#include <lgraph/utils/definitions.hpp>
+
+namespace lgraph {
+
+/**
+ * @brief Read-only view of a contiguous sequence of elements.
+ *
+ * Used to expose the neighbourhood (and the weights) of a node in a
+ * compressed graph (see @ref csr_xxgraph) without copying. It behaves
+ * like a constant @ref neighbourhood: it can be iterated with a
+ * range-based for loop, indexed and queried for its size.
+ *
+ * @param T Type of the elements.
+ */
+template<class T>
+class csr_range {
+	public:
+		/// Constant iterator type.
+		typedef const T *const_iterator;
+
+		/// Constructor with the interval [@e b, @e e).
+		csr_range(const T *b, const T *e) : m_begin(b), m_end(e) { }
+
+		/// Returns a pointer to the first element.
+		inline const T *begin() const { return m_begin; }
+		/// Returns a pointer past the last element.
+		inline const T *end() const { return m_end; }
+		/// Returns the number of elements.
+		inline size_t size() const { return static_cast<size_t>(m_end - m_begin); }
+		/// Returns true if there are no elements.
+		inline bool empty() const { return m_begin == m_end; }
+		/// Returns the @e i-th element.
+		inline const T& operator[] (size_t i) const { return m_begin[i]; }
+
+	private:
+		/// Pointer to the first element.
+		const T *m_begin;
+		/// Pointer past the last element.
+		const T *m_end;
+};
+
+/**
+ * @brief Abstract class for compressed (CSR) graphs.
+ *
+ * A compressed sparse row graph stores the neighbourhoods of all its
+ * nodes in a single contiguous array @ref m_neighbours_data. The
+ * neighbours of node @e u are found in the interval
+ * [@ref m_offsets_data[@e u], @ref m_offsets_data[@e u + 1]) of that array.
+ *
+ * The arrays are either owned by the graph (when it is built from another
+ * graph) or are a view of memory owned by someone else, e.g., a binary
+ * snapshot mapped into memory (see @ref io::snapshot::map). In the latter
+ * case the graph keeps that memory alive in @ref m_storage.
+ *
+ * This representation is read-only: once built from a graph
+ * (see @ref csr_uxgraph and @ref csr_wxgraph) no node nor edge can be
+ * added or removed. In exchange, it uses far less memory per edge than
+ * the adjacency list of @ref xxgraph and makes traversals friendlier to
+ * the cache. The order of the neighbours of each node is the same as in
+ * the graph it was built from, so the traversal algorithms visit the
+ * nodes in the same order in both representations.
+ */
+class csr_xxgraph {
+	public:
+		/// Constructor.
+		csr_xxgraph();
+		/// Copy constructor.
+		csr_xxgraph(const csr_xxgraph& G);
+		/// Destructor.
+		virtual ~csr_xxgraph();
+
+		/// Copy assignment operator.
+		csr_xxgraph& operator= (const csr_xxgraph& G);
+
+		/**
+		 * @brief Deletes all memory used by the graph.
+		 *
+		 * The graph is left with no nodes and no edges.
+		 */
+		void clear();
+
+		// GETTERS
+
+		/// Returns true if node @e u is in this graph.
+		bool has_node(node u) const;
+
+		/**
+		 * @brief Returns true if there is an edge between nodes @e u and @e v
+		 *
+		 * Performs a binary search if the neighbourhoods are sorted (see
+		 * @ref is_adjacency_sorted), and a linear search otherwise.
+		 * @pre @e u and @e v must be in the graph.
+		 */
+		bool has_edge(node u, node v) const;
+
+		/// Returns the number of nodes.
+		size_t n_nodes() const;
+
+		/// Returns the number of edges.
+		size_t n_edges() const;
+
+		/**
+		 * @brief Returns the neighbourhood of node u.
+		 * @param u The node whose neighbourhood we want.
+		 * @pre @e u must be a node from the graph.
+		 */
+		csr_range<node> get_neighbours(node u) const;
+
+		/**
+		 * @brief Returns the number of neighbours of u.
+		 * @param u The node whose neighbourhood size we want
+		 * @pre @e u must be a node from the graph.
+		 */
+		size_t degree(node u) const;
+
+		/**
+		 * @brief Returns whether the graph is weighted or unweighted.
+		 * @return Returns true if the graph is weighted. Returns false if otherwise.
+		 */
+		virtual bool is_weighted() const = 0;
+
+		/**
+		 * @brief Returns whether the graph is directed or undirected.
+		 * @return Returns true if the graph is directed. Returns false if otherwise.
+		 */
+		bool is_directed() const;
+
+		/**
+		 * @brief Returns whether the neighbourhoods are sorted.
+		 *
+		 * A compressed graph keeps the order of the neighbours of the
+		 * graph it was built from. Therefore, its neighbourhoods are
+		 * sorted if that graph was in sorted adjacency mode (see
+		 * @ref xxgraph::sort_adjacency_list).
+		 */
+		bool is_adjacency_sorted() const;
+
+		/**
+		 * @brief Start of each node's neighbourhood.
+		 *
+		 * Has @e n + 1 elements, where @e n is the number of nodes. The last
+		 * element is the total amount of neighbours.
+		 */
+		const size_t *offsets() const;
+
+		/// The neighbourhoods of all nodes, one after the other.
+		const node *neighbours() const;
+
+	protected:
+		/// Storage of the offsets when they are owned by this graph.
+		std::vector<size_t> m_offsets;
+		/// Storage of the neighbourhoods when they are owned by this graph.
+		std::vector<node> m_neighbours;
+		/// Memory pointed by the arrays when they are not owned by this graph.
+		std::shared_ptr<const void> m_storage;
+
+		/// The offsets: either @ref m_offsets or external memory.
+		const size_t *m_offsets_data;
+		/// The neighbourhoods: either @ref m_neighbours or external memory.
+		const node *m_neighbours_data;
+		/// The number of nodes.
+		size_t m_n_nodes;
+		/// The amount of edges in this graph.
+		size_t m_n_edges;
+		/// Is this graph directed?
+		bool m_directed;
+		/// Are the neighbourhoods sorted?
+		bool m_sorted_adjacency;
+
+		/**
+		 * @brief Copies the adjacency list of @e G.
+		 *
+		 * Fills @ref m_offsets and @ref m_neighbours with the neighbourhoods
+		 * of all nodes of @e G, and copies its number of edges, whether
+		 * it is directed or not and whether its neighbourhoods are sorted.
+		 *
+		 * @param G The graph to be compressed.
+		 */
+		void initialise_parent_graph(const xxgraph *G);
+
+		/**
+		 * @brief Makes this graph a view of external arrays.
+		 *
+		 * See @ref csr_uxgraph::init(size_t, const size_t*, const node*, size_t, bool, bool, const std::shared_ptr<const void>&).
+		 */
+		void initialise_parent_view
+		(
+			size_t n_nodes, const size_t *offsets, const node *neighbours,
+			size_t n_edges, bool directed, bool sorted,
+			const std::shared_ptr<const void>& storage
+		);
+};
+
+} // -- namespace lgraph
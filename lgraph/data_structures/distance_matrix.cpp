@@ -0,0 +1,253 @@
+/*********************************************************************
+ * lgraph
+ * Copyright (C) 2018-2019 Lluís Alemany Puig
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ * 
+ * Contact: Lluís Alemany Puig (lluis.alemany.puig@gmail.com)
+ * 
+ ********************************************************************/
+
+
+#include <lgraph/data_structures/distance_matrix.hpp>
+
+// C includes
+#include <assert.h>
+#include <string.h>
+
+// C++ includes
+#include <algorithm>
+using namespace std;
+
+namespace lgraph {
+
+// The distances are read and written with memcpy: the block of memory is
+// an array of bytes, and memcpy of a constant size compiles to a single
+// load or store of the narrow type.
+
+template<typename U>
+inline _new_ load_distance(const uint8_t *data, size_t i) {
+	U x;
+	memcpy(&x, data + i*sizeof(U), sizeof(U));
+	return (x == inf_t<U>() ? inf_t<_new_>() : static_cast<_new_>(x));
+}
+
+template<typename U>
+inline void store_distance(uint8_t *data, size_t i, _new_ d) {
+	const U x = (d == inf_t<_new_>() ? inf_t<U>() : static_cast<U>(d));
+	memcpy(data + i*sizeof(U), &x, sizeof(U));
+}
+
+template<typename U>
+inline void generic_row_sums
+(size_t n, bool symmetric, const uint8_t *data, vector<double>& sums)
+{
+	sums.assign(n, 0.0);
+
+	size_t i = 0;
+	for (node u = 0; u < n; ++u) {
+		for (node v = (symmetric ? u + 1 : 0); v < n; ++v, ++i) {
+			U x;
+			memcpy(&x, data + i*sizeof(U), sizeof(U));
+			if (x != inf_t<U>()) {
+				sums[u] += x;
+				if (symmetric) {
+					sums[v] += x;
+				}
+			}
+		}
+	}
+}
+
+template<typename U>
+inline _new_ generic_max_distance(const uint8_t *data, size_t n_distances) {
+	U M = 0;
+	for (size_t i = 0; i < n_distances; ++i) {
+		U x;
+		memcpy(&x, data + i*sizeof(U), sizeof(U));
+		if (x != inf_t<U>()) {
+			M = std::max(M, x);
+		}
+	}
+	return static_cast<_new_>(M);
+}
+
+template<typename U, typename V>
+inline void re_encode(const uint8_t *from, uint8_t *to, size_t n_distances) {
+	for (size_t i = 0; i < n_distances; ++i) {
+		store_distance<V>(to, i, load_distance<U>(from, i));
+	}
+}
+
+template<typename U>
+inline void re_encode(const uint8_t *from, size_t width, uint8_t *to, size_t n_distances) {
+	switch (width) {
+		case 2: re_encode<U, uint16_t>(from, to, n_distances); break;
+		case 4: re_encode<U, uint32_t>(from, to, n_distances); break;
+		default: re_encode<U, uint64_t>(from, to, n_distances);
+	}
+}
+
+// Number of bytes of the narrowest type that represents 'max_distance',
+// the largest value of every type being reserved for 'no path'.
+inline size_t width_of(_new_ max_distance) {
+	if (max_distance < inf_t<uint8_t>()) {
+		return 1;
+	}
+	if (max_distance < inf_t<uint16_t>()) {
+		return 2;
+	}
+	if (max_distance < inf_t<uint32_t>()) {
+		return 4;
+	}
+	return 8;
+}
+
+/* PRIVATE */
+
+size_t distance_matrix::index(node u, node v) const {
+	assert(u < m_n and v < m_n);
+
+	if (not m_symmetric) {
+		return u*m_n + v;
+	}
+	assert(u != v);
+	if (u > v) {
+		std::swap(u, v);
+	}
+	// the rows of the nodes before 'u' have
+	// (n - 1) + (n - 2) + ... + (n - u) distances
+	return u*(2*m_n - u - 1)/2 + (v - u - 1);
+}
+
+/* PUBLIC */
+
+distance_matrix::distance_matrix() {
+	m_n = 0;
+	m_symmetric = false;
+	m_width = 1;
+}
+
+distance_matrix::~distance_matrix() { }
+
+void distance_matrix::init(size_t n, bool symmetric, _new_ max_distance) {
+	m_n = n;
+	m_symmetric = symmetric;
+
+	m_width = width_of(max_distance);
+
+	const size_t n_distances = (m_symmetric ? n*(n - 1)/2 : n*n);
+	m_data.assign(n_distances*m_width, 0xff);
+
+	if (not m_symmetric) {
+		for (node u = 0; u < n; ++u) {
+			set(u, u, 0);
+		}
+	}
+}
+
+size_t distance_matrix::size() const {
+	return m_n;
+}
+
+bool distance_matrix::is_symmetric() const {
+	return m_symmetric;
+}
+
+size_t distance_matrix::bytes_per_distance() const {
+	return m_width;
+}
+
+size_t distance_matrix::bytes() const {
+	return m_data.size();
+}
+
+_new_ distance_matrix::capacity() const {
+	switch (m_width) {
+		case 1: return inf_t<uint8_t>() - 1;
+		case 2: return inf_t<uint16_t>() - 1;
+		case 4: return inf_t<uint32_t>() - 1;
+		default: return inf_t<uint64_t>() - 1;
+	}
+}
+
+void distance_matrix::widen(_new_ max_distance) {
+	const size_t width = width_of(max_distance);
+	if (width <= m_width) {
+		return;
+	}
+
+	const size_t n_distances = m_data.size()/m_width;
+	std::vector<uint8_t> data(n_distances*width);
+	const uint8_t *from = m_data.data();
+	switch (m_width) {
+		case 1: re_encode<uint8_t>(from, width, data.data(), n_distances); break;
+		case 2: re_encode<uint16_t>(from, width, data.data(), n_distances); break;
+		default: re_encode<uint32_t>(from, width, data.data(), n_distances);
+	}
+	m_data.swap(data);
+	m_width = width;
+}
+
+_new_ distance_matrix::get(node u, node v) const {
+	if (m_symmetric and u == v) {
+		return 0;
+	}
+
+	const size_t i = index(u, v);
+	switch (m_width) {
+		case 1: return load_distance<uint8_t>(&m_data[0], i);
+		case 2: return load_distance<uint16_t>(&m_data[0], i);
+		case 4: return load_distance<uint32_t>(&m_data[0], i);
+		default: return load_distance<uint64_t>(&m_data[0], i);
+	}
+}
+
+void distance_matrix::set(node u, node v, _new_ d) {
+	if (m_symmetric and u == v) {
+		assert(d == 0);
+		return;
+	}
+
+	const size_t i = index(u, v);
+	switch (m_width) {
+		case 1: store_distance<uint8_t>(&m_data[0], i, d); break;
+		case 2: store_distance<uint16_t>(&m_data[0], i, d); break;
+		case 4: store_distance<uint32_t>(&m_data[0], i, d); break;
+		default: store_distance<uint64_t>(&m_data[0], i, d);
+	}
+}
+
+void distance_matrix::row_sums(std::vector<double>& sums) const {
+	const uint8_t *data = m_data.data();
+	switch (m_width) {
+		case 1: generic_row_sums<uint8_t>(m_n, m_symmetric, data, sums); break;
+		case 2: generic_row_sums<uint16_t>(m_n, m_symmetric, data, sums); break;
+		case 4: generic_row_sums<uint32_t>(m_n, m_symmetric, data, sums); break;
+		default: generic_row_sums<uint64_t>(m_n, m_symmetric, data, sums);
+	}
+}
+
+_new_ distance_matrix::max_distance() const {
+	const uint8_t *data = m_data.data();
+	const size_t n_distances = m_data.size()/m_width;
+	switch (m_width) {
+		case 1: return generic_max_distance<uint8_t>(data, n_distances);
+		case 2: return generic_max_distance<uint16_t>(data, n_distances);
+		case 4: return generic_max_distance<uint32_t>(data, n_distances);
+		default: return generic_max_distance<uint64_t>(data, n_distances);
+	}
+}
+
+} // -- namespace lgraph
@@ -0,0 +1,142 @@
+/*********************************************************************
+ * lgraph
+ * Copyright (C) 2018-2019 Lluís Alemany Puig
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ * 
+ * Contact: Lluís Alemany Puig (lluis.alemany.puig@gmail.com)
+ * 
+ ********************************************************************/
+
+
+#pragma once
+
+// C includes
+#include <stddef.h>
+#include <stdint.h>
+
+// C++ includes
+#include <vector>
+
+// lgraph includes
+#include <lgraph/utils/definitions.hpp>
+
+namespace lgraph {
+
+/**
+ * @brief Compact matrix of the distances between all pairs of nodes.
+ *
+ * The distances are stored in a single block of memory, with the
+ * narrowest unsigned integer type (of 1, 2, 4 or 8 bytes) that can
+ * represent the largest distance given at initialisation (see @ref init).
+ * The largest value of that type marks the pairs of nodes not connected
+ * by a path, which are returned as @ref inf_t.
+ *
+ * When the distances are symmetric (in undirected graphs) only the pairs
+ * (@e u,@e v) with @e u < @e v are stored, row after row: the distance
+ * from a node to itself is always 0.
+ *
+ * With small-world graphs, whose diameter is less than 255, a symmetric
+ * matrix takes 1/16 of the memory of a std::vector<std::vector<_new_> >.
+ */
+class distance_matrix {
+	private:
+		/// Number of nodes.
+		size_t m_n;
+		/// Whether only the pairs (u,v) with u < v are stored.
+		bool m_symmetric;
+		/// Number of bytes of every distance.
+		size_t m_width;
+		/// The distances, row after row.
+		std::vector<uint8_t> m_data;
+
+	private:
+		/// Position of the distance between @e u and @e v in @ref m_data.
+		size_t index(node u, node v) const;
+
+	public:
+		/// Empty constructor.
+		distance_matrix();
+		/// Destructor.
+		~distance_matrix();
+
+		/**
+		 * @brief Initialises the matrix.
+		 *
+		 * All pairs of different nodes are initially not connected, and
+		 * the distance from a node to itself is 0.
+		 * @param n Number of nodes.
+		 * @param symmetric Whether the distance from @e u to @e v is
+		 * always equal to the distance from @e v to @e u.
+		 * @param max_distance Largest distance between two nodes connected
+		 * by a path. Determines the number of bytes of every distance.
+		 */
+		void init(size_t n, bool symmetric, _new_ max_distance);
+
+		/// Returns the number of nodes.
+		size_t size() const;
+		/// Returns true if only the pairs (u,v) with u < v are stored.
+		bool is_symmetric() const;
+		/// Returns the number of bytes of every distance stored.
+		size_t bytes_per_distance() const;
+		/// Returns the number of bytes of all the distances stored.
+		size_t bytes() const;
+		/// Returns the largest distance that fits in the bytes of every distance.
+		_new_ capacity() const;
+
+		/**
+		 * @brief Makes room for larger distances.
+		 *
+		 * If @e max_distance does not fit in the current number of bytes
+		 * of every distance (see @ref capacity), the distances stored are
+		 * re-encoded with the narrowest type that fits @e max_distance.
+		 * Otherwise, the matrix is not modified.
+		 * @param max_distance Largest distance between two nodes connected
+		 * by a path.
+		 */
+		void widen(_new_ max_distance);
+
+		/**
+		 * @brief Distance between two nodes.
+		 * @return Returns the distance from @e u to @e v, or @ref inf_t
+		 * if there is no path from @e u to @e v.
+		 */
+		_new_ get(node u, node v) const;
+		/**
+		 * @brief Sets the distance between two nodes.
+		 *
+		 * In symmetric matrices, it also sets the distance from @e v to @e u.
+		 * Different pairs of nodes can be set concurrently.
+		 * @param u The first node.
+		 * @param v The second node.
+		 * @param d The distance from @e u to @e v, or @ref inf_t if there
+		 * is no path.
+		 * @pre @e d is at most the largest distance given to @ref init,
+		 * or @ref inf_t.
+		 */
+		void set(node u, node v, _new_ d);
+
+		/**
+		 * @brief Sum of the distances from every node.
+		 *
+		 * The pairs of nodes not connected are not added.
+		 * @param[out] sums The @e u-th position contains the sum of the
+		 * distances from @e u to the nodes reachable from it.
+		 */
+		void row_sums(std::vector<double>& sums) const;
+		/// Returns the largest distance between two connected nodes.
+		_new_ max_distance() const;
+};
+
+} // -- namespace lgraph
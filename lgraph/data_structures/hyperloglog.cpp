@@ -0,0 +1,162 @@
+/*********************************************************************
+ * lgraph
+ * Copyright (C) 2018-2019 Lluís Alemany Puig
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ * 
+ * Contact: Lluís Alemany Puig (lluis.alemany.puig@gmail.com)
+ * 
+ ********************************************************************/
+
+
+#include <lgraph/data_structures/hyperloglog.hpp>
+
+// C includes
+#include <assert.h>
+#include <string.h>
+#if defined (__SSE2__)
+#include <emmintrin.h>
+#endif
+
+// C++ includes
+#include <cmath>
+
+namespace lgraph {
+
+// Finaliser of the SplitMix64 generator: a bijection
+// of 64-bit words whose bits are well mixed.
+inline uint64_t mix64(uint64_t x) {
+	x ^= x >> 30;
+	x *= 0xbf58476d1ce4e5b9ULL;
+	x ^= x >> 27;
+	x *= 0x94d049bb133111ebULL;
+	x ^= x >> 31;
+	return x;
+}
+
+hyperloglog_counters::hyperloglog_counters() {
+	m_n = 0;
+	m_log2m = 0;
+	m_m = 0;
+	m_salt = 0;
+}
+
+hyperloglog_counters::~hyperloglog_counters() { }
+
+void hyperloglog_counters::init(size_t n, size_t log2m, uint64_t salt) {
+	assert(4 <= log2m and log2m <= 16);
+
+	m_n = n;
+	m_log2m = log2m;
+	m_m = static_cast<size_t>(1) << log2m;
+	m_salt = salt;
+	m_registers.assign(m_n*m_m, 0);
+}
+
+size_t hyperloglog_counters::size() const {
+	return m_n;
+}
+
+size_t hyperloglog_counters::n_registers() const {
+	return m_m;
+}
+
+uint8_t *hyperloglog_counters::registers(size_t c) {
+	assert(c < m_n);
+	return &m_registers[c*m_m];
+}
+
+const uint8_t *hyperloglog_counters::registers(size_t c) const {
+	assert(c < m_n);
+	return &m_registers[c*m_m];
+}
+
+void hyperloglog_counters::add(size_t c, uint64_t x) {
+	const uint64_t h = mix64(x + mix64(m_salt));
+
+	// the first bits choose the register, and the position of the first
+	// bit set in the rest (at most 64 - log2m + 1) is the value
+	const size_t j = static_cast<size_t>(h >> (64 - m_log2m));
+	const uint64_t w = h << m_log2m;
+	const uint8_t rho = static_cast<uint8_t>(
+		w == 0 ? 64 - m_log2m + 1 : __builtin_clzll(w) + 1
+	);
+
+	uint8_t& r = registers(c)[j];
+	if (r < rho) {
+		r = rho;
+	}
+}
+
+bool hyperloglog_counters::merge(size_t c, const uint8_t *regs) {
+	uint8_t *dst = registers(c);
+	size_t i = 0;
+	bool changed = false;
+
+#if defined (__SSE2__)
+	// 16 registers at a time: the maximum of the registers, and
+	// the registers that changed, or-ed over all the blocks
+	__m128i diff = _mm_setzero_si128();
+	for (; i + 16 <= m_m; i += 16) {
+		const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i *>(dst + i));
+		const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i *>(regs + i));
+		const __m128i mx = _mm_max_epu8(a, b);
+		diff = _mm_or_si128(diff, _mm_xor_si128(mx, a));
+		_mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i), mx);
+	}
+	changed = _mm_movemask_epi8(_mm_cmpeq_epi8(diff, _mm_setzero_si128())) != 0xffff;
+#endif
+
+	for (; i < m_m; ++i) {
+		if (dst[i] < regs[i]) {
+			dst[i] = regs[i];
+			changed = true;
+		}
+	}
+	return changed;
+}
+
+void hyperloglog_counters::assign(size_t c, const uint8_t *regs) {
+	memcpy(registers(c), regs, m_m);
+}
+
+double hyperloglog_counters::estimate(size_t c) const {
+	const uint8_t *regs = registers(c);
+	const double m = static_cast<double>(m_m);
+
+	// harmonic mean of 2^(registers)
+	double sum = 0.0;
+	size_t zeros = 0;
+	for (size_t i = 0; i < m_m; ++i) {
+		sum += std::ldexp(1.0, -static_cast<int>(regs[i]));
+		zeros += (regs[i] == 0);
+	}
+
+	double alpha;
+	switch (m_m) {
+		case 16: alpha = 0.673; break;
+		case 32: alpha = 0.697; break;
+		case 64: alpha = 0.709; break;
+		default: alpha = 0.7213/(1.0 + 1.079/m);
+	}
+
+	const double E = alpha*m*m/sum;
+	if (E <= 2.5*m and zeros > 0) {
+		// linear counting
+		return m*std::log(m/zeros);
+	}
+	return E;
+}
+
+} // -- namespace lgraph
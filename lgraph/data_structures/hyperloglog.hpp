@@ -0,0 +1,126 @@
+/*********************************************************************
+ * lgraph
+ * Copyright (C) 2018-2019 Lluís Alemany Puig
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ * 
+ * Contact: Lluís Alemany Puig (lluis.alemany.puig@gmail.com)
+ * 
+ ********************************************************************/
+
+
+#pragma once
+
+// C includes
+#include <stddef.h>
+#include <stdint.h>
+
+// C++ includes
+#include <vector>
+
+namespace lgraph {
+
+/**
+ * @brief Array of HyperLogLog counters.
+ *
+ * A HyperLogLog counter [1] estimates the number of distinct elements
+ * added to it in a constant amount of memory: @e m registers of one
+ * byte, where @e m is a power of 2. Every element is hashed, the first
+ * log2(@e m) bits of the hash choose a register, and the register keeps
+ * the largest position of the first bit set in the remaining bits. The
+ * relative standard error of the estimate is about 1.04/sqrt(@e m).
+ *
+ * The union of two counters is the register-wise maximum of their
+ * registers (see @ref merge), which is done 16 registers at a time with
+ * SSE2 instructions when they are available. The registers of every
+ * counter are contiguous in memory.
+ *
+ * [1] Flajolet, P., Fusy, É., Gandouet, O. and Meunier, F., "HyperLogLog:
+ * the analysis of a near-optimal cardinality estimation algorithm",
+ * Analysis of Algorithms (AofA), 2007.
+ */
+class hyperloglog_counters {
+	private:
+		/// Number of counters.
+		size_t m_n;
+		/// Base 2 logarithm of the number of registers of a counter.
+		size_t m_log2m;
+		/// Number of registers of a counter.
+		size_t m_m;
+		/// Value combined with the elements before hashing them.
+		uint64_t m_salt;
+		/// The registers of all counters, counter after counter.
+		std::vector<uint8_t> m_registers;
+
+	public:
+		/// Empty constructor.
+		hyperloglog_counters();
+		/// Destructor.
+		~hyperloglog_counters();
+
+		/**
+		 * @brief Initialises @e n empty counters.
+		 * @param n Number of counters.
+		 * @param log2m Base 2 logarithm of the number of registers of
+		 * every counter, in [4,16].
+		 * @param salt Value combined with the elements before hashing
+		 * them: counters with different salts make independent errors.
+		 */
+		void init(size_t n, size_t log2m, uint64_t salt = 0);
+
+		/// Returns the number of counters.
+		size_t size() const;
+		/// Returns the number of registers of every counter.
+		size_t n_registers() const;
+
+		/// Returns the registers of the @e c-th counter.
+		uint8_t *registers(size_t c);
+		/// Returns the registers of the @e c-th counter.
+		const uint8_t *registers(size_t c) const;
+
+		/// Adds element @e x to the @e c-th counter.
+		void add(size_t c, uint64_t x);
+
+		/**
+		 * @brief Union of two counters.
+		 *
+		 * Stores in the @e c-th counter its union with the counter whose
+		 * registers are @e regs, of any array with the same number of
+		 * registers per counter.
+		 * @param c The counter updated.
+		 * @param regs The registers of the other counter.
+		 * @return Returns true if the @e c-th counter changed.
+		 */
+		bool merge(size_t c, const uint8_t *regs);
+
+		/**
+		 * @brief Copies a counter.
+		 *
+		 * Makes the @e c-th counter equal to the counter whose registers
+		 * are @e regs.
+		 */
+		void assign(size_t c, const uint8_t *regs);
+
+		/**
+		 * @brief Estimated number of distinct elements in a counter.
+		 *
+		 * Small cardinalities are estimated with linear counting, as in [1].
+		 * @param c The counter.
+		 * @return Returns the estimate of the number of distinct elements
+		 * added to the @e c-th counter.
+		 */
+		double estimate(size_t c) const;
+};
+
+} // -- namespace lgraph
@@ -0,0 +1,171 @@
+/*********************************************************************
+ * lgraph
+ * Copyright (C) 2018-2019 Lluís Alemany Puig
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ * 
+ * Contact: Lluís Alemany Puig (lluis.alemany.puig@gmail.com)
+ * 
+ ********************************************************************/
+
+
+
+#include <lgraph/data_structures/landmark_index.hpp>
+
+// C includes
+#include <assert.h>
+
+// C++ includes
+#include <utility>
+
+namespace lgraph {
+
+// PUBLIC
+
+template<class T>
+landmark_index<T>::landmark_index() : m_n(0), m_directed(false) { }
+
+template<class T>
+landmark_index<T>::~landmark_index() { }
+
+template<class T>
+void landmark_index<T>::init(
+	size_t n, bool directed, std::vector<node>&& landmarks,
+	std::vector<T>&& from, std::vector<T>&& to
+)
+{
+	assert(from.size() == n*landmarks.size());
+	assert(directed ? to.size() == from.size() : to.empty());
+
+	m_n = n;
+	m_directed = directed;
+	m_landmarks = std::move(landmarks);
+	m_from = std::move(from);
+	m_to = std::move(to);
+}
+
+template<class T>
+size_t landmark_index<T>::n_nodes() const {
+	return m_n;
+}
+
+template<class T>
+size_t landmark_index<T>::n_landmarks() const {
+	return m_landmarks.size();
+}
+
+template<class T>
+bool landmark_index<T>::is_directed() const {
+	return m_directed;
+}
+
+template<class T>
+const std::vector<node>& landmark_index<T>::get_landmarks() const {
+	return m_landmarks;
+}
+
+template<class T>
+T landmark_index<T>::from_landmark(size_t i, node u) const {
+	assert(i < n_landmarks() and u < n_nodes());
+	return m_from[u*n_landmarks() + i];
+}
+
+template<class T>
+T landmark_index<T>::to_landmark(size_t i, node u) const {
+	assert(i < n_landmarks() and u < n_nodes());
+	return (m_directed ? m_to[u*n_landmarks() + i] : m_from[u*n_landmarks() + i]);
+}
+
+template<class T>
+const std::vector<T>& landmark_index<T>::get_from() const {
+	return m_from;
+}
+
+template<class T>
+const std::vector<T>& landmark_index<T>::get_to() const {
+	return m_to;
+}
+
+template<class T>
+T landmark_index<T>::lower_bound(node s, node t) const {
+	assert(s < n_nodes() and t < n_nodes());
+
+	const size_t K = n_landmarks();
+	const T inf = inf_t<T>();
+	T lb = 0;
+
+	// d(L,t) - d(L,s) <= d(s,t). In undirected graphs d(L,s) = d(s,L),
+	// so the bound d(s,L) - d(t,L) <= d(s,t) is the same one swapped.
+	// A landmark that reaches s but not t proves that s does not reach t.
+	const T *fs = m_from.data() + s*K;
+	const T *ft = m_from.data() + t*K;
+	for (size_t i = 0; i < K; ++i) {
+		if (fs[i] == inf) {
+			if (not m_directed and ft[i] != inf) {
+				return inf;
+			}
+			continue;
+		}
+		if (ft[i] == inf) {
+			return inf;
+		}
+
+		if (ft[i] > fs[i] and ft[i] - fs[i] > lb) {
+			lb = ft[i] - fs[i];
+		}
+		else if (not m_directed and fs[i] > ft[i] and fs[i] - ft[i] > lb) {
+			lb = fs[i] - ft[i];
+		}
+	}
+
+	if (m_directed) {
+		// d(s,L) - d(t,L) <= d(s,t). A landmark reached from
+		// t but not from s proves that s does not reach t.
+		const T *ts = m_to.data() + s*K;
+		const T *tt = m_to.data() + t*K;
+		for (size_t i = 0; i < K; ++i) {
+			if (tt[i] == inf) {
+				continue;
+			}
+			if (ts[i] == inf) {
+				return inf;
+			}
+			if (ts[i] > tt[i] and ts[i] - tt[i] > lb) {
+				lb = ts[i] - tt[i];
+			}
+		}
+	}
+	return lb;
+}
+
+template<class T>
+T landmark_index<T>::upper_bound(node s, node t) const {
+	assert(s < n_nodes() and t < n_nodes());
+
+	const size_t K = n_landmarks();
+	const T inf = inf_t<T>();
+	T ub = inf;
+
+	// d(s,t) <= d(s,L) + d(L,t)
+	const T *ts = (m_directed ? m_to.data() + s*K : m_from.data() + s*K);
+	const T *ft = m_from.data() + t*K;
+	for (size_t i = 0; i < K; ++i) {
+		if (ts[i] != inf and ft[i] != inf and ts[i] + ft[i] < ub) {
+			ub = ts[i] + ft[i];
+		}
+	}
+	return (s == t ? 0 : ub);
+}
+
+} // -- namespace lgraph
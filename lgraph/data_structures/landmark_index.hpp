@@ -0,0 +1,146 @@
+/*********************************************************************
+ * lgraph
+ * Copyright (C) 2018-2019 Lluís Alemany Puig
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ * 
+ * Contact: Lluís Alemany Puig (lluis.alemany.puig@gmail.com)
+ * 
+ ********************************************************************/
+
+
+
+#pragma once
+
+// C++ includes
+#include <vector>
+
+// lgraph includes
+#include <lgraph/utils/definitions.hpp>
+
+namespace lgraph {
+
+/**
+ * @brief Distances from and to a few nodes of a weighted graph.
+ *
+ * Preprocessed data for repeated shortest-path queries in a static
+ * graph: a few nodes, the landmarks, and the distance from every
+ * landmark to every node (and from every node to every landmark, in
+ * directed graphs). By the triangle inequality, for every landmark @e L
+ * and every pair of nodes @e s, @e t:
+ *
+ * <pre>
+ * d(L,t) - d(L,s) <= d(s,t) <= d(s,L) + d(L,t)
+ * d(s,L) - d(t,L) <= d(s,t)
+ * </pre>
+ *
+ * so the index gives a lower and an upper bound of the distance between
+ * any two nodes in time proportional to the number of landmarks. The
+ * lower bound is used as the heuristic of the A* search in [1] (ALT:
+ * A*, landmarks and triangle inequality), which reaches far fewer nodes
+ * than Dijkstra's algorithm (see @ref traversal::wxdistance_landmarks).
+ *
+ * The distances of every node to all landmarks are contiguous in memory,
+ * so that every bound reads one or two blocks of @e K values, where @e K
+ * is the number of landmarks.
+ *
+ * [1] Goldberg, A. V. and Harrelson, C., "Computing the shortest path: A*
+ * search meets graph theory", SODA, 2005.
+ *
+ * @param T The type of the weights of the graph.
+ */
+template<class T>
+class landmark_index {
+	public:
+		/// Empty constructor.
+		landmark_index();
+		/// Destructor.
+		~landmark_index();
+
+		/**
+		 * @brief Initialises the index.
+		 *
+		 * The vectors are moved into the index.
+		 *
+		 * @param n The number of nodes of the graph.
+		 * @param directed Is the graph directed?
+		 * @param landmarks The landmarks.
+		 * @param from The distance from every landmark to every node,
+		 * infinite (see @ref inf_t) if the node is not reachable: that
+		 * from the @e i-th landmark to node @e u is at position
+		 * @e u*K + @e i, where @e K is the number of landmarks.
+		 * @param to The distance from every node to every landmark, in
+		 * the same layout as @e from. Empty if the graph is undirected.
+		 */
+		void init(
+			size_t n, bool directed, std::vector<node>&& landmarks,
+			std::vector<T>&& from, std::vector<T>&& to
+		);
+
+		/// Returns the number of nodes of the graph.
+		size_t n_nodes() const;
+		/// Returns the number of landmarks.
+		size_t n_landmarks() const;
+		/// Returns true if the graph is directed.
+		bool is_directed() const;
+		/// Returns the landmarks.
+		const std::vector<node>& get_landmarks() const;
+
+		/// Returns the distance from the @e i-th landmark to @e u.
+		T from_landmark(size_t i, node u) const;
+		/// Returns the distance from @e u to the @e i-th landmark.
+		T to_landmark(size_t i, node u) const;
+
+		/// Returns the distances from all landmarks to all nodes.
+		const std::vector<T>& get_from() const;
+		/**
+		 * @brief Returns the distances from all nodes to all landmarks.
+		 *
+		 * Empty if the graph is undirected.
+		 */
+		const std::vector<T>& get_to() const;
+
+		/**
+		 * @brief Lower bound of the distance from @e s to @e t.
+		 *
+		 * It is infinite if the landmarks prove that @e t is not
+		 * reachable from @e s. It is exact if some landmark is in a
+		 * shortest path from @e s to @e t, or has @e s in its shortest
+		 * path to @e t.
+		 */
+		T lower_bound(node s, node t) const;
+		/**
+		 * @brief Upper bound of the distance from @e s to @e t.
+		 *
+		 * The length of the shortest path from @e s to @e t through a
+		 * landmark, infinite if there is none.
+		 */
+		T upper_bound(node s, node t) const;
+
+	private:
+		/// Number of nodes of the graph.
+		size_t m_n;
+		/// Is the graph directed?
+		bool m_directed;
+		/// The landmarks.
+		std::vector<node> m_landmarks;
+		/// Distance from every landmark to every node.
+		std::vector<T> m_from;
+		/// Distance from every node to every landmark (directed graphs).
+		std::vector<T> m_to;
+};
+
+} // -- namespace lgraph
+
+#include <lgraph/data_structures/landmark_index.cpp>
@@ -0,0 +1,197 @@
+/*********************************************************************
+ * lgraph
+ * Copyright (C) 2018-2019 Lluís Alemany Puig
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ * 
+ * Contact: Lluís Alemany Puig (lluis.alemany.puig@gmail.com)
+ * 
+ ********************************************************************/
+
+
+#include <lgraph/data_structures/shortest_path_dag.hpp>
+
+// C includes
+#include <assert.h>
+
+namespace lgraph {
+
+/* PATH ITERATOR */
+
+// PRIVATE
+
+template<class T>
+void shortest_path_dag<T>::path_iterator::descend() {
+	node u = m_stack.back();
+	while (u != m_dag.get_source()) {
+		// every reachable node other than the source has a predecessor
+		m_choice.push_back(0);
+		u = m_dag.predecessor(u, 0);
+		m_stack.push_back(u);
+	}
+}
+
+template<class T>
+void shortest_path_dag<T>::path_iterator::make_path() {
+	m_path.empty();
+	for (size_t i = m_stack.size(); i > 0; --i) {
+		m_path.add_node(m_stack[i - 1]);
+	}
+	m_path.set_length(m_dag.distance(m_stack[0]));
+}
+
+// PUBLIC
+
+template<class T>
+shortest_path_dag<T>::path_iterator::path_iterator
+(const shortest_path_dag<T>& dag, node target)
+	: m_dag(dag)
+{
+	m_end = not dag.is_reachable(target);
+	if (not m_end) {
+		m_stack.push_back(target);
+		descend();
+		make_path();
+	}
+}
+
+template<class T>
+bool shortest_path_dag<T>::path_iterator::end() const {
+	return m_end;
+}
+
+template<class T>
+void shortest_path_dag<T>::path_iterator::next() {
+	assert(not end());
+
+	// backtrack to the last node with predecessors not tried yet
+	while (not m_choice.empty()) {
+		m_stack.pop_back();
+		const node u = m_stack.back();
+		const size_t c = ++m_choice.back();
+
+		if (c < m_dag.n_predecessors(u)) {
+			m_stack.push_back(m_dag.predecessor(u, c));
+			descend();
+			make_path();
+			return;
+		}
+		m_choice.pop_back();
+	}
+	m_end = true;
+}
+
+template<class T>
+const node_path<T>& shortest_path_dag<T>::path_iterator::get_path() const {
+	assert(not end());
+	return m_path;
+}
+
+/* SHORTEST PATH DAG */
+
+template<class T>
+shortest_path_dag<T>::shortest_path_dag() : m_source(0) { }
+
+template<class T>
+shortest_path_dag<T>::~shortest_path_dag() { }
+
+template<class T>
+void shortest_path_dag<T>::init(
+	node source,
+	std::vector<T>&& ds, std::vector<node>&& order,
+	std::vector<size_t>&& pred_offsets, std::vector<node>&& preds
+)
+{
+	assert(pred_offsets.size() == ds.size() + 1);
+	assert(order.size() > 0 and order[0] == source);
+
+	m_source = source;
+	m_dists = std::move(ds);
+	m_order = std::move(order);
+	m_pred_offsets = std::move(pred_offsets);
+	m_preds = std::move(preds);
+
+	// the predecessors of a node precede it in the order
+	m_paths.assign(m_dists.size(), 0.0);
+	m_paths[source] = 1.0;
+	for (size_t i = 1; i < m_order.size(); ++i) {
+		const node v = m_order[i];
+		double p = 0.0;
+		for (size_t j = m_pred_offsets[v]; j < m_pred_offsets[v + 1]; ++j) {
+			p += m_paths[m_preds[j]];
+		}
+		m_paths[v] = p;
+	}
+}
+
+template<class T>
+node shortest_path_dag<T>::get_source() const {
+	return m_source;
+}
+
+template<class T>
+size_t shortest_path_dag<T>::n_nodes() const {
+	return m_dists.size();
+}
+
+template<class T>
+const std::vector<node>& shortest_path_dag<T>::get_order() const {
+	return m_order;
+}
+
+template<class T>
+bool shortest_path_dag<T>::is_reachable(node u) const {
+	assert(u < n_nodes());
+	return m_dists[u] != inf_t<T>();
+}
+
+template<class T>
+const T& shortest_path_dag<T>::distance(node u) const {
+	assert(u < n_nodes());
+	return m_dists[u];
+}
+
+template<class T>
+double shortest_path_dag<T>::n_paths(node u) const {
+	assert(u < n_nodes());
+	return m_paths[u];
+}
+
+template<class T>
+size_t shortest_path_dag<T>::n_predecessors(node u) const {
+	assert(u < n_nodes());
+	return m_pred_offsets[u + 1] - m_pred_offsets[u];
+}
+
+template<class T>
+node shortest_path_dag<T>::predecessor(node u, size_t i) const {
+	assert(i < n_predecessors(u));
+	return m_preds[m_pred_offsets[u] + i];
+}
+
+template<class T>
+typename shortest_path_dag<T>::path_iterator
+shortest_path_dag<T>::paths(node u) const {
+	return path_iterator(*this, u);
+}
+
+template<class T>
+void shortest_path_dag<T>::get_paths(node u, node_path_set<T>& ps) const {
+	ps.clear();
+	for (path_iterator it = paths(u); not it.end(); it.next()) {
+		ps.push_back(it.get_path());
+	}
+}
+
+} // -- namespace lgraph
@@ -0,0 +1,182 @@
+/*********************************************************************
+ * lgraph
+ * Copyright (C) 2018-2019 Lluís Alemany Puig
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ * 
+ * Contact: Lluís Alemany Puig (lluis.alemany.puig@gmail.com)
+ * 
+ ********************************************************************/
+
+
+#pragma once
+
+// C++ includes
+#include <vector>
+
+// lgraph includes
+#include <lgraph/data_structures/node_path.hpp>
+#include <lgraph/utils/definitions.hpp>
+
+namespace lgraph {
+
+/**
+ * @brief The shortest paths from a node to all other nodes of a graph.
+ *
+ * Compact representation of all the shortest paths from a source node:
+ * the distance from the source to every node, the list of predecessors
+ * of every node (the nodes right before it in some shortest path from
+ * the source), and the number of shortest paths from the source to every
+ * node. Its size is proportional to the number of nodes and edges of the
+ * graph, whereas the number of shortest paths grows exponentially with
+ * the distance in some graphs (grids, for example).
+ *
+ * The paths to a node are not stored: they are enumerated on demand with
+ * a @ref path_iterator, which keeps only the path it is at.
+ *
+ * @param T The type used for the distances.
+ */
+template<class T = _new_>
+class shortest_path_dag {
+	public:
+		/**
+		 * @brief Enumerates the shortest paths from the source to a node.
+		 *
+		 * The paths are generated one at a time, backtracking over the
+		 * predecessors of the nodes from the target to the source. The
+		 * memory used is proportional to the length of the paths.
+		 *
+		 * <pre>
+		 * for (auto it = dag.paths(t); not it.end(); it.next()) {
+		 *	const node_path<T>& p = it.get_path();
+		 *	...
+		 * }
+		 * </pre>
+		 */
+		class path_iterator {
+			public:
+				/**
+				 * @brief Constructor.
+				 * @param dag The DAG whose paths are enumerated.
+				 * @param target The node where the paths end at.
+				 */
+				path_iterator(const shortest_path_dag<T>& dag, node target);
+
+				/// Returns true if all paths have been enumerated.
+				bool end() const;
+				/**
+				 * @brief Moves to the next path.
+				 * @pre Not all paths have been enumerated (see @ref end).
+				 */
+				void next();
+				/**
+				 * @brief Returns the current path.
+				 * @pre Not all paths have been enumerated (see @ref end).
+				 */
+				const node_path<T>& get_path() const;
+
+			private:
+				/// Extends the current path to the source through first predecessors.
+				void descend();
+				/// Makes @ref m_path from @ref m_stack.
+				void make_path();
+
+			private:
+				/// The DAG whose paths are enumerated.
+				const shortest_path_dag<T>& m_dag;
+				/// Nodes of the current path, from the target to the source.
+				std::vector<node> m_stack;
+				/// Index of the predecessor of @e m_stack[i] that is @e m_stack[i+1].
+				std::vector<size_t> m_choice;
+				/// The current path, from the source to the target.
+				node_path<T> m_path;
+				/// Were all paths enumerated?
+				bool m_end;
+		};
+
+	public:
+		/// Empty constructor.
+		shortest_path_dag();
+		/// Destructor.
+		~shortest_path_dag();
+
+		/**
+		 * @brief Initialises the DAG.
+		 *
+		 * The vectors are moved into the DAG, and the number of shortest
+		 * paths to every node is computed.
+		 *
+		 * @param source The node where all paths start at.
+		 * @param ds The distance from @e source to every node, infinite
+		 * (see @ref inf_t) for the nodes not reachable from it.
+		 * @param order The nodes reachable from @e source in non-decreasing
+		 * order of distance. The first is @e source.
+		 * @param pred_offsets Position in @e preds of the first predecessor
+		 * of every node. It has one more element than @e ds.
+		 * @param preds The predecessors of every node, those of node @e u
+		 * being in the positions [@e pred_offsets[u], @e pred_offsets[u+1]).
+		 */
+		void init(
+			node source,
+			std::vector<T>&& ds, std::vector<node>&& order,
+			std::vector<size_t>&& pred_offsets, std::vector<node>&& preds
+		);
+
+		/// Returns the node where all paths start at.
+		node get_source() const;
+		/// Returns the number of nodes of the graph.
+		size_t n_nodes() const;
+		/// Returns the nodes reachable from the source, in non-decreasing distance.
+		const std::vector<node>& get_order() const;
+
+		/// Returns true if there is a path from the source to @e u.
+		bool is_reachable(node u) const;
+		/// Returns the distance from the source to @e u.
+		const T& distance(node u) const;
+		/**
+		 * @brief Returns the number of shortest paths from the source to @e u.
+		 *
+		 * It is a floating-point value: the number of paths may not fit
+		 * in any integral type. It is 0 if @e u is not reachable.
+		 */
+		double n_paths(node u) const;
+
+		/// Returns the number of predecessors of @e u.
+		size_t n_predecessors(node u) const;
+		/// Returns the @e i-th predecessor of @e u.
+		node predecessor(node u, size_t i) const;
+
+		/// Returns an iterator over the shortest paths from the source to @e u.
+		path_iterator paths(node u) const;
+		/// Stores in @e ps all the shortest paths from the source to @e u.
+		void get_paths(node u, node_path_set<T>& ps) const;
+
+	private:
+		/// The node where all paths start at.
+		node m_source;
+		/// Distance from the source to every node.
+		std::vector<T> m_dists;
+		/// Number of shortest paths from the source to every node.
+		std::vector<double> m_paths;
+		/// Reachable nodes in non-decreasing order of distance.
+		std::vector<node> m_order;
+		/// Position of the first predecessor of every node in @ref m_preds.
+		std::vector<size_t> m_pred_offsets;
+		/// Predecessors of all nodes.
+		std::vector<node> m_preds;
+};
+
+} // -- namespace lgraph
+
+#include <lgraph/data_structures/shortest_path_dag.cpp>
@@ -0,0 +1,102 @@
+/*********************************************************************
+ * lgraph
+ * Copyright (C) 2018-2019 Lluís Alemany Puig
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ * 
+ * Contact: Lluís Alemany Puig (lluis.alemany.puig@gmail.com)
+ * 
+ ********************************************************************/
+
+
+#include <lgraph/data_structures/triangles.hpp>
+
+// C includes
+#include <assert.h>
+
+// C++ includes
+#include <algorithm>
+
+namespace lgraph {
+
+template<class G_t>
+void node_triangles(const G_t *G, std::vector<size_t>& tris) {
+	assert(not G->is_directed());
+
+	const size_t N = G->n_nodes();
+	tris.assign(N, 0);
+
+	// u precedes v if u has smaller degree, or the same and smaller index
+	auto precedes =
+	[G](node u, node v) -> bool
+	{
+		const size_t du = G->degree(u);
+		const size_t dv = G->degree(v);
+		return du < dv or (du == dv and u < v);
+	};
+
+	// the forward neighbourhood of node u is found in the
+	// interval [offsets[u], offsets[u + 1]) of 'forward'
+	std::vector<size_t> offsets(N + 1, 0);
+	for (node u = 0; u < N; ++u) {
+		offsets[u + 1] = offsets[u];
+		for (node v : G->get_neighbours(u)) {
+			if (precedes(u, v)) {
+				++offsets[u + 1];
+			}
+		}
+	}
+
+	std::vector<node> forward(offsets[N]);
+	for (node u = 0; u < N; ++u) {
+		size_t p = offsets[u];
+		for (node v : G->get_neighbours(u)) {
+			if (precedes(u, v)) {
+				forward[p++] = v;
+			}
+		}
+
+		// a subsequence of a sorted list is sorted
+		if (not G->is_adjacency_sorted()) {
+			std::sort(forward.begin() + offsets[u], forward.begin() + offsets[u + 1]);
+		}
+	}
+
+	// every common forward neighbour w of u and v closes a triangle
+	for (node u = 0; u < N; ++u) {
+		for (size_t i = offsets[u]; i < offsets[u + 1]; ++i) {
+			const node v = forward[i];
+
+			size_t a = offsets[u];
+			size_t b = offsets[v];
+			while (a < offsets[u + 1] and b < offsets[v + 1]) {
+				if (forward[a] < forward[b]) {
+					++a;
+				}
+				else if (forward[b] < forward[a]) {
+					++b;
+				}
+				else {
+					++tris[u];
+					++tris[v];
+					++tris[forward[a]];
+					++a;
+					++b;
+				}
+			}
+		}
+	}
+}
+
+} // -- namespace lgraph
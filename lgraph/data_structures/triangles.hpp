@@ -0,0 +1,59 @@
+/*********************************************************************
+ * lgraph
+ * Copyright (C) 2018-2019 Lluís Alemany Puig
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ * 
+ * Contact: Lluís Alemany Puig (lluis.alemany.puig@gmail.com)
+ * 
+ ********************************************************************/
+
+
+#pragma once
+
+// C++ includes
+#include <vector>
+
+// lgraph includes
+#include <lgraph/utils/definitions.hpp>
+
+namespace lgraph {
+
+/**
+ * @brief Counts the triangles each node of an undirected graph belongs to.
+ *
+ * Applies the degree-ordered forward algorithm. The nodes are ordered
+ * increasingly by degree (ties are broken by index) and every node @e u
+ * only keeps its <em>forward</em> neighbours: those that come after @e u
+ * in that order. Then, every triangle {@e u, @e v, @e w} is found exactly
+ * once, as the intersection of the forward neighbourhoods of @e u and @e v,
+ * where @e u precedes @e v. The forward neighbourhoods are intersected as
+ * sorted lists, so they are sorted first unless the graph is in sorted
+ * adjacency mode (see @ref xxgraph::sort_adjacency_list).
+ *
+ * Since the forward neighbourhood of a high-degree node is short, the
+ * cost is O(m^{3/2}) for any degree distribution, instead of the
+ * O(sum of cubed degrees) of checking every pair of neighbours of
+ * every node.
+ *
+ * @param G The graph. Either an adjacency-list or a compressed graph.
+ * @param[out] tris The number of triangles of every node.
+ * @pre The graph is undirected and has neither loops nor multiple edges.
+ */
+template<class G_t>
+void node_triangles(const G_t *G, std::vector<size_t>& tris);
+
+} // -- namespace lgraph
+
+#include <lgraph/data_structures/triangles.cpp>
@@ -45,6 +45,10 @@ void udgraph::init(const std::vector<neighbourhood>& adj) {
 	for (node u = 0; u < m_adjacency_list.size(); ++u) {
 		m_n_edges += m_adjacency_list[u].size();
 	}
+
+	if (m_sorted_adjacency) {
+		sort_lists();
+	}
 }
 
 // MODIFIERS
@@ -54,7 +58,8 @@ void udgraph::add_edge(node u, node v) {
 	assert( has_node(v) );
 	assert( not has_edge(u,v) );
 
-	m_adjacency_list[u].add(v);
+	neighbourhood& nu = m_adjacency_list[u];
+	nu.insert(get_insert_position(nu, v), v);
 	++m_n_edges;
 }
 
@@ -71,7 +76,7 @@ void udgraph::remove_edge(node u, node v) {
 	// delete the neighbour
 	size_t posu = get_neighbour_position(nu, v);
 	if (posu < nu.size()) {
-		nu.remove(posu);
+		remove_from_list(nu, posu);
 		erased = true;
 	}
 
@@ -101,7 +106,7 @@ void udgraph::remove_node(node u) {
 		// the corresponding nodes
 		for (size_t p = Nv.size(); p > 0; --p) {
 			if (Nv[p - 1] == u) {
-				Nv.remove(p - 1);
+				remove_from_list(Nv, p - 1);
 				m_n_edges -= 1;
 			}
 			else if (Nv[p - 1] > u) {
@@ -51,6 +51,10 @@ void uugraph::init(const std::vector<neighbourhood>& adj) {
 			}
 		}
 	}
+
+	if (m_sorted_adjacency) {
+		sort_lists();
+	}
 }
 
 // MODIFIERS
@@ -60,8 +64,10 @@ void uugraph::add_edge(node u, node v) {
 	assert( has_node(v) );
 	assert( not has_edge(u,v) );
 
-	m_adjacency_list[u].add(v);
-	m_adjacency_list[v].add(u);
+	neighbourhood& nu = m_adjacency_list[u];
+	neighbourhood& nv = m_adjacency_list[v];
+	nu.insert(get_insert_position(nu, v), v);
+	nv.insert(get_insert_position(nv, u), u);
 	++m_n_edges;
 }
 
@@ -79,7 +85,7 @@ void uugraph::remove_edge(node u, node v) {
 	// delete the neighbour
 	size_t posu = get_neighbour_position(nu, v);
 	if (posu < nu.size()) {
-		nu.remove(posu);
+		remove_from_list(nu, posu);
 		erased = true;
 	}
 
@@ -87,7 +93,7 @@ void uugraph::remove_edge(node u, node v) {
 	// delete the neighbour
 	size_t posv = get_neighbour_position(nv, u);
 	if (posv < nv.size()) {
-		nv.remove(posv);
+		remove_from_list(nv, posv);
 		erased = true;
 	}
 
@@ -117,7 +123,7 @@ void uugraph::remove_node(node u) {
 		// the corresponding nodes
 		for (size_t p = Nv.size(); p > 0; --p) {
 			if (Nv[p - 1] == u) {
-				Nv.remove(p - 1);
+				remove_from_list(Nv, p - 1);
 			}
 			else if (Nv[p - 1] > u) {
 				// decrease index of node
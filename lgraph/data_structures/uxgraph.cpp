@@ -24,6 +24,9 @@
 // C includes
 #include <assert.h>
 
+// C++ includes
+#include <utility>
+
 namespace lgraph {
 
 // PUBLIC
@@ -49,6 +52,20 @@ void uxgraph::init(const std::vector<neighbourhood>& adj, size_t n_edges) {
 	clear();
 	m_adjacency_list = adj;
 	m_n_edges = n_edges;
+
+	if (m_sorted_adjacency) {
+		sort_lists();
+	}
+}
+
+void uxgraph::init(std::vector<neighbourhood>&& adj, size_t n_edges) {
+	clear();
+	m_adjacency_list = std::move(adj);
+	m_n_edges = n_edges;
+
+	if (m_sorted_adjacency) {
+		sort_lists();
+	}
 }
 
 // OPERATORS
@@ -57,6 +74,7 @@ uxgraph& uxgraph::operator= (const uxgraph& g) {
 	clear();
 	m_adjacency_list = g.m_adjacency_list;
 	m_n_edges = g.m_n_edges;
+	m_sorted_adjacency = g.m_sorted_adjacency;
 	return *this;
 }
 
@@ -59,6 +59,15 @@ class uxgraph : public xxgraph {
 		 * @param n_edges The number of edges in the adjacency list.
 		 */
 		void init(const std::vector<neighbourhood>& adj, size_t n_edges);
+		/**
+		 * @brief Initialises the graph with adjacency list and number of edges.
+		 *
+		 * Same as @ref init(const std::vector<neighbourhood>&, size_t) but
+		 * the adjacency list is moved into the graph instead of copied.
+		 * @param adj The adjacency list of the graph.
+		 * @param n_edges The number of edges in the adjacency list.
+		 */
+		void init(std::vector<neighbourhood>&& adj, size_t n_edges);
 
 		// OPERATORS
 
@@ -71,6 +71,10 @@ void wdgraph<T>::init
 	for (node u = 0; u < this->m_adjacency_list.size(); ++u) {
 		this->m_n_edges += this->m_adjacency_list[u].size();
 	}
+
+	if (this->m_sorted_adjacency) {
+		this->sort_lists();
+	}
 }
 
 // MODIFIERS
@@ -81,8 +85,11 @@ void wdgraph<T>::add_edge(node u, node v, const T& w) {
 	assert( this->has_node(v) );
 	assert( not this->has_edge(u,v) );
 
-	this->m_adjacency_list[u].add(v);
-	this->m_weights[u].add(w);
+	neighbourhood& nu = this->m_adjacency_list[u];
+
+	size_t posu = this->get_insert_position(nu, v);
+	nu.insert(posu, v);
+	this->m_weights[u].insert(posu, w);
 
 	this->m_n_edges += 1;
 }
@@ -117,8 +124,8 @@ void wdgraph<T>::remove_edge(node u, node v) {
 	// delete the neighbour and the corresponding weight
 	size_t posu = this->get_neighbour_position(nu, v);
 	if (posu < nu.size()) {
-		nu.remove(posu);
-		wu.remove(posu);
+		this->remove_from_list(nu, posu);
+		this->remove_from_list(wu, posu);
 		erased = true;
 	}
 
@@ -156,8 +163,8 @@ void wdgraph<T>::remove_node(node u) {
 		// the corresponding nodes
 		for (size_t p = Nv.size(); p > 0; --p) {
 			if (Nv[p - 1] == u) {
-				Nv.remove(p - 1);
-				Wv.remove(p - 1);
+				this->remove_from_list(Nv, p - 1);
+				this->remove_from_list(Wv, p - 1);
 				this->m_n_edges -= 1;
 			}
 			else if (Nv[p - 1] > u) {
@@ -199,6 +206,9 @@ bool wdgraph<T>::is_directed() const {
 template<class T>
 uxgraph *wdgraph<T>::to_unweighted() const {
 	udgraph *g = new udgraph(this->m_adjacency_list, this->m_n_edges);
+	if (this->m_sorted_adjacency) {
+		g->sort_adjacency_list();
+	}
 	return g;
 }
 
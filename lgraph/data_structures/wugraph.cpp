@@ -75,6 +75,10 @@ void wugraph<T>::init
 			}
 		}
 	}
+
+	if (this->m_sorted_adjacency) {
+		this->sort_lists();
+	}
 }
 
 // MODIFIERS
@@ -85,10 +89,16 @@ void wugraph<T>::add_edge(node u, node v, const T& w) {
 	assert( this->has_node(v) );
 	assert( not this->has_edge(u,v) );
 
-	this->m_adjacency_list[u].add(v);
-	this->m_adjacency_list[v].add(u);
-	this->m_weights[u].add(w);
-	this->m_weights[v].add(w);
+	neighbourhood& nu = this->m_adjacency_list[u];
+	neighbourhood& nv = this->m_adjacency_list[v];
+
+	size_t posu = this->get_insert_position(nu, v);
+	nu.insert(posu, v);
+	this->m_weights[u].insert(posu, w);
+
+	size_t posv = this->get_insert_position(nv, u);
+	nv.insert(posv, u);
+	this->m_weights[v].insert(posv, w);
 
 	this->m_n_edges += 1;
 }
@@ -132,8 +142,8 @@ void wugraph<T>::remove_edge(node u, node v) {
 	// delete the neighbour and the corresponding weight
 	size_t posu = this->get_neighbour_position(nu, v);
 	if (posu < nu.size()) {
-		nu.remove(posu);
-		wu.remove(posu);
+		this->remove_from_list(nu, posu);
+		this->remove_from_list(wu, posu);
 		erased = true;
 	}
 
@@ -141,8 +151,8 @@ void wugraph<T>::remove_edge(node u, node v) {
 	// delete the neighbour and the corresponding weight
 	size_t posv = this->get_neighbour_position(nv, u);
 	if (posv < nv.size()) {
-		nv.remove(posv);
-		wv.remove(posv);
+		this->remove_from_list(nv, posv);
+		this->remove_from_list(wv, posv);
 		erased = true;
 	}
 
@@ -228,8 +238,8 @@ void wugraph<T>::remove_node(node u) {
 		// the corresponding nodes
 		for (size_t p = Nv.size(); p > 0; --p) {
 			if (Nv[p - 1] == u) {
-				Nv.remove(p - 1);
-				Wv.remove(p - 1);
+				this->remove_from_list(Nv, p - 1);
+				this->remove_from_list(Wv, p - 1);
 			}
 			else if (Nv[p - 1] > u) {
 				// decrease index of node
@@ -249,6 +259,9 @@ bool wugraph<T>::is_directed() const {
 template<class T>
 uxgraph *wugraph<T>::to_unweighted() const {
 	uugraph *g = new uugraph(this->m_adjacency_list, this->m_n_edges);
+	if (this->m_sorted_adjacency) {
+		g->sort_adjacency_list();
+	}
 	return g;
 }
 
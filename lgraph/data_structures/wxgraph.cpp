@@ -24,6 +24,10 @@
 // C includes
 #include <assert.h>
 
+// C++ includes
+#include <algorithm>
+#include <utility>
+
 namespace lgraph {
 
 // PUBLIC
@@ -70,6 +74,28 @@ void wxgraph<T>::init
 	this->m_adjacency_list = adj;
 	this->m_weights = wl;
 	this->m_n_edges = n_edges;
+
+	if (this->m_sorted_adjacency) {
+		sort_lists();
+	}
+}
+
+template<class T>
+void wxgraph<T>::init
+(
+	std::vector<neighbourhood>&& adj,
+	std::vector<weight_list<T> >&& wl,
+	size_t n_edges
+)
+{
+	clear();
+	this->m_adjacency_list = std::move(adj);
+	this->m_weights = std::move(wl);
+	this->m_n_edges = n_edges;
+
+	if (this->m_sorted_adjacency) {
+		sort_lists();
+	}
 }
 
 // OPERATORS
@@ -80,6 +106,7 @@ wxgraph<T>& wxgraph<T>::operator= (const wxgraph<T>& g) {
 	m_adjacency_list = g.m_adjacency_list;
 	m_weights = g.m_weights;
 	m_n_edges = g.m_n_edges;
+	m_sorted_adjacency = g.m_sorted_adjacency;
 	return *this;
 }
 
@@ -138,6 +165,33 @@ void wxgraph<T>::edges(std::vector<edge>& all_edges) const {
 	this->get_unique_edges(all_edges);
 }
 
+// PROTECTED
+
+template<class T>
+void wxgraph<T>::sort_lists() {
+	std::vector<std::pair<node, T> > nw;
+
+	for (size_t u = 0; u < this->m_adjacency_list.size(); ++u) {
+		neighbourhood& nu = this->m_adjacency_list[u];
+		weight_list<T>& wu = m_weights[u];
+
+		// sort the neighbours along with their weights
+		nw.resize(nu.size());
+		for (size_t i = 0; i < nu.size(); ++i) {
+			nw[i] = std::make_pair(nu[i], wu[i]);
+		}
+		std::sort(
+			nw.begin(), nw.end(),
+			[](const std::pair<node, T>& a, const std::pair<node, T>& b) -> bool
+			{ return a.first < b.first; }
+		);
+		for (size_t i = 0; i < nu.size(); ++i) {
+			nu[i] = nw[i].first;
+			wu[i] = nw[i].second;
+		}
+	}
+}
+
 // PRIVATE
 
 template<class T>
@@ -70,6 +70,18 @@ class wxgraph : public xxgraph {
 		void init(const std::vector<neighbourhood>& adj,
 				  const std::vector<weight_list<T> >& wl,
 				  size_t n_edges);
+		/**
+		 * @brief Initialise with adjacency list, list of weights and number of edges.
+		 *
+		 * Same as @ref init(const std::vector<neighbourhood>&, const std::vector<weight_list<T> >&, size_t)
+		 * but the lists are moved into the graph instead of copied.
+		 * @param adj The adjacency list of the graph.
+		 * @param wl The weights for every edge.
+		 * @param n_edges The number of edges in the adjacency list.
+		 */
+		void init(std::vector<neighbourhood>&& adj,
+				  std::vector<weight_list<T> >&& wl,
+				  size_t n_edges);
 
 		// OPERATORS
 
@@ -245,6 +257,9 @@ class wxgraph : public xxgraph {
 		/// Clears the list of weights.
 		void clear_weights();
 
+		/// Sorts every neighbourhood along with its list of weights.
+		void sort_lists();
+
 		/**
 		 * @brief Computes the list of unique weighted edges of this graph.
 		 *
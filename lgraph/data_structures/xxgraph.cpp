@@ -24,12 +24,16 @@
 // C includes
 #include <assert.h>
 
+// lgraph includes
+#include <lgraph/data_structures/triangles.hpp>
+
 namespace lgraph {
 
 // PUBLIC
 
 xxgraph::xxgraph() {
 	m_n_edges = 0;
+	m_sorted_adjacency = false;
 }
 
 xxgraph::~xxgraph() {
@@ -59,6 +63,11 @@ void xxgraph::remove_edges(const std::vector<edge>& edge_list) {
 	}
 }
 
+void xxgraph::sort_adjacency_list() {
+	sort_lists();
+	m_sorted_adjacency = true;
+}
+
 // GETTERS
 
 bool xxgraph::has_node(node u) const {
@@ -94,6 +103,10 @@ long long int xxgraph::genus() const {
 	return e - v + 1;
 }
 
+bool xxgraph::is_adjacency_sorted() const {
+	return m_sorted_adjacency;
+}
+
 // I/O
 
 // FEATURES OF GRAPHS
@@ -125,6 +138,17 @@ size_t xxgraph::n_triangles() const {
 	size_t tris = 0;
 	const size_t N = n_nodes();
 
+	if (not is_directed()) {
+		std::vector<size_t> node_tris;
+		node_triangles(this, node_tris);
+		for (size_t t : node_tris) {
+			tris += t;
+		}
+
+		// Each triangle is counted three times
+		return tris/3;
+	}
+
 	for (size_t u = 0; u < N; ++u) {
 
 		const neighbourhood& Nu = get_neighbours(u);
@@ -153,6 +177,10 @@ size_t xxgraph::n_triangles() const {
 // PROTECTED
 
 size_t xxgraph::get_neighbour_position(const neighbourhood& n, node u) const {
+	if (m_sorted_adjacency) {
+		return n.position_s(u);
+	}
+
 	size_t p = 0;
 	while (p < n.size()) {
 		if (n[p] == u) {
@@ -163,6 +191,16 @@ size_t xxgraph::get_neighbour_position(const neighbourhood& n, node u) const {
 	return n.size();
 }
 
+size_t xxgraph::get_insert_position(const neighbourhood& n, node u) const {
+	return (m_sorted_adjacency ? n.lower_bound(u) : n.size());
+}
+
+void xxgraph::sort_lists() {
+	for (neighbourhood& n : m_adjacency_list) {
+		n.sort();
+	}
+}
+
 void xxgraph::initialise_adjacency_list(size_t n) {
 	m_adjacency_list = std::vector<neighbourhood>(n);
 }
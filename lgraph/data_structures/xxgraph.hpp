@@ -113,6 +113,27 @@ class xxgraph {
 		 */
 		virtual void remove_node(node u) = 0;
 
+		/**
+		 * @brief Sorts the neighbourhood of every node.
+		 *
+		 * Sorts increasingly every list in @ref m_adjacency_list (and the
+		 * weights along with it, in weighted graphs) and switches this graph
+		 * to the <em>sorted adjacency</em> mode. In this mode, the graph
+		 * keeps its neighbourhoods sorted after every addition or removal
+		 * of edges and nodes, and after every (re-)initialisation with an
+		 * adjacency list. In exchange:
+		 * - finding a node in a neighbourhood (and, therefore, @ref has_edge)
+		 * performs a binary search instead of a linear search,
+		 * - triangles (see @ref n_triangles) are counted intersecting sorted
+		 * lists without any further sorting.
+		 *
+		 * Adding and removing an edge costs time linear in the degree of its
+		 * endpoints instead of constant time.
+		 *
+		 * @post @ref is_adjacency_sorted returns true.
+		 */
+		void sort_adjacency_list();
+
 		// GETTERS
 
 		/// Returns true if node @e u is in this graph.
@@ -176,6 +197,14 @@ class xxgraph {
 		 */
 		virtual bool is_directed() const = 0;
 
+		/**
+		 * @brief Returns whether the neighbourhoods are kept sorted.
+		 *
+		 * See @ref sort_adjacency_list.
+		 * @return Returns true if the graph is in sorted adjacency mode.
+		 */
+		bool is_adjacency_sorted() const;
+
 		// GRAPH FEATURES
 
 		/// Returns the adjacency matrix of this graph.
@@ -191,6 +220,10 @@ class xxgraph {
 
 		/**
 		 * @brief Returns the number of triangles in this graph.
+		 *
+		 * In undirected graphs, the triangles are counted with the
+		 * degree-ordered forward algorithm in time O(m^{3/2}). See
+		 * @ref node_triangles.
 		 * @return Returns the number of cycles of length 3.
 		 */
 		size_t n_triangles() const;
@@ -200,12 +233,15 @@ class xxgraph {
 		std::vector<neighbourhood> m_adjacency_list;
 		/// The amount of edges in this graph.
 		size_t m_n_edges;
+		/// Are the neighbourhoods kept sorted? See @ref sort_adjacency_list.
+		bool m_sorted_adjacency;
 
 		/**
 		 * @brief Returns the position of node @e u's position in the neighbourhood @e n.
 		 *
 		 * If the position is equal to the number of elements of the list @e n then @e u is in the list.
-		 * Performs a linear search to find it.
+		 * Performs a linear search to find it, or a binary search in sorted
+		 * adjacency mode.
 		 *
 		 * @param n The neighbourhood of a node in the graph.
 		 * @param u The node to look for in the neighbourhood.
@@ -214,6 +250,46 @@ class xxgraph {
 		 */
 		size_t get_neighbour_position(const neighbourhood& n, node u) const;
 
+		/**
+		 * @brief Returns the position where node @e u has to be added in @e n.
+		 *
+		 * In sorted adjacency mode, this is the position that keeps @e n
+		 * sorted. Otherwise, it is the end of the list.
+		 *
+		 * @param n The neighbourhood of a node in the graph.
+		 * @param u The node to be added to the neighbourhood.
+		 */
+		size_t get_insert_position(const neighbourhood& n, node u) const;
+
+		/**
+		 * @brief Removes the element at position @e p of a list of a node.
+		 *
+		 * Used for the neighbourhoods and for the lists of weights. In sorted
+		 * adjacency mode, the order of the remaining elements is preserved.
+		 *
+		 * @param l A neighbourhood or a list of weights.
+		 * @param p The position of the element to be removed.
+		 * @pre @e p < @e l.size()
+		 */
+		template<class L>
+		inline void remove_from_list(L& l, size_t p) const {
+			if (m_sorted_adjacency) {
+				l.remove(p, p + 1);
+			}
+			else {
+				l.remove(p);
+			}
+		}
+
+		/**
+		 * @brief Sorts every neighbourhood in @ref m_adjacency_list.
+		 *
+		 * Graphs that store more information along with each neighbour
+		 * (e.g., the weights) must override this method to keep that
+		 * information at the same position as its neighbour.
+		 */
+		virtual void sort_lists();
+
 		/// Initialise the list of neighbourhoods with @e n instances.
 		void initialise_adjacency_list(size_t n);
 
@@ -26,7 +26,9 @@
 #include <vector>
 
 // lgraph includes
+#include <lgraph/data_structures/csr_uxgraph.hpp>
 #include <lgraph/data_structures/uxgraph.hpp>
+#include <lgraph/graph_traversal/workspace.hpp>
 #include <lgraph/utils/logger.hpp>
 
 namespace lgraph {
@@ -121,6 +123,9 @@ typedef std::function<
  * node of the traversal.
  * @param proc_neigh It is called in line 11 used to perform some
  * operation on each of the neighbours.
+ * @param ws The memory used by the traversal (see @ref workspace). If
+ * null, the memory is allocated for this traversal only. Otherwise, the
+ * set of visited nodes is left in it after the traversal.
  */
 void BFS
 (
@@ -134,10 +139,327 @@ void BFS
 		-> void {},
 	bfs_process_neighbour proc_neigh =
 		[](const uxgraph *, node, node, const std::vector<bool>&)
-		-> void {}
+		-> void {},
+	workspace<> *ws = nullptr
+);
+
+/* VISITOR-BASED BFS */
+
+/**
+ * @brief Visitor that does nothing.
+ *
+ * Default value for the functions of the visitor-based @ref BFS. As a
+ * terminating function it never terminates the traversal, and as a
+ * processing function it does nothing. Since it is known at compile-time
+ * the compiler removes all calls to it.
+ */
+struct bfs_no_op {
+	/// Does nothing, returns false.
+	template<class... Args>
+	inline bool operator() (const Args&...) const { return false; }
+};
+
+/**
+ * @brief Generic Breadth-First search algorithm with visitors.
+ *
+ * Same algorithm as @ref BFS(const uxgraph*, node, bfs_terminate, bfs_process_current, bfs_process_neighbour)
+ * but the functions guiding the traversal are template parameters instead
+ * of @e std::function objects. This allows the compiler to inline them,
+ * removing the cost of an indirect call per node and per edge. Any
+ * callable object (a lambda, a functor, ...) with the same signature as
+ * @ref bfs_terminate, @ref bfs_process_current and @ref bfs_process_neighbour
+ * can be used.
+ *
+ * The graph can be of any type (@ref uxgraph, @ref csr_uxgraph, ...)
+ * that provides the methods @e n_nodes() and @e get_neighbours(u).
+ *
+ * @param G The graph being traversed.
+ * @param source The node where the algorithm starts at.
+ * @param term The terminating function.
+ * @param proc_curr The function to process the currently visited node.
+ * @param proc_neigh The function to process each of the neighbours.
+ * @param ws The memory used by the traversal (see @ref workspace).
+ */
+template<
+	class G_t,
+	class term_t = bfs_no_op,
+	class curr_t = bfs_no_op,
+	class neigh_t = bfs_no_op
+>
+void BFS
+(
+	const G_t *G,
+	node source,
+	term_t term = term_t(),
+	curr_t proc_curr = curr_t(),
+	neigh_t proc_neigh = neigh_t(),
+	workspace<> *ws = nullptr
+);
+
+/* COMPRESSED GRAPHS */
+
+/**
+ * @brief Terminating function for compressed graphs.
+ *
+ * See @ref bfs_terminate.
+ */
+typedef std::function<
+	bool (const csr_uxgraph *G, node u, const std::vector<bool>& vis)
+> csr_bfs_terminate;
+
+/**
+ * @brief Node processing function for compressed graphs.
+ *
+ * See @ref bfs_process_current.
+ */
+typedef std::function<
+	void (const csr_uxgraph *G, node u, const std::vector<bool>& vis)
+> csr_bfs_process_current;
+
+/**
+ * @brief Node processing function for compressed graphs.
+ *
+ * See @ref bfs_process_neighbour.
+ */
+typedef std::function<
+	void (const csr_uxgraph *G, node u, node v, const std::vector<bool>& vis)
+> csr_bfs_process_neighbour;
+
+/**
+ * @brief Generic Breadth-First search algorithm on a compressed graph.
+ *
+ * Same algorithm as @ref BFS(const uxgraph*, node, bfs_terminate, bfs_process_current, bfs_process_neighbour)
+ * on a compressed (CSR) unweighted graph. The nodes are visited in the
+ * same order as in the graph the compressed graph was built from.
+ *
+ * @param G The graph being traversed.
+ * @param source The node where the algorithm starts at.
+ * @param term The terminating function.
+ * @param proc_curr The function to process the currently visited node.
+ * @param proc_neigh The function to process each of the neighbours.
+ * @param ws The memory used by the traversal (see @ref workspace).
+ */
+void BFS
+(
+	const csr_uxgraph *G,
+	node source,
+	csr_bfs_terminate term =
+		[](const csr_uxgraph *, node, const std::vector<bool>&)
+		-> bool { return false; },
+	csr_bfs_process_current proc_curr =
+		[](const csr_uxgraph *, node, const std::vector<bool>&)
+		-> void {},
+	csr_bfs_process_neighbour proc_neigh =
+		[](const csr_uxgraph *, node, node, const std::vector<bool>&)
+		-> void {},
+	workspace<> *ws = nullptr
+);
+
+/* DIRECTION-OPTIMIZING BFS */
+
+/**
+ * @brief Direction-optimizing Breadth-First search.
+ *
+ * Computes the distance from @e source to every node reachable from it,
+ * level by level. Each level is expanded in one of two directions:
+ * - top-down: the neighbours of every node of the frontier are scanned
+ * and those not visited yet form the next frontier. This is what
+ * @ref BFS does.
+ * - bottom-up: every node not visited yet scans its in-neighbours until
+ * it finds one in the frontier, which is stored in a bitmap (see
+ * @ref workspace::node_bitmap).
+ *
+ * The top-down direction scans every edge leaving the frontier, most of
+ * which lead to visited nodes when the frontier is large. The bottom-up
+ * direction stops at the first parent found, but scans all unvisited
+ * nodes. The traversal starts top-down, switches to bottom-up when the
+ * edges leaving the frontier are more than a fraction (1/14) of the edges
+ * leaving the unvisited nodes, and back to top-down when the frontier
+ * shrinks below a fraction (1/24) of the nodes. On graphs of small
+ * diameter this avoids scanning most edges of the middle levels.
+ * The implementation follows the algorithm in [1].
+ *
+ * [1] Scott Beamer, Krste Asanović and David Patterson,
+ * "Direction-optimizing breadth-first search",
+ * Proceedings of SC'12, 2012.
+ *
+ * The bottom-up direction needs the in-neighbours of every node: @e R
+ * is the reverse of @e G (see @ref csr_uxgraph::init_reverse). For
+ * undirected graphs it can be @e G itself. If @e R is null the traversal
+ * is always top-down.
+ *
+ * The graphs can be of any type (@ref uxgraph, @ref csr_uxgraph, ...)
+ * that provides the methods @e n_nodes(), @e n_edges(), @e is_directed(),
+ * @e degree(u) and @e get_neighbours(u).
+ *
+ * @param G The graph being traversed.
+ * @param R The reverse of @e G, or null.
+ * @param source The node where the algorithm starts at.
+ * @param[out] ws The workspace where the distances are stored (see
+ * @ref workspace::distance). The nodes reachable from @e source are in
+ * @ref workspace::visited_nodes, in non-decreasing order of distance.
+ * The number of paths is not computed.
+ * @param target The traversal stops after the level in which this node
+ * is reached, if it is a node of @e G.
+ */
+template<class G_t, class R_t>
+void direction_optimizing_BFS
+(
+	const G_t *G,
+	const R_t *R,
+	node source,
+	workspace<>& ws,
+	node target = inf_t<node>()
+);
+
+/* MULTI-SOURCE BFS */
+
+/**
+ * @brief Bit-parallel Breadth-First search from several sources at once.
+ *
+ * Runs a Breadth-First search from each of up to 64 sources at the same
+ * time. Every node has a 64-bit mask of the sources that have reached it,
+ * and another one of the sources for which it is in the frontier: the
+ * @e i-th bit of a mask corresponds to the @e i-th source. Expanding a
+ * node to its neighbours propagates its whole frontier mask, so that a
+ * neighbourhood is scanned at most once per level for all the sources,
+ * instead of once per source. When the sources are close to one another,
+ * or the graph has a small diameter, most scans are shared.
+ *
+ * Instead of storing the distances, the traversal calls
+ * <pre>proc(v, d, mask)</pre>
+ * for every node @e v and every distance @e d such that @e v is at
+ * distance @e d of the sources of @e mask (and these are all the sources
+ * at that distance). Every pair (source, node) reachable from one another
+ * appears in exactly one call, and the calls are made in non-decreasing
+ * order of distance. The sources themselves are reported at distance 0.
+ * This way, the distances can be stored or accumulated without building
+ * the matrix of distances.
+ *
+ * The graph can be of any type (@ref uxgraph, @ref csr_uxgraph, ...)
+ * that provides the methods @e n_nodes() and @e get_neighbours(u).
+ * The implementation follows the algorithm in [1].
+ *
+ * [1] Manuel Then, Moritz Kaufmann, Fernando Chirigati, Tuan-Anh Hoang-Vu,
+ * Kien Pham, Alfons Kemper, Thomas Neumann and Huy T. Vo,
+ * "The more the merrier: efficient multi-source graph traversal",
+ * Proceedings of the VLDB Endowment, 8(4), 2014.
+ *
+ * @param G The graph being traversed.
+ * @param sources The nodes where the traversals start at.
+ * @param n_sources The number of sources: at most 64.
+ * @param proc The function that processes the distances.
+ * @param ws The memory used by the traversal: the masks are stored in
+ * @ref workspace::node_masks, and the nodes of the frontier in
+ * @ref workspace::node_buffer, which is enlarged to twice the number of
+ * nodes.
+ */
+template<class G_t, class proc_t>
+void multi_source_BFS
+(
+	const G_t *G,
+	const node *sources, size_t n_sources,
+	proc_t proc,
+	workspace<>& ws
+);
+
+/**
+ * @brief Breadth-First search from every node.
+ *
+ * Runs a @ref multi_source_BFS from every block of 64 consecutive nodes,
+ * and calls
+ * <pre>proc(s, v, d)</pre>
+ * for every pair of nodes @e s, @e v such that @e v is at distance @e d
+ * of @e s. The blocks are distributed among the threads: the calls for
+ * the same source @e s are all made by the same thread, in non-decreasing
+ * order of distance, so @e proc can write data of @e s without locking.
+ *
+ * @param G The graph being traversed.
+ * @param proc The function that processes the distances.
+ * @param n_threads Number of threads used to run the traversals (see
+ * @ref utils::n_threads_used).
+ */
+template<class G_t, class proc_t>
+void all_sources_BFS(const G_t *G, proc_t proc, size_t n_threads = 1);
+
+/**
+ * @brief Breadth-First search from a set of nodes.
+ *
+ * Runs a @ref multi_source_BFS from every block of 64 consecutive nodes
+ * of @e sources, and calls
+ * <pre>proc(tid, i, v, d)</pre>
+ * for every node @e v at distance @e d of the source @e sources[i], where
+ * @e tid is the thread making the call, in
+ * [0, @ref utils::n_threads_used(n_threads, n_blocks)) and @e n_blocks
+ * is the number of blocks. As in @ref all_sources_BFS, the calls for the
+ * same source are all made by the same thread, so @e proc can write data
+ * of @e i without locking, and data of @e v in memory of thread @e tid.
+ *
+ * @param G The graph being traversed.
+ * @param sources The nodes where the traversals start at.
+ * @param proc The function that processes the distances.
+ * @param n_threads Number of threads used to run the traversals (see
+ * @ref utils::n_threads_used).
+ */
+template<class G_t, class proc_t>
+void sources_BFS
+(const G_t *G, const std::vector<node>& sources, proc_t proc, size_t n_threads = 1);
+
+/* BIDIRECTIONAL BFS */
+
+/**
+ * @brief Bidirectional Breadth-First search.
+ *
+ * Finds the distance from @e source to @e target with two traversals: a
+ * forward one from @e source on @e G and a backward one from @e target on
+ * @e R, the reverse of @e G. The level of the traversal with the smaller
+ * frontier is expanded each time, and the search stops as soon as an
+ * edge (u,v) joins a node u reached by the forward traversal with a node
+ * v reached by the backward one. Before that, the two sets of nodes
+ * reached are disjoint, so that the first such edge found gives a shortest
+ * path. When the target is at distance @e d, each traversal only reaches
+ * the nodes at distance about @e d/2 of its origin, which on large graphs
+ * are far fewer than the nodes at distance @e d of the source.
+ *
+ * The graphs can be of any type (@ref uxgraph, @ref csr_uxgraph, ...)
+ * that provides the methods @e n_nodes() and @e get_neighbours(u). For
+ * undirected graphs @e R can be @e G itself. For directed graphs, see
+ * @ref csr_uxgraph::init_reverse.
+ *
+ * @param G The graph being traversed.
+ * @param R The reverse of @e G.
+ * @param source The node where the path starts at.
+ * @param target The node where the path ends at.
+ * @param[out] ws_forward The memory of the forward traversal. The
+ * distance from @e source and the parent of each node reached are left
+ * in it (see @ref workspace::distance and @ref workspace::parent).
+ * @param[out] ws_backward The memory of the backward traversal. The
+ * distance to @e target and the next node towards it are left in it.
+ * @param[out] u The last node of the forward part of the path found.
+ * @param[out] v The first node of the backward part of the path found.
+ * A shortest path is made of the path from @e source to @e u (following
+ * the parents in @e ws_forward backwards), the edge (u,v), and the path
+ * from @e v to @e target (following the parents in @e ws_backward). If
+ * @e source and @e target are the same node, @e u and @e v are that node.
+ * @return Returns the distance from @e source to @e target, or infinite
+ * if @e target is not reachable from @e source.
+ */
+template<class G_t, class R_t>
+_new_ bidirectional_BFS
+(
+	const G_t *G,
+	const R_t *R,
+	node source, node target,
+	workspace<>& ws_forward, workspace<>& ws_backward,
+	node& u, node& v
 );
 
 } // -- namespace bfs
 } // -- namespace traversal
 } // -- namespace lgraph
 
+#include <lgraph/graph_traversal/bfs_visitor.cpp>
+#include <lgraph/graph_traversal/bfs_direction.cpp>
+#include <lgraph/graph_traversal/bfs_multi_source.cpp>
+#include <lgraph/graph_traversal/bfs_bidirectional.cpp>
+
@@ -0,0 +1,124 @@
+/*********************************************************************
+ * lgraph
+ * Copyright (C) 2018-2019 Lluís Alemany Puig
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ * 
+ * Contact: Lluís Alemany Puig (lluis.alemany.puig@gmail.com)
+ * 
+ ********************************************************************/
+
+
+#include <lgraph/graph_traversal/bfs.hpp>
+
+// C++ includes
+#include <vector>
+
+namespace lgraph {
+namespace traversal {
+namespace bfs {
+
+// Expands the level [begin, end) of the traversal of X with memory W. The
+// nodes reached are appended to the queue at position 'tail'. Returns true
+// if an edge (a,b) of X joins a node 'a' of the level with a node 'b'
+// reached by the other traversal, whose memory is 'other'.
+template<class X_t>
+inline bool bidirectional_BFS_level
+(
+	const X_t *X, workspace<>& W, const workspace<>& other,
+	size_t begin, size_t end, size_t& tail,
+	node& a, node& b
+)
+{
+	std::vector<node>& Q = W.node_buffer();
+	for (size_t i = begin; i < end; ++i) {
+		const node x = Q[i];
+		const _new_ d = W.distance(x) + 1;
+
+		for (node y : X->get_neighbours(x)) {
+			if (other.is_visited(y)) {
+				a = x;
+				b = y;
+				return true;
+			}
+			if (not W.is_visited(y)) {
+				W.visit(y);
+				W.set_distance(y, d);
+				W.set_parent(y, x);
+				Q[tail++] = y;
+			}
+		}
+	}
+	return false;
+}
+
+template<class G_t, class R_t>
+_new_ bidirectional_BFS
+(
+	const G_t *G,
+	const R_t *R,
+	node source, node target,
+	workspace<>& Wf, workspace<>& Wb,
+	node& u, node& v
+)
+{
+	const size_t N = G->n_nodes();
+	Wf.init(N, true);
+	Wb.init(N, true);
+
+	Wf.visit(source);
+	Wf.set_distance(source, 0);
+	Wb.visit(target);
+	Wb.set_distance(target, 0);
+
+	u = v = source;
+	if (source == target) {
+		return 0;
+	}
+
+	// the queue of each traversal, where the current
+	// level is the range [begin, end)
+	Wf.node_buffer()[0] = source;
+	Wb.node_buffer()[0] = target;
+	size_t begin_f = 0, end_f = 1;
+	size_t begin_b = 0, end_b = 1;
+
+	while (begin_f < end_f and begin_b < end_b) {
+		// expand the smallest frontier
+		if (end_f - begin_f <= end_b - begin_b) {
+			size_t tail = end_f;
+			if (bidirectional_BFS_level(G, Wf, Wb, begin_f, end_f, tail, u, v)) {
+				return Wf.distance(u) + 1 + Wb.distance(v);
+			}
+			begin_f = end_f;
+			end_f = tail;
+		}
+		else {
+			// an edge (a,b) of R is the edge (b,a) of G
+			size_t tail = end_b;
+			if (bidirectional_BFS_level(R, Wb, Wf, begin_b, end_b, tail, v, u)) {
+				return Wf.distance(u) + 1 + Wb.distance(v);
+			}
+			begin_b = end_b;
+			end_b = tail;
+		}
+	}
+
+	// one of the traversals has reached all the nodes it could
+	return inf_t<_new_>();
+}
+
+} // -- namespace bfs
+} // -- namespace traversal
+} // -- namespace lgraph
@@ -0,0 +1,146 @@
+/*********************************************************************
+ * lgraph
+ * Copyright (C) 2018-2019 Lluís Alemany Puig
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ * 
+ * Contact: Lluís Alemany Puig (lluis.alemany.puig@gmail.com)
+ * 
+ ********************************************************************/
+
+
+#include <lgraph/graph_traversal/bfs.hpp>
+
+// C includes
+#include <stdint.h>
+
+// C++ includes
+#include <algorithm>
+#include <vector>
+
+namespace lgraph {
+namespace traversal {
+namespace bfs {
+
+template<class G_t, class R_t>
+void direction_optimizing_BFS
+(
+	const G_t *G,
+	const R_t *R,
+	node source,
+	workspace<>& W,
+	node target
+)
+{
+	// parameters of the heuristic to choose the direction
+	static const size_t alpha = 14;
+	static const size_t beta = 24;
+
+	const size_t N = G->n_nodes();
+	W.init(N, true);
+
+	// the nodes are added to the buffer level by level:
+	// the frontier is always the range [begin, end)
+	std::vector<node>& Q = W.node_buffer();
+	std::vector<uint64_t>& frontier = W.node_bitmap();
+	size_t begin = 0;
+	size_t end = 0;
+	size_t tail = 0;
+
+	W.visit(source);
+	W.set_distance(source, 0);
+	Q[tail++] = source;
+
+	// edges leaving the frontier, and leaving the unvisited nodes
+	size_t edges_frontier = G->degree(source);
+	size_t edges_unvisited =
+		(G->is_directed() ? 1 : 2)*G->n_edges() - edges_frontier;
+
+	bool bottom_up = false;
+	size_t prev_frontier_size = 0;
+	_new_ d = 0;
+
+	while (tail > end) {
+		begin = end;
+		end = tail;
+		if (target < N and W.is_visited(target)) {
+			return;
+		}
+
+		const size_t frontier_size = end - begin;
+		if (R == nullptr) {
+			bottom_up = false;
+		}
+		else if (not bottom_up) {
+			bottom_up = edges_frontier > edges_unvisited/alpha;
+		}
+		else {
+			// go back to top-down only when the frontier shrinks
+			bottom_up =
+				frontier_size >= prev_frontier_size or
+				frontier_size >= N/beta;
+		}
+		prev_frontier_size = frontier_size;
+
+		++d;
+		edges_frontier = 0;
+
+		if (not bottom_up) {
+			for (size_t i = begin; i < end; ++i) {
+				for (node v : G->get_neighbours(Q[i])) {
+					if (not W.is_visited(v)) {
+						W.visit(v);
+						W.set_distance(v, d);
+						Q[tail++] = v;
+						edges_frontier += G->degree(v);
+					}
+				}
+			}
+		}
+		else {
+			for (size_t i = begin; i < end; ++i) {
+				frontier[Q[i] >> 6] |= static_cast<uint64_t>(1) << (Q[i] & 63);
+			}
+
+			// every unvisited node looks for a parent in the frontier
+			for (node v = 0; v < N; ++v) {
+				if (W.is_visited(v)) {
+					continue;
+				}
+				for (node u : R->get_neighbours(v)) {
+					if ((frontier[u >> 6] >> (u & 63)) & 1) {
+						W.visit(v);
+						W.set_distance(v, d);
+						Q[tail++] = v;
+						edges_frontier += G->degree(v);
+						break;
+					}
+				}
+			}
+
+			// leave the bitmap as it was found
+			for (size_t i = begin; i < end; ++i) {
+				frontier[Q[i] >> 6] = 0;
+			}
+		}
+
+		// the degrees are only an estimate of the work
+		// left: do not let the difference wrap around
+		edges_unvisited -= std::min(edges_unvisited, edges_frontier);
+	}
+}
+
+} // -- namespace bfs
+} // -- namespace traversal
+} // -- namespace lgraph
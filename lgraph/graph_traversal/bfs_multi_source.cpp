@@ -0,0 +1,190 @@
+/*********************************************************************
+ * lgraph
+ * Copyright (C) 2018-2019 Lluís Alemany Puig
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ * 
+ * Contact: Lluís Alemany Puig (lluis.alemany.puig@gmail.com)
+ * 
+ ********************************************************************/
+
+
+#include <lgraph/graph_traversal/bfs.hpp>
+
+// C includes
+#include <assert.h>
+#include <stdint.h>
+
+// C++ includes
+#include <algorithm>
+#include <vector>
+
+// lgraph includes
+#include <lgraph/utils/parallel.hpp>
+
+namespace lgraph {
+namespace traversal {
+namespace bfs {
+
+template<class G_t, class proc_t>
+void multi_source_BFS
+(
+	const G_t *G,
+	const node *sources, size_t n_sources,
+	proc_t proc,
+	workspace<>& W
+)
+{
+	assert(n_sources <= 64);
+
+	const size_t N = G->n_nodes();
+	W.init(N);
+
+	// three masks per node: the sources that reached it, the
+	// sources in whose frontier it is, and the sources that
+	// reach it in the next level
+	std::vector<uint64_t>& masks = W.node_masks();
+	masks.assign(3*N, 0);
+	uint64_t *seen = masks.data();
+	uint64_t *frontier = seen + N;
+	uint64_t *next = frontier + N;
+
+	// the nodes of the frontier and the nodes reached in the next
+	// level: the cost of a level depends only on these nodes and
+	// their neighbours, and not on the size of the graph
+	std::vector<node>& Q = W.node_buffer();
+	if (Q.size() < 2*N) {
+		Q.resize(2*N);
+	}
+	node *cur = Q.data();
+	node *nxt = cur + N;
+	size_t n_cur = 0;
+
+	for (size_t i = 0; i < n_sources; ++i) {
+		const node s = sources[i];
+		if (frontier[s] == 0) {
+			cur[n_cur++] = s;
+		}
+		const uint64_t bit = static_cast<uint64_t>(1) << i;
+		seen[s] |= bit;
+		frontier[s] |= bit;
+	}
+	for (size_t i = 0; i < n_cur; ++i) {
+		proc(cur[i], static_cast<_new_>(0), frontier[cur[i]]);
+	}
+
+	_new_ d = 0;
+	while (n_cur > 0) {
+		++d;
+
+		// propagate the frontier of every node to its neighbours
+		size_t n_nxt = 0;
+		for (size_t i = 0; i < n_cur; ++i) {
+			const node u = cur[i];
+			const uint64_t f = frontier[u];
+			frontier[u] = 0;
+
+			for (node v : G->get_neighbours(u)) {
+				if (next[v] == 0) {
+					nxt[n_nxt++] = v;
+				}
+				next[v] |= f;
+			}
+		}
+
+		// keep only the sources that had not reached the nodes yet
+		n_cur = 0;
+		for (size_t i = 0; i < n_nxt; ++i) {
+			const node v = nxt[i];
+			const uint64_t f = next[v] & ~seen[v];
+			next[v] = 0;
+			if (f != 0) {
+				seen[v] |= f;
+				frontier[v] = f;
+				cur[n_cur++] = v;
+				proc(v, d, f);
+			}
+		}
+	}
+}
+
+template<class G_t, class proc_t>
+void all_sources_BFS(const G_t *G, proc_t proc, size_t n_threads) {
+	const size_t N = G->n_nodes();
+	const size_t n_blocks = (N + 63)/64;
+
+	// memory of every thread reused by all its traversals
+	const size_t n_used = utils::n_threads_used(n_threads, n_blocks);
+	std::vector<workspace<> > W(n_used);
+	std::vector<std::vector<node> > sources(n_used, std::vector<node>(64));
+
+	utils::parallel_for(n_blocks, n_threads,
+	[&](size_t tid, size_t b) -> void
+	{
+		const node first = 64*b;
+		const size_t k = std::min(static_cast<size_t>(64), N - first);
+		for (size_t i = 0; i < k; ++i) {
+			sources[tid][i] = first + i;
+		}
+
+		multi_source_BFS(G, sources[tid].data(), k,
+		[&](node v, _new_ d, uint64_t mask) -> void
+		{
+			// one call per source in the mask
+			while (mask != 0) {
+				proc(first + static_cast<node>(__builtin_ctzll(mask)), v, d);
+				mask &= mask - 1;
+			}
+		},
+		W[tid]
+		);
+	}
+	);
+}
+
+template<class G_t, class proc_t>
+void sources_BFS
+(const G_t *G, const std::vector<node>& sources, proc_t proc, size_t n_threads)
+{
+	const size_t n_sources = sources.size();
+	const size_t n_blocks = (n_sources + 63)/64;
+
+	// memory of every thread reused by all its traversals
+	const size_t n_used = utils::n_threads_used(n_threads, n_blocks);
+	std::vector<workspace<> > W(n_used);
+
+	utils::parallel_for(n_blocks, n_threads,
+	[&](size_t tid, size_t b) -> void
+	{
+		const size_t first = 64*b;
+		const size_t k = std::min(static_cast<size_t>(64), n_sources - first);
+
+		multi_source_BFS(G, sources.data() + first, k,
+		[&](node v, _new_ d, uint64_t mask) -> void
+		{
+			// one call per source in the mask
+			while (mask != 0) {
+				proc(tid, first + static_cast<size_t>(__builtin_ctzll(mask)), v, d);
+				mask &= mask - 1;
+			}
+		},
+		W[tid]
+		);
+	}
+	);
+}
+
+} // -- namespace bfs
+} // -- namespace traversal
+} // -- namespace lgraph
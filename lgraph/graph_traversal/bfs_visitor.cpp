@@ -0,0 +1,83 @@
+/*********************************************************************
+ * lgraph
+ * Copyright (C) 2018-2019 Lluís Alemany Puig
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ * 
+ * Contact: Lluís Alemany Puig (lluis.alemany.puig@gmail.com)
+ * 
+ ********************************************************************/
+
+
+#include <lgraph/graph_traversal/bfs.hpp>
+
+// C++ includes
+#include <vector>
+
+namespace lgraph {
+namespace traversal {
+namespace bfs {
+
+template<class G_t, class term_t, class curr_t, class neigh_t>
+void BFS
+(
+	const G_t *G,
+	node source,
+	term_t terminate,
+	curr_t proc_curr,
+	neigh_t proc_neig,
+	workspace<> *ws
+)
+{
+	// use the caller's memory, if any
+	workspace<> local_ws;
+	workspace<>& W = (ws == nullptr ? local_ws : *ws);
+	W.init(G->n_nodes());
+
+	const std::vector<bool>& vis = W.visited();
+
+	// every node is pushed at most once: the queue
+	// fits in a buffer of as many nodes as the graph
+	std::vector<node>& Q = W.node_buffer();
+	size_t head = 0;
+	size_t tail = 0;
+
+	W.visit(source);
+	Q[tail++] = source;
+	bool term = false;
+
+	while (head < tail and not term) {
+		node u = Q[head++];
+
+		proc_curr(G, u, vis);
+
+		if (terminate(G, u, vis)) {
+			term = true;
+		}
+		else {
+			for (node v : G->get_neighbours(u)) {
+				proc_neig(G, u, v, vis);
+
+				if (not vis[v]) {
+					Q[tail++] = v;
+					W.visit(v);
+				}
+			}
+		}
+	}
+}
+
+} // -- namespace bfs
+} // -- namespace traversal
+} // -- namespace lgraph
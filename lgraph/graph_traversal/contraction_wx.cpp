@@ -0,0 +1,492 @@
+/*********************************************************************
+ * lgraph
+ * Copyright (C) 2018-2019 Lluís Alemany Puig
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ * 
+ * Contact: Lluís Alemany Puig (lluis.alemany.puig@gmail.com)
+ * 
+ ********************************************************************/
+
+
+#include <lgraph/graph_traversal/traversal_wx.hpp>
+
+// C includes
+#include <assert.h>
+#include <stdint.h>
+
+// C++ includes
+#include <algorithm>
+#include <functional>
+#include <queue>
+#include <utility>
+#include <vector>
+
+// lgraph includes
+#include <lgraph/graph_traversal/dijkstra_queues.hpp>
+
+namespace lgraph {
+namespace traversal {
+
+/* CONTRACTION */
+
+// Maximum number of nodes settled by a witness search. A search that
+// stops before finding a witness adds a shortcut that may not be needed,
+// which makes the hierarchy larger, but never wrong.
+const size_t ch_witness_limit = 500;
+
+// The edges of the nodes not contracted yet, with the shortcuts added.
+template<class T>
+using ch_adjacency =
+	std::vector<std::vector<typename contraction_hierarchy<T>::edge> >;
+
+// Adds the edge (u,v) to the list of u, or lowers the weight of the edge
+// already there if the new one is lighter.
+template<class T>
+inline void ch_add_edge(ch_adjacency<T>& adj, node u, node v, const T& w, node middle) {
+	for (auto& e : adj[u]) {
+		if (e.neighbour == v) {
+			if (w < e.weight) {
+				e.weight = w;
+				e.middle = middle;
+			}
+			return;
+		}
+	}
+	adj[u].push_back({v, w, middle});
+}
+
+// Removes the edge (u,v) from the list of u.
+template<class T>
+inline void ch_remove_edge(ch_adjacency<T>& adj, node u, node v) {
+	auto& Au = adj[u];
+	for (size_t i = 0; i < Au.size(); ++i) {
+		if (Au[i].neighbour == v) {
+			Au[i] = Au.back();
+			Au.pop_back();
+			return;
+		}
+	}
+}
+
+// Dijkstra's algorithm from 'source' on the nodes not contracted yet,
+// except 'avoid', leaving the distances in 'W'. It stops at distance
+// 'limit' or after settling ch_witness_limit nodes.
+template<class T>
+inline void ch_witness_search(
+	const ch_adjacency<T>& out, node source, node avoid, const T& limit,
+	workspace<T>& W
+)
+{
+	W.init(out.size(), true);
+	dijkstra::default_queue<T> Q(W);
+
+	W.set_distance(source, 0);
+	Q.push(0, source);
+
+	size_t settled = 0;
+	while (not Q.empty()) {
+		const node u = Q.top().second;
+		Q.pop();
+
+		if (W.is_visited(u)) {
+			continue;
+		}
+		W.visit(u);
+
+		const T d_u = W.distance(u);
+		if (d_u > limit or ++settled > ch_witness_limit) {
+			return;
+		}
+
+		for (const auto& e : out[u]) {
+			const T d = d_u + e.weight;
+			if (e.neighbour != avoid and d < W.distance(e.neighbour)) {
+				W.set_distance(e.neighbour, d);
+				Q.push(d, e.neighbour);
+			}
+		}
+	}
+}
+
+// A shortcut (u,x) and its weight.
+template<class T>
+using ch_shortcut = std::pair<std::pair<node, node>, T>;
+
+// Finds the shortcuts needed between the neighbours of 'v' to contract
+// it. In undirected graphs only 'out' is used.
+template<class T>
+inline void ch_shortcuts(
+	const ch_adjacency<T>& out, const ch_adjacency<T>& in, bool directed, node v,
+	workspace<T>& W, std::vector<ch_shortcut<T> >& shortcuts
+)
+{
+	const auto& Ov = out[v];
+	const auto& Iv = (directed ? in[v] : out[v]);
+
+	shortcuts.clear();
+	for (size_t i = 0; i < Iv.size(); ++i) {
+		const node u = Iv[i].neighbour;
+		// in undirected graphs (u,x) and (x,u) are the same shortcut
+		const size_t first_x = (directed ? 0 : i + 1);
+
+		T limit = 0;
+		bool any = false;
+		for (size_t j = first_x; j < Ov.size(); ++j) {
+			if (Ov[j].neighbour != u) {
+				limit = std::max(limit, Iv[i].weight + Ov[j].weight);
+				any = true;
+			}
+		}
+		if (not any) {
+			continue;
+		}
+
+		ch_witness_search(out, u, v, limit, W);
+		for (size_t j = first_x; j < Ov.size(); ++j) {
+			const node x = Ov[j].neighbour;
+			const T w = Iv[i].weight + Ov[j].weight;
+			if (x != u and W.distance(x) > w) {
+				// the path through v is the only shortest one found
+				shortcuts.push_back(std::make_pair(std::make_pair(u, x), w));
+			}
+		}
+	}
+}
+
+// Contracts 'v': adds its shortcuts (see ch_shortcuts) and removes 'v'
+// from the lists of its neighbours.
+template<class T>
+inline void ch_contract(
+	ch_adjacency<T>& out, ch_adjacency<T>& in, bool directed, node v,
+	const std::vector<ch_shortcut<T> >& shortcuts
+)
+{
+	for (const auto& s : shortcuts) {
+		const node u = s.first.first;
+		const node x = s.first.second;
+		ch_add_edge(out, u, x, s.second, v);
+		ch_add_edge((directed ? in : out), x, u, s.second, v);
+	}
+	for (const auto& e : (directed ? in[v] : out[v])) {
+		ch_remove_edge<T>(out, e.neighbour, v);
+	}
+	if (directed) {
+		for (const auto& e : out[v]) {
+			ch_remove_edge<T>(in, e.neighbour, v);
+		}
+	}
+}
+
+// Priority of the contraction of 'v': the number of shortcuts needed
+// minus the number of edges removed (the edge difference), plus the
+// number of neighbours already contracted, which spreads the contraction
+// uniformly over the graph. The smallest is contracted first.
+template<class T>
+inline int64_t ch_priority(
+	const ch_adjacency<T>& out, const ch_adjacency<T>& in, bool directed, node v,
+	size_t n_shortcuts, const std::vector<size_t>& contracted_neighbours
+)
+{
+	const size_t removed = out[v].size() + (directed ? in[v].size() : 0);
+	return
+		static_cast<int64_t>(n_shortcuts) - static_cast<int64_t>(removed) +
+		static_cast<int64_t>(contracted_neighbours[v]);
+}
+
+// Stores the lists of edges 'lists' in the layout of a
+// contraction_hierarchy: offsets and contiguous edges.
+template<class T>
+inline void ch_compress(
+	const ch_adjacency<T>& lists,
+	std::vector<size_t>& offsets, std::vector<typename contraction_hierarchy<T>::edge>& edges
+)
+{
+	const size_t N = lists.size();
+	offsets.assign(N + 1, 0);
+	for (node u = 0; u < N; ++u) {
+		offsets[u + 1] = offsets[u] + lists[u].size();
+	}
+	edges.clear();
+	edges.reserve(offsets[N]);
+	for (node u = 0; u < N; ++u) {
+		edges.insert(edges.end(), lists[u].begin(), lists[u].end());
+	}
+}
+
+template<class T, class G_t>
+inline void generic_wxcontract(const G_t *G, contraction_hierarchy<T>& ch) {
+	const size_t N = G->n_nodes();
+	const bool directed = G->is_directed();
+
+	ch_adjacency<T> out(N), in(directed ? N : 0);
+	for (node u = 0; u < N; ++u) {
+		const auto& Nu = G->get_neighbours(u);
+		const auto& wu = G->get_weights(u);
+		for (size_t i = 0; i < Nu.size(); ++i) {
+			if (Nu[i] == u) {
+				continue;
+			}
+			ch_add_edge(out, u, Nu[i], wu[i], N);
+			if (directed) {
+				ch_add_edge(in, Nu[i], u, wu[i], N);
+			}
+		}
+	}
+
+	workspace<T> W;
+	std::vector<size_t> contracted_neighbours(N, 0);
+	std::vector<ch_shortcut<T> > shortcuts;
+
+	// lazy updates: the priority of a node is recomputed when it is
+	// at the top of the queue, and it is contracted only if it still
+	// is the smallest
+	typedef std::pair<int64_t, node> ch_node;
+	std::priority_queue<ch_node, std::vector<ch_node>, std::greater<ch_node> > Q;
+	for (node u = 0; u < N; ++u) {
+		ch_shortcuts(out, in, directed, u, W, shortcuts);
+		Q.push(std::make_pair(
+			ch_priority<T>(out, in, directed, u, shortcuts.size(), contracted_neighbours), u
+		));
+	}
+
+	std::vector<size_t> rank(N);
+	ch_adjacency<T> up(N), down(directed ? N : 0);
+	size_t next_rank = 0;
+
+	while (not Q.empty()) {
+		const node v = Q.top().second;
+		Q.pop();
+
+		ch_shortcuts(out, in, directed, v, W, shortcuts);
+		const int64_t p =
+			ch_priority<T>(out, in, directed, v, shortcuts.size(), contracted_neighbours);
+		if (not Q.empty() and p > Q.top().first) {
+			Q.push(std::make_pair(p, v));
+			continue;
+		}
+
+		ch_contract(out, in, directed, v, shortcuts);
+		rank[v] = next_rank++;
+
+		// all the neighbours of v are of higher rank
+		for (const auto& e : out[v]) {
+			++contracted_neighbours[e.neighbour];
+		}
+		if (directed) {
+			for (const auto& e : in[v]) {
+				++contracted_neighbours[e.neighbour];
+			}
+			down[v] = std::move(in[v]);
+		}
+		up[v] = std::move(out[v]);
+	}
+
+	std::vector<size_t> up_offsets, down_offsets;
+	std::vector<typename contraction_hierarchy<T>::edge> up_edges, down_edges;
+	ch_compress<T>(up, up_offsets, up_edges);
+	if (directed) {
+		ch_compress<T>(down, down_offsets, down_edges);
+	}
+
+	ch.init(
+		directed, std::move(rank),
+		std::move(up_offsets), std::move(up_edges),
+		std::move(down_offsets), std::move(down_edges)
+	);
+}
+
+/* QUERIES */
+
+// Settles the next node of one of the traversals of a query, with queue
+// Q and memory W, and relaxes its upward edges if 'upward' is true, or its
+// downward edges otherwise. The node is stalled, and its edges are not
+// relaxed, if it is reached with a shorter distance through an edge in
+// the other direction from a node of higher rank (stall-on-demand): its
+// distance is not the shortest, so no shortest path goes up the hierarchy
+// through it. The shortest path found through a node settled by both
+// traversals, of length 'mu', and the node, 'meet', are updated.
+template<class T, class queue_t>
+inline void ch_query_step(
+	const contraction_hierarchy<T>& ch, bool upward,
+	queue_t& Q, workspace<T>& W, const workspace<T>& other,
+	T& mu, node& meet
+)
+{
+	typedef typename contraction_hierarchy<T>::edge edge;
+
+	const node u = Q.top().second;
+	Q.pop();
+
+	if (W.is_visited(u)) {
+		return;
+	}
+	W.visit(u);
+
+	const T d_u = W.distance(u);
+	const T d_other = other.distance(u);
+	if (d_other != inf_t<T>() and d_u + d_other < mu) {
+		mu = d_u + d_other;
+		meet = u;
+	}
+
+	const edge *stall_begin = (upward ? ch.down_begin(u) : ch.up_begin(u));
+	const edge *stall_end = (upward ? ch.down_end(u) : ch.up_end(u));
+	for (const edge *e = stall_begin; e != stall_end; ++e) {
+		const T d_v = W.distance(e->neighbour);
+		if (d_v != inf_t<T>() and d_v + e->weight < d_u) {
+			return;
+		}
+	}
+
+	const edge *begin = (upward ? ch.up_begin(u) : ch.down_begin(u));
+	const edge *end = (upward ? ch.up_end(u) : ch.down_end(u));
+	for (const edge *e = begin; e != end; ++e) {
+		const T d = d_u + e->weight;
+		if (d < W.distance(e->neighbour)) {
+			W.set_distance(e->neighbour, d);
+			W.set_parent(e->neighbour, u);
+			Q.push(d, e->neighbour);
+		}
+	}
+}
+
+// The query of [1]: a search from 'source' on the upward edges and a
+// search from 'target' on the downward edges. Every traversal stops when
+// its next distance is not shorter than the shortest path found, 'mu',
+// whose node of highest rank is 'meet'.
+template<class T>
+inline T ch_query(
+	const contraction_hierarchy<T>& ch, node source, node target,
+	workspace<T>& Wf, workspace<T>& Wb, node& meet
+)
+{
+	assert(source < ch.n_nodes());
+	assert(target < ch.n_nodes());
+
+	const size_t N = ch.n_nodes();
+	Wf.init(N, true);
+	Wb.init(N, true);
+
+	Wf.set_distance(source, 0);
+	Wb.set_distance(target, 0);
+
+	T mu = inf_t<T>();
+	meet = N;
+
+	dijkstra::default_queue<T> Qf(Wf), Qb(Wb);
+	Qf.push(0, source);
+	Qb.push(0, target);
+
+	while (true) {
+		const bool open_f = not Qf.empty() and Qf.top().first < mu;
+		const bool open_b = not Qb.empty() and Qb.top().first < mu;
+		if (not open_f and not open_b) {
+			break;
+		}
+
+		// the traversal whose next node is closer to its origin advances
+		if (open_f and (not open_b or Qf.top().first <= Qb.top().first)) {
+			ch_query_step(ch, true, Qf, Wf, Wb, mu, meet);
+		}
+		else {
+			ch_query_step(ch, false, Qb, Wb, Wf, mu, meet);
+		}
+	}
+	return mu;
+}
+
+template<class T>
+T wxdistance_contracted(
+	const contraction_hierarchy<T>& ch, node source, node target,
+	workspace<T> *ws_forward, workspace<T> *ws_backward
+)
+{
+	workspace<T> local_wf, local_wb;
+	workspace<T>& Wf = (ws_forward == nullptr ? local_wf : *ws_forward);
+	workspace<T>& Wb = (ws_backward == nullptr ? local_wb : *ws_backward);
+
+	node meet;
+	return ch_query(ch, source, target, Wf, Wb, meet);
+}
+
+template<class T>
+void wxpath_contracted(
+	const contraction_hierarchy<T>& ch, node source, node target,
+	node_path<T>& p,
+	workspace<T> *ws_forward, workspace<T> *ws_backward
+)
+{
+	workspace<T> local_wf, local_wb;
+	workspace<T>& Wf = (ws_forward == nullptr ? local_wf : *ws_forward);
+	workspace<T>& Wb = (ws_backward == nullptr ? local_wb : *ws_backward);
+
+	node meet;
+	const T d = ch_query(ch, source, target, Wf, Wb, meet);
+
+	p.empty();
+	if (d == inf_t<T>()) {
+		return;
+	}
+
+	// the nodes of the hierarchy from the source up to 'meet'...
+	const node N = ch.n_nodes();
+	std::vector<node> up_path;
+	for (node l = meet; l != N; l = Wf.parent(l)) {
+		up_path.push_back(l);
+	}
+
+	// ... unpacked into the edges of the graph, and
+	// then down from 'meet' to the target, unpacked
+	p.add_node(source);
+	for (size_t i = up_path.size() - 1; i > 0; --i) {
+		ch.unpack(up_path[i], up_path[i - 1], p);
+	}
+	for (node l = meet; l != target; l = Wb.parent(l)) {
+		ch.unpack(l, Wb.parent(l), p);
+	}
+
+	// With edges of weight 0, the searches may meet past a cycle of
+	// length 0, which repeats nodes: every node is followed by what
+	// follows its last occurrence.
+	const std::vector<node> walk = p.get_nodes();
+	std::vector<std::pair<node, size_t> > last(walk.size());
+	for (size_t i = 0; i < walk.size(); ++i) {
+		last[i] = std::make_pair(walk[i], i);
+	}
+	std::sort(last.begin(), last.end());
+
+	p.empty();
+	for (size_t i = 0; i < walk.size(); ++i) {
+		const auto it = std::upper_bound(
+			last.begin(), last.end(), std::make_pair(walk[i], walk.size())
+		);
+		i = (it - 1)->second;
+		p.add_node(walk[i]);
+	}
+	p.set_length(d);
+}
+
+template<class T>
+void wxcontract(const wxgraph<T> *G, contraction_hierarchy<T>& ch) {
+	generic_wxcontract(G, ch);
+}
+
+template<class T>
+void wxcontract(const csr_wxgraph<T> *G, contraction_hierarchy<T>& ch) {
+	generic_wxcontract(G, ch);
+}
+
+} // -- namespace traversal
+} // -- namespace lgraph
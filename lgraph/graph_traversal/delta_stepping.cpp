@@ -0,0 +1,287 @@
+/*********************************************************************
+ * lgraph
+ * Copyright (C) 2018-2019 Lluís Alemany Puig
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ * 
+ * Contact: Lluís Alemany Puig (lluis.alemany.puig@gmail.com)
+ * 
+ ********************************************************************/
+
+
+#include <lgraph/graph_traversal/delta_stepping.hpp>
+
+// C++ includes
+#include <algorithm>
+#include <atomic>
+
+// lgraph includes
+#include <lgraph/utils/parallel.hpp>
+
+namespace lgraph {
+namespace traversal {
+
+// Number of nodes of a frontier relaxed by a task.
+const size_t delta_stepping_chunk = 256;
+
+// Largest weight and number of edges of a graph.
+template<class T, class G_t>
+inline void delta_stepping_scan
+(const G_t *G, size_t n_threads, T& max_w, size_t& n_edges)
+{
+	const size_t N = G->n_nodes();
+	const size_t n_tasks = (N + delta_stepping_chunk - 1)/delta_stepping_chunk;
+	n_threads = utils::n_threads_used(n_threads, n_tasks);
+
+	std::vector<T> thread_max(n_threads, 0);
+	std::vector<size_t> thread_edges(n_threads, 0);
+	utils::parallel_for(n_tasks, n_threads,
+	[&](size_t tid, size_t t) -> void
+	{
+		const node last = std::min(N, (t + 1)*delta_stepping_chunk);
+		for (node u = t*delta_stepping_chunk; u < last; ++u) {
+			const auto& wu = G->get_weights(u);
+			for (size_t i = 0; i < wu.size(); ++i) {
+				thread_max[tid] = std::max(thread_max[tid], wu[i]);
+			}
+			thread_edges[tid] += wu.size();
+		}
+	}
+	);
+
+	max_w = 0;
+	n_edges = 0;
+	for (size_t tid = 0; tid < n_threads; ++tid) {
+		max_w = std::max(max_w, thread_max[tid]);
+		n_edges += thread_edges[tid];
+	}
+}
+
+// Largest weight divided by the average degree.
+template<class T>
+inline T delta_stepping_width(const T& max_w, size_t n_nodes, size_t n_edges) {
+	if (n_edges == 0) {
+		return 1;
+	}
+	const T delta = static_cast<T>(max_w/(static_cast<double>(n_edges)/n_nodes));
+	return (delta > 0 ? delta : 1);
+}
+
+template<class T, class G_t>
+T delta_stepping_width(const G_t *G, size_t n_threads) {
+	T max_w;
+	size_t n_edges;
+	delta_stepping_scan(G, n_threads, max_w, n_edges);
+	return delta_stepping_width(max_w, G->n_nodes(), n_edges);
+}
+
+template<class T, class G_t>
+void delta_stepping
+(
+	const G_t *G, node source, std::vector<T>& ds,
+	T delta, size_t n_threads
+)
+{
+	const size_t N = G->n_nodes();
+
+	T max_w;
+	size_t n_edges;
+	delta_stepping_scan(G, n_threads, max_w, n_edges);
+	if (not (delta > 0)) {
+		delta = delta_stepping_width(max_w, N, n_edges);
+	}
+	n_threads = utils::n_threads_used(n_threads, N);
+
+	// tentative distances
+	std::vector<std::atomic<T> > dist(N);
+	for (node u = 0; u < N; ++u) {
+		dist[u].store(inf_t<T>(), std::memory_order_relaxed);
+	}
+
+	// The tentative distances of the nodes in the buckets are at most
+	// max_w away from the smallest one, so only a window of n_buckets
+	// buckets, starting at the current bucket i, is used at any time, and
+	// it is stored cyclically. The window never has more than N + 1
+	// buckets: with a small delta the nodes beyond it are kept in an
+	// overflow bucket until the window reaches them.
+	const size_t n_buckets =
+		(max_w/delta < static_cast<T>(N) ? static_cast<size_t>(max_w/delta) + 2 : N + 1);
+	auto bucket_of =
+	[&delta](const T& d) -> size_t
+	{
+		return static_cast<size_t>(d/delta);
+	};
+
+	// buckets and overflow bucket of every thread, and the smallest
+	// bucket of the nodes added to every overflow bucket
+	std::vector<std::vector<std::vector<node> > > B
+		(n_threads, std::vector<std::vector<node> >(n_buckets));
+	std::vector<std::vector<node> > O(n_threads);
+	std::vector<size_t> O_min(n_threads, inf_t<size_t>());
+	size_t i = 0;
+
+	// Lowers the distance to v to d, if it is smaller. The node is added
+	// to the buckets of thread 'tid' only if 'tid' lowered it.
+	auto relax =
+	[&](size_t tid, node v, const T& d) -> void
+	{
+		T d_v = dist[v].load(std::memory_order_relaxed);
+		while (d < d_v) {
+			if (dist[v].compare_exchange_weak(d_v, d, std::memory_order_relaxed)) {
+				const size_t b = bucket_of(d);
+				if (b < i + n_buckets) {
+					B[tid][b%n_buckets].push_back(v);
+				}
+				else {
+					O[tid].push_back(v);
+					O_min[tid] = std::min(O_min[tid], b);
+				}
+				return;
+			}
+		}
+	};
+
+	// Moves the nodes of the overflow buckets that fall in the window
+	// into it. The nodes whose distance was lowered below bucket i were
+	// added to the buckets again, and already processed.
+	auto fill_window =
+	[&]() -> void
+	{
+		for (size_t tid = 0; tid < n_threads; ++tid) {
+			if (O_min[tid] >= i + n_buckets) {
+				continue;
+			}
+
+			std::vector<node>& Ot = O[tid];
+			O_min[tid] = inf_t<size_t>();
+			size_t k = 0;
+			for (node u : Ot) {
+				const size_t b = bucket_of(dist[u].load(std::memory_order_relaxed));
+				if (b < i) {
+					continue;
+				}
+				if (b < i + n_buckets) {
+					B[tid][b%n_buckets].push_back(u);
+				}
+				else {
+					Ot[k++] = u;
+					O_min[tid] = std::min(O_min[tid], b);
+				}
+			}
+			Ot.resize(k);
+		}
+	};
+
+	// Relaxes the light (or heavy) edges of the nodes in F.
+	auto relax_edges =
+	[&](const std::vector<node>& F, bool light) -> void
+	{
+		const size_t n_tasks =
+			(F.size() + delta_stepping_chunk - 1)/delta_stepping_chunk;
+
+		utils::parallel_for(n_tasks, n_threads,
+		[&](size_t tid, size_t t) -> void
+		{
+			const size_t last = std::min(F.size(), (t + 1)*delta_stepping_chunk);
+			for (size_t i = t*delta_stepping_chunk; i < last; ++i) {
+				const node u = F[i];
+				const T d_u = dist[u].load(std::memory_order_relaxed);
+
+				const auto& Nu = G->get_neighbours(u);
+				const auto& wu = G->get_weights(u);
+				for (size_t j = 0; j < Nu.size(); ++j) {
+					if ((wu[j] <= delta) == light) {
+						relax(tid, Nu[j], d_u + wu[j]);
+					}
+				}
+			}
+		}
+		);
+	};
+
+	// Stamps: a node is in the frontier of phase p if in_phase[u] == p,
+	// and it was removed from bucket i if in_bucket[u] == i + 1.
+	std::vector<size_t> in_phase(N, 0), in_bucket(N, 0);
+	size_t phase = 0;
+
+	// frontier of the current phase, and all nodes removed from the bucket
+	std::vector<node> F, R;
+
+	relax(0, source, 0);
+
+	while (true) {
+		// find the smallest non-empty bucket: the nodes of the
+		// overflow buckets are never beyond the window
+		fill_window();
+		size_t k = 0;
+		bool found = false;
+		while (k < n_buckets and not found) {
+			for (size_t tid = 0; tid < n_threads and not found; ++tid) {
+				found = not B[tid][(i + k)%n_buckets].empty();
+			}
+			if (not found) {
+				++k;
+			}
+		}
+		if (not found) {
+			// the window is empty: move it to the overflow buckets
+			i = *std::min_element(O_min.begin(), O_min.end());
+			if (i == inf_t<size_t>()) {
+				break;
+			}
+			continue;
+		}
+		i += k;
+		R.clear();
+
+		// light edges: as many phases as needed to empty bucket i
+		while (true) {
+			++phase;
+			F.clear();
+			for (size_t tid = 0; tid < n_threads; ++tid) {
+				std::vector<node>& Bi = B[tid][i%n_buckets];
+				for (node u : Bi) {
+					// ignore nodes that were added more than once, or
+					// whose distance was lowered to a smaller bucket
+					const T d_u = dist[u].load(std::memory_order_relaxed);
+					if (in_phase[u] != phase and bucket_of(d_u) == i) {
+						in_phase[u] = phase;
+						F.push_back(u);
+						if (in_bucket[u] != i + 1) {
+							in_bucket[u] = i + 1;
+							R.push_back(u);
+						}
+					}
+				}
+				Bi.clear();
+			}
+			if (F.empty()) {
+				break;
+			}
+			relax_edges(F, true);
+		}
+
+		// heavy edges: once for every node removed from bucket i
+		relax_edges(R, false);
+		++i;
+	}
+
+	ds.resize(N);
+	for (node u = 0; u < N; ++u) {
+		ds[u] = dist[u].load(std::memory_order_relaxed);
+	}
+}
+
+} // -- namespace traversal
+} // -- namespace lgraph
@@ -0,0 +1,105 @@
+/*********************************************************************
+ * lgraph
+ * Copyright (C) 2018-2019 Lluís Alemany Puig
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ * 
+ * Contact: Lluís Alemany Puig (lluis.alemany.puig@gmail.com)
+ * 
+ ********************************************************************/
+
+
+#pragma once
+
+// C++ includes
+#include <vector>
+
+// lgraph includes
+#include <lgraph/data_structures/csr_wxgraph.hpp>
+#include <lgraph/data_structures/wxgraph.hpp>
+
+namespace lgraph {
+namespace traversal {
+
+/**
+ * @brief Default bucket width of the @ref delta_stepping algorithm.
+ *
+ * Returns the largest weight of @e G divided by its average degree, which
+ * is the bucket width suggested in [1] for graphs with random weights. It
+ * is never 0.
+ *
+ * The graph can be of any type (@ref wxgraph, @ref csr_wxgraph, ...)
+ * that provides the methods @e n_nodes(), @e get_neighbours(u) and
+ * @e get_weights(u).
+ *
+ * [1] Meyer, U. and Sanders, P., "Delta-stepping: a parallelizable shortest
+ * path algorithm", Journal of Algorithms, 2003.
+ *
+ * @param G The graph.
+ * @param n_threads Number of threads used to scan the graph (see
+ * @ref utils::n_threads_used).
+ */
+template<class T, class G_t>
+T delta_stepping_width(const G_t *G, size_t n_threads = 1);
+
+/**
+ * @brief Parallel single-source shortest paths.
+ *
+ * Computes the distances from @e source to all nodes of @e G, with
+ * non-negative weights, using the delta-stepping algorithm in [1].
+ *
+ * The nodes are kept in buckets of width @e delta: bucket @e i holds the
+ * nodes at a tentative distance in [i*delta, (i+1)*delta). The smallest
+ * non-empty bucket is processed in phases: all its nodes relax, in
+ * parallel, their light edges (those of weight at most @e delta), which
+ * may add nodes to the same bucket again, until the bucket is empty. Then
+ * all the nodes removed from it relax their heavy edges once. Relaxations
+ * lower the tentative distances with atomic operations, and every thread
+ * adds the nodes whose distance it lowered to its own buckets, so no
+ * locking is needed. Only a window of at most n + 1 consecutive buckets
+ * is kept per thread: the nodes beyond it wait in an overflow bucket,
+ * and are moved into the window when it reaches their buckets.
+ *
+ * With a very small @e delta every bucket holds nodes at the same
+ * distance, like Dijkstra's algorithm. With a very large one, all nodes
+ * are in the same bucket, like Bellman-Ford's algorithm. The distances
+ * are the same as those of Dijkstra's algorithm, up to the rounding of
+ * floating-point weights, for any @e delta and any number of threads.
+ *
+ * The graph can be of any type (@ref wxgraph, @ref csr_wxgraph, ...)
+ * that provides the methods @e n_nodes(), @e get_neighbours(u) and
+ * @e get_weights(u).
+ *
+ * [1] Meyer, U. and Sanders, P., "Delta-stepping: a parallelizable shortest
+ * path algorithm", Journal of Algorithms, 2003.
+ *
+ * @param G The graph being traversed.
+ * @param source The node where the algorithm starts at.
+ * @param[out] ds The distance from @e source to every node, infinite
+ * (see @ref inf_t) for the nodes not reachable from @e source.
+ * @param delta The width of the buckets. If it is 0, the width given by
+ * @ref delta_stepping_width is used.
+ * @param n_threads Number of threads (see @ref utils::n_threads_used).
+ */
+template<class T, class G_t>
+void delta_stepping
+(
+	const G_t *G, node source, std::vector<T>& ds,
+	T delta = 0, size_t n_threads = 1
+);
+
+} // -- namespace traversal
+} // -- namespace lgraph
+
+#include <lgraph/graph_traversal/delta_stepping.cpp>
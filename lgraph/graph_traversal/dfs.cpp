@@ -23,7 +23,6 @@
 
 // C++ includes
 #include <vector>
-#include <stack>
 
 // lgraph includes
 #include <lgraph/utils/logger.hpp>
@@ -38,22 +37,31 @@ void DFS
 	node source,
 	dfs_terminate terminate,
 	dfs_process_current proc_curr,
-	dfs_process_neighbour proc_neig
+	dfs_process_neighbour proc_neig,
+	workspace<> *ws
 )
 {
 	utils::logger<utils::null_stream>& LOG = utils::logger<utils::null_stream>::get_logger();
 	LOG.log() << "DEPTH-FIRST SEARCH ALGORITHM" << std::endl;
 
-	std::vector<bool> vis(G->n_nodes(), false);
-	std::stack<node> S;
+	// use the caller's memory, if any
+	workspace<> local_ws;
+	workspace<>& W = (ws == nullptr ? local_ws : *ws);
+	W.init(G->n_nodes());
 
-	vis[source] = true;
-	S.push(source);
+	const std::vector<bool>& vis = W.visited();
+
+	// every node is pushed at most once: the stack
+	// fits in a buffer of as many nodes as the graph
+	std::vector<node>& S = W.node_buffer();
+	size_t top = 0;
+
+	W.visit(source);
+	S[top++] = source;
 	bool term = false;
 
-	while (not S.empty() and not term) {
-		node u = S.top();
-		S.pop();
+	while (top > 0 and not term) {
+		node u = S[--top];
 
 		LOG.log() << "Current node: " << u << std::endl;
 		LOG.log() << "... processing ...";
@@ -90,8 +98,8 @@ void DFS
 					LOG.log() << "    Neighbour " << v
 							  << " was not visited before" << std::endl;
 
-					S.push(v);
-					vis[v] = true;
+					S[top++] = v;
+					W.visit(v);
 				}
 				else {
 					LOG.log() << "    Neighbour " << v
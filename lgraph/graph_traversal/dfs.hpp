@@ -27,6 +27,7 @@
 
 // lgraph includes
 #include <lgraph/data_structures/uxgraph.hpp>
+#include <lgraph/graph_traversal/workspace.hpp>
 
 namespace lgraph {
 namespace traversal {
@@ -120,6 +121,9 @@ typedef std::function<
  * node of the traversal.
  * @param proc_neigh It is called in line 11 used to perform some operation
  * on each of the neighbours.
+ * @param ws The memory used by the traversal (see @ref workspace). If
+ * null, the memory is allocated for this traversal only. Otherwise, the
+ * set of visited nodes is left in it after the traversal.
  */
 void DFS
 (
@@ -133,7 +137,8 @@ void DFS
 		-> void {},
 	dfs_process_neighbour proc_neigh =
 		[](const uxgraph *, node, node, const std::vector<bool>&)
-		-> void {}
+		-> void {},
+	workspace<> *ws = nullptr
 );
 
 } // -- namespace dfs
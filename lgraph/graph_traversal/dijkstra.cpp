@@ -22,106 +22,97 @@
 #include <lgraph/graph_traversal/dijkstra.hpp>
 
 // C++ includes
+#include <functional>
 #include <vector>
-#include <queue>
-
-// lgraph includes
-#include <lgraph/utils/logger.hpp>
 
 namespace lgraph {
 namespace traversal {
 namespace dijkstra {
 
-template<class T>
+template<class T, class queue_t, class G_t, class term_t, class curr_t, class neigh_t>
 void Dijkstra
 (
-	const wxgraph<T> *G,
+	const G_t *G,
 	node source,
-	djka_terminate<T> terminate,
-	djka_process_current<T> proc_curr,
-	djka_process_neighbour<T> proc_neig
+	term_t terminate,
+	curr_t proc_curr,
+	neigh_t proc_neig,
+	workspace<T> *ws
 )
 {
-	utils::logger<utils::null_stream>& LOG = utils::logger<utils::null_stream>::get_logger();
-	LOG.log() << "DIJKSTRA ALGORITHM" << std::endl;
+	// use the caller's memory, if any
+	workspace<T> local_ws;
+	workspace<T>& W = (ws == nullptr ? local_ws : *ws);
+	W.init(G->n_nodes());
 
-	std::vector<bool> vis(G->n_nodes(), false);
-	std::priority_queue<
-		djka_node<T>,				// -> elements' type,
-		std::vector<djka_node<T> >,	// -> compare elements so that smaller distances
-		std::greater<djka_node<T> >	// are at the top
-	> Q;
+	const std::vector<bool>& vis = W.visited();
 
-	Q.push(djka_node<T>(0, source));
+	// priority queue: smaller distances are at the top
+	queue_t Q(W);
+	Q.push(0, source);
 	bool term = false;
 
 	while (not Q.empty() and not term) {
-		djka_node<T> u = Q.top();
+		const djka_node<T> u = Q.top();
 		Q.pop();
 
-		LOG.log() << "Current node: " << u.second << std::endl;
-
 		if (not vis[u.second]) {
-			vis[u.second] = true;
-
-			LOG.log() << "    ... processing";
+			W.visit(u.second);
 
 			proc_curr(G, u, vis);
 
-			LOG.log() << "    ... processed." << std::endl;
-			LOG.log() << "Checking termination condition" << std::endl;
-
 			if (terminate(G, u, vis)) {
-
-				LOG.log() << "! Termination condition true for node "
-						  << u.second << std::endl;
-
 				term = true;
 			}
 			else {
-				const neighbourhood& Nu = G->get_neighbours(u.second);
-				const weight_list<T>& wu = G->get_weights(u.second);
-
-				LOG.log() << "Iterate through neighbours of "
-						  << u.second << std::endl;
-				LOG.log() << "    Node " << u.second << " has "
-						  << Nu.size() << " neighbours" << std::endl;
-				LOG.log() << "    Node " << u.second << " has " << wu.size()
-						  << " weights" << std::endl;
+				const auto& Nu = G->get_neighbours(u.second);
+				const auto& wu = G->get_weights(u.second);
 
 				auto wu_it = wu.begin();
-				for (
-					auto Nu_it = Nu.begin();
-					Nu_it != Nu.end();
-					++Nu_it, ++wu_it
-				)
-				{
-					LOG.log() << "    Neighbour index: " << Nu_it - Nu.begin()
-							  << std::endl;
-
+				for (auto Nu_it = Nu.begin(); Nu_it != Nu.end(); ++Nu_it, ++wu_it) {
 					node v = *Nu_it;
 					T weight_uv = *wu_it;
 
-					LOG.log() << "    Neighbour " << v << " was not visited before"
-							  << std::endl;
-					LOG.log() << "        weight edge (" << u.second << "," << v << "): "
-							  << weight_uv << std::endl;
-
-					LOG.log() << "        ... processing";
 					bool add_next = proc_neig(G, u.second, v, weight_uv, vis);
-					LOG.log() << "        ... processed." << std::endl;
-
-					if (add_next) {
-						Q.push( djka_node<T>(u.first + weight_uv, v) );
+					if (add_next and not vis[v]) {
+						Q.push(u.first + weight_uv, v);
 					}
 				}
 			}
 		}
-
-		LOG.log() << std::endl;
 	}
 }
 
+template<class T>
+void Dijkstra
+(
+	const wxgraph<T> *G,
+	node source,
+	djka_terminate<T> terminate,
+	djka_process_current<T> proc_curr,
+	djka_process_neighbour<T> proc_neig,
+	workspace<T> *ws
+)
+{
+	Dijkstra<T, default_queue<T>, wxgraph<T> >
+		(G, source, terminate, proc_curr, proc_neig, ws);
+}
+
+template<class T>
+void Dijkstra
+(
+	const csr_wxgraph<T> *G,
+	node source,
+	csr_djka_terminate<T> terminate,
+	csr_djka_process_current<T> proc_curr,
+	csr_djka_process_neighbour<T> proc_neig,
+	workspace<T> *ws
+)
+{
+	Dijkstra<T, default_queue<T>, csr_wxgraph<T> >
+		(G, source, terminate, proc_curr, proc_neig, ws);
+}
+
 } // -- namespace dijkstra
 } // -- namespace traversal
 } // -- namespace lgraph
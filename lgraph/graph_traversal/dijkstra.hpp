@@ -25,16 +25,15 @@
 #include <functional>
 
 // lgraph includes
+#include <lgraph/data_structures/csr_wxgraph.hpp>
 #include <lgraph/data_structures/wxgraph.hpp>
+#include <lgraph/graph_traversal/dijkstra_queues.hpp>
+#include <lgraph/graph_traversal/workspace.hpp>
 
 namespace lgraph {
 namespace traversal {
 namespace dijkstra {
 
-/// A pair encoding the distance to a node, and that node.
-template<class T>
-using djka_node = std::pair<T, node>;
-
 /**
  * @brief Terminating function.
  *
@@ -132,7 +131,9 @@ std::function<
  * It is called in line 7 used to perform some operation on the current
  * node of the traversal.
  * @param proc_neigh It is called between the 'for' loop in line 13 and
- * the used to perform some operation on each of the neighbours.
+ * the used to perform some operation on each of the neighbours. * @param ws The memory used by the traversal (see @ref workspace). If
+ * null, the memory is allocated for this traversal only. Otherwise, the
+ * set of visited nodes is left in it after the traversal.
  */
 template<class T>
 void Dijkstra
@@ -147,7 +148,201 @@ void Dijkstra
 		-> void {},
 	djka_process_neighbour<T> proc_neigh =
 		[](const wxgraph<T> *, node, node, const T&, const std::vector<bool>&)
-		-> bool { return true; }
+		-> bool { return true; },
+	workspace<T> *ws = nullptr
+);
+
+/* VISITOR-BASED DIJKSTRA */
+
+/**
+ * @brief Visitor that does nothing.
+ *
+ * Default value for the terminating and the node processing functions of
+ * the visitor-based @ref Dijkstra. As a terminating function it never
+ * terminates the traversal, and as a processing function it does nothing.
+ * Since it is known at compile-time the compiler removes all calls to it.
+ */
+struct djka_no_op {
+	/// Does nothing, returns false.
+	template<class... Args>
+	inline bool operator() (const Args&...) const { return false; }
+};
+
+/**
+ * @brief Visitor that adds every neighbour to the queue.
+ *
+ * Default value for the neighbour processing function of the
+ * visitor-based @ref Dijkstra.
+ */
+struct djka_always_add {
+	/// Does nothing, returns true.
+	template<class... Args>
+	inline bool operator() (const Args&...) const { return true; }
+};
+
+/**
+ * @brief Generic Dijkstra algorithm with visitors.
+ *
+ * Same algorithm as @ref Dijkstra(const wxgraph<T>*, node, djka_terminate<T>, djka_process_current<T>, djka_process_neighbour<T>)
+ * but the functions guiding the traversal are template parameters instead
+ * of @e std::function objects. This allows the compiler to inline them,
+ * removing the cost of an indirect call per node and per edge. Any
+ * callable object (a lambda, a functor, ...) with the same signature as
+ * @ref djka_terminate, @ref djka_process_current and @ref djka_process_neighbour
+ * can be used.
+ *
+ * The graph can be of any type (@ref wxgraph, @ref csr_wxgraph, ...)
+ * that provides the methods @e n_nodes(), @e get_neighbours(u) and
+ * @e get_weights(u). The type of the weights @e T has to be given
+ * explicitly.
+ *
+ * The priority queue is the template parameter @e queue_t. By default
+ * (see @ref default_queue) it is a @ref radix_heap when the weights are
+ * integral, and an @ref indexed_heap otherwise, where pushing a node
+ * already in the queue decreases its distance. A @ref lazy_heap, which
+ * adds one element per push, can also be used:
+ *
+ * <pre>
+ * Dijkstra<T, lazy_heap<T> >(G, source, term, proc_curr, proc_neigh);
+ * </pre>
+ *
+ * The @ref indexed_heap and the @ref lazy_heap break ties between equal
+ * distances by node index, so the nodes are visited in the same order with
+ * either of them. Nodes already visited are never pushed.
+ *
+ * @param G The graph being traversed.
+ * @param source The node where the algorithm starts at.
+ * @param term The terminating function.
+ * @param proc_curr The function to process the currently visited node.
+ * @param proc_neigh The function to process each of the neighbours.
+ * @param ws The memory used by the traversal (see @ref workspace).
+ */
+template<
+	class T,
+	class queue_t = default_queue<T>,
+	class G_t,
+	class term_t = djka_no_op,
+	class curr_t = djka_no_op,
+	class neigh_t = djka_always_add
+>
+void Dijkstra
+(
+	const G_t *G,
+	node source,
+	term_t term = term_t(),
+	curr_t proc_curr = curr_t(),
+	neigh_t proc_neigh = neigh_t(),
+	workspace<T> *ws = nullptr
+);
+
+/* COMPRESSED GRAPHS */
+
+/**
+ * @brief Terminating function for compressed graphs.
+ *
+ * See @ref djka_terminate.
+ */
+template<class T = size_t>
+using csr_djka_terminate =
+std::function<
+	bool (const csr_wxgraph<T> *G,const djka_node<T>& u, const std::vector<bool>& vis)
+>;
+
+/**
+ * @brief Node processing function for compressed graphs.
+ *
+ * See @ref djka_process_current.
+ */
+template<class T = size_t>
+using csr_djka_process_current =
+std::function<
+	void (const csr_wxgraph<T> *G, const djka_node<T>& u, const std::vector<bool>& vis)
+>;
+
+/**
+ * @brief Node processing function for compressed graphs.
+ *
+ * See @ref djka_process_neighbour.
+ */
+template<class T = size_t>
+using csr_djka_process_neighbour =
+std::function<
+	bool (const csr_wxgraph<T> *G, node u, node v, const T& w, const std::vector<bool>& vis)
+>;
+
+/**
+ * @brief Generic Dijkstra algorithm on a compressed graph.
+ *
+ * Same algorithm as @ref Dijkstra(const wxgraph<T>*, node, djka_terminate<T>, djka_process_current<T>, djka_process_neighbour<T>)
+ * on a compressed (CSR) weighted graph.
+ *
+ * @param G The graph being traversed.
+ * @param source The node where the algorithm starts at.
+ * @param term The terminating function.
+ * @param proc_curr The function to process the currently visited node.
+ * @param proc_neigh The function to process each of the neighbours.
+ * @param ws The memory used by the traversal (see @ref workspace).
+ */
+template<class T>
+void Dijkstra
+(
+	const csr_wxgraph<T> *G,
+	node source,
+	csr_djka_terminate<T> term =
+		[](const csr_wxgraph<T> *, const djka_node<T>&, const std::vector<bool>&)
+		-> bool { return false; },
+	csr_djka_process_current<T> proc_curr =
+		[](const csr_wxgraph<T> *, const djka_node<T>&, const std::vector<bool>&)
+		-> void {},
+	csr_djka_process_neighbour<T> proc_neigh =
+		[](const csr_wxgraph<T> *, node, node, const T&, const std::vector<bool>&)
+		-> bool { return true; },
+	workspace<T> *ws = nullptr
+);
+
+/* BIDIRECTIONAL DIJKSTRA */
+
+/**
+ * @brief Bidirectional Dijkstra algorithm.
+ *
+ * Finds the distance from @e source to @e target with two traversals: a
+ * forward one from @e source on @e G and a backward one from @e target on
+ * @e R, the reverse of @e G. The traversal whose next node is closer to
+ * its origin advances one node each time. Every edge (u,v) relaxed
+ * between a node u reached by the forward traversal and a node v reached
+ * by the backward one gives a path from @e source to @e target, the
+ * shortest of which, of length @e mu, is kept. The search stops when the
+ * sum of the distances of the next nodes of both traversals is at least
+ * @e mu: no path through a node not settled yet can be shorter.
+ *
+ * The graphs can be of any type (@ref wxgraph, @ref csr_wxgraph, ...)
+ * that provides the methods @e n_nodes(), @e get_neighbours(u) and
+ * @e get_weights(u). For undirected graphs @e R can be @e G itself. For
+ * directed graphs, see @ref csr_wxgraph::init_reverse.
+ *
+ * @param G The graph being traversed.
+ * @param R The reverse of @e G.
+ * @param source The node where the path starts at.
+ * @param target The node where the path ends at.
+ * @param[out] ws_forward The memory of the forward traversal. The
+ * distance from @e source and the parent of each node reached are left
+ * in it (see @ref workspace::distance and @ref workspace::parent).
+ * @param[out] ws_backward The memory of the backward traversal. The
+ * distance to @e target and the next node towards it are left in it.
+ * @param[out] u The last node of the forward part of the path found.
+ * @param[out] v The first node of the backward part of the path found.
+ * See @ref bfs::bidirectional_BFS for details.
+ * @return Returns the distance from @e source to @e target, or infinite
+ * if @e target is not reachable from @e source.
+ */
+template<class T, class G_t, class R_t>
+T bidirectional_Dijkstra
+(
+	const G_t *G,
+	const R_t *R,
+	node source, node target,
+	workspace<T>& ws_forward, workspace<T>& ws_backward,
+	node& u, node& v
 );
 
 } // -- namespace dijkstra
@@ -155,3 +350,4 @@ void Dijkstra
 } // -- namespace lgraph
 
 #include <lgraph/graph_traversal/dijkstra.cpp>
+#include <lgraph/graph_traversal/dijkstra_bidirectional.cpp>
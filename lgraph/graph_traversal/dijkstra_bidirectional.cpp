@@ -0,0 +1,129 @@
+/*********************************************************************
+ * lgraph
+ * Copyright (C) 2018-2019 Lluís Alemany Puig
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ * 
+ * Contact: Lluís Alemany Puig (lluis.alemany.puig@gmail.com)
+ * 
+ ********************************************************************/
+
+
+#include <lgraph/graph_traversal/dijkstra.hpp>
+
+// C++ includes
+#include <vector>
+
+namespace lgraph {
+namespace traversal {
+namespace dijkstra {
+
+// Settles the next node of the traversal of X with queue Q and memory W,
+// and relaxes its edges. Every edge (a,b) of X relaxed from the node
+// settled 'a' to a node 'b' reached by the other traversal, whose memory
+// is 'other', gives a path of length W.distance(a) + w(a,b) +
+// other.distance(b). If it is shorter than 'mu', 'mu', 'a' and 'b' are
+// updated.
+template<class T, class X_t, class queue_t>
+inline void bidirectional_Dijkstra_step
+(
+	const X_t *X, queue_t& Q, workspace<T>& W, const workspace<T>& other,
+	T& mu, node& a, node& b
+)
+{
+	const djka_node<T> x = Q.top();
+	Q.pop();
+
+	if (W.is_visited(x.second)) {
+		// a longer distance to a node already settled
+		return;
+	}
+	W.visit(x.second);
+
+	const auto& Nx = X->get_neighbours(x.second);
+	const auto& wx = X->get_weights(x.second);
+	for (size_t i = 0; i < Nx.size(); ++i) {
+		const node y = Nx[i];
+		const T dy = x.first + wx[i];
+
+		if (dy + static_cast<T>(1.0e-5) < W.distance(y)) {
+			W.set_distance(y, dy);
+			W.set_parent(y, x.second);
+			Q.push(dy, y);
+		}
+
+		const T dy_other = other.distance(y);
+		if (dy_other != inf_t<T>() and dy + dy_other < mu) {
+			mu = dy + dy_other;
+			a = x.second;
+			b = y;
+		}
+	}
+}
+
+template<class T, class G_t, class R_t>
+T bidirectional_Dijkstra
+(
+	const G_t *G,
+	const R_t *R,
+	node source, node target,
+	workspace<T>& Wf, workspace<T>& Wb,
+	node& u, node& v
+)
+{
+	const size_t N = G->n_nodes();
+	Wf.init(N, true);
+	Wb.init(N, true);
+
+	Wf.set_distance(source, 0);
+	Wb.set_distance(target, 0);
+
+	u = v = source;
+	if (source == target) {
+		return 0;
+	}
+
+	// length of the shortest path found so far
+	T mu = inf_t<T>();
+
+	default_queue<T> Qf(Wf), Qb(Wb);
+	Qf.push(0, source);
+	Qb.push(0, target);
+
+	while (not Qf.empty() and not Qb.empty()) {
+		// the tops of the heaps are the smallest distances
+		const T top_f = Qf.top().first;
+		const T top_b = Qb.top().first;
+
+		// every path through a node not settled by either
+		// traversal is at least as long as the shortest found
+		if (mu != inf_t<T>() and top_f + top_b >= mu) {
+			break;
+		}
+
+		if (top_f <= top_b) {
+			bidirectional_Dijkstra_step(G, Qf, Wf, Wb, mu, u, v);
+		}
+		else {
+			// an edge (a,b) of R is the edge (b,a) of G
+			bidirectional_Dijkstra_step(R, Qb, Wb, Wf, mu, v, u);
+		}
+	}
+
+	return mu;
+}
+
+} // -- namespace dijkstra
+} // -- namespace traversal
+} // -- namespace lgraph
@@ -0,0 +1,259 @@
+/*********************************************************************
+ * lgraph
+ * Copyright (C) 2018-2019 Lluís Alemany Puig
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ * 
+ * Contact: Lluís Alemany Puig (lluis.alemany.puig@gmail.com)
+ * 
+ ********************************************************************/
+
+
+#include <lgraph/graph_traversal/dijkstra_queues.hpp>
+
+// C includes
+#include <assert.h>
+
+// C++ includes
+#include <algorithm>
+#include <functional>
+
+namespace lgraph {
+namespace traversal {
+namespace dijkstra {
+
+/* INDEXED HEAP */
+
+// PRIVATE
+
+template<class T, size_t d>
+void indexed_heap<T,d>::sift_up(size_t i) {
+	const djka_node<T> x = m_heap[i];
+	while (i > 0) {
+		const size_t p = (i - 1)/d;
+		if (not (x < m_heap[p])) {
+			break;
+		}
+		m_heap[i] = m_heap[p];
+		m_pos[m_heap[i].second] = i;
+		i = p;
+	}
+	m_heap[i] = x;
+	m_pos[x.second] = i;
+}
+
+template<class T, size_t d>
+void indexed_heap<T,d>::sift_down(size_t i) {
+	const size_t n = m_heap.size();
+	const djka_node<T> x = m_heap[i];
+	while (true) {
+		const size_t first = d*i + 1;
+		if (first >= n) {
+			break;
+		}
+
+		// smallest child
+		const size_t last = std::min(first + d, n);
+		size_t c = first;
+		for (size_t j = first + 1; j < last; ++j) {
+			if (m_heap[j] < m_heap[c]) {
+				c = j;
+			}
+		}
+
+		if (not (m_heap[c] < x)) {
+			break;
+		}
+		m_heap[i] = m_heap[c];
+		m_pos[m_heap[i].second] = i;
+		i = c;
+	}
+	m_heap[i] = x;
+	m_pos[x.second] = i;
+}
+
+// PUBLIC
+
+template<class T, size_t d>
+indexed_heap<T,d>::indexed_heap(workspace<T>& W)
+	: m_heap(W.heap()), m_pos(W.heap_positions())
+{
+	// the positions are allocated the first time they are needed
+	if (m_pos.size() != W.size()) {
+		m_pos.assign(W.size(), inf_t<size_t>());
+	}
+}
+
+template<class T, size_t d>
+bool indexed_heap<T,d>::empty() const {
+	return m_heap.empty();
+}
+
+template<class T, size_t d>
+size_t indexed_heap<T,d>::size() const {
+	return m_heap.size();
+}
+
+template<class T, size_t d>
+const djka_node<T>& indexed_heap<T,d>::top() const {
+	assert(not empty());
+	return m_heap[0];
+}
+
+template<class T, size_t d>
+void indexed_heap<T,d>::pop() {
+	assert(not empty());
+	m_pos[m_heap[0].second] = inf_t<size_t>();
+
+	const djka_node<T> last = m_heap.back();
+	m_heap.pop_back();
+	if (not m_heap.empty()) {
+		m_heap[0] = last;
+		sift_down(0);
+	}
+}
+
+template<class T, size_t d>
+void indexed_heap<T,d>::push(const T& k, node u) {
+	const size_t p = m_pos[u];
+	if (p == inf_t<size_t>()) {
+		m_heap.push_back(djka_node<T>(k, u));
+		sift_up(m_heap.size() - 1);
+	}
+	else if (k < m_heap[p].first) {
+		// decrease key
+		m_heap[p].first = k;
+		sift_up(p);
+	}
+}
+
+/* LAZY HEAP */
+
+template<class T>
+lazy_heap<T>::lazy_heap(workspace<T>& W) : m_heap(W.heap()) { }
+
+template<class T>
+bool lazy_heap<T>::empty() const {
+	return m_heap.empty();
+}
+
+template<class T>
+size_t lazy_heap<T>::size() const {
+	return m_heap.size();
+}
+
+template<class T>
+const djka_node<T>& lazy_heap<T>::top() const {
+	assert(not empty());
+	return m_heap.front();
+}
+
+template<class T>
+void lazy_heap<T>::pop() {
+	assert(not empty());
+	std::pop_heap(m_heap.begin(), m_heap.end(), std::greater<djka_node<T> >());
+	m_heap.pop_back();
+}
+
+template<class T>
+void lazy_heap<T>::push(const T& k, node u) {
+	m_heap.push_back(djka_node<T>(k, u));
+	std::push_heap(m_heap.begin(), m_heap.end(), std::greater<djka_node<T> >());
+}
+
+/* RADIX HEAP */
+
+// PRIVATE
+
+template<class T>
+size_t radix_heap<T>::bucket(const T& k) const {
+	const uint64_t x = static_cast<uint64_t>(k) ^ m_last;
+	return (x == 0 ? 0 : 64 - __builtin_clzll(x));
+}
+
+template<class T>
+void radix_heap<T>::refill() {
+	size_t i = 1;
+	while (m_buckets[i].empty()) {
+		++i;
+	}
+
+	// the smallest distance in the bucket is the new 'last'...
+	std::vector<djka_node<T> >& B = m_buckets[i];
+	T k = B[0].first;
+	for (size_t j = 1; j < B.size(); ++j) {
+		k = std::min(k, B[j].first);
+	}
+	m_last = static_cast<uint64_t>(k);
+
+	// ... and all its elements go to smaller buckets
+	for (const djka_node<T>& e : B) {
+		m_buckets[bucket(e.first)].push_back(e);
+	}
+	B.clear();
+}
+
+// PUBLIC
+
+template<class T>
+radix_heap<T>::radix_heap(workspace<T>& W)
+	: m_buckets(W.buckets()), m_size(0), m_last(0)
+{
+	static_assert(std::is_integral<T>::value, "Distances must be integral");
+
+	// the buckets are allocated the first time they are needed
+	if (m_buckets.size() != 65) {
+		m_buckets.resize(65);
+	}
+}
+
+template<class T>
+bool radix_heap<T>::empty() const {
+	return m_size == 0;
+}
+
+template<class T>
+size_t radix_heap<T>::size() const {
+	return m_size;
+}
+
+template<class T>
+const djka_node<T>& radix_heap<T>::top() {
+	assert(not empty());
+	if (m_buckets[0].empty()) {
+		refill();
+	}
+	return m_buckets[0].back();
+}
+
+template<class T>
+void radix_heap<T>::pop() {
+	assert(not empty());
+	if (m_buckets[0].empty()) {
+		refill();
+	}
+	m_buckets[0].pop_back();
+	--m_size;
+}
+
+template<class T>
+void radix_heap<T>::push(const T& k, node u) {
+	assert(static_cast<uint64_t>(k) >= m_last);
+	m_buckets[bucket(k)].push_back(djka_node<T>(k, u));
+	++m_size;
+}
+
+} // -- namespace dijkstra
+} // -- namespace traversal
+} // -- namespace lgraph
@@ -0,0 +1,232 @@
+/*********************************************************************
+ * lgraph
+ * Copyright (C) 2018-2019 Lluís Alemany Puig
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ * 
+ * Contact: Lluís Alemany Puig (lluis.alemany.puig@gmail.com)
+ * 
+ ********************************************************************/
+
+
+#pragma once
+
+// C includes
+#include <stdint.h>
+
+// C++ includes
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// lgraph includes
+#include <lgraph/graph_traversal/workspace.hpp>
+
+namespace lgraph {
+namespace traversal {
+namespace dijkstra {
+
+/// A pair encoding the distance to a node, and that node.
+template<class T>
+using djka_node = std::pair<T, node>;
+
+/**
+ * @brief Indexed d-ary heap of (distance, node) pairs.
+ *
+ * Priority queue of Dijkstra's algorithm where every node appears at most
+ * once. The position of every node in the heap is kept, so that pushing
+ * a node already in the queue with a smaller distance decreases its key
+ * in O(log_d n) time instead of adding another entry. The queue has at
+ * most n elements, and no element is ever popped twice.
+ *
+ * A larger arity @e d makes the heap shallower, so that decreasing a key,
+ * which is the most frequent operation in dense graphs, is cheaper, at
+ * the expense of comparing more children when popping.
+ *
+ * The memory of the queue belongs to a @ref workspace (see
+ * @ref workspace::heap and @ref workspace::heap_positions).
+ *
+ * @param T The type of the distances.
+ * @param d The arity of the heap.
+ */
+template<class T, size_t d = 4>
+class indexed_heap {
+	public:
+		/**
+		 * @brief Constructor with workspace.
+		 *
+		 * The queue uses the memory of @e W, which must have been
+		 * initialised with the number of nodes of the graph (see
+		 * @ref workspace::init).
+		 * @param W The workspace of the traversal.
+		 */
+		indexed_heap(workspace<T>& W);
+
+		/// Returns true if there are no elements in the queue.
+		bool empty() const;
+		/// Returns the number of elements in the queue.
+		size_t size() const;
+		/// Returns the element with the smallest distance.
+		const djka_node<T>& top() const;
+		/// Removes the element with the smallest distance.
+		void pop();
+		/**
+		 * @brief Adds node @e u at distance @e k.
+		 *
+		 * If @e u is already in the queue, its distance is decreased to
+		 * @e k, or left as it is if it is not larger than @e k.
+		 */
+		void push(const T& k, node u);
+
+	private:
+		/// Moves the element at position @e i towards the root.
+		void sift_up(size_t i);
+		/// Moves the element at position @e i towards the leaves.
+		void sift_down(size_t i);
+
+	private:
+		/// The elements of the heap.
+		std::vector<djka_node<T> >& m_heap;
+		/// Position of every node in @ref m_heap.
+		std::vector<size_t>& m_pos;
+};
+
+/**
+ * @brief Binary heap of (distance, node) pairs with lazy deletion.
+ *
+ * Priority queue of Dijkstra's algorithm where every push adds a new
+ * element, even if the node is already in the queue. The elements of a
+ * node that are not its smallest are popped after it, and ignored by the
+ * algorithm. The queue may have as many elements as edges in the graph.
+ *
+ * The memory of the queue belongs to a @ref workspace (see
+ * @ref workspace::heap).
+ *
+ * @param T The type of the distances.
+ */
+template<class T>
+class lazy_heap {
+	public:
+		/**
+		 * @brief Constructor with workspace.
+		 * @param W The workspace of the traversal.
+		 */
+		lazy_heap(workspace<T>& W);
+
+		/// Returns true if there are no elements in the queue.
+		bool empty() const;
+		/// Returns the number of elements in the queue.
+		size_t size() const;
+		/// Returns the element with the smallest distance.
+		const djka_node<T>& top() const;
+		/// Removes the element with the smallest distance.
+		void pop();
+		/// Adds node @e u at distance @e k.
+		void push(const T& k, node u);
+
+	private:
+		/// The elements of the heap.
+		std::vector<djka_node<T> >& m_heap;
+};
+
+/**
+ * @brief Radix heap of (distance, node) pairs.
+ *
+ * Monotone priority queue for integral distances: the distance of every
+ * element pushed cannot be smaller than the distance of the last element
+ * popped, which is always the case in Dijkstra's algorithm with
+ * non-negative weights. Like in the @ref lazy_heap every push adds a new
+ * element, and the algorithm ignores those of nodes already visited.
+ *
+ * The elements are kept in 65 buckets. Bucket 0 holds the elements whose
+ * distance equals that of the last element popped, @e last, and bucket
+ * @e i > 0 those whose distance has its highest bit different from
+ * @e last at position @e i - 1. When bucket 0 runs out, the first
+ * non-empty bucket is emptied into smaller buckets using its minimum as
+ * the new @e last. Every element moves to a smaller bucket each
+ * time it is moved, so that Dijkstra's algorithm runs in O(M + N log C)
+ * time, where @e C is the largest distance, instead of O(M log N).
+ *
+ * The memory of the queue belongs to a @ref workspace (see
+ * @ref workspace::buckets).
+ *
+ * The implementation follows the description in [1].
+ *
+ * [1] Ahuja, R. K., Mehlhorn, K., Orlin, J. B. and Tarjan, R. E., "Faster
+ * algorithms for the shortest path problem", Journal of the ACM, 1990.
+ *
+ * @param T The type of the distances. Must be an integral type.
+ */
+template<class T>
+class radix_heap {
+	public:
+		/**
+		 * @brief Constructor with workspace.
+		 * @param W The workspace of the traversal.
+		 */
+		radix_heap(workspace<T>& W);
+
+		/// Returns true if there are no elements in the queue.
+		bool empty() const;
+		/// Returns the number of elements in the queue.
+		size_t size() const;
+		/**
+		 * @brief Returns an element with the smallest distance.
+		 *
+		 * The buckets are rearranged when bucket 0 is empty. This is
+		 * not done when popping, since the elements pushed after a pop
+		 * may be closer than the rest of the elements in the queue.
+		 */
+		const djka_node<T>& top();
+		/// Removes an element with the smallest distance.
+		void pop();
+		/**
+		 * @brief Adds node @e u at distance @e k.
+		 * @pre @e k is not smaller than the distance of the last
+		 * element popped.
+		 */
+		void push(const T& k, node u);
+
+	private:
+		/// Index of the bucket of an element at distance @e k.
+		size_t bucket(const T& k) const;
+		/// Moves the first non-empty bucket into bucket 0.
+		void refill();
+
+	private:
+		/// The buckets of the heap.
+		std::vector<std::vector<djka_node<T> > >& m_buckets;
+		/// Number of elements in the heap.
+		size_t m_size;
+		/// Distance of the last element popped.
+		uint64_t m_last;
+};
+
+/**
+ * @brief The default priority queue of Dijkstra's algorithm.
+ *
+ * A @ref radix_heap for integral distances and an @ref indexed_heap for
+ * the others.
+ */
+template<class T>
+using default_queue =
+typename std::conditional<
+	std::is_integral<T>::value, radix_heap<T>, indexed_heap<T>
+>::type;
+
+} // -- namespace dijkstra
+} // -- namespace traversal
+} // -- namespace lgraph
+
+#include <lgraph/graph_traversal/dijkstra_queues.cpp>
@@ -21,195 +21,343 @@
 
 #include <lgraph/graph_traversal/traversal_ux.hpp>
 
+// C includes
+#include <assert.h>
+
 // C++ includes
-#include <queue>
+#include <algorithm>
+#include <numeric>
+#include <vector>
 using namespace std;
 
 // lgraph includes
 #include <lgraph/graph_traversal/bfs.hpp>
+#include <lgraph/utils/parallel.hpp>
 
 namespace lgraph {
 namespace traversal {
 using namespace std;
-using namespace bfs;
-
-/* VERTEX-VERTEX */
 
-_new_ uxdistance(const uxgraph *G, node source, node target) {
-	// distances from source to nodes
-	queue<_new_> distances;
-	distances.push(0);
-
-	// current distance from source to u
-	_new_ current_dist;
-
-	// distance from source to target. Set to infinite
-	// for those targets not reachable from source.
-	_new_ st_dist = inf_t<_new_>();
-
-	// DO terminate when target node is found. BFS guarantees that when this happens
-	// the shortest distance was found
-	bfs_terminate terminate =
-	[&target](const uxgraph *, node u, const vector<bool>&)
-	{
-		return u == target;
-	};
+/* VERTEX-ALL */
 
-	bfs_process_current process_current =
-	[&distances, &current_dist, &target, &st_dist]
-	(const uxgraph *, node u, const vector<bool>&)
-	{
-		current_dist = distances.front();
-		distances.pop();
+// Breadth-First Search from 'source' specialised for the computation
+// of distances and of the number of shortest paths, which are left in
+// the workspace 'W'. The traversal stops when 'target' is reached, if
+// it is a node of the graph. Resetting the workspace costs O(k), where
+// k is the number of nodes reached in the previous traversal.
+template<class G_t>
+inline void generic_uxdistance_from
+(const G_t *G, node source, node target, workspace<>& W)
+{
+	W.init(G->n_nodes(), true);
+	vector<node>& Q = W.node_buffer();
+	size_t head = 0;
+	size_t tail = 0;
+
+	W.visit(source);
+	W.set_distance(source, 0);
+	W.set_n_paths(source, 1);
+	Q[tail++] = source;
+
+	while (head < tail) {
+		const node u = Q[head++];
 		if (u == target) {
-			st_dist = current_dist;
+			// all the nodes at a shorter distance have already
+			// been processed: the distance and the number of
+			// paths to the target are final
+			return;
 		}
-	};
 
-	// function to compute the shortest distance from source to node v
-	bfs_process_neighbour process_neighbour =
-	[&distances, &current_dist]
-	(const uxgraph *, node, node v, const vector<bool>& vis)
-	{
-		if (not vis[v]) {
-			distances.push(current_dist + 1);
-		}
-	};
-
-	BFS(G, source, terminate, process_current, process_neighbour);
+		const _new_ d = W.distance(u) + 1;
+		const size_t np = W.n_paths(u);
 
-	return st_dist;
+		for (node v : G->get_neighbours(u)) {
+			if (not W.is_visited(v)) {
+				// first time v is reached: shortest distance found
+				W.visit(v);
+				W.set_distance(v, d);
+				W.set_n_paths(v, np);
+				Q[tail++] = v;
+			}
+			else if (W.distance(v) == d) {
+				// another shortest path to v through u
+				W.set_n_paths(v, W.n_paths(v) + np);
+			}
+		}
+	}
 }
 
-_new_ uxdistance(const uxgraph *G, node source, node target, size_t& n_paths) {
-	vector<_new_> distances;
-	vector<size_t> paths;
-	uxdistance(G, source, distances, paths);
-	n_paths = paths[target];
-	return distances[target];
+template<class G_t>
+inline void generic_uxdistance(const G_t *G, node source, workspace<>& W) {
+	generic_uxdistance_from(G, source, G->n_nodes(), W);
 }
 
-/* VERTEX-ALL */
+// Distances from 'source', without the number of paths, computed with
+// the direction-optimizing BFS. Its bottom-up steps need the in-neighbours
+// of every node: in undirected graphs these are just the neighbours. The
+// reverse of a directed graph costs as much as a traversal to build, so
+// here directed graphs are traversed top-down only.
+template<class G_t>
+inline void generic_uxdistance_only
+(const G_t *G, node source, node target, workspace<>& W)
+{
+	const G_t *R = (G->is_directed() ? nullptr : G);
+	bfs::direction_optimizing_BFS(G, R, source, W, target);
+}
 
-void uxdistance(const uxgraph *G, node source, std::vector<_new_>& ds) {
-	const size_t N = G->n_nodes();
+template<class G_t>
+inline void generic_uxdistance
+(const G_t *G, node source, std::vector<_new_>& ds, workspace<> *ws)
+{
+	workspace<> local_ws;
+	workspace<>& W = (ws == nullptr ? local_ws : *ws);
+	generic_uxdistance_only(G, source, G->n_nodes(), W);
 
 	// distance from source to all nodes
-	ds = vector<_new_>(N, inf_t<_new_>());
-	ds[source] = 0;
+	ds.assign(G->n_nodes(), inf_t<_new_>());
+	for (node u : W.visited_nodes()) {
+		ds[u] = W.distance(u);
+	}
+}
 
-	// do NOT terminate: iterate through all nodes
-	bfs_terminate terminate =
-	[](const uxgraph *, node, const vector<bool>&)
-	{ return false; };
+template<class G_t>
+inline void generic_uxdistance(
+	const G_t *G, node source,
+	std::vector<_new_>& ds, std::vector<size_t>& n_paths,
+	workspace<> *ws
+)
+{
+	workspace<> local_ws;
+	workspace<>& W = (ws == nullptr ? local_ws : *ws);
+	generic_uxdistance(G, source, W);
 
-	// don't need to process the currently visited node
-	bfs_process_current process_current =
-	[](const uxgraph *, node, const vector<bool>&) { };
+	// distance from source to all nodes and
+	// number of paths between each pair of nodes
+	ds.assign(G->n_nodes(), inf_t<_new_>());
+	n_paths.assign(G->n_nodes(), 0);
+	for (node u : W.visited_nodes()) {
+		ds[u] = W.distance(u);
+		n_paths[u] = W.n_paths(u);
+	}
+}
 
-	// function to compute the shortest distance from source to node v
-	bfs_process_neighbour process_neighbour =
-	[&ds](const uxgraph *, node u, node v, const vector<bool>&)
-	{
-		_new_ d = ds[u] + 1;
-		if (d < ds[v]) {
-			ds[v] = d;
-		}
-	};
+/* VERTEX-VERTEX */
 
-	BFS(G, source, terminate, process_current, process_neighbour);
+template<class G_t>
+inline _new_ generic_uxdistance
+(const G_t *G, node source, node target, workspace<> *ws)
+{
+	workspace<> local_ws;
+	workspace<>& W = (ws == nullptr ? local_ws : *ws);
+
+	// terminate when the target node is found. Set to infinite
+	// for those targets not reachable from source.
+	generic_uxdistance_only(G, source, target, W);
+	return W.distance(target);
 }
 
-void uxdistance
-(const uxgraph *G, node source, std::vector<_new_>& ds, std::vector<size_t>& n_paths)
+template<class G_t>
+inline _new_ generic_uxdistance
+(const G_t *G, node source, node target, size_t& n_paths, workspace<> *ws)
 {
-	const size_t N = G->n_nodes();
+	workspace<> local_ws;
+	workspace<>& W = (ws == nullptr ? local_ws : *ws);
 
-	// distance from source to all nodes
-	ds = vector<_new_>(N, inf_t<_new_>());
-	ds[source] = 0;
-	// number of paths between each pair of nodes
-	n_paths = vector<size_t>(N, 0);
-	n_paths[source] = 1;
+	generic_uxdistance_from(G, source, target, W);
+	n_paths = W.n_paths(target);
+	return W.distance(target);
+}
 
-	// do NOT terminate: iterate through all nodes
-	bfs_terminate terminate =
-	[](const uxgraph *, node, const vector<bool>&)
-	{
-		return false;
-	};
+template<class G_t>
+inline _new_ generic_uxdistance_bidirectional(
+	const G_t *G, const csr_uxgraph *R, node source, node target,
+	workspace<> *ws_forward, workspace<> *ws_backward
+)
+{
+	workspace<> local_wf, local_wb;
+	workspace<>& Wf = (ws_forward == nullptr ? local_wf : *ws_forward);
+	workspace<>& Wb = (ws_backward == nullptr ? local_wb : *ws_backward);
+
+	node u, v;
+	if (R == nullptr) {
+		// an undirected graph is its own reverse
+		assert(not G->is_directed());
+		return bfs::bidirectional_BFS(G, G, source, target, Wf, Wb, u, v);
+	}
+	return bfs::bidirectional_BFS(G, R, source, target, Wf, Wb, u, v);
+}
 
-	// don't need to process the currently visited node
-	bfs_process_current process_current =
-	[](const uxgraph *, node, const vector<bool>&) { };
+/* ALL-ALL */
 
-	// function to compute the shortest distance from source to node v
-	bfs_process_neighbour process_neighbour =
-	[&ds, &n_paths](const uxgraph *, node u, node v, const vector<bool>&)
-	{
-		_new_ d = ds[u] + 1;
-		if (d < ds[v]) {
-			ds[v] = d;
-			n_paths[v] = n_paths[u];
-		}
-		else if (d == ds[v]) {
-			++n_paths[v];
-		}
-	};
+// Breadth-First Search from 'source' specialised for the computation
+// of distances. The distances are stored in 'ds' and, if 'np' is not
+// null, the number of shortest paths in 'np'. Both must have size N and
+// be initialised to infinite and 0 respectively: the distances are also
+// used to know which nodes have been visited. The queue 'Q' must have
+// size N, and can be reused across calls so as to avoid allocating
+// memory in every traversal.
+template<class G_t>
+inline void generic_uxdistance_from
+(const G_t *G, node source, vector<node>& Q, _new_ *ds, size_t *np)
+{
+	size_t head = 0;
+	size_t tail = 0;
 
-	BFS(G, source, terminate, process_current, process_neighbour);
+	ds[source] = 0;
+	if (np != nullptr) {
+		np[source] = 1;
+	}
+	Q[tail++] = source;
+
+	while (head < tail) {
+		const node u = Q[head++];
+		const _new_ d = ds[u] + 1;
+
+		for (node v : G->get_neighbours(u)) {
+			if (ds[v] == inf_t<_new_>()) {
+				// first time v is reached: shortest distance found
+				ds[v] = d;
+				if (np != nullptr) {
+					np[v] = np[u];
+				}
+				Q[tail++] = v;
+			}
+			else if (np != nullptr and ds[v] == d) {
+				// another shortest path to v through u
+				np[v] += np[u];
+			}
+		}
+	}
 }
 
-/* ALL-ALL */
-
-void uxdistances(const uxgraph *G, std::vector<std::vector<_new_> >& dist) {
+// The all-pairs distances are computed with a BFS from every node,
+// which costs O(N*M) instead of the O(N^3) of Floyd-Warshall. The
+// traversals are independent: they are distributed among the threads,
+// each of which has its own queue, and each writes only to the rows of
+// its own sources.
+
+// Without the number of paths, the traversals are bit-parallel: the
+// neighbourhoods scanned are shared by 64 sources at a time.
+template<class G_t>
+inline void generic_uxdistances
+(const G_t *G, std::vector<std::vector<_new_> >& dist, size_t n_threads)
+{
 	const size_t N = G->n_nodes();
 
 	// initialise data
 	dist = vector<vector<_new_> >(N, vector<_new_>(N, inf_t<_new_>()));
 
-	// initialise with edge weights (here always 1)
-	for (size_t u = 0; u < N; ++u) {
-		const neighbourhood& Nu = G->get_neighbours(u);
-		for (size_t v : Nu) {
-			dist[u][v] = 1;
+	bfs::all_sources_BFS(G,
+	[&](node s, node v, _new_ d) -> void { dist[s][v] = d; },
+	n_threads
+	);
+}
+
+// A lower bound of the largest distance between two nodes, which
+// determines the initial type of the distances of a compact matrix: the
+// eccentricity of the node of largest degree, found with a single BFS.
+template<class G_t>
+inline _new_ generic_uxmax_distance_lower_bound(const G_t *G) {
+	const size_t N = G->n_nodes();
+	if (N == 0) {
+		return 0;
+	}
+
+	node hub = 0;
+	for (node u = 1; u < N; ++u) {
+		if (G->degree(u) > G->degree(hub)) {
+			hub = u;
 		}
 	}
 
-	// find the all-to-all distance (N^3)
-	for (size_t w = 0; w < N; ++w) {
-		// distance from a vertex to itself is 0
-		dist[w][w] = 0;
+	workspace<> W;
+	generic_uxdistance_only(G, hub, N, W);
+	_new_ ecc = 0;
+	for (node u : W.visited_nodes()) {
+		ecc = std::max(ecc, W.distance(u));
+	}
+	return ecc;
+}
 
-		for (size_t u = 0; u < N; ++u) {
-			for (size_t v = 0; v < N; ++v) {
+// The matrix is filled in a single pass over all sources. The distances
+// that do not fit in the initial type are not stored, but their sources
+// are recorded by the thread that traverses them, together with the
+// largest distance found. The matrix is then widened and only the
+// sources recorded are traversed again.
+template<class G_t>
+inline void generic_uxdistances
+(const G_t *G, distance_matrix& dist, size_t n_threads)
+{
+	const size_t N = G->n_nodes();
+	const bool directed = G->is_directed();
+	dist.init(N, not directed, generic_uxmax_distance_lower_bound(G));
+	const _new_ cap = dist.capacity();
+
+	vector<node> sources(N);
+	iota(sources.begin(), sources.end(), 0);
+
+	// largest distance and sources overflowed of every thread
+	const size_t n_used = utils::n_threads_used(n_threads, (N + 63)/64);
+	vector<_new_> M(n_used, 0);
+	vector<vector<node> > overflowed(n_used);
+	vector<char> is_overflowed(N, 0);
+
+	// every pair of nodes is written by the thread of its first node
+	bfs::sources_BFS(G, sources,
+	[&](size_t tid, size_t s, node v, _new_ d) -> void {
+		if (not directed and v < s) {
+			return;
+		}
+		M[tid] = std::max(M[tid], d);
+		if (d <= cap) {
+			dist.set(s, v, d);
+		}
+		else if (not is_overflowed[s]) {
+			is_overflowed[s] = 1;
+			overflowed[tid].push_back(s);
+		}
+	},
+	n_threads
+	);
 
-				// ignore the cases where:
-				// the path is not moving
-				if (u == v) {
-					continue;
-				}
-				// the distances are infinite
-				if (dist[u][w] == inf_t<_new_>()) {
-					continue;
-				}
-				if (dist[w][v] == inf_t<_new_>()) {
-					continue;
-				}
+	sources.clear();
+	for (const vector<node>& o : overflowed) {
+		sources.insert(sources.end(), o.begin(), o.end());
+	}
+	if (sources.empty()) {
+		return;
+	}
 
-				size_t d = dist[u][w] + dist[w][v];
-				if (d < dist[u][v]) {
-					dist[u][v] = dist[u][w] + dist[w][v];
-				}
-			}
+	dist.widen(*max_element(M.begin(), M.end()));
+	bfs::sources_BFS(G, sources,
+	[&](size_t, size_t i, node v, _new_ d) -> void {
+		if (d > cap and (directed or sources[i] < v)) {
+			dist.set(sources[i], v, d);
 		}
-	}
+	},
+	n_threads
+	);
 }
 
-void uxdistances(
-	const uxgraph *G,
+// Sum of the distances from every node to all the nodes it reaches.
+template<class G_t>
+inline void generic_uxdistance_sums
+(const G_t *G, std::vector<_new_>& sums, size_t n_threads)
+{
+	sums.assign(G->n_nodes(), 0);
+
+	bfs::all_sources_BFS(G,
+	[&](node s, node, _new_ d) -> void { sums[s] += d; },
+	n_threads
+	);
+}
+
+template<class G_t>
+inline void generic_uxdistances(
+	const G_t *G,
 	std::vector<std::vector<_new_> >& dist,
-	std::vector<std::vector<size_t> >& n_paths
+	std::vector<std::vector<size_t> >& n_paths,
+	size_t n_threads
 )
 {
 	const size_t N = G->n_nodes();
@@ -217,59 +365,147 @@ void uxdistances(
 	// initialise data
 	dist = vector<vector<_new_> >(N, vector<_new_>(N, inf_t<_new_>()));
 	n_paths = vector<vector<size_t> >(N, vector<size_t>(N, 0));
+	vector<vector<node> > Q(utils::n_threads_used(n_threads, N), vector<node>(N));
 
-	// initialise with edge weights (here always 1) the distance and the
-	// number of shortest-paths from u to all its neighbours
-	for (size_t u = 0; u < N; ++u) {
-		const neighbourhood& Nu = G->get_neighbours(u);
-		for (size_t v : Nu) {
-			dist[u][v] = 1;
-			n_paths[u][v] = 1;
-		}
+	utils::parallel_for(N, n_threads,
+	[&](size_t tid, node s) -> void
+	{
+		generic_uxdistance_from(G, s, Q[tid], dist[s].data(), n_paths[s].data());
 	}
+	);
+}
 
-	// find the all-to-all distance (N^3)
-	for (size_t w = 0; w < N; ++w) {
-		// distance from a vertex to itself is 0
-		dist[w][w] = 0;
-		n_paths[w][w] = 1;
+/* VERTEX-VERTEX */
 
-		for (size_t u = 0; u < N; ++u) {
-			for (size_t v = 0; v < N; ++v) {
+_new_ uxdistance(const uxgraph *G, node source, node target, workspace<> *ws) {
+	return generic_uxdistance(G, source, target, ws);
+}
 
-				// ignore the cases where:
-				// the path is not moving
-				if (u == v) {
-					continue;
-				}
-				// the distances are infinite
-				if (dist[u][w] == inf_t<_new_>()) {
-					continue;
-				}
-				if (dist[w][v] == inf_t<_new_>()) {
-					continue;
-				}
+_new_ uxdistance
+(const uxgraph *G, node source, node target, size_t& n_paths, workspace<> *ws)
+{
+	return generic_uxdistance(G, source, target, n_paths, ws);
+}
 
-				size_t d = dist[u][w] + dist[w][v];
-				if (d < dist[u][v]) {
-					// this is a shorter path than the shortest found so far
-					dist[u][v] = dist[u][w] + dist[w][v];
+_new_ uxdistance_bidirectional(
+	const uxgraph *G, const csr_uxgraph *R, node source, node target,
+	workspace<> *ws_forward, workspace<> *ws_backward
+)
+{
+	return generic_uxdistance_bidirectional
+	(G, R, source, target, ws_forward, ws_backward);
+}
 
-					if (u != w and w != v) {
-						n_paths[u][v] = n_paths[u][w]*n_paths[w][v];
-					}
-				}
-				else if (d == dist[u][v]) {
-					// this is a path as short as the shortest found so far
-					if (u != w and w != v) {
-						n_paths[u][v] += n_paths[u][w]*n_paths[w][v];
-					}
-				}
-			}
-		}
-	}
+_new_ uxdistance(const csr_uxgraph *G, node source, node target, workspace<> *ws) {
+	return generic_uxdistance(G, source, target, ws);
+}
+
+_new_ uxdistance
+(const csr_uxgraph *G, node source, node target, size_t& n_paths, workspace<> *ws)
+{
+	return generic_uxdistance(G, source, target, n_paths, ws);
+}
+
+_new_ uxdistance_bidirectional(
+	const csr_uxgraph *G, const csr_uxgraph *R, node source, node target,
+	workspace<> *ws_forward, workspace<> *ws_backward
+)
+{
+	return generic_uxdistance_bidirectional
+	(G, R, source, target, ws_forward, ws_backward);
+}
+
+/* VERTEX-ALL */
+
+void uxdistance
+(const uxgraph *G, node source, std::vector<_new_>& ds, workspace<> *ws)
+{
+	generic_uxdistance(G, source, ds, ws);
+}
+
+void uxdistance(
+	const uxgraph *G, node source,
+	std::vector<_new_>& ds, std::vector<size_t>& n_paths,
+	workspace<> *ws
+)
+{
+	generic_uxdistance(G, source, ds, n_paths, ws);
+}
+
+void uxdistance(const uxgraph *G, node source, workspace<>& ws) {
+	generic_uxdistance(G, source, ws);
+}
+
+void uxdistance
+(const csr_uxgraph *G, node source, std::vector<_new_>& ds, workspace<> *ws)
+{
+	generic_uxdistance(G, source, ds, ws);
+}
+
+void uxdistance(
+	const csr_uxgraph *G, node source,
+	std::vector<_new_>& ds, std::vector<size_t>& n_paths,
+	workspace<> *ws
+)
+{
+	generic_uxdistance(G, source, ds, n_paths, ws);
+}
+
+void uxdistance(const csr_uxgraph *G, node source, workspace<>& ws) {
+	generic_uxdistance(G, source, ws);
+}
+
+/* ALL-ALL */
+
+void uxdistances
+(const uxgraph *G, std::vector<std::vector<_new_> >& dist, size_t n_threads)
+{
+	generic_uxdistances(G, dist, n_threads);
+}
+
+void uxdistances(
+	const uxgraph *G,
+	std::vector<std::vector<_new_> >& dist,
+	std::vector<std::vector<size_t> >& n_paths,
+	size_t n_threads
+)
+{
+	generic_uxdistances(G, dist, n_paths, n_threads);
+}
+
+void uxdistances(const uxgraph *G, distance_matrix& dist, size_t n_threads) {
+	generic_uxdistances(G, dist, n_threads);
+}
+
+void uxdistance_sums(const uxgraph *G, std::vector<_new_>& sums, size_t n_threads) {
+	generic_uxdistance_sums(G, sums, n_threads);
+}
+
+void uxdistances
+(const csr_uxgraph *G, std::vector<std::vector<_new_> >& dist, size_t n_threads)
+{
+	generic_uxdistances(G, dist, n_threads);
+}
+
+void uxdistances(
+	const csr_uxgraph *G,
+	std::vector<std::vector<_new_> >& dist,
+	std::vector<std::vector<size_t> >& n_paths,
+	size_t n_threads
+)
+{
+	generic_uxdistances(G, dist, n_paths, n_threads);
+}
+
+void uxdistances(const csr_uxgraph *G, distance_matrix& dist, size_t n_threads) {
+	generic_uxdistances(G, dist, n_threads);
+}
+
+void uxdistance_sums
+(const csr_uxgraph *G, std::vector<_new_>& sums, size_t n_threads)
+{
+	generic_uxdistance_sums(G, sums, n_threads);
 }
 
 } // -- namespace traversal
 } // -- namespace lgraph
-
@@ -21,245 +21,368 @@
 
 #include <lgraph/graph_traversal/traversal_wx.hpp>
 
+// C++ includes
+#include <algorithm>
+#include <cmath>
+#include <functional>
+
 // lgraph includes
+#include <lgraph/graph_traversal/delta_stepping.hpp>
 #include <lgraph/graph_traversal/dijkstra.hpp>
+#include <lgraph/utils/parallel.hpp>
 
 namespace lgraph {
 namespace traversal {
 
+/* VERTEX-ALL */
+
+// Dijkstra's algorithm from 'source' specialised for the computation
+// of distances and of the number of shortest paths, which are left in
+// the workspace 'W'. The traversal stops when 'target' is reached, if
+// it is a node of the graph. Resetting the workspace costs O(k), where
+// k is the number of nodes reached in the previous traversal.
+template<class T, class G_t>
+inline void generic_wxdistance_from
+(const G_t *G, node source, node target, workspace<T>& W)
+{
+	W.init(G->n_nodes(), true);
+
+	// priority queue: smaller distances are at the top
+	dijkstra::default_queue<T> Q(W);
+
+	W.set_distance(source, 0);
+	W.set_n_paths(source, 1);
+	Q.push(0, source);
+
+	while (not Q.empty()) {
+		const node u = Q.top().second;
+		Q.pop();
+
+		if (W.is_visited(u)) {
+			continue;
+		}
+		W.visit(u);
+		if (u == target) {
+			return;
+		}
+
+		const T d_u = W.distance(u);
+		const size_t np_u = W.n_paths(u);
+
+		const auto& Nu = G->get_neighbours(u);
+		const auto& wu = G->get_weights(u);
+
+		auto wu_it = wu.begin();
+		for (auto Nu_it = Nu.begin(); Nu_it != Nu.end(); ++Nu_it, ++wu_it) {
+			const node v = *Nu_it;
+			const T d = d_u + *wu_it;
+			const T d_v = W.distance(v);
+
+			if (d + static_cast<T>(1.0e-5) < d_v) {
+				// shorter path from source to v
+				W.set_distance(v, d);
+				W.set_n_paths(v, np_u);
+				Q.push(d, v);
+			}
+			else if (equal_lengths(d, d_v)) {
+				// equally long path from source to v
+				W.set_n_paths(v, W.n_paths(v) + np_u);
+			}
+		}
+	}
+}
+
+template<class T, class G_t>
+inline void generic_wxdistance(const G_t *G, node source, workspace<T>& W) {
+	assert(G->has_node(source));
+	generic_wxdistance_from(G, source, G->n_nodes(), W);
+}
+
+template<class T, class G_t>
+inline void generic_wxdistance
+(const G_t *G, node source, std::vector<T>& ds, workspace<T> *ws)
+{
+	workspace<T> local_ws;
+	workspace<T>& W = (ws == nullptr ? local_ws : *ws);
+	generic_wxdistance(G, source, W);
+
+	// distance from source to all nodes
+	ds.assign(G->n_nodes(), inf_t<T>());
+	for (node u : W.visited_nodes()) {
+		ds[u] = W.distance(u);
+	}
+}
+
+template<class T, class G_t>
+inline void generic_wxdistance(
+	const G_t *G, node source,
+	std::vector<T>& ds, std::vector<size_t>& n_paths,
+	workspace<T> *ws
+)
+{
+	workspace<T> local_ws;
+	workspace<T>& W = (ws == nullptr ? local_ws : *ws);
+	generic_wxdistance(G, source, W);
+
+	// distance from source to all nodes and number of
+	// paths between the source and the rest of nodes
+	ds.assign(G->n_nodes(), inf_t<T>());
+	n_paths.assign(G->n_nodes(), 0);
+	for (node u : W.visited_nodes()) {
+		ds[u] = W.distance(u);
+		n_paths[u] = W.n_paths(u);
+	}
+}
+
 /* VERTEX-VERTEX */
 
-template<class T>
-T wxdistance(const wxgraph<T> *G, node source, node target) {
+template<class T, class G_t>
+inline T generic_wxdistance
+(const G_t *G, node source, node target, workspace<T> *ws)
+{
 	assert(G->has_node(source));
 	assert(G->has_node(target));
 
-	// distance from source to target. Set to infinite
-	// for those targets not reachable from source.
-	T st_dist = inf_t<T>();
+	workspace<T> local_ws;
+	workspace<T>& W = (ws == nullptr ? local_ws : *ws);
 
 	// DO terminate when target node is found. Dijkstra guarantees that
-	// when this happens the shortest distance was found
-	dijkstra::djka_terminate<T> terminate =
-	[&target]
-	(const wxgraph<T> *,const dijkstra::djka_node<T>& u, const std::vector<bool>&) -> bool
-	{
-		return u.second == target;
-	};
+	// when this happens the shortest distance was found. Set to infinite
+	// for those targets not reachable from source.
+	generic_wxdistance_from(G, source, target, W);
+	return W.distance(target);
+}
 
-	// function to retrieve the shortest distance from source to node v
-	dijkstra::djka_process_current<T> proc_curr =
-	[&target, &st_dist]
-	(const wxgraph<T> *, const dijkstra::djka_node<T>& u, const std::vector<bool>&)
-	{
-		if (u.second == target) {
-			st_dist = u.first;
-		}
-	};
+template<class T, class G_t>
+inline T generic_wxdistance
+(const G_t *G, node source, node target, size_t& n_paths, workspace<T> *ws)
+{
+	assert(G->has_node(source));
+	assert(G->has_node(target));
 
-	dijkstra::Dijkstra(G, source, terminate, proc_curr);
+	workspace<T> local_ws;
+	workspace<T>& W = (ws == nullptr ? local_ws : *ws);
 
-	return st_dist;
+	// do NOT terminate at the target: the paths through nodes at
+	// (almost) the same distance as the target may not be counted yet
+	generic_wxdistance_from(G, source, G->n_nodes(), W);
+	n_paths = W.n_paths(target);
+	return W.distance(target);
 }
 
-template<class T>
-T wxdistance(const wxgraph<T> *G, node source, node target, size_t& n_paths) {
+template<class T, class G_t>
+inline T generic_wxdistance_bidirectional(
+	const G_t *G, const csr_wxgraph<T> *R, node source, node target,
+	workspace<T> *ws_forward, workspace<T> *ws_backward
+)
+{
 	assert(G->has_node(source));
 	assert(G->has_node(target));
 
-	std::vector<T> distances;
-	std::vector<size_t> paths;
-	wxdistance(G, source, distances, paths);
-	n_paths = paths[target];
-	return distances[target];
+	workspace<T> local_wf, local_wb;
+	workspace<T>& Wf = (ws_forward == nullptr ? local_wf : *ws_forward);
+	workspace<T>& Wb = (ws_backward == nullptr ? local_wb : *ws_backward);
+
+	node u, v;
+	if (R == nullptr) {
+		// an undirected graph is its own reverse
+		assert(not G->is_directed());
+		return dijkstra::bidirectional_Dijkstra(G, G, source, target, Wf, Wb, u, v);
+	}
+	return dijkstra::bidirectional_Dijkstra(G, R, source, target, Wf, Wb, u, v);
 }
 
-/* VERTEX-ALL */
+/* ALL-ALL */
 
-template<class T>
-void wxdistance(const wxgraph<T> *G, node source, std::vector<T>& ds) {
-	assert(G->has_node(source));
+// The all-pairs distances are computed with Dijkstra's algorithm from
+// every node, which costs O(N*M*log(N)) instead of the O(N^3) of
+// Floyd-Warshall. The traversals are independent: they are distributed
+// among the threads, each of which has its own workspace, and each writes
+// only to the rows of its own sources.
 
+template<class T, class G_t>
+inline void generic_wxdistances
+(const G_t *G, std::vector<std::vector<T> >& dist, size_t n_threads)
+{
 	const size_t N = G->n_nodes();
+	dist = std::vector<std::vector<T> >(N);
+	std::vector<workspace<T> > W(utils::n_threads_used(n_threads, N));
 
-	// distance from source to all nodes
-	ds = std::vector<T>(N, inf_t<T>());
-	ds[source] = 0;
-
-	// do NOT terminate: iterate through all nodes
-	dijkstra::djka_terminate<T> terminate =
-	[](const wxgraph<T> *, const dijkstra::djka_node<T>&, const std::vector<bool>&) -> bool
-	{ return false; };
+	utils::parallel_for(N, n_threads,
+	[&](size_t tid, node s) -> void
+	{
+		generic_wxdistance(G, s, dist[s], &W[tid]);
+	}
+	);
+}
 
-	// don't need to process the currently visited node
-	dijkstra::djka_process_current<T> proc_curr =
-	[](const wxgraph<T> *, const dijkstra::djka_node<T>&, const std::vector<bool>&) { };
+template<class T, class G_t>
+inline void generic_wxdistances(
+	const G_t *G,
+	std::vector<std::vector<T> >& dist,
+	std::vector<std::vector<size_t> >& n_paths,
+	size_t n_threads
+)
+{
+	const size_t N = G->n_nodes();
+	dist = std::vector<std::vector<T> >(N);
+	n_paths = std::vector<std::vector<size_t> >(N);
+	std::vector<workspace<T> > W(utils::n_threads_used(n_threads, N));
 
-	// function to compute the shortest distance from source to node v
-	dijkstra::djka_process_neighbour<T> proc_neig =
-	[&ds](const wxgraph<T> *, node u, node v, T w, const std::vector<bool>&) -> bool
+	utils::parallel_for(N, n_threads,
+	[&](size_t tid, node s) -> void
 	{
-		bool add = false;
-		if (ds[u] + w + static_cast<T>(1.0e-5) < ds[v]) {
-			ds[v] = ds[u] + w;
-			add = true;
-		}
-		return add;
-	};
+		generic_wxdistance(G, s, dist[s], n_paths[s], &W[tid]);
+	}
+	);
+}
+
+/* VERTEX-VERTEX */
+
+template<class T>
+T wxdistance(const wxgraph<T> *G, node source, node target, workspace<T> *ws) {
+	return generic_wxdistance<T>(G, source, target, ws);
+}
+
+template<class T>
+T wxdistance
+(const wxgraph<T> *G, node source, node target, size_t& n_paths, workspace<T> *ws)
+{
+	return generic_wxdistance<T>(G, source, target, n_paths, ws);
+}
+
+template<class T>
+T wxdistance_bidirectional(
+	const wxgraph<T> *G, const csr_wxgraph<T> *R, node source, node target,
+	workspace<T> *ws_forward, workspace<T> *ws_backward
+)
+{
+	return generic_wxdistance_bidirectional<T>
+	(G, R, source, target, ws_forward, ws_backward);
+}
 
-	dijkstra::Dijkstra(G, source, terminate, proc_curr, proc_neig);
+template<class T>
+T wxdistance(const csr_wxgraph<T> *G, node source, node target, workspace<T> *ws) {
+	return generic_wxdistance<T>(G, source, target, ws);
 }
 
+template<class T>
+T wxdistance
+(const csr_wxgraph<T> *G, node source, node target, size_t& n_paths, workspace<T> *ws)
+{
+	return generic_wxdistance<T>(G, source, target, n_paths, ws);
+}
+
+template<class T>
+T wxdistance_bidirectional(
+	const csr_wxgraph<T> *G, const csr_wxgraph<T> *R, node source, node target,
+	workspace<T> *ws_forward, workspace<T> *ws_backward
+)
+{
+	return generic_wxdistance_bidirectional<T>
+	(G, R, source, target, ws_forward, ws_backward);
+}
+
+/* VERTEX-ALL */
+
 template<class T>
 void wxdistance
-(const wxgraph<T> *G, node source, std::vector<T>& ds, std::vector<size_t>& n_paths)
+(const wxgraph<T> *G, node source, std::vector<T>& ds, workspace<T> *ws)
 {
-	assert(G->has_node(source));
+	generic_wxdistance(G, source, ds, ws);
+}
 
-	const size_t N = G->n_nodes();
+template<class T>
+void wxdistance(
+	const wxgraph<T> *G, node source,
+	std::vector<T>& ds, std::vector<size_t>& n_paths,
+	workspace<T> *ws
+)
+{
+	generic_wxdistance(G, source, ds, n_paths, ws);
+}
 
-	// distance from source to all nodes
-	ds = std::vector<T>(N, inf_t<T>());
-	ds[source] = 0;
-	// number of paths between the source and the rest of nodes
-	n_paths = std::vector<size_t>(N, 0);
-	n_paths[source] = 1;
-
-	// do NOT terminate: iterate through all nodes
-	dijkstra::djka_terminate<T> terminate =
-	[](const wxgraph<T> *, const dijkstra::djka_node<T>&, const std::vector<bool>&) -> bool
-	{ return false; };
-
-	// don't need to process the currently visited node
-	dijkstra::djka_process_current<T> proc_curr =
-	[](const wxgraph<T> *, const dijkstra::djka_node<T>&, const std::vector<bool>&) { };
-
-	// function to compute the shortest distance from source to node v
-	dijkstra::djka_process_neighbour<T> proc_neig =
-	[&ds, &n_paths]
-	(const wxgraph<T> *, node u, node v, const T& w, const std::vector<bool>&) -> bool
-	{
-		bool add = false;
-		T d = ds[u] + w;
-		if (d + static_cast<T>(1.0e-5) < ds[v]) {
-			ds[v] = d;
-			n_paths[v] = n_paths[u];
-			add = true;
-		}
-		else if (std::abs(d - ds[v]) <= static_cast<T>(1.0e-5)) {
-			n_paths[v] += n_paths[u];
-			add = true;
-		}
-		return add;
-	};
+template<class T>
+void wxdistance(const wxgraph<T> *G, node source, workspace<T>& ws) {
+	generic_wxdistance(G, source, ws);
+}
 
-	dijkstra::Dijkstra(G, source, terminate, proc_curr, proc_neig);
+template<class T>
+void wxdistance_delta_stepping(
+	const wxgraph<T> *G, node source, std::vector<T>& ds,
+	T delta, size_t n_threads
+)
+{
+	delta_stepping(G, source, ds, delta, n_threads);
 }
 
-/* ALL-ALL */
+template<class T>
+void wxdistance
+(const csr_wxgraph<T> *G, node source, std::vector<T>& ds, workspace<T> *ws)
+{
+	generic_wxdistance(G, source, ds, ws);
+}
 
 template<class T>
-void wxdistances(const wxgraph<T> *G, std::vector<std::vector<T> >& dist) {
-	const size_t N = G->n_nodes();
+void wxdistance(
+	const csr_wxgraph<T> *G, node source,
+	std::vector<T>& ds, std::vector<size_t>& n_paths,
+	workspace<T> *ws
+)
+{
+	generic_wxdistance(G, source, ds, n_paths, ws);
+}
 
-	// initialise data
-	dist = std::vector<std::vector<T> >(N, std::vector<T>(N, inf_t<T>()));
+template<class T>
+void wxdistance(const csr_wxgraph<T> *G, node source, workspace<T>& ws) {
+	generic_wxdistance(G, source, ws);
+}
 
-	// initialise with edge weights
-	for (size_t u = 0; u < N; ++u) {
-		const neighbourhood& Nu = G->get_neighbours(u);
-		for (size_t v : Nu) {
-			dist[u][v] = G->edge_weight(u,v);
-		}
-	}
+template<class T>
+void wxdistance_delta_stepping(
+	const csr_wxgraph<T> *G, node source, std::vector<T>& ds,
+	T delta, size_t n_threads
+)
+{
+	delta_stepping(G, source, ds, delta, n_threads);
+}
 
-	// find the all-to-all distance (N^3)
-	for (size_t w = 0; w < N; ++w) {
-		// distance from a vertex to itself is 0
-		dist[w][w] = 0;
-
-		for (size_t u = 0; u < N; ++u) {
-			for (size_t v = 0; v < N; ++v) {
-
-				if (u == v) {
-					continue;
-				}
-				if (dist[u][w] == inf_t<T>()) {
-					continue;
-				}
-				if (dist[w][v] == inf_t<T>()) {
-					continue;
-				}
-
-				T d = dist[u][w] + dist[w][v];
-				if (d + static_cast<T>(1.0e-5) < dist[u][v]) {
-					dist[u][v] = d;
-				}
-			}
-		}
-	}
+/* ALL-ALL */
+
+template<class T>
+void wxdistances
+(const wxgraph<T> *G, std::vector<std::vector<T> >& dist, size_t n_threads)
+{
+	generic_wxdistances(G, dist, n_threads);
 }
 
 template<class T>
 void wxdistances(
 	const wxgraph<T> *G,
 	std::vector<std::vector<T> >& dist,
-	std::vector<std::vector<size_t> >& n_paths
+	std::vector<std::vector<size_t> >& n_paths,
+	size_t n_threads
 )
 {
-	const size_t N = G->n_nodes();
+	generic_wxdistances(G, dist, n_paths, n_threads);
+}
 
-	// initialise data
-	dist = std::vector<std::vector<T> >(N, std::vector<T>(N, inf_t<T>()));
-	n_paths = std::vector<std::vector<size_t> >(N, std::vector<size_t>(N, 0));
-
-	// initialise with edge weights (here always 1) the distance and the
-	// number of shortest-paths from u to all its neighbours
-	for (size_t u = 0; u < N; ++u) {
-		const neighbourhood& Nu = G->get_neighbours(u);
-		for (size_t v : Nu) {
-			dist[u][v] = G->edge_weight(u,v);
-			n_paths[u][v] = 1;
-		}
-	}
+template<class T>
+void wxdistances
+(const csr_wxgraph<T> *G, std::vector<std::vector<T> >& dist, size_t n_threads)
+{
+	generic_wxdistances(G, dist, n_threads);
+}
 
-	// find the all-to-all distance (N^3)
-	for (size_t w = 0; w < N; ++w) {
-		// distance from a vertex to itself is 0
-		dist[w][w] = 0;
-		n_paths[w][w] = 1;
-
-		for (size_t u = 0; u < N; ++u) {
-			for (size_t v = 0; v < N; ++v) {
-
-				if (u == v) {
-					continue;
-				}
-				if (dist[u][w] == inf_t<T>()) {
-					continue;
-				}
-				if (dist[w][v] == inf_t<T>()) {
-					continue;
-				}
-
-				T d = dist[u][w] + dist[w][v];
-				if (d + static_cast<T>(1.0e-5) < dist[u][v]) {
-					// this is a shorter path than the shortest found so far
-					dist[u][v] = d;
-
-					if (u != w and w != v) {
-						n_paths[u][v] = n_paths[u][w]*n_paths[w][v];
-					}
-				}
-				else if (std::abs(d - dist[u][v]) <= static_cast<T>(1.0e-5)) {
-					// this is a path as short as the shortest found so far
-					if (u != w and w != v) {
-						n_paths[u][v] += n_paths[u][w]*n_paths[w][v];
-					}
-				}
-			}
-		}
-	}
+template<class T>
+void wxdistances(
+	const csr_wxgraph<T> *G,
+	std::vector<std::vector<T> >& dist,
+	std::vector<std::vector<size_t> >& n_paths,
+	size_t n_threads
+)
+{
+	generic_wxdistances(G, dist, n_paths, n_threads);
 }
 
 } // -- namespace traversal
@@ -0,0 +1,328 @@
+/*********************************************************************
+ * lgraph
+ * Copyright (C) 2018-2019 Lluís Alemany Puig
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ * 
+ * Contact: Lluís Alemany Puig (lluis.alemany.puig@gmail.com)
+ * 
+ ********************************************************************/
+
+
+#include <lgraph/graph_traversal/traversal_wx.hpp>
+
+// C includes
+#include <assert.h>
+
+// C++ includes
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+// lgraph includes
+#include <lgraph/graph_traversal/dijkstra.hpp>
+#include <lgraph/utils/parallel.hpp>
+
+namespace lgraph {
+namespace traversal {
+
+/* LANDMARKS */
+
+// Stores the distance from 'source' to every node u of X at position
+// u*K + i of 'ds', the layout of the distances of a landmark_index. The
+// positions of the nodes not reachable from 'source' are not modified.
+template<class T, class X_t>
+inline void landmark_distances(
+	const X_t *X, node source, size_t K, size_t i,
+	std::vector<T>& ds, workspace<T>& W
+)
+{
+	dijkstra::Dijkstra<T>(
+		X, source, dijkstra::djka_no_op(),
+		[&](const X_t *, const dijkstra::djka_node<T>& u, const std::vector<bool>&)
+		-> void
+		{
+			ds[u.second*K + i] = u.first;
+		},
+		dijkstra::djka_always_add(), &W
+	);
+}
+
+template<class T, class G_t>
+inline void generic_wxlandmarks(
+	const G_t *G, const csr_wxgraph<T> *R,
+	const std::vector<node>& landmarks, landmark_index<T>& idx,
+	size_t n_threads
+)
+{
+	const bool directed = G->is_directed();
+	assert(not directed or R != nullptr);
+
+	const size_t N = G->n_nodes();
+	const size_t K = landmarks.size();
+	std::vector<T> from(N*K, inf_t<T>());
+	std::vector<T> to(directed ? N*K : 0, inf_t<T>());
+
+	// every traversal writes the distances of its own landmark
+	std::vector<workspace<T> > W(utils::n_threads_used(n_threads, K));
+	utils::parallel_for(K, n_threads,
+	[&](size_t tid, size_t i) -> void
+	{
+		landmark_distances(G, landmarks[i], K, i, from, W[tid]);
+		if (directed) {
+			// an edge (a,b) of R is the edge (b,a) of G
+			landmark_distances(R, landmarks[i], K, i, to, W[tid]);
+		}
+	}
+	);
+
+	idx.init(N, directed, std::vector<node>(landmarks), std::move(from), std::move(to));
+}
+
+template<class T, class G_t>
+inline void generic_wxlandmarks
+(const G_t *G, const csr_wxgraph<T> *R, size_t K, landmark_index<T>& idx)
+{
+	const bool directed = G->is_directed();
+	assert(not directed or R != nullptr);
+
+	const size_t N = G->n_nodes();
+	K = std::min(K, N);
+
+	std::vector<node> landmarks;
+	std::vector<bool> is_landmark(N, false);
+	std::vector<T> from(N*K, inf_t<T>());
+	std::vector<T> to(directed ? N*K : 0, inf_t<T>());
+	workspace<T> W;
+
+	// distance from every node to its closest landmark, the
+	// first of which is the node farthest from node 0
+	std::vector<T> closest(N, inf_t<T>());
+	if (K > 0) {
+		landmark_distances(G, 0, 1, 0, closest, W);
+	}
+
+	for (size_t i = 0; i < K; ++i) {
+		// the farthest node, nodes not reachable being the farthest
+		node l = N;
+		for (node u = 0; u < N; ++u) {
+			if (not is_landmark[u] and (l == N or closest[u] > closest[l])) {
+				l = u;
+			}
+		}
+		if (i == 0) {
+			closest.assign(N, inf_t<T>());
+		}
+
+		landmarks.push_back(l);
+		is_landmark[l] = true;
+		landmark_distances(G, l, K, i, from, W);
+		if (directed) {
+			landmark_distances(R, l, K, i, to, W);
+		}
+
+		for (node u = 0; u < N; ++u) {
+			T d = from[u*K + i];
+			if (directed) {
+				// length of the round trip
+				const T d_to = to[u*K + i];
+				d = (d == inf_t<T>() or d_to == inf_t<T>() ? inf_t<T>() : d + d_to);
+			}
+			closest[u] = std::min(closest[u], d);
+		}
+	}
+
+	idx.init(N, directed, std::move(landmarks), std::move(from), std::move(to));
+}
+
+// The A* search of [1] from 'source' to 'target': the potential of every
+// node is the lower bound of its distance to 'target' given by 'idx',
+// which is consistent, so every node is settled at most once and at its
+// shortest distance, as in Dijkstra's algorithm. The distance and the
+// parent of the nodes reached are left in the workspace 'W'. The nodes
+// that the landmarks prove that do not reach 'target' are never pushed.
+//
+// [1] Goldberg, A. V. and Harrelson, C., "Computing the shortest path: A*
+// search meets graph theory", SODA, 2005.
+template<class T, class G_t>
+inline T generic_wxdistance_landmarks_from
+(const G_t *G, const landmark_index<T>& idx, node source, node target, workspace<T>& W)
+{
+	assert(G->has_node(source));
+	assert(G->has_node(target));
+	assert(idx.n_nodes() == G->n_nodes());
+
+	W.init(G->n_nodes(), true);
+	W.set_distance(source, 0);
+
+	const T h_source = idx.lower_bound(source, target);
+	if (h_source == inf_t<T>()) {
+		return inf_t<T>();
+	}
+
+	// priority queue: smaller distance plus potential at the top
+	dijkstra::default_queue<T> Q(W);
+	Q.push(h_source, source);
+
+	while (not Q.empty()) {
+		const node u = Q.top().second;
+		Q.pop();
+
+		if (W.is_visited(u)) {
+			continue;
+		}
+		W.visit(u);
+		if (u == target) {
+			return W.distance(u);
+		}
+
+		const T d_u = W.distance(u);
+
+		const auto& Nu = G->get_neighbours(u);
+		const auto& wu = G->get_weights(u);
+
+		auto wu_it = wu.begin();
+		for (auto Nu_it = Nu.begin(); Nu_it != Nu.end(); ++Nu_it, ++wu_it) {
+			const node v = *Nu_it;
+			const T d = d_u + *wu_it;
+
+			if (d + static_cast<T>(1.0e-5) < W.distance(v)) {
+				const T h_v = idx.lower_bound(v, target);
+				if (h_v == inf_t<T>()) {
+					continue;
+				}
+				W.set_distance(v, d);
+				W.set_parent(v, u);
+				Q.push(d + h_v, v);
+			}
+		}
+	}
+	return inf_t<T>();
+}
+
+template<class T, class G_t>
+inline T generic_wxdistance_landmarks(
+	const G_t *G, const landmark_index<T>& idx, node source, node target,
+	workspace<T> *ws
+)
+{
+	workspace<T> local_ws;
+	workspace<T>& W = (ws == nullptr ? local_ws : *ws);
+	return generic_wxdistance_landmarks_from(G, idx, source, target, W);
+}
+
+template<class T, class G_t>
+inline void generic_wxpath_landmarks(
+	const G_t *G, const landmark_index<T>& idx, node source, node target,
+	node_path<T>& p, workspace<T> *ws
+)
+{
+	workspace<T> local_ws;
+	workspace<T>& W = (ws == nullptr ? local_ws : *ws);
+	const T d = generic_wxdistance_landmarks_from(G, idx, source, target, W);
+
+	p.empty();
+	if (d == inf_t<T>()) {
+		return;
+	}
+
+	// from the target back to the source
+	const node N = G->n_nodes();
+	for (node l = target; l != N; l = W.parent(l)) {
+		p.add_node(l);
+	}
+	p.reverse();
+	p.set_length(d);
+}
+
+/* ADJACENCY LISTS */
+
+template<class T>
+void wxlandmarks(
+	const wxgraph<T> *G, const csr_wxgraph<T> *R, size_t K,
+	landmark_index<T>& idx
+)
+{
+	generic_wxlandmarks(G, R, K, idx);
+}
+
+template<class T>
+void wxlandmarks(
+	const wxgraph<T> *G, const csr_wxgraph<T> *R,
+	const std::vector<node>& landmarks, landmark_index<T>& idx,
+	size_t n_threads
+)
+{
+	generic_wxlandmarks(G, R, landmarks, idx, n_threads);
+}
+
+template<class T>
+T wxdistance_landmarks(
+	const wxgraph<T> *G, const landmark_index<T>& idx, node source, node target,
+	workspace<T> *ws
+)
+{
+	return generic_wxdistance_landmarks(G, idx, source, target, ws);
+}
+
+template<class T>
+void wxpath_landmarks(
+	const wxgraph<T> *G, const landmark_index<T>& idx, node source, node target,
+	node_path<T>& p, workspace<T> *ws
+)
+{
+	generic_wxpath_landmarks(G, idx, source, target, p, ws);
+}
+
+/* COMPRESSED GRAPHS */
+
+template<class T>
+void wxlandmarks(
+	const csr_wxgraph<T> *G, const csr_wxgraph<T> *R, size_t K,
+	landmark_index<T>& idx
+)
+{
+	generic_wxlandmarks(G, R, K, idx);
+}
+
+template<class T>
+void wxlandmarks(
+	const csr_wxgraph<T> *G, const csr_wxgraph<T> *R,
+	const std::vector<node>& landmarks, landmark_index<T>& idx,
+	size_t n_threads
+)
+{
+	generic_wxlandmarks(G, R, landmarks, idx, n_threads);
+}
+
+template<class T>
+T wxdistance_landmarks(
+	const csr_wxgraph<T> *G, const landmark_index<T>& idx, node source, node target,
+	workspace<T> *ws
+)
+{
+	return generic_wxdistance_landmarks(G, idx, source, target, ws);
+}
+
+template<class T>
+void wxpath_landmarks(
+	const csr_wxgraph<T> *G, const landmark_index<T>& idx, node source, node target,
+	node_path<T>& p, workspace<T> *ws
+)
+{
+	generic_wxpath_landmarks(G, idx, source, target, p, ws);
+}
+
+} // -- namespace traversal
+} // -- namespace lgraph
@@ -28,9 +28,11 @@ using namespace std;
 /* VERTEX-VERTEX */
 
 // one path
-void uxpath(const uxgraph *G, node source, node target, boolean_path<_new_>& p) {
+void uxpath
+(const uxgraph *G, node source, node target, boolean_path<_new_>& p, workspace<> *ws)
+{
 	node_path<_new_> path;
-	uxpath(G, source, target, path);
+	uxpath(G, source, target, path, ws);
 	p.init(G->n_nodes(), path);
 }
 
@@ -45,11 +47,14 @@ void uxpaths(const uxgraph *G, node source, node target, boolean_path_set<_new_>
 
 // one path
 void uxpath(const uxgraph *G, node source, std::vector<boolean_path<_new_> >& ps) {
+	const size_t N = G->n_nodes();
+
 	vector<node_path<_new_> > nps;
 	uxpath(G, source, nps);
-	for (const node_path<_new_>& p : nps) {
-		ps.push_back(boolean_path<_new_>());
-		ps.back().init(G->n_nodes(), p);
+
+	ps = vector<boolean_path<_new_> >(N);
+	for (size_t i = 0; i < N; ++i) {
+		ps[i].init(N, nps[i]);
 	}
 }
 
@@ -69,13 +74,16 @@ void uxpaths(const uxgraph *G, node source, std::vector<boolean_path_set<_new_>
 /* ALL-ALL */
 
 // one path
-void uxpath
-(const uxgraph *G, std::vector<std::vector<boolean_path<_new_> > >& all_all_paths)
+void uxpath(
+	const uxgraph *G,
+	std::vector<std::vector<boolean_path<_new_> > >& all_all_paths,
+	size_t n_threads
+)
 {
 	const size_t N = G->n_nodes();
 
 	vector<node_path_set<_new_> > node_ps;
-	uxpath(G, node_ps);
+	uxpath(G, node_ps, n_threads);
 
 	all_all_paths = vector<boolean_path_set<_new_> >(N);
 	for (size_t i = 0; i < N; ++i) {
@@ -21,84 +21,147 @@
 
 #include <lgraph/graph_traversal/traversal_ux.hpp>
 
+// C includes
+#include <assert.h>
+
 // C++ includes
-#include <queue>
 using namespace std;
 
 // lgraph includes
 #include <lgraph/graph_traversal/bfs.hpp>
+#include <lgraph/utils/parallel.hpp>
 
 namespace lgraph {
 namespace traversal {
 using namespace std;
 using namespace bfs;
 
-/* VERTEX-VERTEX */
+// A BFS from 'source' that leaves in 'W' the distance and the parent of
+// every node reached, so that the path to any of them can be rebuilt at
+// the end instead of copying the path to every node as it is reached. The
+// traversal stops when 'target' is reached, if it is a node of the graph.
+template<class G_t>
+inline void generic_uxparents
+(const G_t *G, node source, node target, workspace<>& W)
+{
+	W.init(G->n_nodes(), true);
+	W.visit(source);
+	W.set_distance(source, 0);
 
-// one path
-void uxpath(const uxgraph *G, node source, node target, node_path<_new_>& p) {
-	// path from source to target starts at source
-	p.add_node(source);
+	// the visited nodes are the BFS queue
+	for (size_t head = 0; head < W.visited_nodes().size(); ++head) {
+		const node u = W.visited_nodes()[head];
+		if (u == target) {
+			return;
+		}
 
-	// path from a node to itself
-	if (source == target) {
+		const _new_ d = W.distance(u) + 1;
+		for (node v : G->get_neighbours(u)) {
+			if (not W.is_visited(v)) {
+				W.visit(v);
+				W.set_distance(v, d);
+				W.set_parent(v, u);
+			}
+		}
+	}
+}
+
+// The path from the source of the BFS that filled 'W' to 'target'.
+inline void uxpath_from_parents
+(const workspace<>& W, node target, node_path<_new_>& p)
+{
+	p.empty();
+	if (not W.is_visited(target)) {
 		return;
 	}
 
-	// distances from source to nodes
-	queue<node_path<_new_> > paths;
-	paths.push(p);
+	// from the target back to the source
+	for (node l = target; l != W.size(); l = W.parent(l)) {
+		p.add_node(l);
+	}
+	p.reverse();
+	p.set_length(W.distance(target));
+}
 
-	// current distance from source to u
-	node_path<_new_> current_path;
+/* VERTEX-VERTEX */
 
-	// terminate when target is found
-	bfs_terminate terminate =
-	[&target](const uxgraph *, node u, const vector<bool>&)
-	{
-		return u == target;
-	};
+// one path
+void uxpath
+(const uxgraph *G, node source, node target, node_path<_new_>& p, workspace<> *ws)
+{
+	workspace<> local_ws;
+	workspace<>& W = (ws == nullptr ? local_ws : *ws);
 
-	bfs_process_current process_current =
-	[&paths, &p, &current_path, &target]
-	(const uxgraph *, node u, const vector<bool>&)
-	{
-		current_path = paths.front();
-		paths.pop();
+	generic_uxparents(G, source, target, W);
+	uxpath_from_parents(W, target, p);
+}
 
-		if (u == target) {
-			p = current_path;
-		}
-	};
+// all paths
+void uxpaths(const uxgraph *G, node source, node target, node_path_set<_new_>& ps) {
+	shortest_path_dag<_new_> dag;
+	uxpaths(G, source, dag);
+	dag.get_paths(target, ps);
+}
 
-	// function to compute the shortest distance from source to node v
-	bfs_process_neighbour process_neighbour =
-	[&paths, &current_path]
-	(const uxgraph *, node, node v, const vector<bool>& vis)
-	{
-		if (not vis[v]) {
-			node_path<_new_> path_to_v = current_path;
-			path_to_v.add_node(v);
-			path_to_v.add_length(1);
-			paths.push(path_to_v);
-		}
-	};
+// one path, with a bidirectional search
+template<class G_t>
+inline void generic_uxpath_bidirectional(
+	const G_t *G, const csr_uxgraph *R, node source, node target,
+	node_path<_new_>& p,
+	workspace<> *ws_forward, workspace<> *ws_backward
+)
+{
+	workspace<> local_wf, local_wb;
+	workspace<>& Wf = (ws_forward == nullptr ? local_wf : *ws_forward);
+	workspace<>& Wb = (ws_backward == nullptr ? local_wb : *ws_backward);
+
+	node u, v;
+	_new_ d;
+	if (R == nullptr) {
+		// an undirected graph is its own reverse
+		assert(not G->is_directed());
+		d = bidirectional_BFS(G, G, source, target, Wf, Wb, u, v);
+	}
+	else {
+		d = bidirectional_BFS(G, R, source, target, Wf, Wb, u, v);
+	}
 
-	BFS(G, source, terminate, process_current, process_neighbour);
+	p.empty();
+	if (d == inf_t<_new_>()) {
+		return;
+	}
 
-	// if the path only contains one node (the source)
-	// then there is no path at all
-	if (p.size() == 1) {
-		// delete only node
-		p.delete_last();
+	// from u back to the source...
+	const node N = G->n_nodes();
+	for (node l = u; l != N; l = Wf.parent(l)) {
+		p.add_node(l);
 	}
+	p.reverse();
+	// ... and from v forward to the target
+	if (u != v) {
+		for (node l = v; l != N; l = Wb.parent(l)) {
+			p.add_node(l);
+		}
+	}
+	p.set_length(d);
 }
 
-// all paths
-void uxpaths(const uxgraph *G, node source, node target, node_path_set<_new_>& ps) {
-	vector<node_path_set<_new_> > node_all_paths;
-	uxpaths(G, source, node_all_paths);
-	ps = node_all_paths[target];
+void uxpath_bidirectional(
+	const uxgraph *G, const csr_uxgraph *R, node source, node target,
+	node_path<_new_>& p,
+	workspace<> *ws_forward, workspace<> *ws_backward
+)
+{
+	generic_uxpath_bidirectional(G, R, source, target, p, ws_forward, ws_backward);
+}
+
+void uxpath_bidirectional(
+	const csr_uxgraph *G, const csr_uxgraph *R, node source, node target,
+	node_path<_new_>& p,
+	workspace<> *ws_forward, workspace<> *ws_backward
+)
+{
+	generic_uxpath_bidirectional(G, R, source, target, p, ws_forward, ws_backward);
 }
 
 /* VERTEX-ALL */
@@ -107,291 +170,165 @@ void uxpaths(const uxgraph *G, node source, node target, node_path_set<_new_>& p
 void uxpath(const uxgraph *G, node source, std::vector<node_path<_new_> >& ps) {
 	const size_t N = G->n_nodes();
 
-	// path from source to target
-	ps = vector<node_path<_new_> >(N);
-	ps[source] = node_path<_new_>(source); // start path at node 'source'
-
-	bfs_terminate terminate =
-	[](const uxgraph *, node, const vector<bool>&) { return false; };
+	workspace<> W;
+	generic_uxparents(G, source, N, W);
 
-	bfs_process_current process_current =
-	[](const uxgraph *, node, const vector<bool>&) { };
-
-	// function to compute the shortest distance from source to node v
-	bfs_process_neighbour process_neighbour =
-	[&ps](const uxgraph *, node u, node v, const vector<bool>&)
-	{
-		// add one node, count the number of edges
-		size_t d_u = ps[u].size() + 1 - 1;
-		// number of edges
-		size_t d_v = ps[v].size() - 1;
-		if (d_u < d_v) {
-			ps[v] = ps[u];
-			ps[v].add_node(v);
-			ps[v].add_length(1);
-		}
-	};
-
-	BFS(G, source, terminate, process_current, process_neighbour);
+	ps = vector<node_path<_new_> >(N);
+	for (node target : W.visited_nodes()) {
+		uxpath_from_parents(W, target, ps[target]);
+	}
 }
 
 // all paths
 void uxpaths(const uxgraph *G, node source, std::vector<node_path_set<_new_> >& ps) {
 	const size_t N = G->n_nodes();
 
-	// all paths from source to a target
-	ps = vector<node_path_set<_new_> >(N);
-
-	// only one path from source to source
-	ps[source] = node_path_set<_new_>(1);
-	ps[source][0].add_node(source);
+	shortest_path_dag<_new_> dag;
+	uxpaths(G, source, dag);
 
-	bfs_terminate terminate =
-	[](const uxgraph *, node, const vector<bool>&) { return false; };
+	ps = vector<node_path_set<_new_> >(N);
+	for (node target = 0; target < N; ++target) {
+		dag.get_paths(target, ps[target]);
+	}
+}
 
-	bfs_process_current process_current =
-	[](const uxgraph *, node, const vector<bool>&) { };
+// A BFS from 'source' computes the distances and the order of the nodes,
+// and the predecessors of every node are gathered afterwards scanning the
+// edges of the nodes reached twice: first to count them, then to store
+// them. This needs no memory per node other than that of the DAG.
+template<class G_t>
+inline void generic_uxpaths_dag
+(const G_t *G, node source, shortest_path_dag<_new_>& dag)
+{
+	const size_t N = G->n_nodes();
 
-	// function to compute the shortest distance from source to node v
-	bfs_process_neighbour process_neighbour =
-	[&ps](const uxgraph *, node u, node v, const vector<bool>&)
-	{
-		// distance from 'source' to 'u'
-		size_t d_u;
-		if (ps[u].size() == 0) {
-			// not a single path from 'source' to 'u'
-			d_u = inf_t<_new_>();
+	vector<_new_> ds(N, inf_t<_new_>());
+	vector<node> order;
+	ds[source] = 0;
+	order.push_back(source);
+
+	// the order of the nodes is the BFS queue
+	for (size_t head = 0; head < order.size(); ++head) {
+		const node u = order[head];
+		for (node v : G->get_neighbours(u)) {
+			if (ds[v] == inf_t<_new_>()) {
+				ds[v] = ds[u] + 1;
+				order.push_back(v);
+			}
 		}
-		else {
-			// at least one path from 'source' to 'u'
+	}
 
-			// add one node, count the number of edges,
-			// path from 'source' to 'u' to 'v'
-			d_u = ps[u][0].size() + 1 - 1;
+	// 'u' is a predecessor of 'v' if there is an edge (u,v) and
+	// 'v' is one step farther from the source than 'u'
+	vector<size_t> offsets(N + 1, 0);
+	for (node u : order) {
+		for (node v : G->get_neighbours(u)) {
+			if (ds[v] == ds[u] + 1) {
+				++offsets[v + 1];
+			}
 		}
+	}
+	for (node u = 0; u < N; ++u) {
+		offsets[u + 1] += offsets[u];
+	}
 
-		// distance from 'source' to 'v'
-		size_t d_v;
-		if (ps[v].size() == 0) {
-			// not a single path from 'source' to 'u'
-			d_v = inf_t<_new_>();
+	vector<node> preds(offsets[N]);
+	vector<size_t> next(offsets.begin(), offsets.end() - 1);
+	for (node u : order) {
+		for (node v : G->get_neighbours(u)) {
+			if (ds[v] == ds[u] + 1) {
+				preds[next[v]++] = u;
+			}
 		}
-		else {
-			// at least one path from 'source' to 'u'
+	}
 
-			// number of edges
-			// path from 'source' to 'v'
-			d_v = ps[v][0].size() - 1;
-		}
+	dag.init(source, std::move(ds), std::move(order), std::move(offsets), std::move(preds));
+}
 
-		if (d_u < d_v) {
-			// if shorter path found, clear all paths to 'v' and add the new ones.
-			ps[v] = ps[u];
-			for (node_path<_new_>& np : ps[v]) {
-				np.add_node(v);
-				np.add_length(1);
-			}
-		}
-		else if (d_u == d_v) {
-			// if the path found is as long as the shortest, just add it
-			size_t prev_size = ps[v].size();
+template<class G_t>
+inline void generic_uxpaths_dag
+(const G_t *G, std::vector<shortest_path_dag<_new_> >& dags, size_t n_threads)
+{
+	const size_t N = G->n_nodes();
+	dags = vector<shortest_path_dag<_new_> >(N);
 
-			// add all node paths found so far
-			ps[v].insert( ps[v].end(), ps[u].begin(), ps[u].end() );
+	utils::parallel_for(N, n_threads,
+	[&](size_t, node s) -> void
+	{
+		generic_uxpaths_dag(G, s, dags[s]);
+	}
+	);
+}
 
-			// add another vertex to the newly added paths
-			for (size_t i = prev_size; i < ps[v].size(); ++i) {
-				ps[v][i].add_node(v);
-				ps[v][i].add_length(1);
-			}
-		}
-	};
+void uxpaths(const uxgraph *G, node source, shortest_path_dag<_new_>& dag) {
+	generic_uxpaths_dag(G, source, dag);
+}
 
-	BFS(G, source, terminate, process_current, process_neighbour);
+void uxpaths(const csr_uxgraph *G, node source, shortest_path_dag<_new_>& dag) {
+	generic_uxpaths_dag(G, source, dag);
 }
 
 /* ALL-ALL */
 
 // one path
-void uxpath
-(const uxgraph *G, std::vector<std::vector<node_path<_new_> > >& all_all_paths)
+void uxpath(
+	const uxgraph *G,
+	std::vector<std::vector<node_path<_new_> > >& all_all_paths,
+	size_t n_threads
+)
 {
 	const size_t N = G->n_nodes();
-
-	// allocate memory...
-	vector<vector<_new_> > dist(N, vector<_new_>(N, inf_t<_new_>()));
 	all_all_paths =
-		vector<vector<node_path<_new_> > >
-		(N, vector<node_path<_new_> >(N));
-
-	// initialise data
-	for (size_t u = 0; u < N; ++u) {
-
-		// initialise paths for each pair of neighbouring nodes
-		const neighbourhood& Nu = G->get_neighbours(u);
-		for (size_t v : Nu) {
-			dist[u][v] = 1;
-			all_all_paths[u][v].add_node(u);
-			all_all_paths[u][v].add_node(v);
-			all_all_paths[u][v].add_length(1);
-		}
-	}
+		vector<vector<node_path<_new_> > >(N, vector<node_path<_new_> >(N));
 
-	// find the all-to-all shortest paths (N^3)
-	for (size_t w = 0; w < N; ++w) {
-		// distance from a vertex to itself is 0
-		dist[w][w] = 0;
-		all_all_paths[w][w].add_node(w);
-
-		for (size_t u = 0; u < N; ++u) {
-			for (size_t v = 0; v < N; ++v) {
-
-				// ignore the cases where:
-				// the path is not moving
-				if (u == v) {
-					continue;
-				}
-				// the distances are infinite
-				if (dist[u][w] == inf_t<_new_>()) {
-					continue;
-				}
-				if (dist[w][v] == inf_t<_new_>()) {
-					continue;
-				}
-
-				_new_ d = dist[u][w] + dist[w][v];
-				if (d < dist[u][v]) {
-					dist[u][v] = d;
-
-					all_all_paths[u][v] = all_all_paths[u][w];
-					all_all_paths[u][v].concatenate(all_all_paths[w][v]);
-				}
-			}
-		}
-	}
-
-	// clear those paths with only one vertex
-	for (size_t u = 0; u < N; ++u) {
-		for (size_t v = 0; v < N; ++v) {
-			if (u == v) {
-				continue;
-			}
-
-			node_path<_new_>& p = all_all_paths[u][v];
-			if (p.size() == 1) {
-				p.delete_last();
-			}
+	// a BFS from every node: each writes only to the paths
+	// of its own source, so they can be run in parallel
+	vector<workspace<> > W(utils::n_threads_used(n_threads, N));
+	utils::parallel_for(N, n_threads,
+	[&](size_t tid, node s) -> void
+	{
+		generic_uxparents(G, s, N, W[tid]);
+		for (node target : W[tid].visited_nodes()) {
+			uxpath_from_parents(W[tid], target, all_all_paths[s][target]);
 		}
 	}
+	);
 }
 
 // all paths
-void uxpaths
-(const uxgraph *G, std::vector<std::vector<node_path_set<_new_> > >& all_all_paths)
+void uxpaths(
+	const uxgraph *G,
+	std::vector<std::vector<node_path_set<_new_> > >& all_all_paths,
+	size_t n_threads
+)
 {
 	const size_t N = G->n_nodes();
+	all_all_paths = vector<vector<node_path_set<_new_> > >(N);
 
-	// allocate memory...
-	vector<vector<size_t> > dist(N, vector<size_t>(N, inf_t<_new_>()));
-	all_all_paths =
-		vector<vector<node_path_set<_new_> > >
-			(N, vector<node_path_set<_new_> >(N));
-
-	// initialise with edge weights (here always 1) the distance and the
-	// shortest-path from u to all its neighbours with {u,v}
-	for (size_t u = 0; u < N; ++u) {
-		const neighbourhood& Nu = G->get_neighbours(u);
-		for (size_t v : Nu) {
-			dist[u][v] = 1;
-			all_all_paths[u][v] = node_path_set<_new_>(1);
-			all_all_paths[u][v][0].add_node(u);
-			all_all_paths[u][v][0].add_node(v);
-			all_all_paths[u][v][0].add_length(1);
-		}
-	}
-
-	// find all the all-to-all shortest paths (N^3)
-	for (size_t w = 0; w < N; ++w) {
-		// distance from a vertex to itself is 0, the path just {w}
-		dist[w][w] = 0;
-		all_all_paths[w][w] = node_path_set<_new_>(1, node_path<_new_>(w));
-
-		for (size_t u = 0; u < N; ++u) {
-			for (size_t v = 0; v < N; ++v) {
-
-				if (dist[u][w] == inf_t<_new_>() or dist[w][v] == inf_t<_new_>()) continue;
-				if (u == v) continue;
-
-				size_t d = dist[u][w] + dist[w][v];
-				if (d < dist[u][v]) {
-					// this is a shorter path than the shortest found so far
-					dist[u][v] = dist[u][w] + dist[w][v];
-
-					if (u != w and w != v) {
-						// concatenate each path {u, ..., w}
-						// with each path {w, ..., v} (without repeating the w)
-
-						size_t n_uw = all_all_paths[u][w].size();
-						size_t n_wv = all_all_paths[w][v].size();
-						all_all_paths[u][v] = node_path_set<_new_>( n_uw*n_wv );
-
-						size_t uv = 0;
-						for (size_t uw = 0; uw < n_uw; ++uw) {
-							for (size_t wv = 0; wv < n_wv; ++wv) {
-								all_all_paths[u][v][uv] = all_all_paths[u][w][uw];
-								all_all_paths[u][v][uv].concatenate( all_all_paths[w][v][wv] );
-								++uv;
-							}
-						}
-					}
-				}
-				else if (d == dist[u][v]) {
-					// this is a path as short as the shortest found so far
-					if (u != w and w != v) {
-
-						// if the path found is as long as the shortest,
-						// just add the new ones: cartesian product of
-						// the current paths:
-						// append to all_all_paths[u][v]
-						// all_all_paths[u][w] x all_all_paths[w][v]
-
-						size_t n_wv = all_all_paths[w][v].size();
-
-						for (size_t wv = 0; wv < n_wv; ++wv) {
-							// place iterator at the position corresponding
-							// to the first added path from all_all_paths[u][w]
-							size_t uv = all_all_paths[u][v].size();
-
-							all_all_paths[u][v].insert(
-								all_all_paths[u][v].end(),
-								all_all_paths[u][w].begin(), all_all_paths[u][w].end()
-							);
-
-							// append each path from 'w' to 'v' to the new added paths
-							for (size_t s = uv; s < all_all_paths[u][v].size(); ++s) {
-								all_all_paths[u][v][s].concatenate( all_all_paths[w][v][wv] );
-							}
-						}
-					}
-				}
-			}
-		}
+	// a BFS from every node: each writes only to the paths
+	// of its own source, so they can be run in parallel
+	utils::parallel_for(N, n_threads,
+	[&](size_t, node s) -> void
+	{
+		uxpaths(G, s, all_all_paths[s]);
 	}
+	);
+}
 
-	// clear those paths with only one vertex
-	for (size_t u = 0; u < N; ++u) {
-		for (size_t v = 0; v < N; ++v) {
-			if (u == v) {
-				continue;
-			}
+void uxpaths(
+	const uxgraph *G, std::vector<shortest_path_dag<_new_> >& dags,
+	size_t n_threads
+)
+{
+	generic_uxpaths_dag(G, dags, n_threads);
+}
 
-			for (node_path<_new_>& p : all_all_paths[u][v]) {
-				if (p.size() == 1) {
-					p.delete_last();
-				}
-			}
-		}
-	}
+void uxpaths(
+	const csr_uxgraph *G, std::vector<shortest_path_dag<_new_> >& dags,
+	size_t n_threads
+)
+{
+	generic_uxpaths_dag(G, dags, n_threads);
 }
 
 } // -- namespace traversal
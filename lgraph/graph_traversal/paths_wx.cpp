@@ -21,34 +21,12 @@
 
 #include <lgraph/graph_traversal/traversal_wx.hpp>
 
+// C++ includes
+#include <cmath>
+
 // lgraph includes
 #include <lgraph/graph_traversal/dijkstra.hpp>
-
-// Make a list of paths given a matrix of precendes
-template<class T>
-inline void make_paths
-(
-	lgraph::node source,
-	const std::vector< std::vector<lgraph::node> >& prev,
-	lgraph::node nidx,
-	lgraph::node_path<T>& path,
-	lgraph::node_path_set<T>& ps
-)
-{
-	path.add_node(nidx);
-	if (nidx == source) {
-		// path contains a list of nodes from target to source
-		ps.push_back(path);
-		ps.back().reverse();
-		return;
-	}
-
-	for (size_t i = 0; i < prev[nidx].size(); ++i) {
-		lgraph::node prev_node = prev[nidx][i];
-		make_paths(source, prev, prev_node, path, ps);
-		path.delete_last();
-	}
-}
+#include <lgraph/utils/parallel.hpp>
 
 namespace lgraph {
 namespace traversal {
@@ -69,7 +47,7 @@ void wxpath(const wxgraph<T> *G, node source, node target, node_path<T>& p) {
 	ds[source] = 0;
 
 	// terminate when target is found
-	dijkstra::djka_terminate<T> terminate =
+	auto terminate =
 	[&target]
 	(const wxgraph<T> *, const dijkstra::djka_node<T>& u, const std::vector<bool>&)
 	-> bool
@@ -77,12 +55,8 @@ void wxpath(const wxgraph<T> *G, node source, node target, node_path<T>& p) {
 		return u.second == target;
 	};
 
-	dijkstra::djka_process_current<T> proc_curr =
-	[](const wxgraph<T> *, const dijkstra::djka_node<T>&, const std::vector<bool>&)
-	-> void { };
-
 	// function to compute the shortest distance from node u to node v
-	dijkstra::djka_process_neighbour<T> proc_neig =
+	auto proc_neig =
 	[&prev, &ds]
 	(const wxgraph<T> *, node u, node v, const T& w, const std::vector<bool>&)
 	-> bool
@@ -96,7 +70,7 @@ void wxpath(const wxgraph<T> *G, node source, node target, node_path<T>& p) {
 		return add;
 	};
 
-	dijkstra::Dijkstra(G, source, terminate, proc_curr, proc_neig);
+	dijkstra::Dijkstra<T>(G, source, terminate, dijkstra::djka_no_op(), proc_neig);
 
 	p.empty();
 	node l = target;
@@ -120,51 +94,197 @@ void wxpaths(const wxgraph<T> *G, node source, node target, node_path_set<T>& ps
 	assert(G->has_node(source));
 	assert(G->has_node(target));
 
+	shortest_path_dag<T> dag;
+	wxpaths(G, source, dag);
+	dag.get_paths(target, ps);
+}
+
+// Dijkstra's algorithm from 'source' computes the distances and the order
+// in which the nodes are settled. The predecessors of every node are
+// gathered afterwards scanning the edges of the nodes reached twice: first
+// to count them, then to store them. Two paths are equally long if their
+// lengths differ in at most 1e-5. A predecessor must have been settled
+// before, so that edges of weight (close to) 0 cannot make cycles.
+template<class T, class G_t>
+inline void generic_wxpaths_dag
+(const G_t *G, node source, shortest_path_dag<T>& dag)
+{
 	const size_t N = G->n_nodes();
 
-	// prev[v] = u <-> u is the previous node to v in the path
-	std::vector< std::vector<node> > prev(N);
 	std::vector<T> ds(N, inf_t<T>());
+	std::vector<node> order;
 	ds[source] = 0;
 
-	// terminate when target is found
-	dijkstra::djka_terminate<T> terminate =
-	[&target]
-	(const wxgraph<T> *, const dijkstra::djka_node<T>&, const std::vector<bool>&)
-	-> bool
+	auto proc_curr =
+	[&order]
+	(const G_t *, const dijkstra::djka_node<T>& u, const std::vector<bool>&)
+	-> void
 	{
-		return false;
+		order.push_back(u.second);
 	};
 
-	dijkstra::djka_process_current<T> proc_curr =
-	[](const wxgraph<T> *, const dijkstra::djka_node<T>&, const std::vector<bool>&)
-	-> void { };
-
-	// function to compute the shortest distance from node u to node v
-	dijkstra::djka_process_neighbour<T> proc_neig =
-	[&prev, &ds]
-	(const wxgraph<T> *, node u, node v, const T& w, const std::vector<bool>&)
+	auto proc_neig =
+	[&ds]
+	(const G_t *, node u, node v, const T& w, const std::vector<bool>&)
 	-> bool
 	{
-		bool add = false;
 		if (ds[u] + w + static_cast<T>(1.0e-5) < ds[v]) {
-			// shorter path from u to v
 			ds[v] = ds[u] + w;
-			prev[v] = std::vector<node>(1, u);
-			add = true;
-		}
-		else if (std::abs(ds[u] + w - ds[v]) <= static_cast<T>(1.0e-5)) {
-			// equally long path from u to v
-			prev[v].push_back(u);
+			return true;
 		}
-		return add;
+		return false;
 	};
 
-	dijkstra::Dijkstra(G, source, terminate, proc_curr, proc_neig);
+	dijkstra::Dijkstra<T>(G, source, dijkstra::djka_no_op(), proc_curr, proc_neig);
+
+	// position of every node in the order
+	std::vector<size_t> rank(N, N);
+	for (size_t i = 0; i < order.size(); ++i) {
+		rank[order[i]] = i;
+	}
+	auto is_pred =
+	[&](node u, node v, const T& w) -> bool
+	{
+		return rank[u] < rank[v] and
+			   equal_lengths<T>(ds[u] + w, ds[v]);
+	};
+
+	std::vector<size_t> offsets(N + 1, 0);
+	for (node u : order) {
+		const auto& Nu = G->get_neighbours(u);
+		const auto& wu = G->get_weights(u);
+		for (size_t i = 0; i < Nu.size(); ++i) {
+			if (is_pred(u, Nu[i], wu[i])) {
+				++offsets[Nu[i] + 1];
+			}
+		}
+	}
+	for (node u = 0; u < N; ++u) {
+		offsets[u + 1] += offsets[u];
+	}
+
+	std::vector<node> preds(offsets[N]);
+	std::vector<size_t> fill(offsets.begin(), offsets.end() - 1);
+	for (node u : order) {
+		const auto& Nu = G->get_neighbours(u);
+		const auto& wu = G->get_weights(u);
+		for (size_t i = 0; i < Nu.size(); ++i) {
+			if (is_pred(u, Nu[i], wu[i])) {
+				preds[fill[Nu[i]]++] = u;
+			}
+		}
+	}
+
+	dag.init(source, std::move(ds), std::move(order), std::move(offsets), std::move(preds));
+}
+
+template<class T, class G_t>
+inline void generic_wxpaths_dag
+(const G_t *G, std::vector<shortest_path_dag<T> >& dags, size_t n_threads)
+{
+	const size_t N = G->n_nodes();
+	dags = std::vector<shortest_path_dag<T> >(N);
+
+	utils::parallel_for(N, n_threads,
+	[&](size_t, node s) -> void
+	{
+		generic_wxpaths_dag(G, s, dags[s]);
+	}
+	);
+}
+
+template<class T>
+void wxpaths(const wxgraph<T> *G, node source, shortest_path_dag<T>& dag) {
+	generic_wxpaths_dag(G, source, dag);
+}
+
+template<class T>
+void wxpaths(const csr_wxgraph<T> *G, node source, shortest_path_dag<T>& dag) {
+	generic_wxpaths_dag(G, source, dag);
+}
+
+template<class T>
+void wxpaths(
+	const wxgraph<T> *G, std::vector<shortest_path_dag<T> >& dags,
+	size_t n_threads
+)
+{
+	generic_wxpaths_dag(G, dags, n_threads);
+}
+
+template<class T>
+void wxpaths(
+	const csr_wxgraph<T> *G, std::vector<shortest_path_dag<T> >& dags,
+	size_t n_threads
+)
+{
+	generic_wxpaths_dag(G, dags, n_threads);
+}
+
+// one path, with a bidirectional search
+template<class T, class G_t>
+inline void generic_wxpath_bidirectional(
+	const G_t *G, const csr_wxgraph<T> *R, node source, node target,
+	node_path<T>& p,
+	workspace<T> *ws_forward, workspace<T> *ws_backward
+)
+{
+	assert(G->has_node(source));
+	assert(G->has_node(target));
+
+	workspace<T> local_wf, local_wb;
+	workspace<T>& Wf = (ws_forward == nullptr ? local_wf : *ws_forward);
+	workspace<T>& Wb = (ws_backward == nullptr ? local_wb : *ws_backward);
+
+	node u, v;
+	T d;
+	if (R == nullptr) {
+		// an undirected graph is its own reverse
+		assert(not G->is_directed());
+		d = dijkstra::bidirectional_Dijkstra(G, G, source, target, Wf, Wb, u, v);
+	}
+	else {
+		d = dijkstra::bidirectional_Dijkstra(G, R, source, target, Wf, Wb, u, v);
+	}
+
+	p.empty();
+	if (d == inf_t<T>()) {
+		return;
+	}
+
+	// from u back to the source...
+	const node N = G->n_nodes();
+	for (node l = u; l != N; l = Wf.parent(l)) {
+		p.add_node(l);
+	}
+	p.reverse();
+	// ... and from v forward to the target
+	if (u != v) {
+		for (node l = v; l != N; l = Wb.parent(l)) {
+			p.add_node(l);
+		}
+	}
+	p.set_length(d);
+}
+
+template<class T>
+void wxpath_bidirectional(
+	const wxgraph<T> *G, const csr_wxgraph<T> *R, node source, node target,
+	node_path<T>& p,
+	workspace<T> *ws_forward, workspace<T> *ws_backward
+)
+{
+	generic_wxpath_bidirectional<T>(G, R, source, target, p, ws_forward, ws_backward);
+}
 
-	node_path<T> empty_path;
-	empty_path.set_length(ds[target]);
-	make_paths(source, prev, target, empty_path, ps);
+template<class T>
+void wxpath_bidirectional(
+	const csr_wxgraph<T> *G, const csr_wxgraph<T> *R, node source, node target,
+	node_path<T>& p,
+	workspace<T> *ws_forward, workspace<T> *ws_backward
+)
+{
+	generic_wxpath_bidirectional<T>(G, R, source, target, p, ws_forward, ws_backward);
 }
 
 /* NODE-ALL */
@@ -181,17 +301,8 @@ void wxpath(const wxgraph<T> *G, node source, std::vector<node_path<T> >& ps) {
 	std::vector<T> ds(N, inf_t<T>());
 	ds[source] = 0;
 
-	// terminate when target is found
-	dijkstra::djka_terminate<T> terminate =
-	[](const wxgraph<T> *, const dijkstra::djka_node<T>&, const std::vector<bool>&)
-	-> bool { return false; };
-
-	dijkstra::djka_process_current<T> proc_curr =
-	[](const wxgraph<T> *, const dijkstra::djka_node<T>&, const std::vector<bool>&)
-	-> void { };
-
 	// function to compute the shortest distance from node u to node v
-	dijkstra::djka_process_neighbour<T> proc_neig =
+	auto proc_neig =
 	[&prev, &ds]
 	(const wxgraph<T> *, node u, node v, const T& w, const std::vector<bool>&)
 	-> bool
@@ -205,7 +316,9 @@ void wxpath(const wxgraph<T> *G, node source, std::vector<node_path<T> >& ps) {
 		return add;
 	};
 
-	dijkstra::Dijkstra(G, source, terminate, proc_curr, proc_neig);
+	// do NOT terminate and do not process the current node
+	dijkstra::Dijkstra<T>
+	(G, source, dijkstra::djka_no_op(), dijkstra::djka_no_op(), proc_neig);
 
 	ps = std::vector<node_path<T> >(N);
 	for (node u = 0; u < N; ++u) {
@@ -232,10 +345,12 @@ void wxpath(const wxgraph<T> *G, node source, std::vector<node_path<T> >& ps) {
 template<class T> void wxpaths
 (const wxgraph<T> *G, node source, std::vector<node_path_set<T> >& ps)
 {
-	ps = std::vector<node_path_set<T> >(G->n_nodes());
+	shortest_path_dag<T> dag;
+	wxpaths(G, source, dag);
 
+	ps = std::vector<node_path_set<T> >(G->n_nodes());
 	for (node target = 0; target < G->n_nodes(); ++target) {
-		wxpaths(G, source, target, ps[target]);
+		dag.get_paths(target, ps[target]);
 	}
 }
 
@@ -284,10 +399,14 @@ template<class T> void wxpath
 					continue;
 				}
 				// the distances are infinite
-				if (dist[u][w] == inf_t<_new_>()) {
+				if (dist[u][w] == inf_t<T>()) {
+					continue;
+				}
+				if (dist[w][v] == inf_t<T>()) {
 					continue;
 				}
-				if (dist[w][v] == inf_t<_new_>()) {
+				// the length of the path through w cannot be represented
+				if (dist[w][v] > inf_t<T>() - dist[u][w]) {
 					continue;
 				}
 
@@ -345,10 +464,14 @@ template<class T> void wxpaths
 					continue;
 				}
 				// the distances are infinite
-				if (dist[u][w] == inf_t<_new_>()) {
+				if (dist[u][w] == inf_t<T>()) {
+					continue;
+				}
+				if (dist[w][v] == inf_t<T>()) {
 					continue;
 				}
-				if (dist[w][v] == inf_t<_new_>()) {
+				// the length of the path through w cannot be represented
+				if (dist[w][v] > inf_t<T>() - dist[u][w]) {
 					continue;
 				}
 
@@ -375,7 +498,7 @@ template<class T> void wxpaths
 						}
 					}
 				}
-				else if (std::abs(d - dist[u][v]) <= static_cast<T>(1.0e-5)) {
+				else if (equal_lengths(d, dist[u][v])) {
 
 					// this is a path as short as the shortest found so far
 					if (u != w and w != v) {
@@ -26,8 +26,12 @@
 
 // lgraph includes
 #include <lgraph/data_structures/boolean_path.hpp>
+#include <lgraph/data_structures/csr_uxgraph.hpp>
+#include <lgraph/data_structures/distance_matrix.hpp>
 #include <lgraph/data_structures/node_path.hpp>
+#include <lgraph/data_structures/shortest_path_dag.hpp>
 #include <lgraph/data_structures/uxgraph.hpp>
+#include <lgraph/graph_traversal/workspace.hpp>
 
 namespace lgraph {
 namespace traversal {
@@ -43,14 +47,18 @@ namespace traversal {
 /**
  * @brief Directed/Undirected distance between two nodes.
  *
- * Applies a Breadth-First Search algorithm.
+ * Applies a Breadth-First Search algorithm. In undirected graphs it is
+ * the direction-optimizing one (see @ref bfs::direction_optimizing_BFS).
  *
  * @param[in] G A directed/undirected unweighted graph.
  * @param[in] source The source node.
  * @param[in] target The target node.
+ * @param ws The memory used by the traversal (see @ref workspace). If
+ * null, the memory is allocated for this call only.
  * @return The shortest distance between @e source and @e target.
  */
-_new_ uxdistance(const uxgraph *G, node source, node target);
+_new_ uxdistance
+(const uxgraph *G, node source, node target, workspace<> *ws = nullptr);
 /**
  * @brief Directed/Undirected distance between two nodes.
  *
@@ -61,9 +69,37 @@ _new_ uxdistance(const uxgraph *G, node source, node target);
  * @param[in] target The target node.
  * @param[out] n_paths The number of shortest paths between @e source and
  * @e target.
+ * @param ws The memory used by the traversal (see @ref workspace). If
+ * null, the memory is allocated for this call only.
  * @return The shortest distance between @e source and @e target.
  */
-_new_ uxdistance(const uxgraph *G, node source, node target, size_t& n_paths);
+_new_ uxdistance(
+	const uxgraph *G, node source, node target, size_t& n_paths,
+	workspace<> *ws = nullptr
+);
+
+/**
+ * @brief Directed/Undirected distance between two nodes.
+ *
+ * Applies a bidirectional Breadth-First Search algorithm (see
+ * @ref bfs::bidirectional_BFS), which usually reaches far fewer nodes
+ * than @ref uxdistance(const uxgraph*, node, node, workspace<>*).
+ *
+ * @param[in] G A directed/undirected unweighted graph.
+ * @param[in] R The reverse of @e G (see @ref csr_uxgraph::init_reverse).
+ * If null, @e G must be undirected, and is its own reverse.
+ * @param[in] source The source node.
+ * @param[in] target The target node.
+ * @param ws_forward The memory used by the traversal from @e source (see
+ * @ref workspace). If null, the memory is allocated for this call only.
+ * @param ws_backward The memory used by the traversal from @e target.
+ * If null, the memory is allocated for this call only.
+ * @return The shortest distance between @e source and @e target.
+ */
+_new_ uxdistance_bidirectional(
+	const uxgraph *G, const csr_uxgraph *R, node source, node target,
+	workspace<> *ws_forward = nullptr, workspace<> *ws_backward = nullptr
+);
 
 // NODE-ALL
 
@@ -71,14 +107,20 @@ _new_ uxdistance(const uxgraph *G, node source, node target, size_t& n_paths);
  * @brief Directed/Undirected distance between a node to the rest of the
  * graph's nodes.
  *
- * Applies a Breadth-First Search algorithm.
+ * Applies a Breadth-First Search algorithm. In undirected graphs it is
+ * the direction-optimizing one (see @ref bfs::direction_optimizing_BFS).
  *
  * @param[in] G A directed/undirected unweighted graph.
  * @param[in] source The source node.
  * @param[out] uxdistances The i-th position contains the directed/undirected
  * distance between the source node and the i-th node of the graph.
+ * @param ws The memory used by the traversal (see @ref workspace). If
+ * null, the memory is allocated for this call only.
  */
-void uxdistance(const uxgraph *G, node source, std::vector<_new_>& uxdistances);
+void uxdistance(
+	const uxgraph *G, node source, std::vector<_new_>& uxdistances,
+	workspace<> *ws = nullptr
+);
 /**
  * @brief Directed/Undirected distance between a node to the rest of the
  * graph's nodes.
@@ -91,39 +133,102 @@ void uxdistance(const uxgraph *G, node source, std::vector<_new_>& uxdistances);
  * distance between the source node and the i-th node of the graph.
  * @param[out] n_paths The i-th position contains the number of shortest paths
  * between the source node and the i-th node.
+ * @param ws The memory used by the traversal (see @ref workspace). If
+ * null, the memory is allocated for this call only.
  */
 void uxdistance(
 	const uxgraph *G, node source,
-	std::vector<_new_>& uxdistances, std::vector<size_t>& n_paths
+	std::vector<_new_>& uxdistances, std::vector<size_t>& n_paths,
+	workspace<> *ws = nullptr
 );
+/**
+ * @brief Directed/Undirected distance between a node to the rest of the
+ * graph's nodes.
+ *
+ * Applies a Breadth-First Search algorithm. The distances and the
+ * number of shortest paths are left in the workspace (see
+ * @ref workspace::distance and @ref workspace::n_paths), and the nodes
+ * reachable from @e source in @ref workspace::visited_nodes. Only the
+ * nodes reached are written, so this costs O(k) time and no memory
+ * allocation when the workspace is reused, where k is the number of
+ * nodes and edges reachable from @e source.
+ *
+ * @param[in] G A directed/undirected unweighted graph.
+ * @param[in] source The source node.
+ * @param[out] ws The workspace where the distances are stored.
+ */
+void uxdistance(const uxgraph *G, node source, workspace<>& ws);
 
 // ALL-ALL
 
 /**
  * @brief Directed/Undirected distance between all pairs of nodes.
  *
- * Applies the Floyd-Warshall algorithm.
+ * Applies a Breadth-First Search algorithm from every node, 64 nodes at
+ * a time (see @ref bfs::all_sources_BFS).
  *
  * @param[in] G A directed/undirected unweighted graph.
  * @param[out] ds The shortest directed/undirected distance between all pairs
  * of nodes.
+ * @param[in] n_threads Number of threads used to run the traversals (see
+ * @ref utils::n_threads_used).
  */
-void uxdistances(const uxgraph *G, std::vector<std::vector<_new_> >& ds);
+void uxdistances
+(const uxgraph *G, std::vector<std::vector<_new_> >& ds, size_t n_threads = 1);
 /**
  * @brief Directed/Undirected distance between all pairs of nodes.
  *
- * Applies the Floyd-Warshall algorithm.
+ * Applies a Breadth-First Search algorithm from every node.
  *
  * @param[in] G A directed/undirected unweighted graph.
  * @param[out] ds The shortest directed/undirected distance between all pairs
  * of nodes.
  * @param[out] n_paths The number of shortest paths between each pair of nodes.
+ * @param[in] n_threads Number of threads used to run the traversals (see
+ * @ref utils::n_threads_used).
  */
 void uxdistances(
 	const uxgraph *G,
 	std::vector<std::vector<_new_> >& ds,
-	std::vector<std::vector<size_t> >& n_paths
+	std::vector<std::vector<size_t> >& n_paths,
+	size_t n_threads = 1
 );
+/**
+ * @brief Directed/Undirected distance between all pairs of nodes.
+ *
+ * Applies a Breadth-First Search algorithm from every node, 64 nodes at
+ * a time (see @ref bfs::all_sources_BFS), and stores the distances in a
+ * compact matrix (see @ref distance_matrix): in undirected graphs only
+ * the pairs (u,v) with u < v are stored, and every distance takes the
+ * bytes needed for the largest one. The initial number of bytes fits the
+ * eccentricity of the node of largest degree. The sources with larger
+ * distances are traversed again after widening the matrix (see
+ * @ref distance_matrix::widen).
+ *
+ * @param[in] G A directed/undirected unweighted graph.
+ * @param[out] ds The shortest directed/undirected distance between all pairs
+ * of nodes.
+ * @param[in] n_threads Number of threads used to run the traversals (see
+ * @ref utils::n_threads_used).
+ */
+void uxdistances
+(const uxgraph *G, distance_matrix& ds, size_t n_threads = 1);
+/**
+ * @brief Sum of the distances from every node to the rest of the nodes.
+ *
+ * Applies a Breadth-First Search algorithm from every node, 64 nodes at
+ * a time (see @ref bfs::all_sources_BFS). The distances are added as they
+ * are found: only O(n) memory is used instead of the O(n^2) of
+ * @ref uxdistances.
+ *
+ * @param[in] G A directed/undirected unweighted graph.
+ * @param[out] sums The i-th position contains the sum of the distances
+ * from the i-th node to all the nodes reachable from it.
+ * @param[in] n_threads Number of threads used to run the traversals (see
+ * @ref utils::n_threads_used).
+ */
+void uxdistance_sums
+(const uxgraph *G, std::vector<_new_>& sums, size_t n_threads = 1);
 
 /* PATH FINDING IN UNWEIGHTED GRAPHS */
 
@@ -132,25 +237,38 @@ void uxdistances(
 /**
  * @brief A directed/undirected path between two nodes.
  *
- * Applies a Breadth-First Search algorithm.
+ * Applies a Breadth-First Search algorithm that stops when @e target is
+ * reached. Only the parent of every node reached is stored, and the path
+ * is rebuilt from them at the end (see @ref workspace::parent).
  *
  * @param[in] G A directed/undirected unweighted graph.
  * @param[in] source The source node.
  * @param[in] target The target node.
- * @param[out] p A path between the nodes.
+ * @param[out] p A path between the nodes. Empty if @e target is not
+ * reachable from @e source.
+ * @param ws The memory used by the traversal (see @ref workspace). If
+ * null, the memory is allocated for this call only.
  */
-void uxpath(const uxgraph *G, node source, node target, node_path<_new_>& p);
+void uxpath(
+	const uxgraph *G, node source, node target, node_path<_new_>& p,
+	workspace<> *ws = nullptr
+);
 /**
  * @brief A directed/undirected path between two nodes.
  *
- * Applies a Breadth-First Search algorithm.
+ * See @ref uxpath(const uxgraph*, node, node, node_path<_new_>&, workspace<>*).
  *
  * @param[in] G A directed/undirected unweighted graph.
  * @param[in] source The source node.
  * @param[in] target The target node.
  * @param[out] p A path between the nodes.
+ * @param ws The memory used by the traversal (see @ref workspace). If
+ * null, the memory is allocated for this call only.
  */
-void uxpath(const uxgraph *G, node source, node target, boolean_path<_new_>& p);
+void uxpath(
+	const uxgraph *G, node source, node target, boolean_path<_new_>& p,
+	workspace<> *ws = nullptr
+);
 
 /**
  * @brief All directed/undirected path between two nodes.
@@ -175,6 +293,30 @@ void uxpaths(const uxgraph *G, node source, node target, node_path_set<_new_>& p
  */
 void uxpaths(const uxgraph *G, node source, node target, boolean_path_set<_new_>& ps);
 
+/**
+ * @brief A directed/undirected path between two nodes.
+ *
+ * Applies a bidirectional Breadth-First Search algorithm (see
+ * @ref bfs::bidirectional_BFS).
+ *
+ * @param[in] G A directed/undirected unweighted graph.
+ * @param[in] R The reverse of @e G (see @ref csr_uxgraph::init_reverse).
+ * If null, @e G must be undirected, and is its own reverse.
+ * @param[in] source The source node.
+ * @param[in] target The target node.
+ * @param[out] p A shortest path between the nodes. Empty if @e target is
+ * not reachable from @e source.
+ * @param ws_forward The memory used by the traversal from @e source (see
+ * @ref workspace). If null, the memory is allocated for this call only.
+ * @param ws_backward The memory used by the traversal from @e target.
+ * If null, the memory is allocated for this call only.
+ */
+void uxpath_bidirectional(
+	const uxgraph *G, const csr_uxgraph *R, node source, node target,
+	node_path<_new_>& p,
+	workspace<> *ws_forward = nullptr, workspace<> *ws_backward = nullptr
+);
+
 // NODE-ALL
 
 /**
@@ -224,37 +366,67 @@ void uxpaths(const uxgraph *G, node source, std::vector<node_path_set<_new_> >&
  * the graph.
  */
 void uxpaths(const uxgraph *G, node source, std::vector<boolean_path_set<_new_> >& ps);
+/**
+ * @brief All directed/undirected shortest paths between a source node and
+ * any other node in the graph.
+ *
+ * Applies a Breadth-First Search algorithm. The paths are not enumerated:
+ * they are stored compactly as the distances, the predecessors and the
+ * number of shortest paths of every node (see @ref shortest_path_dag),
+ * from which they can be generated one at a time.
+ *
+ * @param[in] G A directed/undirected unweighted graph.
+ * @param[in] source The source node.
+ * @param[out] dag All shortest paths from the source node.
+ */
+void uxpaths(const uxgraph *G, node source, shortest_path_dag<_new_>& dag);
 
 // ALL-ALL
 
 /**
  * @brief A directed/undirected path between all pairs of nodes in the graph.
  *
- * Applies Floyd-Warshall's algorithm.
+ * Applies a Breadth-First Search algorithm from every node.
  *
  * @param[in] G A directed/undirected unweighted graph.
  * @param[out] ps A path between the nodes.
+ * @param[in] n_threads Number of threads used to run the traversals (see
+ * @ref utils::n_threads_used).
  */
-void uxpath(const uxgraph *G, std::vector<std::vector<node_path<_new_> > >& ps);
+void uxpath(
+	const uxgraph *G, std::vector<std::vector<node_path<_new_> > >& ps,
+	size_t n_threads = 1
+);
 /**
  * @brief A directed/undirected path between all pairs of nodes in the graph.
  *
- * Applies Floyd-Warshall's algorithm.
+ * Applies a Breadth-First Search algorithm from every node.
  *
  * @param[in] G A directed/undirected unweighted graph.
  * @param[out] ps A path between the nodes.
+ * @param[in] n_threads Number of threads used to run the traversals (see
+ * @ref utils::n_threads_used).
  */
-void uxpath(const uxgraph *G, std::vector<std::vector<boolean_path<_new_> > >& ps);
+void uxpath(
+	const uxgraph *G, std::vector<std::vector<boolean_path<_new_> > >& ps,
+	size_t n_threads = 1
+);
 
 /**
  * @brief All directed/undirected paths between all pairs of nodes in the graph.
  *
- * Applies Floyd-Warshall's algorithm.
+ * Applies a Breadth-First Search algorithm from every node.
  *
  * @param[in] G A directed/undirected unweighted graph.
  * @param[out] ps A path between the nodes.
+ * @param[in] n_threads Number of threads used to run the traversals (see
+ * @ref utils::n_threads_used).
  */
-void uxpaths(const uxgraph *G, std::vector<std::vector<node_path_set<_new_> > >& ps);
+void uxpaths(
+	const uxgraph *G,
+	std::vector<std::vector<node_path_set<_new_> > >& ps,
+	size_t n_threads = 1
+);
 /**
  * @brief All directed/undirected paths between all pairs of nodes in the
  * graph.
@@ -265,6 +437,253 @@ void uxpaths(const uxgraph *G, std::vector<std::vector<node_path_set<_new_> > >&
  * @param[out] ps A path between the nodes.
  */
 void uxpaths(const uxgraph *G, std::vector<std::vector<boolean_path_set<_new_> > >& ps);
+/**
+ * @brief All directed/undirected shortest paths between all pairs of nodes
+ * in the graph.
+ *
+ * See @ref uxpaths(const uxgraph*, node, shortest_path_dag<_new_>&).
+ *
+ * @param[in] G A directed/undirected unweighted graph.
+ * @param[out] dags @e dags[s] contains all shortest paths from node @e s.
+ * @param[in] n_threads Number of threads used to run the traversals (see
+ * @ref utils::n_threads_used).
+ */
+void uxpaths(
+	const uxgraph *G, std::vector<shortest_path_dag<_new_> >& dags,
+	size_t n_threads = 1
+);
+
+// ----------------------------------------------------------------
+// COMPRESSED UNWEIGHTED GRAPHS
+// ----------------------------------------------------------------
+
+/* DISTANCE COMPUTATION */
+
+// NODE-NODE
+
+/**
+ * @brief Directed/Undirected distance between two nodes.
+ *
+ * See @ref uxdistance(const uxgraph*, node, node, workspace<>*).
+ *
+ * @param[in] G A directed/undirected compressed unweighted graph.
+ * @param[in] source The source node.
+ * @param[in] target The target node.
+ * @param ws The memory used by the traversal (see @ref workspace). If
+ * null, the memory is allocated for this call only.
+ * @return The shortest distance between @e source and @e target.
+ */
+_new_ uxdistance
+(const csr_uxgraph *G, node source, node target, workspace<> *ws = nullptr);
+/**
+ * @brief Directed/Undirected distance between two nodes.
+ *
+ * See @ref uxdistance(const uxgraph*, node, node, size_t&, workspace<>*).
+ *
+ * @param[in] G A directed/undirected compressed unweighted graph.
+ * @param[in] source The source node.
+ * @param[in] target The target node.
+ * @param[out] n_paths The number of shortest paths between @e source and
+ * @e target.
+ * @param ws The memory used by the traversal (see @ref workspace). If
+ * null, the memory is allocated for this call only.
+ * @return The shortest distance between @e source and @e target.
+ */
+_new_ uxdistance(
+	const csr_uxgraph *G, node source, node target, size_t& n_paths,
+	workspace<> *ws = nullptr
+);
+
+/**
+ * @brief Directed/Undirected distance between two nodes.
+ *
+ * See @ref uxdistance_bidirectional(const uxgraph*, const csr_uxgraph*, node, node, workspace<>*, workspace<>*).
+ *
+ * @param[in] G A directed/undirected compressed unweighted graph.
+ * @param[in] R The reverse of @e G (see @ref csr_uxgraph::init_reverse).
+ * If null, @e G must be undirected, and is its own reverse.
+ * @param[in] source The source node.
+ * @param[in] target The target node.
+ * @param ws_forward The memory used by the traversal from @e source (see
+ * @ref workspace). If null, the memory is allocated for this call only.
+ * @param ws_backward The memory used by the traversal from @e target.
+ * If null, the memory is allocated for this call only.
+ * @return The shortest distance between @e source and @e target.
+ */
+_new_ uxdistance_bidirectional(
+	const csr_uxgraph *G, const csr_uxgraph *R, node source, node target,
+	workspace<> *ws_forward = nullptr, workspace<> *ws_backward = nullptr
+);
+
+// NODE-ALL
+
+/**
+ * @brief Directed/Undirected distance between a node to the rest of the
+ * graph's nodes.
+ *
+ * See @ref uxdistance(const uxgraph*, node, std::vector<_new_>&, workspace<>*).
+ *
+ * @param[in] G A directed/undirected compressed unweighted graph.
+ * @param[in] source The source node.
+ * @param[out] uxdistances The i-th position contains the directed/undirected
+ * distance between the source node and the i-th node of the graph.
+ * @param ws The memory used by the traversal (see @ref workspace). If
+ * null, the memory is allocated for this call only.
+ */
+void uxdistance(
+	const csr_uxgraph *G, node source, std::vector<_new_>& uxdistances,
+	workspace<> *ws = nullptr
+);
+/**
+ * @brief Directed/Undirected distance between a node to the rest of the
+ * graph's nodes.
+ *
+ * See @ref uxdistance(const uxgraph*, node, std::vector<_new_>&, std::vector<size_t>&, workspace<>*).
+ *
+ * @param[in] G A directed/undirected compressed unweighted graph.
+ * @param[in] source The source node.
+ * @param[out] uxdistances The i-th position contains the directed/undirected
+ * distance between the source node and the i-th node of the graph.
+ * @param[out] n_paths The i-th position contains the number of shortest paths
+ * between the source node and the i-th node.
+ * @param ws The memory used by the traversal (see @ref workspace). If
+ * null, the memory is allocated for this call only.
+ */
+void uxdistance(
+	const csr_uxgraph *G, node source,
+	std::vector<_new_>& uxdistances, std::vector<size_t>& n_paths,
+	workspace<> *ws = nullptr
+);
+/**
+ * @brief Directed/Undirected distance between a node to the rest of the
+ * graph's nodes.
+ *
+ * See @ref uxdistance(const uxgraph*, node, workspace<>&).
+ *
+ * @param[in] G A directed/undirected compressed unweighted graph.
+ * @param[in] source The source node.
+ * @param[out] ws The workspace where the distances are stored.
+ */
+void uxdistance(const csr_uxgraph *G, node source, workspace<>& ws);
+
+// ALL-ALL
+
+/**
+ * @brief Directed/Undirected distance between all pairs of nodes.
+ *
+ * See @ref uxdistances(const uxgraph*, std::vector<std::vector<_new_> >&, size_t).
+ *
+ * @param[in] G A directed/undirected compressed unweighted graph.
+ * @param[out] ds The shortest directed/undirected distance between all pairs
+ * of nodes.
+ * @param[in] n_threads Number of threads used to run the traversals (see
+ * @ref utils::n_threads_used).
+ */
+void uxdistances
+(const csr_uxgraph *G, std::vector<std::vector<_new_> >& ds, size_t n_threads = 1);
+/**
+ * @brief Directed/Undirected distance between all pairs of nodes.
+ *
+ * See @ref uxdistances(const uxgraph*, std::vector<std::vector<_new_> >&, std::vector<std::vector<size_t> >&, size_t).
+ *
+ * @param[in] G A directed/undirected compressed unweighted graph.
+ * @param[out] ds The shortest directed/undirected distance between all pairs
+ * of nodes.
+ * @param[out] n_paths The number of shortest paths between each pair of nodes.
+ * @param[in] n_threads Number of threads used to run the traversals (see
+ * @ref utils::n_threads_used).
+ */
+void uxdistances(
+	const csr_uxgraph *G,
+	std::vector<std::vector<_new_> >& ds,
+	std::vector<std::vector<size_t> >& n_paths,
+	size_t n_threads = 1
+);
+/**
+ * @brief Directed/Undirected distance between all pairs of nodes.
+ *
+ * See @ref uxdistances(const uxgraph*, distance_matrix&, size_t).
+ *
+ * @param[in] G A directed/undirected compressed unweighted graph.
+ * @param[out] ds The shortest directed/undirected distance between all pairs
+ * of nodes.
+ * @param[in] n_threads Number of threads used to run the traversals (see
+ * @ref utils::n_threads_used).
+ */
+void uxdistances
+(const csr_uxgraph *G, distance_matrix& ds, size_t n_threads = 1);
+/**
+ * @brief Sum of the distances from every node to the rest of the nodes.
+ *
+ * See @ref uxdistance_sums(const uxgraph*, std::vector<_new_>&, size_t).
+ *
+ * @param[in] G A directed/undirected compressed unweighted graph.
+ * @param[out] sums The i-th position contains the sum of the distances
+ * from the i-th node to all the nodes reachable from it.
+ * @param[in] n_threads Number of threads used to run the traversals (see
+ * @ref utils::n_threads_used).
+ */
+void uxdistance_sums
+(const csr_uxgraph *G, std::vector<_new_>& sums, size_t n_threads = 1);
+
+/* PATH FINDING IN UNWEIGHTED GRAPHS */
+
+// NODE-NODE
+
+/**
+ * @brief A directed/undirected path between two nodes.
+ *
+ * See @ref uxpath_bidirectional(const uxgraph*, const csr_uxgraph*, node, node, node_path<_new_>&, workspace<>*, workspace<>*).
+ *
+ * @param[in] G A directed/undirected compressed unweighted graph.
+ * @param[in] R The reverse of @e G (see @ref csr_uxgraph::init_reverse).
+ * If null, @e G must be undirected, and is its own reverse.
+ * @param[in] source The source node.
+ * @param[in] target The target node.
+ * @param[out] p A shortest path between the nodes. Empty if @e target is
+ * not reachable from @e source.
+ * @param ws_forward The memory used by the traversal from @e source (see
+ * @ref workspace). If null, the memory is allocated for this call only.
+ * @param ws_backward The memory used by the traversal from @e target.
+ * If null, the memory is allocated for this call only.
+ */
+void uxpath_bidirectional(
+	const csr_uxgraph *G, const csr_uxgraph *R, node source, node target,
+	node_path<_new_>& p,
+	workspace<> *ws_forward = nullptr, workspace<> *ws_backward = nullptr
+);
+
+// NODE-ALL
+
+/**
+ * @brief All directed/undirected shortest paths between a source node and
+ * any other node in the graph.
+ *
+ * See @ref uxpaths(const uxgraph*, node, shortest_path_dag<_new_>&).
+ *
+ * @param[in] G A directed/undirected compressed unweighted graph.
+ * @param[in] source The source node.
+ * @param[out] dag All shortest paths from the source node.
+ */
+void uxpaths(const csr_uxgraph *G, node source, shortest_path_dag<_new_>& dag);
+
+// ALL-ALL
+
+/**
+ * @brief All directed/undirected shortest paths between all pairs of nodes
+ * in the graph.
+ *
+ * See @ref uxpaths(const uxgraph*, node, shortest_path_dag<_new_>&).
+ *
+ * @param[in] G A directed/undirected compressed unweighted graph.
+ * @param[out] dags @e dags[s] contains all shortest paths from node @e s.
+ * @param[in] n_threads Number of threads used to run the traversals (see
+ * @ref utils::n_threads_used).
+ */
+void uxpaths(
+	const csr_uxgraph *G, std::vector<shortest_path_dag<_new_> >& dags,
+	size_t n_threads = 1
+);
 
 } // -- namespace traversal
 } // -- namespace lgraph
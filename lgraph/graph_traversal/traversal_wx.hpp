@@ -26,8 +26,13 @@
 
 // lgraph includes
 #include <lgraph/data_structures/boolean_path.hpp>
+#include <lgraph/data_structures/contraction_hierarchy.hpp>
+#include <lgraph/data_structures/csr_wxgraph.hpp>
+#include <lgraph/data_structures/landmark_index.hpp>
 #include <lgraph/data_structures/node_path.hpp>
+#include <lgraph/data_structures/shortest_path_dag.hpp>
 #include <lgraph/data_structures/wxgraph.hpp>
+#include <lgraph/graph_traversal/workspace.hpp>
 
 namespace lgraph {
 namespace traversal {
@@ -48,10 +53,13 @@ namespace traversal {
  * @param[in] G A directed/undirected weighted graph.
  * @param[in] source The source node.
  * @param[in] target The target node.
+ * @param ws The memory used by the traversal (see @ref workspace). If
+ * null, the memory is allocated for this call only.
  * @return The shortest distance between @e source and @e target.
  */
 template<class T>
-T wxdistance(const wxgraph<T> *G, node source, node target);
+T wxdistance
+(const wxgraph<T> *G, node source, node target, workspace<T> *ws = nullptr);
 /**
  * @brief Directed/Undirected distance between two nodes.
  *
@@ -62,10 +70,64 @@ T wxdistance(const wxgraph<T> *G, node source, node target);
  * @param[in] target The target node.
  * @param[out] n_paths The number of shortest paths between @e source and
  * @e target.
+ * @param ws The memory used by the traversal (see @ref workspace). If
+ * null, the memory is allocated for this call only.
  * @return The shortest distance between @e source and @e target.
  */
 template<class T>
-T wxdistance(const wxgraph<T> *G, node source, node target, size_t& n_paths);
+T wxdistance(
+	const wxgraph<T> *G, node source, node target, size_t& n_paths,
+	workspace<T> *ws = nullptr
+);
+
+/**
+ * @brief Directed/Undirected distance between two nodes.
+ *
+ * Applies a bidirectional Dijkstra's algorithm (see
+ * @ref dijkstra::bidirectional_Dijkstra), which usually reaches far fewer
+ * nodes than @ref wxdistance(const wxgraph<T>*, node, node, workspace<T>*).
+ *
+ * @param[in] G A directed/undirected weighted graph.
+ * @param[in] R The reverse of @e G (see @ref csr_wxgraph::init_reverse).
+ * If null, @e G must be undirected, and is its own reverse.
+ * @param[in] source The source node.
+ * @param[in] target The target node.
+ * @param ws_forward The memory used by the traversal from @e source (see
+ * @ref workspace). If null, the memory is allocated for this call only.
+ * @param ws_backward The memory used by the traversal from @e target.
+ * If null, the memory is allocated for this call only.
+ * @return The shortest distance between @e source and @e target.
+ */
+template<class T>
+T wxdistance_bidirectional(
+	const wxgraph<T> *G, const csr_wxgraph<T> *R, node source, node target,
+	workspace<T> *ws_forward = nullptr, workspace<T> *ws_backward = nullptr
+);
+
+/**
+ * @brief Directed/Undirected distance between two nodes.
+ *
+ * Applies the A* search guided by the landmarks of @e idx (see
+ * @ref landmark_index): the next node settled is the one with the
+ * smallest sum of its distance from @e source and the lower bound of its
+ * distance to @e target. The search reaches far fewer nodes than
+ * @ref wxdistance(const wxgraph<T>*, node, node, workspace<T>*) when the
+ * bounds are tight, and none at all when the landmarks prove that
+ * @e target is not reachable from @e source.
+ *
+ * @param[in] G A directed/undirected weighted graph.
+ * @param[in] idx The landmarks of @e G (see @ref wxlandmarks).
+ * @param[in] source The source node.
+ * @param[in] target The target node.
+ * @param ws The memory used by the traversal (see @ref workspace). If
+ * null, the memory is allocated for this call only.
+ * @return The shortest distance between @e source and @e target.
+ */
+template<class T>
+T wxdistance_landmarks(
+	const wxgraph<T> *G, const landmark_index<T>& idx, node source, node target,
+	workspace<T> *ws = nullptr
+);
 
 // NODE-ALL
 
@@ -79,9 +141,14 @@ T wxdistance(const wxgraph<T> *G, node source, node target, size_t& n_paths);
  * @param[in] source The source node.
  * @param[out] wxdistances The i-th position contains the directed/undirected
  * distance between the source node and the i-th node of the graph.
+ * @param ws The memory used by the traversal (see @ref workspace). If
+ * null, the memory is allocated for this call only.
  */
 template<class T>
-void wxdistance(const wxgraph<T> *G, node source, std::vector<T>& wxdistances);
+void wxdistance(
+	const wxgraph<T> *G, node source, std::vector<T>& wxdistances,
+	workspace<T> *ws = nullptr
+);
 /**
  * @brief Directed/Undirected distance between a node to the rest of the graph's nodes.
  *
@@ -93,11 +160,54 @@ void wxdistance(const wxgraph<T> *G, node source, std::vector<T>& wxdistances);
  * distance between the source node and the i-th node of the graph.
  * @param[out] n_paths The i-th position contains the number of shortest paths
  * between the source node and the i-th node.
+ * @param ws The memory used by the traversal (see @ref workspace). If
+ * null, the memory is allocated for this call only.
  */
 template<class T>
 void wxdistance(
 	const wxgraph<T> *G, node source,
-	std::vector<T>& wxdistances, std::vector<size_t>& n_paths
+	std::vector<T>& wxdistances, std::vector<size_t>& n_paths,
+	workspace<T> *ws = nullptr
+);
+/**
+ * @brief Directed/Undirected distance between a node to the rest of the
+ * graph's nodes.
+ *
+ * Applies Dijkstra's algorithm for shortest-path finding. The
+ * distances and the number of shortest paths are left in the workspace
+ * (see @ref workspace::distance and @ref workspace::n_paths), and the
+ * nodes reachable from @e source in @ref workspace::visited_nodes. Only
+ * the nodes reached are written, so this needs no memory allocation
+ * when the workspace is reused.
+ *
+ * @param[in] G A directed/undirected weighted graph.
+ * @param[in] source The source node.
+ * @param[out] ws The workspace where the distances are stored.
+ */
+template<class T>
+void wxdistance(const wxgraph<T> *G, node source, workspace<T>& ws);
+/**
+ * @brief Directed/Undirected distance between a node to the rest of the
+ * graph's nodes, in parallel.
+ *
+ * Applies the delta-stepping algorithm (see @ref delta_stepping), which
+ * uses several threads for a single source. The distances are the same
+ * as those of @ref wxdistance(const wxgraph<T>*, node, std::vector<T>&, workspace<T>*),
+ * up to the rounding of floating-point weights.
+ *
+ * @param[in] G A directed/undirected weighted graph.
+ * @param[in] source The source node.
+ * @param[out] wxdistances The i-th position contains the directed/undirected
+ * distance between the source node and the i-th node of the graph.
+ * @param[in] delta The width of the buckets of the algorithm. If it is 0,
+ * a width is chosen from the weights and the degrees of the graph (see
+ * @ref delta_stepping_width).
+ * @param[in] n_threads Number of threads (see @ref utils::n_threads_used).
+ */
+template<class T>
+void wxdistance_delta_stepping(
+	const wxgraph<T> *G, node source, std::vector<T>& wxdistances,
+	T delta = 0, size_t n_threads = 1
 );
 
 // ALL-ALL
@@ -105,28 +215,34 @@ void wxdistance(
 /**
  * @brief Directed/Undirected distance between all pairs of nodes.
  *
- * Applies the Floyd-Warshall algorithm.
+ * Applies Dijkstra's algorithm from every node.
  *
  * @param[in] G A directed/undirected weighted graph.
  * @param[out] ds The shortest directed/undirected distance between all pairs
  * of nodes.
+ * @param[in] n_threads Number of threads used to run the traversals (see
+ * @ref utils::n_threads_used).
  */
 template<class T>
-void wxdistances(const wxgraph<T> *G, std::vector<std::vector<T> >& ds);
+void wxdistances
+(const wxgraph<T> *G, std::vector<std::vector<T> >& ds, size_t n_threads = 1);
 /**
  * @brief Directed/Undirected distance between all pairs of nodes.
  *
- * Applies the Floyd-Warshall algorithm.
+ * Applies Dijkstra's algorithm from every node.
  *
  * @param[in] G A directed/undirected weighted graph.
  * @param[out] ds The shortest directed/undirected distance between all pairs
  * of nodes.
  * @param[out] n_paths The number of shortest paths between each pair of nodes.
+ * @param[in] n_threads Number of threads used to run the traversals (see
+ * @ref utils::n_threads_used).
  */
 template<class T>
 void wxdistances(
 	const wxgraph<T> *G,
-	std::vector<std::vector<T> >& ds, std::vector<std::vector<size_t> >& n_paths
+	std::vector<std::vector<T> >& ds, std::vector<std::vector<size_t> >& n_paths,
+	size_t n_threads = 1
 );
 
 // NODE-NODE
@@ -181,6 +297,52 @@ void wxpaths(const wxgraph<T> *G, node source, node target, node_path_set<T>& ps
 template<class T>
 void wxpaths(const wxgraph<T> *G, node source, node target, boolean_path_set<T>& ps);
 
+/**
+ * @brief A directed/undirected path between two nodes.
+ *
+ * Applies a bidirectional Dijkstra's algorithm (see
+ * @ref dijkstra::bidirectional_Dijkstra).
+ *
+ * @param[in] G A directed/undirected weighted graph.
+ * @param[in] R The reverse of @e G (see @ref csr_wxgraph::init_reverse).
+ * If null, @e G must be undirected, and is its own reverse.
+ * @param[in] source The source node.
+ * @param[in] target The target node.
+ * @param[out] p A shortest path between the nodes. Empty if @e target is
+ * not reachable from @e source.
+ * @param ws_forward The memory used by the traversal from @e source (see
+ * @ref workspace). If null, the memory is allocated for this call only.
+ * @param ws_backward The memory used by the traversal from @e target.
+ * If null, the memory is allocated for this call only.
+ */
+template<class T>
+void wxpath_bidirectional(
+	const wxgraph<T> *G, const csr_wxgraph<T> *R, node source, node target,
+	node_path<T>& p,
+	workspace<T> *ws_forward = nullptr, workspace<T> *ws_backward = nullptr
+);
+
+/**
+ * @brief A directed/undirected path between two nodes.
+ *
+ * Applies the A* search guided by landmarks (see
+ * @ref wxdistance_landmarks(const wxgraph<T>*, const landmark_index<T>&, node, node, workspace<T>*)).
+ *
+ * @param[in] G A directed/undirected weighted graph.
+ * @param[in] idx The landmarks of @e G (see @ref wxlandmarks).
+ * @param[in] source The source node.
+ * @param[in] target The target node.
+ * @param[out] p A shortest path between the nodes. Empty if @e target is
+ * not reachable from @e source.
+ * @param ws The memory used by the traversal (see @ref workspace). If
+ * null, the memory is allocated for this call only.
+ */
+template<class T>
+void wxpath_landmarks(
+	const wxgraph<T> *G, const landmark_index<T>& idx, node source, node target,
+	node_path<T>& p, workspace<T> *ws = nullptr
+);
+
 // NODE-ALL
 
 /**
@@ -236,6 +398,23 @@ template<class T>
 void wxpaths(
 	const wxgraph<T> *G, node source, std::vector<boolean_path_set<T> >& ps
 );
+/**
+ * @brief All directed/undirected shortest paths between a source node and
+ * any other node in the graph.
+ *
+ * Applies Dijkstra's algorithm for shortest-path finding. The paths are
+ * not enumerated: they are stored compactly as the distances, the
+ * predecessors and the number of shortest paths of every node (see
+ * @ref shortest_path_dag), from which they can be generated one at a time.
+ * Two paths are considered equally long if their lengths differ in at
+ * most 1e-5.
+ *
+ * @param[in] G A directed/undirected weighted graph.
+ * @param[in] source The source node.
+ * @param[out] dag All shortest paths from the source node.
+ */
+template<class T>
+void wxpaths(const wxgraph<T> *G, node source, shortest_path_dag<T>& dag);
 
 // ALL-ALL
 
@@ -280,10 +459,487 @@ void wxpaths(const wxgraph<T> *G, std::vector<std::vector<node_path_set<T> > >&
  */
 template<class T>
 void wxpaths(const wxgraph<T> *G, std::vector<std::vector<boolean_path_set<T> > >& ps);
+/**
+ * @brief All directed/undirected shortest paths between all pairs of nodes
+ * in the graph.
+ *
+ * See @ref wxpaths(const wxgraph<T>*, node, shortest_path_dag<T>&).
+ *
+ * @param[in] G A directed/undirected weighted graph.
+ * @param[out] dags @e dags[s] contains all shortest paths from node @e s.
+ * @param[in] n_threads Number of threads used to run the traversals (see
+ * @ref utils::n_threads_used).
+ */
+template<class T>
+void wxpaths(
+	const wxgraph<T> *G, std::vector<shortest_path_dag<T> >& dags,
+	size_t n_threads = 1
+);
+
+/* LANDMARKS */
+
+/**
+ * @brief Selects landmarks and builds their index.
+ *
+ * The landmarks are chosen with the farthest heuristic in [1]: the first
+ * is the node farthest from node 0, and every other is the node farthest
+ * from its closest landmark, where the distance between a node and a
+ * landmark is, in directed graphs, the length of the shortest round trip
+ * between them. Nodes not reachable from any landmark are the farthest,
+ * so that every connected component gets a landmark before any of them
+ * gets two. Ties are broken by node index, so the selection is
+ * deterministic. Every landmark costs one traversal of the graph (two in
+ * directed graphs), and the index stores @e K distances (2@e K in
+ * directed graphs) per node.
+ *
+ * [1] Goldberg, A. V. and Harrelson, C., "Computing the shortest path: A*
+ * search meets graph theory", SODA, 2005.
+ *
+ * @param[in] G A directed/undirected weighted graph.
+ * @param[in] R The reverse of @e G (see @ref csr_wxgraph::init_reverse).
+ * If null, @e G must be undirected.
+ * @param[in] K The number of landmarks. At most the number of nodes are
+ * selected.
+ * @param[out] idx The landmarks and their distances to all nodes.
+ */
+template<class T>
+void wxlandmarks(
+	const wxgraph<T> *G, const csr_wxgraph<T> *R, size_t K,
+	landmark_index<T>& idx
+);
+/**
+ * @brief Builds the index of the given landmarks.
+ *
+ * The traversals from the landmarks are independent, and are run in
+ * parallel.
+ *
+ * @param[in] G A directed/undirected weighted graph.
+ * @param[in] R The reverse of @e G (see @ref csr_wxgraph::init_reverse).
+ * If null, @e G must be undirected.
+ * @param[in] landmarks The landmarks.
+ * @param[out] idx The landmarks and their distances to all nodes.
+ * @param[in] n_threads Number of threads used to run the traversals (see
+ * @ref utils::n_threads_used).
+ */
+template<class T>
+void wxlandmarks(
+	const wxgraph<T> *G, const csr_wxgraph<T> *R,
+	const std::vector<node>& landmarks, landmark_index<T>& idx,
+	size_t n_threads = 1
+);
+
+/* CONTRACTION HIERARCHIES */
+
+/**
+ * @brief Builds the contraction hierarchy of a graph.
+ *
+ * The nodes are contracted in increasing order of priority, following
+ * [1]: the number of shortcuts that the contraction of a node needs
+ * minus the number of its edges (the edge difference), plus the number
+ * of its neighbours already contracted. Priorities are updated lazily:
+ * the node of smallest priority is contracted only if its priority,
+ * recomputed, is still the smallest. A shortcut (u,x) through @e v is
+ * not added if a witness search, a Dijkstra's search from @e u that
+ * avoids @e v, finds a path from @e u to @e x not longer than the one
+ * through @e v. Witness searches are limited to a few hundred nodes, so
+ * a few shortcuts not needed may be added.
+ *
+ * The distances and paths found with the hierarchy (see
+ * @ref wxdistance_contracted and @ref wxpath_contracted) are the
+ * same as those found with Dijkstra's algorithm on @e G.
+ *
+ * [1] Geisberger, R., Sanders, P., Schultes, D. and Delling, D.,
+ * "Contraction hierarchies: faster and simpler hierarchical routing in
+ * road networks", WEA, 2008.
+ *
+ * @param[in] G A directed/undirected weighted graph.
+ * @param[out] ch The contraction hierarchy of @e G.
+ */
+template<class T>
+void wxcontract(const wxgraph<T> *G, contraction_hierarchy<T>& ch);
+
+/**
+ * @brief Directed/Undirected distance between two nodes.
+ *
+ * Applies the bidirectional query of [1] on a contraction hierarchy
+ * (see @ref contraction_hierarchy): a search from @e source that only
+ * goes up the hierarchy, and a search from @e target that only goes
+ * down, with stall-on-demand. Each search stops when the next node to
+ * be settled is not closer than the shortest path found.
+ *
+ * [1] Geisberger, R., Sanders, P., Schultes, D. and Delling, D.,
+ * "Contraction hierarchies: faster and simpler hierarchical routing in
+ * road networks", WEA, 2008.
+ *
+ * @param[in] ch The contraction hierarchy of a directed/undirected
+ * weighted graph (see @ref wxcontract).
+ * @param[in] source The source node.
+ * @param[in] target The target node.
+ * @param ws_forward The memory used by the traversal from @e source (see
+ * @ref workspace). If null, the memory is allocated for this call only.
+ * @param ws_backward The memory used by the traversal from @e target.
+ * If null, the memory is allocated for this call only.
+ * @return The shortest distance between @e source and @e target.
+ */
+template<class T>
+T wxdistance_contracted(
+	const contraction_hierarchy<T>& ch, node source, node target,
+	workspace<T> *ws_forward = nullptr, workspace<T> *ws_backward = nullptr
+);
+
+/**
+ * @brief A directed/undirected path between two nodes.
+ *
+ * Applies the query of @ref wxdistance_contracted, and unpacks the
+ * shortcuts of the path found into edges of the graph.
+ *
+ * @param[in] ch The contraction hierarchy of a directed/undirected
+ * weighted graph (see @ref wxcontract).
+ * @param[in] source The source node.
+ * @param[in] target The target node.
+ * @param[out] p A shortest path between the nodes. Empty if @e target is
+ * not reachable from @e source.
+ * @param ws_forward The memory used by the traversal from @e source (see
+ * @ref workspace). If null, the memory is allocated for this call only.
+ * @param ws_backward The memory used by the traversal from @e target.
+ * If null, the memory is allocated for this call only.
+ */
+template<class T>
+void wxpath_contracted(
+	const contraction_hierarchy<T>& ch, node source, node target,
+	node_path<T>& p,
+	workspace<T> *ws_forward = nullptr, workspace<T> *ws_backward = nullptr
+);
+
+// ------------------------------------------------------------
+// COMPRESSED WEIGHTED GRAPHS
+// ------------------------------------------------------------
+
+/* DISTANCE COMPUTATION */
+
+// NODE-NODE
+
+/**
+ * @brief Directed/Undirected distance between two nodes.
+ *
+ * See @ref wxdistance(const wxgraph<T>*, node, node, workspace<T>*).
+ *
+ * @param[in] G A directed/undirected compressed weighted graph.
+ * @param[in] source The source node.
+ * @param[in] target The target node.
+ * @param ws The memory used by the traversal (see @ref workspace). If
+ * null, the memory is allocated for this call only.
+ * @return The shortest distance between @e source and @e target.
+ */
+template<class T>
+T wxdistance
+(const csr_wxgraph<T> *G, node source, node target, workspace<T> *ws = nullptr);
+/**
+ * @brief Directed/Undirected distance between two nodes.
+ *
+ * See @ref wxdistance(const wxgraph<T>*, node, node, size_t&, workspace<T>*).
+ *
+ * @param[in] G A directed/undirected compressed weighted graph.
+ * @param[in] source The source node.
+ * @param[in] target The target node.
+ * @param[out] n_paths The number of shortest paths between @e source and
+ * @e target.
+ * @param ws The memory used by the traversal (see @ref workspace). If
+ * null, the memory is allocated for this call only.
+ * @return The shortest distance between @e source and @e target.
+ */
+template<class T>
+T wxdistance(
+	const csr_wxgraph<T> *G, node source, node target, size_t& n_paths,
+	workspace<T> *ws = nullptr
+);
+
+/**
+ * @brief Directed/Undirected distance between two nodes.
+ *
+ * See @ref wxdistance_bidirectional(const wxgraph<T>*, const csr_wxgraph<T>*, node, node, workspace<T>*, workspace<T>*).
+ *
+ * @param[in] G A directed/undirected compressed weighted graph.
+ * @param[in] R The reverse of @e G (see @ref csr_wxgraph::init_reverse).
+ * If null, @e G must be undirected, and is its own reverse.
+ * @param[in] source The source node.
+ * @param[in] target The target node.
+ * @param ws_forward The memory used by the traversal from @e source (see
+ * @ref workspace). If null, the memory is allocated for this call only.
+ * @param ws_backward The memory used by the traversal from @e target.
+ * If null, the memory is allocated for this call only.
+ * @return The shortest distance between @e source and @e target.
+ */
+template<class T>
+T wxdistance_bidirectional(
+	const csr_wxgraph<T> *G, const csr_wxgraph<T> *R, node source, node target,
+	workspace<T> *ws_forward = nullptr, workspace<T> *ws_backward = nullptr
+);
+
+/**
+ * @brief Directed/Undirected distance between two nodes.
+ *
+ * See @ref wxdistance_landmarks(const wxgraph<T>*, const landmark_index<T>&, node, node, workspace<T>*).
+ *
+ * @param[in] G A directed/undirected compressed weighted graph.
+ * @param[in] idx The landmarks of @e G (see @ref wxlandmarks).
+ * @param[in] source The source node.
+ * @param[in] target The target node.
+ * @param ws The memory used by the traversal (see @ref workspace). If
+ * null, the memory is allocated for this call only.
+ * @return The shortest distance between @e source and @e target.
+ */
+template<class T>
+T wxdistance_landmarks(
+	const csr_wxgraph<T> *G, const landmark_index<T>& idx, node source, node target,
+	workspace<T> *ws = nullptr
+);
+
+// NODE-ALL
+
+/**
+ * @brief Directed/Undirected distance between a node to the rest of the
+ * graph's nodes.
+ *
+ * See @ref wxdistance(const wxgraph<T>*, node, std::vector<T>&, workspace<T>*).
+ *
+ * @param[in] G A directed/undirected compressed weighted graph.
+ * @param[in] source The source node.
+ * @param[out] wxdistances The i-th position contains the directed/undirected
+ * distance between the source node and the i-th node of the graph.
+ * @param ws The memory used by the traversal (see @ref workspace). If
+ * null, the memory is allocated for this call only.
+ */
+template<class T>
+void wxdistance(
+	const csr_wxgraph<T> *G, node source, std::vector<T>& wxdistances,
+	workspace<T> *ws = nullptr
+);
+/**
+ * @brief Directed/Undirected distance between a node to the rest of the graph's nodes.
+ *
+ * See @ref wxdistance(const wxgraph<T>*, node, std::vector<T>&, std::vector<size_t>&, workspace<T>*).
+ *
+ * @param[in] G A directed/undirected compressed weighted graph.
+ * @param[in] source The source node.
+ * @param[out] wxdistances The i-th position contains the directed/undirected
+ * distance between the source node and the i-th node of the graph.
+ * @param[out] n_paths The i-th position contains the number of shortest paths
+ * between the source node and the i-th node.
+ * @param ws The memory used by the traversal (see @ref workspace). If
+ * null, the memory is allocated for this call only.
+ */
+template<class T>
+void wxdistance(
+	const csr_wxgraph<T> *G, node source,
+	std::vector<T>& wxdistances, std::vector<size_t>& n_paths,
+	workspace<T> *ws = nullptr
+);
+/**
+ * @brief Directed/Undirected distance between a node to the rest of the
+ * graph's nodes.
+ *
+ * See @ref wxdistance(const wxgraph<T>*, node, workspace<T>&).
+ *
+ * @param[in] G A directed/undirected compressed weighted graph.
+ * @param[in] source The source node.
+ * @param[out] ws The workspace where the distances are stored.
+ */
+template<class T>
+void wxdistance(const csr_wxgraph<T> *G, node source, workspace<T>& ws);
+/**
+ * @brief Directed/Undirected distance between a node to the rest of the
+ * graph's nodes, in parallel.
+ *
+ * See @ref wxdistance_delta_stepping(const wxgraph<T>*, node, std::vector<T>&, T, size_t).
+ *
+ * @param[in] G A directed/undirected compressed weighted graph.
+ * @param[in] source The source node.
+ * @param[out] wxdistances The i-th position contains the directed/undirected
+ * distance between the source node and the i-th node of the graph.
+ * @param[in] delta The width of the buckets of the algorithm.
+ * @param[in] n_threads Number of threads.
+ */
+template<class T>
+void wxdistance_delta_stepping(
+	const csr_wxgraph<T> *G, node source, std::vector<T>& wxdistances,
+	T delta = 0, size_t n_threads = 1
+);
+
+// ALL-ALL
+
+/**
+ * @brief Directed/Undirected distance between all pairs of nodes.
+ *
+ * See @ref wxdistances(const wxgraph<T>*, std::vector<std::vector<T> >&, size_t).
+ *
+ * @param[in] G A directed/undirected compressed weighted graph.
+ * @param[out] ds The shortest directed/undirected distance between all pairs
+ * of nodes.
+ * @param[in] n_threads Number of threads used to run the traversals (see
+ * @ref utils::n_threads_used).
+ */
+template<class T>
+void wxdistances
+(const csr_wxgraph<T> *G, std::vector<std::vector<T> >& ds, size_t n_threads = 1);
+/**
+ * @brief Directed/Undirected distance between all pairs of nodes.
+ *
+ * See @ref wxdistances(const wxgraph<T>*, std::vector<std::vector<T> >&, std::vector<std::vector<size_t> >&, size_t).
+ *
+ * @param[in] G A directed/undirected compressed weighted graph.
+ * @param[out] ds The shortest directed/undirected distance between all pairs
+ * of nodes.
+ * @param[out] n_paths The number of shortest paths between each pair of nodes.
+ * @param[in] n_threads Number of threads used to run the traversals (see
+ * @ref utils::n_threads_used).
+ */
+template<class T>
+void wxdistances(
+	const csr_wxgraph<T> *G,
+	std::vector<std::vector<T> >& ds, std::vector<std::vector<size_t> >& n_paths,
+	size_t n_threads = 1
+);
+
+/* PATH FINDING IN WEIGHTED GRAPHS */
+
+// NODE-NODE
+
+/**
+ * @brief A directed/undirected path between two nodes.
+ *
+ * See @ref wxpath_bidirectional(const wxgraph<T>*, const csr_wxgraph<T>*, node, node, node_path<T>&, workspace<T>*, workspace<T>*).
+ *
+ * @param[in] G A directed/undirected compressed weighted graph.
+ * @param[in] R The reverse of @e G (see @ref csr_wxgraph::init_reverse).
+ * If null, @e G must be undirected, and is its own reverse.
+ * @param[in] source The source node.
+ * @param[in] target The target node.
+ * @param[out] p A shortest path between the nodes. Empty if @e target is
+ * not reachable from @e source.
+ * @param ws_forward The memory used by the traversal from @e source (see
+ * @ref workspace). If null, the memory is allocated for this call only.
+ * @param ws_backward The memory used by the traversal from @e target.
+ * If null, the memory is allocated for this call only.
+ */
+template<class T>
+void wxpath_bidirectional(
+	const csr_wxgraph<T> *G, const csr_wxgraph<T> *R, node source, node target,
+	node_path<T>& p,
+	workspace<T> *ws_forward = nullptr, workspace<T> *ws_backward = nullptr
+);
+
+/**
+ * @brief A directed/undirected path between two nodes.
+ *
+ * See @ref wxpath_landmarks(const wxgraph<T>*, const landmark_index<T>&, node, node, node_path<T>&, workspace<T>*).
+ *
+ * @param[in] G A directed/undirected compressed weighted graph.
+ * @param[in] idx The landmarks of @e G (see @ref wxlandmarks).
+ * @param[in] source The source node.
+ * @param[in] target The target node.
+ * @param[out] p A shortest path between the nodes. Empty if @e target is
+ * not reachable from @e source.
+ * @param ws The memory used by the traversal (see @ref workspace). If
+ * null, the memory is allocated for this call only.
+ */
+template<class T>
+void wxpath_landmarks(
+	const csr_wxgraph<T> *G, const landmark_index<T>& idx, node source, node target,
+	node_path<T>& p, workspace<T> *ws = nullptr
+);
+
+// NODE-ALL
+
+/**
+ * @brief All directed/undirected shortest paths between a source node and
+ * any other node in the graph.
+ *
+ * See @ref wxpaths(const wxgraph<T>*, node, shortest_path_dag<T>&).
+ *
+ * @param[in] G A directed/undirected compressed weighted graph.
+ * @param[in] source The source node.
+ * @param[out] dag All shortest paths from the source node.
+ */
+template<class T>
+void wxpaths(const csr_wxgraph<T> *G, node source, shortest_path_dag<T>& dag);
+
+// ALL-ALL
+
+/**
+ * @brief All directed/undirected shortest paths between all pairs of nodes
+ * in the graph.
+ *
+ * See @ref wxpaths(const wxgraph<T>*, node, shortest_path_dag<T>&).
+ *
+ * @param[in] G A directed/undirected compressed weighted graph.
+ * @param[out] dags @e dags[s] contains all shortest paths from node @e s.
+ * @param[in] n_threads Number of threads used to run the traversals (see
+ * @ref utils::n_threads_used).
+ */
+template<class T>
+void wxpaths(
+	const csr_wxgraph<T> *G, std::vector<shortest_path_dag<T> >& dags,
+	size_t n_threads = 1
+);
+
+/* LANDMARKS */
+
+/**
+ * @brief Selects landmarks and builds their index.
+ *
+ * See @ref wxlandmarks(const wxgraph<T>*, const csr_wxgraph<T>*, size_t, landmark_index<T>&).
+ *
+ * @param[in] G A directed/undirected compressed weighted graph.
+ * @param[in] R The reverse of @e G (see @ref csr_wxgraph::init_reverse).
+ * If null, @e G must be undirected.
+ * @param[in] K The number of landmarks. At most the number of nodes are
+ * selected.
+ * @param[out] idx The landmarks and their distances to all nodes.
+ */
+template<class T>
+void wxlandmarks(
+	const csr_wxgraph<T> *G, const csr_wxgraph<T> *R, size_t K,
+	landmark_index<T>& idx
+);
+/**
+ * @brief Builds the index of the given landmarks.
+ *
+ * See @ref wxlandmarks(const wxgraph<T>*, const csr_wxgraph<T>*, const std::vector<node>&, landmark_index<T>&, size_t).
+ *
+ * @param[in] G A directed/undirected compressed weighted graph.
+ * @param[in] R The reverse of @e G (see @ref csr_wxgraph::init_reverse).
+ * If null, @e G must be undirected.
+ * @param[in] landmarks The landmarks.
+ * @param[out] idx The landmarks and their distances to all nodes.
+ * @param[in] n_threads Number of threads used to run the traversals (see
+ * @ref utils::n_threads_used).
+ */
+template<class T>
+void wxlandmarks(
+	const csr_wxgraph<T> *G, const csr_wxgraph<T> *R,
+	const std::vector<node>& landmarks, landmark_index<T>& idx,
+	size_t n_threads = 1
+);
+
+/* CONTRACTION HIERARCHIES */
+
+/**
+ * @brief Builds the contraction hierarchy of a graph.
+ *
+ * See @ref wxcontract(const wxgraph<T>*, contraction_hierarchy<T>&).
+ *
+ * @param[in] G A directed/undirected compressed weighted graph.
+ * @param[out] ch The contraction hierarchy of @e G.
+ */
+template<class T>
+void wxcontract(const csr_wxgraph<T> *G, contraction_hierarchy<T>& ch);
 
 } // -- namespace traversal
 } // -- namespace lgraph
 
 #include <lgraph/graph_traversal/paths_wx.cpp>
 #include <lgraph/graph_traversal/distances_wx.cpp>
+#include <lgraph/graph_traversal/landmarks_wx.cpp>
+#include <lgraph/graph_traversal/contraction_wx.cpp>
 #include <lgraph/graph_traversal/paths_boolean_wx.cpp>
@@ -0,0 +1,222 @@
+/*********************************************************************
+ * lgraph
+ * Copyright (C) 2018-2019 Lluís Alemany Puig
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ * 
+ * Contact: Lluís Alemany Puig (lluis.alemany.puig@gmail.com)
+ * 
+ ********************************************************************/
+
+#include <lgraph/graph_traversal/workspace.hpp>
+
+// C includes
+#include <assert.h>
+
+// C++ includes
+#include <algorithm>
+
+namespace lgraph {
+namespace traversal {
+
+// PRIVATE
+
+template<class T, class stamp_t>
+inline void workspace<T, stamp_t>::stamp(node u) {
+	if (m_stamps[u] != m_epoch) {
+		m_stamps[u] = m_epoch;
+		m_dists[u] = inf_t<T>();
+		m_paths[u] = 0;
+		m_parents[u] = m_n;
+	}
+}
+
+// PUBLIC
+
+template<class T, class stamp_t>
+workspace<T, stamp_t>::workspace() {
+	m_n = 0;
+	m_epoch = 1;
+}
+
+template<class T, class stamp_t>
+workspace<T, stamp_t>::workspace(size_t n, bool with_distances) {
+	m_n = 0;
+	m_epoch = 1;
+	init(n, with_distances);
+}
+
+template<class T, class stamp_t>
+workspace<T, stamp_t>::~workspace() { }
+
+template<class T, class stamp_t>
+void workspace<T, stamp_t>::init(size_t n, bool with_distances) {
+	if (m_n != n) {
+		m_n = n;
+		m_vis.assign(n, false);
+		m_visited_nodes.clear();
+		m_nodes.resize(n);
+		m_bitmap.assign((n + 63)/64, 0);
+
+		// distances of the previous size are useless
+		m_stamps.clear();
+		m_dists.clear();
+		m_paths.clear();
+		m_parents.clear();
+		m_heap_pos.clear();
+	}
+
+	if (with_distances and m_stamps.size() != n) {
+		// no slot belongs to the current generation
+		m_epoch = 1;
+		m_stamps.assign(n, 0);
+		m_dists.resize(n);
+		m_paths.resize(n);
+		m_parents.resize(n);
+	}
+
+	reset();
+}
+
+template<class T, class stamp_t>
+void workspace<T, stamp_t>::reset() {
+	for (node u : m_visited_nodes) {
+		m_vis[u] = false;
+	}
+	m_visited_nodes.clear();
+	if (not m_heap_pos.empty()) {
+		// nodes left in the heap by a traversal that terminated early
+		for (const std::pair<T, node>& e : m_heap) {
+			m_heap_pos[e.second] = inf_t<size_t>();
+		}
+	}
+	m_heap.clear();
+	for (std::vector<std::pair<T, node> >& b : m_buckets) {
+		b.clear();
+	}
+
+	++m_epoch;
+	if (m_epoch == 0) {
+		// the generations wrapped around: stamps of old
+		// generations could be mistaken for the current one
+		std::fill(m_stamps.begin(), m_stamps.end(), 0);
+		m_epoch = 1;
+	}
+}
+
+template<class T, class stamp_t>
+size_t workspace<T, stamp_t>::size() const {
+	return m_n;
+}
+
+// VISITED NODES
+
+template<class T, class stamp_t>
+const std::vector<bool>& workspace<T, stamp_t>::visited() const {
+	return m_vis;
+}
+
+template<class T, class stamp_t>
+bool workspace<T, stamp_t>::is_visited(node u) const {
+	return m_vis[u];
+}
+
+template<class T, class stamp_t>
+void workspace<T, stamp_t>::visit(node u) {
+	if (not m_vis[u]) {
+		m_vis[u] = true;
+		m_visited_nodes.push_back(u);
+	}
+}
+
+template<class T, class stamp_t>
+const std::vector<node>& workspace<T, stamp_t>::visited_nodes() const {
+	return m_visited_nodes;
+}
+
+// DISTANCES
+
+template<class T, class stamp_t>
+T workspace<T, stamp_t>::distance(node u) const {
+	assert(m_stamps.size() == m_n);
+	return (m_stamps[u] == m_epoch ? m_dists[u] : inf_t<T>());
+}
+
+template<class T, class stamp_t>
+void workspace<T, stamp_t>::set_distance(node u, const T& d) {
+	assert(m_stamps.size() == m_n);
+	stamp(u);
+	m_dists[u] = d;
+}
+
+template<class T, class stamp_t>
+size_t workspace<T, stamp_t>::n_paths(node u) const {
+	assert(m_stamps.size() == m_n);
+	return (m_stamps[u] == m_epoch ? m_paths[u] : 0);
+}
+
+template<class T, class stamp_t>
+void workspace<T, stamp_t>::set_n_paths(node u, size_t k) {
+	assert(m_stamps.size() == m_n);
+	stamp(u);
+	m_paths[u] = k;
+}
+
+template<class T, class stamp_t>
+node workspace<T, stamp_t>::parent(node u) const {
+	assert(m_stamps.size() == m_n);
+	return (m_stamps[u] == m_epoch ? m_parents[u] : m_n);
+}
+
+template<class T, class stamp_t>
+void workspace<T, stamp_t>::set_parent(node u, node p) {
+	assert(m_stamps.size() == m_n);
+	stamp(u);
+	m_parents[u] = p;
+}
+
+// BUFFERS
+
+template<class T, class stamp_t>
+std::vector<node>& workspace<T, stamp_t>::node_buffer() {
+	return m_nodes;
+}
+
+template<class T, class stamp_t>
+std::vector<uint64_t>& workspace<T, stamp_t>::node_bitmap() {
+	return m_bitmap;
+}
+
+template<class T, class stamp_t>
+std::vector<uint64_t>& workspace<T, stamp_t>::node_masks() {
+	return m_masks;
+}
+
+template<class T, class stamp_t>
+std::vector<std::pair<T, node> >& workspace<T, stamp_t>::heap() {
+	return m_heap;
+}
+
+template<class T, class stamp_t>
+std::vector<size_t>& workspace<T, stamp_t>::heap_positions() {
+	return m_heap_pos;
+}
+
+template<class T, class stamp_t>
+std::vector<std::vector<std::pair<T, node> > >& workspace<T, stamp_t>::buckets() {
+	return m_buckets;
+}
+
+} // -- namespace traversal
+} // -- namespace lgraph
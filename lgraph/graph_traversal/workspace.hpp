@@ -0,0 +1,266 @@
+/*********************************************************************
+ * lgraph
+ * Copyright (C) 2018-2019 Lluís Alemany Puig
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ * 
+ * Contact: Lluís Alemany Puig (lluis.alemany.puig@gmail.com)
+ * 
+ ********************************************************************/
+
+#pragma once
+
+// C includes
+#include <stdint.h>
+
+// C++ includes
+#include <utility>
+#include <vector>
+
+// lgraph includes
+#include <lgraph/utils/definitions.hpp>
+
+namespace lgraph {
+namespace traversal {
+
+/**
+ * @brief Memory used by a traversal of a graph.
+ *
+ * The traversal algorithms (@ref bfs::BFS, @ref dfs::DFS,
+ * @ref dijkstra::Dijkstra) and the distance functions need a set of
+ * visited nodes, a queue (or a stack, or a heap) and, sometimes, the
+ * distance from the source to every node. Allocating and clearing them
+ * costs O(n) per traversal, which dominates the cost of traversals that
+ * only reach a few nodes, and of many traversals in a row (from every
+ * node, for example). A workspace holds all this memory so that it can
+ * be reused from one traversal to the next.
+ *
+ * Resetting a workspace (see @ref reset) costs O(k), where k is the
+ * number of nodes reached since the last reset:
+ * - the visited nodes are recorded (see @ref visited_nodes) so that
+ * only their markers are cleared,
+ * - the distances and the number of paths are stamped with the
+ * generation (or epoch) they were set in. A reset starts a new
+ * generation, so the values set before are seen as unset without
+ * touching them.
+ *
+ * The distances and the number of paths are only allocated when asked
+ * for in @ref init.
+ *
+ * A workspace can only be used by one traversal at a time. Parallel
+ * traversals need one workspace per thread.
+ *
+ * @param T The type of the distances.
+ * @param stamp_t The type of the generations. It is an unsigned integral
+ * type. Smaller types use less memory, but the generations wrap around
+ * more often, and then all stamps are cleared in O(n) time.
+ */
+template<class T = _new_, class stamp_t = uint32_t>
+class workspace {
+	public:
+		/// Empty constructor.
+		workspace();
+		/**
+		 * @brief Constructor with size.
+		 *
+		 * See @ref init(size_t, bool) for details.
+		 */
+		workspace(size_t n, bool with_distances = false);
+		/// Destructor.
+		~workspace();
+
+		/**
+		 * @brief Prepares this workspace for a traversal of a graph.
+		 *
+		 * If the workspace was used for a graph of the same number of
+		 * nodes it is just reset (see @ref reset). Otherwise, memory is
+		 * reallocated.
+		 *
+		 * @param n The number of nodes of the graph.
+		 * @param with_distances Allocate memory for the distances, the
+		 * number of paths and the parents (see @ref distance,
+		 * @ref n_paths and @ref parent).
+		 * Once allocated, it is kept until the number of nodes changes.
+		 */
+		void init(size_t n, bool with_distances = false);
+
+		/**
+		 * @brief Starts a new traversal.
+		 *
+		 * All nodes become unvisited, all distances infinite, all
+		 * numbers of paths 0 and no node has a parent. The queue and the heap are emptied.
+		 */
+		void reset();
+
+		/// Returns the number of nodes this workspace was initialised with.
+		size_t size() const;
+
+		// VISITED NODES
+
+		/**
+		 * @brief The set of visited nodes.
+		 *
+		 * The i-th position is true if, and only if, the i-th node was
+		 * visited. This is the set passed to the functions guiding the
+		 * traversals.
+		 */
+		const std::vector<bool>& visited() const;
+		/// Returns true if node @e u was visited.
+		bool is_visited(node u) const;
+		/// Marks node @e u as visited.
+		void visit(node u);
+		/**
+		 * @brief The visited nodes, in the order they were marked.
+		 *
+		 * Iterating over this list instead of over all nodes costs
+		 * O(k) instead of O(n), where k is the number of visited nodes.
+		 */
+		const std::vector<node>& visited_nodes() const;
+
+		// DISTANCES
+
+		/**
+		 * @brief Returns the distance to node @e u.
+		 * @return Returns the last value set with @ref set_distance
+		 * since the last reset, or infinite.
+		 * @pre Memory for the distances was allocated (see @ref init).
+		 */
+		T distance(node u) const;
+		/// Sets the distance to node @e u.
+		void set_distance(node u, const T& d);
+
+		/**
+		 * @brief Returns the number of shortest paths to node @e u.
+		 * @return Returns the last value set with @ref set_n_paths
+		 * since the last reset, or 0.
+		 * @pre Memory for the distances was allocated (see @ref init).
+		 */
+		size_t n_paths(node u) const;
+		/// Sets the number of shortest paths to node @e u.
+		void set_n_paths(node u, size_t k);
+
+		/**
+		 * @brief Returns the parent of node @e u.
+		 *
+		 * The parent of a node is the node it was reached from in the
+		 * traversal, so that the path to it can be rebuilt.
+		 * @return Returns the last value set with @ref set_parent
+		 * since the last reset, or @ref size() if there is none.
+		 * @pre Memory for the distances was allocated (see @ref init).
+		 */
+		node parent(node u) const;
+		/// Sets the parent of node @e u.
+		void set_parent(node u, node p);
+
+		// BUFFERS
+
+		/**
+		 * @brief Buffer of (at least) @ref size() nodes.
+		 *
+		 * Used as the queue of the Breadth-First search and as the
+		 * stack of the Depth-First search: in both, every node is added
+		 * at most once. Its contents are undefined at the beginning of a
+		 * traversal.
+		 */
+		std::vector<node>& node_buffer();
+
+		/**
+		 * @brief Bitmap of @ref size() bits.
+		 *
+		 * The bit of node @e u is bit @e u % 64 of the word @e u / 64.
+		 * Used as the set of nodes of the frontier of the
+		 * direction-optimizing Breadth-First search. All bits are 0 at
+		 * the beginning of a traversal: a traversal that uses it must
+		 * clear the bits it sets.
+		 */
+		std::vector<uint64_t>& node_bitmap();
+
+		/**
+		 * @brief Masks of 64 bits for every node.
+		 *
+		 * Used by the multi-source Breadth-First search, which sizes
+		 * and initialises them. They are only allocated by the
+		 * traversals that use them.
+		 */
+		std::vector<uint64_t>& node_masks();
+
+		/**
+		 * @brief Heap of (distance, node) pairs.
+		 *
+		 * Used as the priority queue of Dijkstra's algorithm. It is
+		 * empty after a reset.
+		 */
+		std::vector<std::pair<T, node> >& heap();
+
+		/**
+		 * @brief Position of every node in the heap.
+		 *
+		 * Used by the indexed priority queues of Dijkstra's algorithm.
+		 * The position of the nodes not in the heap is @ref inf_t. It
+		 * is allocated by the queues that use it, and the nodes left in
+		 * the heap are removed from it after a reset.
+		 */
+		std::vector<size_t>& heap_positions();
+
+		/**
+		 * @brief Buckets of (distance, node) pairs.
+		 *
+		 * Used by the monotone priority queues of Dijkstra's algorithm.
+		 * They are allocated by the queues that use them, and emptied
+		 * after a reset.
+		 */
+		std::vector<std::vector<std::pair<T, node> > >& buckets();
+
+	private:
+		/// Initialises the slot of node @e u for the current generation.
+		void stamp(node u);
+
+	private:
+		/// Number of nodes.
+		size_t m_n;
+
+		/// Visited markers.
+		std::vector<bool> m_vis;
+		/// Nodes marked as visited since the last reset.
+		std::vector<node> m_visited_nodes;
+
+		/// Current generation.
+		stamp_t m_epoch;
+		/// Generation in which each slot was last initialised.
+		std::vector<stamp_t> m_stamps;
+		/// Distances. Only valid in slots of the current generation.
+		std::vector<T> m_dists;
+		/// Number of paths. Only valid in slots of the current generation.
+		std::vector<size_t> m_paths;
+		/// Parents. Only valid in slots of the current generation.
+		std::vector<node> m_parents;
+
+		/// Queue or stack of nodes.
+		std::vector<node> m_nodes;
+		/// Bitmap of nodes.
+		std::vector<uint64_t> m_bitmap;
+		/// Masks of every node.
+		std::vector<uint64_t> m_masks;
+		/// Heap of (distance, node) pairs.
+		std::vector<std::pair<T, node> > m_heap;
+		/// Position of every node in @ref m_heap.
+		std::vector<size_t> m_heap_pos;
+		/// Buckets of (distance, node) pairs.
+		std::vector<std::vector<std::pair<T, node> > > m_buckets;
+};
+
+} // -- namespace traversal
+} // -- namespace lgraph
+
+#include <lgraph/graph_traversal/workspace.cpp>
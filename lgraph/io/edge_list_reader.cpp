@@ -0,0 +1,193 @@
+/*********************************************************************
+ * lgraph
+ * Copyright (C) 2018-2019 Lluís Alemany Puig
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ * 
+ * Contact: Lluís Alemany Puig (lluis.alemany.puig@gmail.com)
+ * 
+ ********************************************************************/
+
+
+#include <lgraph/io/edge_list_reader.hpp>
+
+// C++ includes
+#include <algorithm>
+#include <numeric>
+
+// lgraph includes
+#include <lgraph/io/mapped_file.hpp>
+
+namespace lgraph {
+namespace io {
+namespace edge_list {
+
+// Keep only the first occurrence of every neighbour of every node
+// (and its weight). Returns the number of edges left.
+template<class T>
+inline size_t remove_duplicate_edges
+(
+	bool directed,
+	std::vector<neighbourhood>& adj,
+	std::vector<weight_list<T> > *wl
+)
+{
+	std::vector<size_t> order;
+	std::vector<node> ns;
+	std::vector<T> ws;
+	size_t n_neighbours = 0;
+
+	for (node u = 0; u < adj.size(); ++u) {
+		neighbourhood& nu = adj[u];
+		if (nu.size() == 0) {
+			continue;
+		}
+
+		// sort the neighbours keeping the order of the
+		// file among the occurrences of the same neighbour
+		order.resize(nu.size());
+		std::iota(order.begin(), order.end(), 0);
+		std::stable_sort(
+			order.begin(), order.end(),
+			[&nu](size_t i, size_t j) -> bool { return nu[i] < nu[j]; }
+		);
+
+		ns.clear();
+		ws.clear();
+		for (size_t i : order) {
+			const node v = nu[i];
+
+			// a loop in an undirected graph adds
+			// its node twice to the neighbourhood
+			const size_t copies = (not directed and v == u ? 2 : 1);
+			if (ns.size() >= copies and ns[ns.size() - copies] == v) {
+				continue;
+			}
+
+			ns.push_back(v);
+			if (wl != nullptr) {
+				ws.push_back((*wl)[u][i]);
+			}
+		}
+
+		std::copy(ns.begin(), ns.end(), nu.begin());
+		if (wl != nullptr) {
+			std::copy(ws.begin(), ws.end(), (*wl)[u].begin());
+		}
+		if (ns.size() < nu.size()) {
+			nu.remove(ns.size(), nu.size());
+			if (wl != nullptr) {
+				(*wl)[u].remove(ns.size(), (*wl)[u].size());
+			}
+		}
+
+		n_neighbours += nu.size();
+	}
+
+	return (directed ? n_neighbours : n_neighbours/2);
+}
+
+template<class T>
+bool read_adjacency
+(
+	const char *filename, bool directed, duplicates dup,
+	std::vector<neighbourhood>& adj,
+	std::vector<weight_list<T> > *wl,
+	size_t& n_edges
+)
+{
+	// each pass reads the file from beginning to end
+	mapped_file file;
+	if (not file.open(filename, mapped_file::access::sequential)) {
+		return false;
+	}
+
+	text_scanner scanner(file.data(), file.data() + file.size());
+
+	uint64_t u = 0, v = 0;
+	double w = 0.0;
+	auto next_edge =
+	[&]() -> bool
+	{
+		return scanner.next(u) and scanner.next(v) and
+			   (wl == nullptr or scanner.next(w));
+	};
+
+	// first pass: count the lines and the degree of every node
+	std::vector<size_t> degree(1, 0);
+	size_t n_lines = 0;
+	while (next_edge()) {
+		const size_t max_idx = std::max(u, v);
+		if (max_idx >= degree.size()) {
+			degree.resize(max_idx + 1, 0);
+		}
+
+		++degree[u];
+		if (not directed) {
+			++degree[v];
+		}
+		++n_lines;
+	}
+
+	// allocate every neighbourhood with its exact size
+	const size_t N = degree.size();
+	adj.clear();
+	adj.reserve(N);
+	for (node s = 0; s < N; ++s) {
+		adj.emplace_back(degree[s]);
+	}
+	if (wl != nullptr) {
+		wl->clear();
+		wl->reserve(N);
+		for (node s = 0; s < N; ++s) {
+			wl->emplace_back(degree[s]);
+		}
+	}
+
+	// second pass: fill the neighbourhoods. From now on,
+	// degree[s] is the number of neighbours of s added so far
+	std::fill(degree.begin(), degree.end(), 0);
+	scanner.rewind();
+	for (size_t l = 0; l < n_lines; ++l) {
+		// both passes read the same contents, so this only
+		// fails if the file was modified in between
+		if (not next_edge()) {
+			return false;
+		}
+
+		adj[u][degree[u]] = v;
+		if (wl != nullptr) {
+			(*wl)[u][degree[u]] = static_cast<T>(w);
+		}
+		++degree[u];
+
+		if (not directed) {
+			adj[v][degree[v]] = u;
+			if (wl != nullptr) {
+				(*wl)[v][degree[v]] = static_cast<T>(w);
+			}
+			++degree[v];
+		}
+	}
+
+	n_edges = n_lines;
+	if (dup == duplicates::remove) {
+		n_edges = remove_duplicate_edges(directed, adj, wl);
+	}
+	return true;
+}
+
+} // -- namespace edge_list
+} // -- namespace io
+} // -- namespace lgraph
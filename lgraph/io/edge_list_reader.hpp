@@ -0,0 +1,188 @@
+/*********************************************************************
+ * lgraph
+ * Copyright (C) 2018-2019 Lluís Alemany Puig
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ * 
+ * Contact: Lluís Alemany Puig (lluis.alemany.puig@gmail.com)
+ * 
+ ********************************************************************/
+
+
+#pragma once
+
+// C includes
+#include <stdint.h>
+#include <stdlib.h>
+
+// C++ includes
+#include <vector>
+
+// lgraph includes
+#include <lgraph/utils/definitions.hpp>
+
+namespace lgraph {
+namespace io {
+namespace edge_list {
+
+/**
+ * @brief What to do with the edges that appear more than once in a file.
+ *
+ * In undirected graphs, the lines "u v" and "v u" are the same edge.
+ */
+enum class duplicates {
+	/**
+	 * @brief Every line of the file is added as an edge.
+	 *
+	 * The file is trusted not to contain repeated edges: no check is
+	 * made at all. This is the fastest policy.
+	 */
+	keep,
+	/**
+	 * @brief Only the first occurrence of every edge is added.
+	 *
+	 * In weighted graphs, the weight of the edge is the one found in
+	 * its first occurrence. As a side effect, the neighbourhood of
+	 * every node is left sorted.
+	 */
+	remove
+};
+
+/**
+ * @brief Scanner of numbers in a text held in memory.
+ *
+ * Mimics the operator >> of C++'s input streams: whitespace before
+ * every number is skipped, and reading stops at the first token that
+ * is not a number.
+ */
+class text_scanner {
+	public:
+		/// Constructor with the text in the interval [@e b, @e e).
+		text_scanner(const char *b, const char *e) : m_begin(b), m_end(e), m_cur(b) { }
+
+		/**
+		 * @brief Reads a non-negative integer in decimal notation.
+		 * @param[out] x The integer read.
+		 * @return Returns false if there are no more numbers.
+		 */
+		inline bool next(uint64_t& x) {
+			skip_whitespace();
+			if (m_cur == m_end or not is_digit(*m_cur)) {
+				return false;
+			}
+
+			x = 0;
+			while (m_cur != m_end and is_digit(*m_cur)) {
+				x = 10*x + static_cast<uint64_t>(*m_cur - '0');
+				++m_cur;
+			}
+			return true;
+		}
+
+		/**
+		 * @brief Reads a real number.
+		 *
+		 * The number is converted with the C library's @e strtod.
+		 * @param[out] x The number read.
+		 * @return Returns false if there are no more numbers.
+		 */
+		inline bool next(double& x) {
+			skip_whitespace();
+
+			// copy the token: the text need not be null-terminated
+			char token[64];
+			size_t len = 0;
+			while (m_cur + len != m_end and len + 1 < sizeof(token) and
+				   not is_space(m_cur[len]))
+			{
+				token[len] = m_cur[len];
+				++len;
+			}
+			token[len] = '\0';
+
+			char *token_end = nullptr;
+			x = strtod(token, &token_end);
+			if (token_end == token) {
+				return false;
+			}
+			m_cur += (token_end - token);
+			return true;
+		}
+
+		/// Moves the scanner back to the beginning of the text.
+		inline void rewind() {
+			m_cur = m_begin;
+		}
+
+	private:
+		/// Beginning of the text.
+		const char *m_begin;
+		/// End of the text.
+		const char *m_end;
+		/// Current position of the scanner.
+		const char *m_cur;
+
+		static inline bool is_digit(char c) {
+			return '0' <= c and c <= '9';
+		}
+
+		static inline bool is_space(char c) {
+			return c == ' ' or c == '\n' or c == '\t' or
+				   c == '\r' or c == '\v' or c == '\f';
+		}
+
+		inline void skip_whitespace() {
+			while (m_cur != m_end and is_space(*m_cur)) {
+				++m_cur;
+			}
+		}
+};
+
+/**
+ * @brief Reads the adjacency list of a graph from a file in edge list format.
+ *
+ * The file is mapped into memory (see @ref mapped_file) and read twice:
+ * the first pass counts the degree of every node and the second fills
+ * the neighbourhoods, which are allocated with their exact size
+ * beforehand. No edge is looked up in the graph while reading, so
+ * repeated edges are dealt with according to @e dup.
+ *
+ * The order of the neighbours of every node is the order in which
+ * they appear in the file, unless @e dup is @ref duplicates::remove.
+ *
+ * @param filename The name of the file to be read.
+ * @param directed Is the graph directed?
+ * @param dup What to do with repeated edges.
+ * @param[out] adj The adjacency list.
+ * @param[out] wl The weights of the edges, or a null pointer if the
+ * file is unweighted (then, @e T is irrelevant).
+ * @param[out] n_edges The number of edges in @e adj.
+ * @return Returns false if the file could not be opened, or if the
+ * second pass did not find the edges counted in the first. Returns true
+ * otherwise.
+ */
+template<class T>
+bool read_adjacency
+(
+	const char *filename, bool directed, duplicates dup,
+	std::vector<neighbourhood>& adj,
+	std::vector<weight_list<T> > *wl,
+	size_t& n_edges
+);
+
+} // -- namespace edge_list
+} // -- namespace io
+} // -- namespace lgraph
+
+#include <lgraph/io/edge_list_reader.cpp>
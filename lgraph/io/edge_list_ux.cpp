@@ -23,6 +23,7 @@
 
 // C++ includes
 #include <fstream>
+#include <utility>
 using namespace std;
 
 namespace lgraph {
@@ -31,31 +32,20 @@ namespace edge_list {
 
 // -- READING --
 
-bool read(const std::string& filename, uxgraph *g) {
-	return read(filename.c_str(), g);
+bool read(const std::string& filename, uxgraph *g, duplicates dup) {
+	return read(filename.c_str(), g, dup);
 }
 
-bool read(const char *filename, uxgraph *g) {
-	ifstream fin;
-	fin.open(filename);
+bool read(const char *filename, uxgraph *g, duplicates dup) {
+	vector<neighbourhood> adj;
+	size_t n_edges;
 
 	// file could not be opened. return "error"
-	if (not fin.is_open()) {
+	if (not read_adjacency<node>(filename, g->is_directed(), dup, adj, nullptr, n_edges)) {
 		return false;
 	}
 
-	size_t max_vert_idx = 0;
-	vector<edge> edge_list;
-	size_t u, v;
-	while (fin >> u >> v) {
-		edge_list.push_back(edge(u, v));
-		max_vert_idx = max(max_vert_idx, u);
-		max_vert_idx = max(max_vert_idx, v);
-	}
-	fin.close();
-
-	g->init(max_vert_idx + 1);
-	g->add_edges(edge_list);
+	g->init(std::move(adj), n_edges);
 	return true;
 }
 
@@ -24,6 +24,7 @@
 // lgraph includes
 #include <lgraph/data_structures/uxgraph.hpp>
 #include <lgraph/data_structures/wxgraph.hpp>
+#include <lgraph/io/edge_list_reader.hpp>
 
 namespace lgraph {
 namespace io {
@@ -35,20 +36,28 @@ namespace edge_list {
 
 /**
  * @brief Reads an unweighted graph in edge list format.
+ *
+ * Every line "u v" of the file is an edge. The graph has as many nodes
+ * as the largest index found plus one. See @ref read_adjacency.
  * @param filename The name of the file to be read.
  * @param[out] g The graph built with the contents in the file.
+ * @param dup What to do with repeated edges.
  * @return Returns false if the file coule not be opened.
  * Returns true otherwise.
  */
-bool read(const std::string& filename, uxgraph *g);
+bool read(const std::string& filename, uxgraph *g, duplicates dup = duplicates::keep);
 /**
  * @brief Reads an unweighted graph in edge list format.
+ *
+ * Every line "u v" of the file is an edge. The graph has as many nodes
+ * as the largest index found plus one. See @ref read_adjacency.
  * @param filename The name of the file to be read.
  * @param[out] g The graph built with the contents in the file.
+ * @param dup What to do with repeated edges.
  * @return Returns false if the file coule not be opened.
  * Returns true otherwise.
  */
-bool read(const char *filename, uxgraph *g);
+bool read(const char *filename, uxgraph *g, duplicates dup = duplicates::keep);
 
 /**
  * @brief Writes an unweighted graph in edge list format.
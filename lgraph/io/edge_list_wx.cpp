@@ -23,6 +23,7 @@
 
 // C++ includes
 #include <fstream>
+#include <utility>
 
 namespace lgraph {
 namespace io {
@@ -31,34 +32,20 @@ namespace edge_list {
 // -- READING --
 
 template<class T>
-bool read(const std::string& filename, wxgraph<T> *g) {
-	return read(filename.c_str(), g);
+bool read(const std::string& filename, wxgraph<T> *g, duplicates dup) {
+	return read(filename.c_str(), g, dup);
 }
 
 template<class T>
-bool read(const char *filename, wxgraph<T> *g) {
-	std::ifstream fin;
-	fin.open(filename);
-	if (not fin.is_open()) {
+bool read(const char *filename, wxgraph<T> *g, duplicates dup) {
+	std::vector<neighbourhood> adj;
+	std::vector<weight_list<T> > wl;
+	size_t n_edges;
+	if (not read_adjacency<T>(filename, g->is_directed(), dup, adj, &wl, n_edges)) {
 		return false;
 	}
 
-	size_t max_vert_idx = 0;
-	std::vector<edge> edge_list;
-	std::vector<T> weights;
-	size_t u, v;
-	T w;
-	while (fin >> u >> v) {
-		fin >> w;
-		edge_list.push_back(edge(u, v));
-		weights.push_back(w);
-		max_vert_idx = std::max(max_vert_idx, u);
-		max_vert_idx = std::max(max_vert_idx, v);
-	}
-	fin.close();
-
-	g->init(max_vert_idx + 1);
-	g->add_edges(edge_list, weights);
+	g->init(std::move(adj), std::move(wl), n_edges);
 	return true;
 }
 
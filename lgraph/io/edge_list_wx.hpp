@@ -24,6 +24,7 @@
 // lgraph includes
 #include <lgraph/data_structures/uxgraph.hpp>
 #include <lgraph/data_structures/wxgraph.hpp>
+#include <lgraph/io/edge_list_reader.hpp>
 
 namespace lgraph {
 namespace io {
@@ -35,22 +36,30 @@ namespace edge_list {
 
 /**
  * @brief Reads a weighted graph in edge list format.
+ *
+ * Every line "u v w" of the file is an edge of weight w. The graph has
+ * as many nodes as the largest index found plus one. See @ref read_adjacency.
  * @param filename The name of the file to be read.
  * @param[out] g The graph built with the contents in the file.
+ * @param dup What to do with repeated edges.
  * @return Returns false if the file coule not be opened.
  * Returns true otherwise.
  */
 template<class T>
-bool read(const std::string& filename, wxgraph<T> *g);
+bool read(const std::string& filename, wxgraph<T> *g, duplicates dup = duplicates::keep);
 /**
  * @brief Reads a weighted graph in edge list format.
+ *
+ * Every line "u v w" of the file is an edge of weight w. The graph has
+ * as many nodes as the largest index found plus one. See @ref read_adjacency.
  * @param filename The name of the file to be read.
  * @param[out] g The graph built with the contents in the file.
+ * @param dup What to do with repeated edges.
  * @return Returns false if the file coule not be opened.
  * Returns true otherwise.
  */
 template<class T>
-bool read(const char *filename, wxgraph<T> *g);
+bool read(const char *filename, wxgraph<T> *g, duplicates dup = duplicates::keep);
 
 /**
  * @brief Writes a weighted graph in edge list format.
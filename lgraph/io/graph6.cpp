@@ -217,8 +217,9 @@ void to_g6_string(const uugraph& g, std::string& s) {
 	 * an attempt to obtain a safer computation.
 	 */
 
-	// bits needed for the adjacency matrix
-	size_t n_bits = n_cells + (n_cells/6)*2;
+	// bits needed for the adjacency matrix: each group of 6 cells
+	// (the last one may be incomplete) is stored in a whole byte
+	size_t n_bits = 8*(n_cells/6 + (n_cells%6 != 0));
 
 	static_bitset bs;
 	bs.init_unset(n_bits);
@@ -37,3 +37,6 @@
 #include <lgraph/io/edge_list_ux.hpp>
 #include <lgraph/io/edge_list_wx.hpp>
 #include <lgraph/io/gsd6.hpp>
+#include <lgraph/io/snapshot_landmarks.hpp>
+#include <lgraph/io/snapshot_ux.hpp>
+#include <lgraph/io/snapshot_wx.hpp>
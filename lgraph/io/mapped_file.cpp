@@ -0,0 +1,136 @@
+/*********************************************************************
+ * lgraph
+ * Copyright (C) 2018-2019 Lluís Alemany Puig
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ * 
+ * Contact: Lluís Alemany Puig (lluis.alemany.puig@gmail.com)
+ * 
+ ********************************************************************/
+
+
+#include <lgraph/io/mapped_file.hpp>
+
+// C includes
+#if defined (__unix__) or defined (__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define LGRAPH_USE_MMAP
+#endif
+
+// C++ includes
+#include <fstream>
+
+// lgraph includes
+#include <lgraph/utils/definitions.hpp>
+
+namespace lgraph {
+namespace io {
+
+// PUBLIC
+
+mapped_file::mapped_file() : m_data(nullptr), m_size(0), m_open(false) { }
+
+mapped_file::~mapped_file() {
+	close();
+}
+
+bool mapped_file::open(const char *filename, access a) {
+	close();
+
+#if defined (LGRAPH_USE_MMAP)
+	int fd = ::open(filename, O_RDONLY);
+	if (fd == -1) {
+		return false;
+	}
+
+	struct stat st;
+	if (fstat(fd, &st) == -1) {
+		::close(fd);
+		return false;
+	}
+
+	m_size = static_cast<size_t>(st.st_size);
+	if (m_size > 0) {
+		void *p = mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+		if (p == MAP_FAILED) {
+			::close(fd);
+			m_size = 0;
+			return false;
+		}
+
+		if (a == access::sequential) {
+			madvise(p, m_size, MADV_SEQUENTIAL);
+		}
+		else if (a == access::random) {
+			madvise(p, m_size, MADV_RANDOM);
+		}
+		m_data = static_cast<const char *>(p);
+	}
+
+	// the mapping stays valid after closing the descriptor
+	::close(fd);
+#else
+	UNUSED(a);
+	std::ifstream fin(filename, std::ios::binary);
+	if (not fin.is_open()) {
+		return false;
+	}
+
+	fin.seekg(0, std::ios::end);
+	m_size = static_cast<size_t>(fin.tellg());
+	fin.seekg(0, std::ios::beg);
+
+	m_buffer.resize(m_size);
+	if (m_size > 0) {
+		fin.read(m_buffer.data(), m_size);
+		m_data = m_buffer.data();
+	}
+#endif
+
+	m_open = true;
+	return true;
+}
+
+void mapped_file::close() {
+#if defined (LGRAPH_USE_MMAP)
+	if (m_data != nullptr) {
+		munmap(const_cast<char *>(m_data), m_size);
+	}
+#else
+	m_buffer.clear();
+	m_buffer.shrink_to_fit();
+#endif
+
+	m_data = nullptr;
+	m_size = 0;
+	m_open = false;
+}
+
+bool mapped_file::is_open() const {
+	return m_open;
+}
+
+const char *mapped_file::data() const {
+	return m_data;
+}
+
+size_t mapped_file::size() const {
+	return m_size;
+}
+
+} // -- namespace io
+} // -- namespace lgraph
@@ -0,0 +1,111 @@
+/*********************************************************************
+ * lgraph
+ * Copyright (C) 2018-2019 Lluís Alemany Puig
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ * 
+ * Contact: Lluís Alemany Puig (lluis.alemany.puig@gmail.com)
+ * 
+ ********************************************************************/
+
+
+#pragma once
+
+// C includes
+#include <stddef.h>
+
+// C++ includes
+#include <vector>
+
+namespace lgraph {
+namespace io {
+
+/**
+ * @brief Read-only view of the contents of a file.
+ *
+ * Maps a whole file into memory so that it can be read as an array of
+ * bytes without copying it nor reading it line by line. When memory
+ * mapping is not available the contents of the file are read into a
+ * buffer owned by this object.
+ *
+ * The memory is released when the object is destroyed or when
+ * @ref close is called.
+ */
+class mapped_file {
+	public:
+		/**
+		 * @brief How the contents of the file will be read.
+		 *
+		 * Passed on to the system as a hint (see @ref open) so that
+		 * it can choose how many pages to read ahead.
+		 */
+		enum class access {
+			/// No hint is given: the system's default.
+			normal,
+			/// From the first byte to the last, once.
+			sequential,
+			/// In no predictable order.
+			random
+		};
+
+	public:
+		/// Constructor.
+		mapped_file();
+		/// Destructor. Unmaps the file.
+		~mapped_file();
+
+		mapped_file(const mapped_file&) = delete;
+		mapped_file& operator= (const mapped_file&) = delete;
+
+		/**
+		 * @brief Maps the file @e filename into memory.
+		 *
+		 * If this object already held a file, it is closed first.
+		 * @param filename The name of the file to be mapped.
+		 * @param a How the contents will be read. Ignored when the
+		 * file is read into a buffer.
+		 * @return Returns false if the file could not be opened or mapped.
+		 * Returns true otherwise.
+		 */
+		bool open(const char *filename, access a = access::normal);
+
+		/// Releases the memory of the file.
+		void close();
+
+		/// Returns true if a file is mapped.
+		bool is_open() const;
+
+		/**
+		 * @brief Returns a pointer to the first byte of the file.
+		 *
+		 * Returns a null pointer if the file is empty.
+		 */
+		const char *data() const;
+
+		/// Returns the size of the file in bytes.
+		size_t size() const;
+
+	private:
+		/// The first byte of the file.
+		const char *m_data;
+		/// The size of the file.
+		size_t m_size;
+		/// Is there a file mapped?
+		bool m_open;
+		/// Contents of the file when it could not be mapped.
+		std::vector<char> m_buffer;
+};
+
+} // -- namespace io
+} // -- namespace lgraph
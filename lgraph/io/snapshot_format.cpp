@@ -0,0 +1,168 @@
+/*********************************************************************
+ * lgraph
+ * Copyright (C) 2018-2019 Lluís Alemany Puig
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ * 
+ * Contact: Lluís Alemany Puig (lluis.alemany.puig@gmail.com)
+ * 
+ ********************************************************************/
+
+
+#include <lgraph/io/snapshot_format.hpp>
+
+// C includes
+#include <string.h>
+
+// C++ includes
+#include <algorithm>
+
+namespace lgraph {
+namespace io {
+namespace snapshot {
+
+void write_adjacency
+(
+	std::ofstream& fout, const xxgraph *g,
+	uint32_t weight_kind, uint32_t weight_size
+)
+{
+	const size_t N = g->n_nodes();
+
+	size_t n_neighbours = 0;
+	for (node u = 0; u < N; ++u) {
+		n_neighbours += g->degree(u);
+	}
+
+	snapshot_header h;
+	memset(&h, 0, sizeof(snapshot_header));
+	memcpy(h.magic, snapshot_magic, sizeof(snapshot_magic));
+	h.version = snapshot_version;
+	h.flags =
+		(g->is_directed() ? snapshot_directed : 0) |
+		(g->is_weighted() ? snapshot_weighted : 0) |
+		(g->is_adjacency_sorted() ? snapshot_sorted : 0);
+	h.byte_order = snapshot_byte_order;
+	h.weight_kind = weight_kind;
+	h.weight_size = weight_size;
+	h.n_nodes = N;
+	h.n_edges = g->n_edges();
+	h.n_neighbours = n_neighbours;
+	fout.write(reinterpret_cast<const char *>(&h), sizeof(snapshot_header));
+
+	// offsets
+	uint64_t offset = 0;
+	fout.write(reinterpret_cast<const char *>(&offset), sizeof(uint64_t));
+	for (node u = 0; u < N; ++u) {
+		offset += g->degree(u);
+		fout.write(reinterpret_cast<const char *>(&offset), sizeof(uint64_t));
+	}
+
+	// neighbourhoods
+	for (node u = 0; u < N; ++u) {
+		const neighbourhood& nu = g->get_neighbours(u);
+		if (nu.size() > 0) {
+			fout.write(
+				reinterpret_cast<const char *>(nu.begin()),
+				nu.size()*sizeof(node)
+			);
+		}
+	}
+}
+
+bool check_header
+(
+	const mapped_file& file,
+	uint32_t weight_kind, uint32_t weight_size,
+	snapshot_header& h
+)
+{
+	if (file.size() < sizeof(snapshot_header)) {
+		return false;
+	}
+	memcpy(&h, file.data(), sizeof(snapshot_header));
+
+	if (memcmp(h.magic, snapshot_magic, sizeof(snapshot_magic)) != 0) {
+		return false;
+	}
+	if (h.version != snapshot_version or h.byte_order != snapshot_byte_order) {
+		return false;
+	}
+
+	// the weights must be of the type expected
+	const bool weighted = (h.flags & snapshot_weighted) != 0;
+	if (weighted != (weight_size > 0)) {
+		return false;
+	}
+	if (h.weight_kind != weight_kind or h.weight_size != weight_size) {
+		return false;
+	}
+
+	// the file must hold all the arrays. Every count is compared with
+	// the bytes left before multiplying it, so that the values of a
+	// corrupt header cannot overflow
+	uint64_t left = file.size() - sizeof(snapshot_header);
+	if (h.n_nodes >= left/sizeof(uint64_t)) {
+		return false;
+	}
+	left -= (h.n_nodes + 1)*sizeof(uint64_t);
+	if (h.n_neighbours > left/(sizeof(uint64_t) + h.weight_size)) {
+		return false;
+	}
+
+	// the offsets must start at 0, never decrease
+	// and end at the length of the neighbourhoods
+	const char *offsets = file.data() + sizeof(snapshot_header);
+	uint64_t prev = 0, next;
+	for (uint64_t u = 0; u <= h.n_nodes; ++u) {
+		memcpy(&next, offsets + u*sizeof(uint64_t), sizeof(uint64_t));
+		if ((u == 0 and next != 0) or next < prev) {
+			return false;
+		}
+		prev = next;
+	}
+	return prev == h.n_neighbours;
+}
+
+void read_adjacency
+(
+	const mapped_file& file, const snapshot_header& h,
+	std::vector<neighbourhood>& adj
+)
+{
+	const char *offsets = file.data() + sizeof(snapshot_header);
+	const char *neighbours = offsets + (h.n_nodes + 1)*sizeof(uint64_t);
+
+	adj.clear();
+	adj.reserve(h.n_nodes);
+
+	uint64_t begin, end;
+	memcpy(&begin, offsets, sizeof(uint64_t));
+	for (node u = 0; u < h.n_nodes; ++u) {
+		memcpy(&end, offsets + (u + 1)*sizeof(uint64_t), sizeof(uint64_t));
+
+		adj.emplace_back(end - begin);
+		if (end > begin) {
+			memcpy(
+				adj.back().begin(), neighbours + begin*sizeof(uint64_t),
+				(end - begin)*sizeof(uint64_t)
+			);
+		}
+		begin = end;
+	}
+}
+
+} // -- namespace snapshot
+} // -- namespace io
+} // -- namespace lgraph
@@ -0,0 +1,160 @@
+/*********************************************************************
+ * lgraph
+ * Copyright (C) 2018-2019 Lluís Alemany Puig
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ * 
+ * Contact: Lluís Alemany Puig (lluis.alemany.puig@gmail.com)
+ * 
+ ********************************************************************/
+
+
+#pragma once
+
+// C includes
+#include <stdint.h>
+
+// C++ includes
+#include <fstream>
+#include <type_traits>
+#include <vector>
+
+// lgraph includes
+#include <lgraph/data_structures/xxgraph.hpp>
+#include <lgraph/io/mapped_file.hpp>
+
+namespace lgraph {
+namespace io {
+
+/**
+ * @brief Binary snapshots of graphs.
+ *
+ * A snapshot stores a graph in the compressed (CSR) layout of
+ * @ref csr_xxgraph so that it can be mapped into memory and used
+ * without parsing it (see @ref map). The file consists of:
+ * - a header of 64 bytes (see @ref snapshot_header),
+ * - the @e n + 1 offsets of the neighbourhoods (64-bit integers),
+ * - the neighbourhoods of all nodes (64-bit integers),
+ * - the weights of the edges, parallel to the neighbourhoods (only
+ * in weighted graphs).
+ *
+ * All numbers are written in the byte order of the machine that wrote
+ * the file, which is recorded in the header: a snapshot can only be
+ * read on machines with the same byte order.
+ */
+namespace snapshot {
+
+/// First bytes of every snapshot.
+static const char snapshot_magic[8] = {'L','G','R','A','P','H','S','N'};
+/// Version of the format written by this library.
+static const uint32_t snapshot_version = 1;
+/// Value of @ref snapshot_header::byte_order in the machine that wrote the file.
+static const uint64_t snapshot_byte_order = 0x0102030405060708ULL;
+
+/// Flag of a directed graph.
+static const uint32_t snapshot_directed = 1;
+/// Flag of a weighted graph.
+static const uint32_t snapshot_weighted = 2;
+/// Flag of a graph whose neighbourhoods are sorted.
+static const uint32_t snapshot_sorted = 4;
+
+/// Header of a snapshot.
+struct snapshot_header {
+	/// Equal to @ref snapshot_magic.
+	char magic[8];
+	/// Version of the format.
+	uint32_t version;
+	/// Bitwise or of the flags @ref snapshot_directed, ...
+	uint32_t flags;
+	/// Equal to @ref snapshot_byte_order if the byte order is the same.
+	uint64_t byte_order;
+	/// Kind of weights: see @ref weight_kind.
+	uint32_t weight_kind;
+	/// Size in bytes of every weight. 0 in unweighted graphs.
+	uint32_t weight_size;
+	/// Number of nodes.
+	uint64_t n_nodes;
+	/// Number of edges.
+	uint64_t n_edges;
+	/// Length of the array of neighbourhoods.
+	uint64_t n_neighbours;
+	/// Unused. Set to 0.
+	uint64_t reserved;
+};
+
+/**
+ * @brief Identifies the type of the weights.
+ * @return Returns 0 for unweighted graphs (when @e T is void), 1 for
+ * signed integers, 2 for unsigned integers and 3 for floating point
+ * numbers.
+ */
+template<class T>
+inline uint32_t weight_kind() {
+	return (std::is_void<T>::value ? 0 :
+			std::is_floating_point<T>::value ? 3 :
+			std::is_signed<T>::value ? 1 : 2);
+}
+
+/**
+ * @brief Writes the header and the neighbourhoods of a graph.
+ *
+ * The weights, if any, must be written right after.
+ * @param fout The binary stream to write to.
+ * @param g The graph.
+ * @param weight_kind See @ref weight_kind.
+ * @param weight_size Size in bytes of every weight.
+ */
+void write_adjacency
+(
+	std::ofstream& fout, const xxgraph *g,
+	uint32_t weight_kind, uint32_t weight_size
+);
+
+/**
+ * @brief Checks the header of a snapshot mapped into memory.
+ *
+ * Checks that the file is a snapshot of a compatible version, that it
+ * was written on a machine with the same byte order, that it has the
+ * weights expected, that it is large enough to hold all the arrays
+ * described in the header and that the offsets are consistent. The
+ * neighbours themselves are not checked.
+ *
+ * @param file The snapshot.
+ * @param weight_kind Kind of weights expected (see @ref weight_kind).
+ * @param weight_size Size in bytes of the weights expected.
+ * @param[out] h The header of the file.
+ * @return Returns true if the file can be used.
+ */
+bool check_header
+(
+	const mapped_file& file,
+	uint32_t weight_kind, uint32_t weight_size,
+	snapshot_header& h
+);
+
+/**
+ * @brief Copies the neighbourhoods of a snapshot into an adjacency list.
+ * @param file The snapshot.
+ * @param h Its header (see @ref check_header).
+ * @param[out] adj The neighbourhood of every node.
+ */
+void read_adjacency
+(
+	const mapped_file& file, const snapshot_header& h,
+	std::vector<neighbourhood>& adj
+);
+
+} // -- namespace snapshot
+} // -- namespace io
+} // -- namespace lgraph
@@ -0,0 +1,162 @@
+/*********************************************************************
+ * lgraph
+ * Copyright (C) 2018-2019 Lluís Alemany Puig
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ * 
+ * Contact: Lluís Alemany Puig (lluis.alemany.puig@gmail.com)
+ * 
+ ********************************************************************/
+
+
+
+#include <lgraph/io/snapshot_landmarks.hpp>
+
+// C includes
+#include <string.h>
+
+// C++ includes
+#include <fstream>
+#include <utility>
+#include <vector>
+
+// lgraph includes
+#include <lgraph/io/mapped_file.hpp>
+#include <lgraph/io/snapshot_format.hpp>
+
+namespace lgraph {
+namespace io {
+namespace snapshot {
+
+// -- READING --
+
+template<class T>
+bool read(const std::string& filename, landmark_index<T>& idx) {
+	return read(filename.c_str(), idx);
+}
+
+template<class T>
+bool read(const char *filename, landmark_index<T>& idx) {
+	mapped_file file;
+	if (not file.open(filename, mapped_file::access::sequential)) {
+		return false;
+	}
+	if (file.size() < sizeof(landmarks_header)) {
+		return false;
+	}
+
+	landmarks_header h;
+	memcpy(&h, file.data(), sizeof(landmarks_header));
+	if (memcmp(h.magic, landmarks_magic, sizeof(landmarks_magic)) != 0) {
+		return false;
+	}
+	if (h.version != landmarks_version or h.byte_order != snapshot_byte_order) {
+		return false;
+	}
+	if (h.weight_kind != weight_kind<T>() or h.weight_size != sizeof(T)) {
+		return false;
+	}
+
+	// the file must hold all the arrays: the sizes in the header
+	// are checked first so that their products cannot overflow
+	const bool directed = (h.flags & snapshot_directed) != 0;
+	if (h.n_landmarks > h.n_nodes or
+		(h.n_landmarks > 0 and h.n_nodes > file.size()/sizeof(T)/h.n_landmarks))
+	{
+		return false;
+	}
+	const uint64_t n_dists = h.n_nodes*h.n_landmarks;
+	const uint64_t expected =
+		sizeof(landmarks_header) +
+		h.n_landmarks*sizeof(uint64_t) +
+		(directed ? 2 : 1)*n_dists*sizeof(T);
+	if (file.size() < expected) {
+		return false;
+	}
+
+	const char *landmarks_data = file.data() + sizeof(landmarks_header);
+	const char *from_data = landmarks_data + h.n_landmarks*sizeof(uint64_t);
+	const char *to_data = from_data + n_dists*sizeof(T);
+
+	std::vector<node> landmarks(h.n_landmarks);
+	std::vector<T> from(n_dists);
+	std::vector<T> to(directed ? n_dists : 0);
+	if (h.n_landmarks > 0) {
+		memcpy(&landmarks[0], landmarks_data, h.n_landmarks*sizeof(uint64_t));
+	}
+	if (n_dists > 0) {
+		memcpy(&from[0], from_data, n_dists*sizeof(T));
+		if (directed) {
+			memcpy(&to[0], to_data, n_dists*sizeof(T));
+		}
+	}
+
+	// the landmarks must be nodes of the graph
+	for (node l : landmarks) {
+		if (l >= h.n_nodes) {
+			return false;
+		}
+	}
+
+	idx.init(h.n_nodes, directed, std::move(landmarks), std::move(from), std::move(to));
+	return true;
+}
+
+// -- WRITING --
+
+template<class T>
+bool write(const std::string& filename, const landmark_index<T>& idx) {
+	return write(filename.c_str(), idx);
+}
+
+template<class T>
+bool write(const char *filename, const landmark_index<T>& idx) {
+	std::ofstream fout;
+	fout.open(filename, std::ios::binary);
+	if (not fout.is_open()) {
+		return false;
+	}
+
+	landmarks_header h;
+	memset(&h, 0, sizeof(landmarks_header));
+	memcpy(h.magic, landmarks_magic, sizeof(landmarks_magic));
+	h.version = landmarks_version;
+	h.flags = (idx.is_directed() ? snapshot_directed : 0);
+	h.byte_order = snapshot_byte_order;
+	h.weight_kind = weight_kind<T>();
+	h.weight_size = sizeof(T);
+	h.n_nodes = idx.n_nodes();
+	h.n_landmarks = idx.n_landmarks();
+	fout.write(reinterpret_cast<const char *>(&h), sizeof(landmarks_header));
+
+	const std::vector<node>& landmarks = idx.get_landmarks();
+	const std::vector<T>& from = idx.get_from();
+	const std::vector<T>& to = idx.get_to();
+	if (not landmarks.empty()) {
+		fout.write(reinterpret_cast<const char *>(&landmarks[0]), landmarks.size()*sizeof(node));
+	}
+	if (not from.empty()) {
+		fout.write(reinterpret_cast<const char *>(&from[0]), from.size()*sizeof(T));
+	}
+	if (not to.empty()) {
+		fout.write(reinterpret_cast<const char *>(&to[0]), to.size()*sizeof(T));
+	}
+
+	fout.close();
+	return true;
+}
+
+} // -- namespace snapshot
+} // -- namespace io
+} // -- namespace lgraph
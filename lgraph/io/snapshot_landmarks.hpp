@@ -0,0 +1,127 @@
+/*********************************************************************
+ * lgraph
+ * Copyright (C) 2018-2019 Lluís Alemany Puig
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ * 
+ * Contact: Lluís Alemany Puig (lluis.alemany.puig@gmail.com)
+ * 
+ ********************************************************************/
+
+
+
+#pragma once
+
+// C includes
+#include <stdint.h>
+
+// C++ includes
+#include <string>
+
+// lgraph includes
+#include <lgraph/data_structures/landmark_index.hpp>
+
+namespace lgraph {
+namespace io {
+namespace snapshot {
+
+// ---------------
+// -- LANDMARKS --
+
+/// First bytes of every snapshot of a @ref landmark_index.
+static const char landmarks_magic[8] = {'L','G','R','A','P','H','L','M'};
+/// Version of the format of the snapshots of a @ref landmark_index.
+static const uint32_t landmarks_version = 1;
+
+/**
+ * @brief Header of a snapshot of a @ref landmark_index.
+ *
+ * The header is followed by:
+ * - the landmarks (64-bit integers),
+ * - the distances from the landmarks to all nodes (see
+ * @ref landmark_index::get_from),
+ * - the distances from all nodes to the landmarks, only in directed
+ * graphs (see @ref landmark_index::get_to).
+ *
+ * Like graph snapshots, the numbers are written in the byte order of the
+ * machine that wrote the file.
+ */
+struct landmarks_header {
+	/// Equal to @ref landmarks_magic.
+	char magic[8];
+	/// Version of the format.
+	uint32_t version;
+	/// Equal to @ref snapshot_directed if the graph is directed, 0 otherwise.
+	uint32_t flags;
+	/// Equal to @ref snapshot_byte_order if the byte order is the same.
+	uint64_t byte_order;
+	/// Kind of the distances: see @ref weight_kind.
+	uint32_t weight_kind;
+	/// Size in bytes of every distance.
+	uint32_t weight_size;
+	/// Number of nodes of the graph.
+	uint64_t n_nodes;
+	/// Number of landmarks.
+	uint64_t n_landmarks;
+	/// Unused. Set to 0.
+	uint64_t reserved;
+};
+
+/**
+ * @brief Reads a landmark index from a binary snapshot.
+ * @param filename The name of the file to be read.
+ * @param[out] idx The index stored in the file.
+ * @return Returns false if the file could not be opened or if it is not
+ * a valid snapshot of an index with distances of type @e T. Returns true
+ * otherwise.
+ */
+template<class T>
+bool read(const std::string& filename, landmark_index<T>& idx);
+/**
+ * @brief Reads a landmark index from a binary snapshot.
+ * @param filename The name of the file to be read.
+ * @param[out] idx The index stored in the file.
+ * @return Returns false if the file could not be opened or if it is not
+ * a valid snapshot of an index with distances of type @e T. Returns true
+ * otherwise.
+ */
+template<class T>
+bool read(const char *filename, landmark_index<T>& idx);
+
+/**
+ * @brief Writes a landmark index as a binary snapshot.
+ * @param filename The name of the file where the index will be
+ * written to.
+ * @param idx The index to store.
+ * @return Returns false if the file could not be opened.
+ * Returns true otherwise.
+ */
+template<class T>
+bool write(const std::string& filename, const landmark_index<T>& idx);
+/**
+ * @brief Writes a landmark index as a binary snapshot.
+ * @param filename The name of the file where the index will be
+ * written to.
+ * @param idx The index to store.
+ * @return Returns false if the file could not be opened.
+ * Returns true otherwise.
+ */
+template<class T>
+bool write(const char *filename, const landmark_index<T>& idx);
+
+} // -- namespace snapshot
+} // -- namespace io
+} // -- namespace lgraph
+
+#include <lgraph/io/snapshot_landmarks.cpp>
@@ -0,0 +1,124 @@
+/*********************************************************************
+ * lgraph
+ * Copyright (C) 2018-2019 Lluís Alemany Puig
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ * 
+ * Contact: Lluís Alemany Puig (lluis.alemany.puig@gmail.com)
+ * 
+ ********************************************************************/
+
+
+#include <lgraph/io/snapshot_ux.hpp>
+
+// C++ includes
+#include <fstream>
+#include <memory>
+#include <utility>
+using namespace std;
+
+// lgraph includes
+#include <lgraph/io/snapshot_format.hpp>
+
+namespace lgraph {
+namespace io {
+namespace snapshot {
+
+// -- READING --
+
+bool read(const std::string& filename, uxgraph *g) {
+	return read(filename.c_str(), g);
+}
+
+bool read(const char *filename, uxgraph *g) {
+	// the arrays are copied from beginning to end
+	mapped_file file;
+	if (not file.open(filename, mapped_file::access::sequential)) {
+		return false;
+	}
+
+	snapshot_header h;
+	if (not check_header(file, weight_kind<void>(), 0, h)) {
+		return false;
+	}
+	if (((h.flags & snapshot_directed) != 0) != g->is_directed()) {
+		return false;
+	}
+
+	vector<neighbourhood> adj;
+	read_adjacency(file, h, adj);
+	g->init(std::move(adj), h.n_edges);
+	if ((h.flags & snapshot_sorted) != 0) {
+		g->sort_adjacency_list();
+	}
+	return true;
+}
+
+bool map(const std::string& filename, csr_uxgraph *g) {
+	return map(filename.c_str(), g);
+}
+
+bool map(const char *filename, csr_uxgraph *g) {
+	if (sizeof(size_t) != sizeof(uint64_t)) {
+		return false;
+	}
+
+	shared_ptr<mapped_file> file = make_shared<mapped_file>();
+	if (not file->open(filename)) {
+		return false;
+	}
+
+	snapshot_header h;
+	if (not check_header(*file, weight_kind<void>(), 0, h)) {
+		return false;
+	}
+
+	const char *offsets = file->data() + sizeof(snapshot_header);
+	const char *neighbours = offsets + (h.n_nodes + 1)*sizeof(uint64_t);
+	g->init(
+		h.n_nodes,
+		reinterpret_cast<const size_t *>(offsets),
+		reinterpret_cast<const node *>(neighbours),
+		h.n_edges,
+		(h.flags & snapshot_directed) != 0,
+		(h.flags & snapshot_sorted) != 0,
+		file
+	);
+	return true;
+}
+
+// -- WRITING --
+
+bool write(const std::string& filename, const uxgraph *g) {
+	return write(filename.c_str(), g);
+}
+
+bool write(const char *filename, const uxgraph *g) {
+	ofstream fout;
+	fout.open(filename, ios::binary);
+
+	// file could not be opened. return "error"
+	if (not fout.is_open()) {
+		return false;
+	}
+
+	write_adjacency(fout, g, weight_kind<void>(), 0);
+
+	fout.close();
+	return true;
+}
+
+} // -- namespace snapshot
+} // -- namespace io
+} // -- namespace lgraph
@@ -0,0 +1,163 @@
+/*********************************************************************
+ * lgraph
+ * Copyright (C) 2018-2019 Lluís Alemany Puig
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ * 
+ * Contact: Lluís Alemany Puig (lluis.alemany.puig@gmail.com)
+ * 
+ ********************************************************************/
+
+
+#include <lgraph/io/snapshot_wx.hpp>
+
+// C includes
+#include <string.h>
+
+// C++ includes
+#include <fstream>
+#include <memory>
+#include <utility>
+
+// lgraph includes
+#include <lgraph/io/snapshot_format.hpp>
+
+namespace lgraph {
+namespace io {
+namespace snapshot {
+
+// -- READING --
+
+template<class T>
+bool read(const std::string& filename, wxgraph<T> *g) {
+	return read(filename.c_str(), g);
+}
+
+template<class T>
+bool read(const char *filename, wxgraph<T> *g) {
+	// the arrays are copied from beginning to end
+	mapped_file file;
+	if (not file.open(filename, mapped_file::access::sequential)) {
+		return false;
+	}
+
+	snapshot_header h;
+	if (not check_header(file, weight_kind<T>(), sizeof(T), h)) {
+		return false;
+	}
+	if (((h.flags & snapshot_directed) != 0) != g->is_directed()) {
+		return false;
+	}
+
+	std::vector<neighbourhood> adj;
+	read_adjacency(file, h, adj);
+
+	// the weights come right after the neighbourhoods
+	const char *weights =
+		file.data() + sizeof(snapshot_header) +
+		(h.n_nodes + 1 + h.n_neighbours)*sizeof(uint64_t);
+
+	std::vector<weight_list<T> > wl;
+	wl.reserve(h.n_nodes);
+	size_t begin = 0;
+	for (node u = 0; u < h.n_nodes; ++u) {
+		wl.emplace_back(adj[u].size());
+		if (adj[u].size() > 0) {
+			memcpy(wl.back().begin(), weights + begin*sizeof(T), adj[u].size()*sizeof(T));
+		}
+		begin += adj[u].size();
+	}
+
+	g->init(std::move(adj), std::move(wl), h.n_edges);
+	if ((h.flags & snapshot_sorted) != 0) {
+		g->sort_adjacency_list();
+	}
+	return true;
+}
+
+template<class T>
+bool map(const std::string& filename, csr_wxgraph<T> *g) {
+	return map(filename.c_str(), g);
+}
+
+template<class T>
+bool map(const char *filename, csr_wxgraph<T> *g) {
+	if (sizeof(size_t) != sizeof(uint64_t)) {
+		return false;
+	}
+
+	std::shared_ptr<mapped_file> file = std::make_shared<mapped_file>();
+	if (not file->open(filename)) {
+		return false;
+	}
+
+	snapshot_header h;
+	if (not check_header(*file, weight_kind<T>(), sizeof(T), h)) {
+		return false;
+	}
+
+	const char *offsets = file->data() + sizeof(snapshot_header);
+	const char *neighbours = offsets + (h.n_nodes + 1)*sizeof(uint64_t);
+	const char *weights = neighbours + h.n_neighbours*sizeof(uint64_t);
+
+	// the weights start at a multiple of 8 bytes
+	if (reinterpret_cast<uintptr_t>(weights) % alignof(T) != 0) {
+		return false;
+	}
+
+	g->init(
+		h.n_nodes,
+		reinterpret_cast<const size_t *>(offsets),
+		reinterpret_cast<const node *>(neighbours),
+		reinterpret_cast<const T *>(weights),
+		h.n_edges,
+		(h.flags & snapshot_directed) != 0,
+		(h.flags & snapshot_sorted) != 0,
+		file
+	);
+	return true;
+}
+
+// -- WRITING --
+
+template<class T>
+bool write(const std::string& filename, const wxgraph<T> *g) {
+	return write(filename.c_str(), g);
+}
+
+template<class T>
+bool write(const char *filename, const wxgraph<T> *g) {
+	std::ofstream fout;
+	fout.open(filename, std::ios::binary);
+	if (not fout.is_open()) {
+		return false;
+	}
+
+	write_adjacency(fout, g, weight_kind<T>(), sizeof(T));
+
+	// weights, parallel to the neighbourhoods
+	for (node u = 0; u < g->n_nodes(); ++u) {
+		const weight_list<T>& wu = g->get_weights(u);
+		if (wu.size() > 0) {
+			fout.write(reinterpret_cast<const char *>(wu.begin()), wu.size()*sizeof(T));
+		}
+	}
+
+	fout.close();
+	return true;
+}
+
+} // -- namespace snapshot
+} // -- namespace io
+} // -- namespace lgraph
@@ -0,0 +1,118 @@
+/*********************************************************************
+ * lgraph
+ * Copyright (C) 2018-2019 Lluís Alemany Puig
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ * 
+ * Contact: Lluís Alemany Puig (lluis.alemany.puig@gmail.com)
+ * 
+ ********************************************************************/
+
+
+#pragma once
+
+// C++ includes
+#include <string>
+
+// lgraph includes
+#include <lgraph/data_structures/csr_wxgraph.hpp>
+#include <lgraph/data_structures/wxgraph.hpp>
+
+namespace lgraph {
+namespace io {
+namespace snapshot {
+
+// --------------
+// -- WEIGHTED --
+
+/**
+ * @brief Reads a weighted graph from a binary snapshot.
+ *
+ * The neighbourhoods and the weights are copied into @e g, which is
+ * left in sorted adjacency mode if the graph written was.
+ * @param filename The name of the file to be read.
+ * @param[out] g The graph built with the contents in the file.
+ * @return Returns false if the file could not be opened, if it is not
+ * a valid snapshot with weights of type @e T, or if it does not match
+ * the directedness of @e g. Returns true otherwise.
+ */
+template<class T>
+bool read(const std::string& filename, wxgraph<T> *g);
+/**
+ * @brief Reads a weighted graph from a binary snapshot.
+ *
+ * The neighbourhoods and the weights are copied into @e g, which is
+ * left in sorted adjacency mode if the graph written was.
+ * @param filename The name of the file to be read.
+ * @param[out] g The graph built with the contents in the file.
+ * @return Returns false if the file could not be opened, if it is not
+ * a valid snapshot with weights of type @e T, or if it does not match
+ * the directedness of @e g. Returns true otherwise.
+ */
+template<class T>
+bool read(const char *filename, wxgraph<T> *g);
+
+/**
+ * @brief Maps a binary snapshot of a weighted graph into memory.
+ *
+ * Nothing is copied nor parsed: @e g is a view of the file, which
+ * stays mapped while @e g (or any copy of it) uses it.
+ * @param filename The name of the file to be mapped.
+ * @param[out] g The compressed graph.
+ * @return Returns false if the file could not be opened or if it is not
+ * a valid snapshot with weights of type @e T. Also returns false on
+ * machines whose @e size_t is not a 64-bit integer. Returns true otherwise.
+ */
+template<class T>
+bool map(const std::string& filename, csr_wxgraph<T> *g);
+/**
+ * @brief Maps a binary snapshot of a weighted graph into memory.
+ *
+ * Nothing is copied nor parsed: @e g is a view of the file, which
+ * stays mapped while @e g (or any copy of it) uses it.
+ * @param filename The name of the file to be mapped.
+ * @param[out] g The compressed graph.
+ * @return Returns false if the file could not be opened or if it is not
+ * a valid snapshot with weights of type @e T. Also returns false on
+ * machines whose @e size_t is not a 64-bit integer. Returns true otherwise.
+ */
+template<class T>
+bool map(const char *filename, csr_wxgraph<T> *g);
+
+/**
+ * @brief Writes a weighted graph as a binary snapshot.
+ * @param filename The name of the file where the graph will be
+ * written to.
+ * @param g The graph to store.
+ * @return Returns false if the file could not be opened.
+ * Returns true otherwise.
+ */
+template<class T>
+bool write(const std::string& filename, const wxgraph<T> *g);
+/**
+ * @brief Writes a weighted graph as a binary snapshot.
+ * @param filename The name of the file where the graph will be
+ * written to.
+ * @param g The graph to store.
+ * @return Returns false if the file could not be opened.
+ * Returns true otherwise.
+ */
+template<class T>
+bool write(const char *filename, const wxgraph<T> *g);
+
+} // -- namespace snapshot
+} // -- namespace io
+} // -- namespace lgraph
+
+#include <lgraph/io/snapshot_wx.cpp>
@@ -4,6 +4,7 @@ CONFIG += c++11
 CONFIG -= app_bundle
 CONFIG -= qt
 CONFIG += staticlib
+CONFIG += thread
 
 QMAKE_CXXFLAGS_DEBUG += -DDEBUG -g
 QMAKE_CXXFLAGS_RELEASE += -DNDEBUG
@@ -22,8 +23,22 @@ HEADERS += \
     data_structures/udgraph.hpp \
     data_structures/node_path.hpp \
     data_structures/node_path.cpp \
+    data_structures/shortest_path_dag.hpp \
+    data_structures/shortest_path_dag.cpp \
+    data_structures/landmark_index.hpp \
+    data_structures/landmark_index.cpp \
+    data_structures/contraction_hierarchy.hpp \
+    data_structures/contraction_hierarchy.cpp \
+    data_structures/hyperloglog.hpp \
+    data_structures/distance_matrix.hpp \
     data_structures/boolean_path.hpp \
     data_structures/boolean_path.cpp \
+    data_structures/csr_xxgraph.hpp \
+    data_structures/csr_uxgraph.hpp \
+    data_structures/csr_wxgraph.hpp \
+    data_structures/csr_wxgraph.cpp \
+    data_structures/triangles.hpp \
+    data_structures/triangles.cpp \
     generate_graphs/classic/classic.hpp \
     generate_graphs/classic/regular.hpp \
     generate_graphs/random/erdos_renyi.hpp \
@@ -43,13 +58,35 @@ HEADERS += \
     epidemics/sis_immune.cpp \
     graph_traversal/dfs.hpp \
     graph_traversal/bfs.hpp \
+    graph_traversal/bfs_visitor.cpp \
+    graph_traversal/bfs_direction.cpp \
+    graph_traversal/bfs_multi_source.cpp \
+    graph_traversal/bfs_bidirectional.cpp \
+    graph_traversal/delta_stepping.hpp \
+    graph_traversal/delta_stepping.cpp \
     graph_traversal/dijkstra.hpp \
     graph_traversal/dijkstra.cpp \
+    graph_traversal/dijkstra_bidirectional.cpp \
+    graph_traversal/dijkstra_queues.hpp \
+    graph_traversal/dijkstra_queues.cpp \
+    graph_traversal/workspace.hpp \
+    graph_traversal/workspace.cpp \
     utils/logger.hpp \
     utils/definitions.hpp \
     utils/static_bitset.hpp \
+    utils/parallel.hpp \
+    utils/parallel_for.cpp \
     communities/communities.hpp \
     io/io.hpp \
+    io/mapped_file.hpp \
+    io/edge_list_reader.hpp \
+    io/edge_list_reader.cpp \
+    io/snapshot_format.hpp \
+    io/snapshot_ux.hpp \
+    io/snapshot_wx.hpp \
+    io/snapshot_wx.cpp \
+    io/snapshot_landmarks.hpp \
+    io/snapshot_landmarks.cpp \
     io/gsd6.hpp \
     utils/svector.hpp \
     utils/svector.cpp \
@@ -62,6 +99,8 @@ HEADERS += \
     metrics/centralities_ux.hpp \
     metrics/centralities_wx.hpp \
     graph_traversal/distances_wx.cpp \
+    graph_traversal/landmarks_wx.cpp \
+    graph_traversal/contraction_wx.cpp \
     graph_traversal/paths_wx.cpp \
     graph_traversal/paths_boolean_wx.cpp \
     metrics/clustering_wx.hpp \
@@ -73,14 +112,22 @@ HEADERS += \
 	io/edge_list_wx.hpp \
 	io/edge_list_wx.cpp \
     metrics/clustering_xu.hpp \
-    metrics/centralities_xx.hpp
+    metrics/centralities_xx.hpp \
+    metrics/centralities_dag.cpp \
+    metrics/centralities_sampling.hpp \
+    metrics/distance_bounds.hpp
 
 SOURCES += \
     utils/static_bitset.cpp \
+    utils/parallel.cpp \
     data_structures/xxgraph.cpp \
     data_structures/uxgraph.cpp \
     data_structures/uugraph.cpp \
     data_structures/udgraph.cpp \
+    data_structures/csr_xxgraph.cpp \
+    data_structures/csr_uxgraph.cpp \
+    data_structures/hyperloglog.cpp \
+    data_structures/distance_matrix.cpp \
     graph_traversal/bfs.cpp \
     graph_traversal/dfs.cpp \
     generate_graphs/classic/linear_tree.cpp \
@@ -93,6 +140,9 @@ SOURCES += \
     io/sparse6.cpp \
     io/digraph6.cpp \
     io/gsd6.cpp \
+    io/mapped_file.cpp \
+    io/snapshot_format.cpp \
+    io/snapshot_ux.cpp \
     graph_traversal/distances_ux.cpp \
     graph_traversal/paths_ux.cpp \
     graph_traversal/paths_boolean_ux.cpp \
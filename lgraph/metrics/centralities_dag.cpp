@@ -0,0 +1,113 @@
+/*********************************************************************
+ * lgraph
+ * Copyright (C) 2018-2019 Lluís Alemany Puig
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ * 
+ * Contact: Lluís Alemany Puig (lluis.alemany.puig@gmail.com)
+ * 
+ ********************************************************************/
+
+
+#include <lgraph/metrics/centralities_xx.hpp>
+
+namespace lgraph {
+namespace networks {
+namespace metrics {
+namespace centralities {
+
+/* BETWEENNES */
+
+// Brandes' accumulation of the dependencies of every source over its
+// shortest-path DAG. Only the pairs (s,t) with s < t are considered. Adds
+// to 'inner[u]' the sum over all such pairs of the fraction of shortest
+// paths with 'u' as an intermediate node, and to 'ends[u]' the number of
+// pairs, connected by at least one path, where 'u' is an endpoint.
+template<class T>
+inline void dag_brandes(
+	const std::vector<shortest_path_dag<T> >& dags,
+	std::vector<double>& inner, std::vector<double>& ends
+)
+{
+	const size_t N = dags.size();
+	inner.assign(N, 0.0);
+	ends.assign(N, 0.0);
+
+	// dependency of the source on each node
+	std::vector<double> delta(N, 0.0);
+
+	for (node s = 0; s < N; ++s) {
+		const shortest_path_dag<T>& dag = dags[s];
+		const std::vector<node>& order = dag.get_order();
+
+		// accumulate the dependencies in non-increasing order of
+		// distance: every node 'w' that follows 'v' in a shortest
+		// path has already been processed
+		for (size_t i = order.size(); i > 0; --i) {
+			const node w = order[i - 1];
+
+			if (w != s) {
+				inner[w] += delta[w];
+			}
+			if (w > s) {
+				// the pair (s,w) is connected
+				ends[s] += 1.0;
+				ends[w] += 1.0;
+			}
+
+			// paths that end at 'w' only count if s < w
+			const double cw = (w > s ? 1.0 : 0.0);
+			const double f = (cw + delta[w])/dag.n_paths(w);
+			for (size_t j = 0; j < dag.n_predecessors(w); ++j) {
+				const node v = dag.predecessor(w, j);
+				delta[v] += dag.n_paths(v)*f;
+			}
+			delta[w] = 0.0;
+		}
+	}
+}
+
+template<class T>
+double betweenness(const std::vector<shortest_path_dag<T> >& dags, node u) {
+	const size_t N = dags.size();
+
+	std::vector<double> inner, ends;
+	dag_brandes(dags, inner, ends);
+
+	// every pair (s,t) with s == u or t == u adds 1
+	double B = inner[u] + (N - 1);
+
+	// normalise with "(n - 1) choose 2"
+	const size_t n_minus_1__chose_2 = ((N - 1)*(N - 2))/2;
+	return B/n_minus_1__chose_2;
+}
+
+template<class T>
+void betweenness(const std::vector<shortest_path_dag<T> >& dags, std::vector<double>& bc) {
+	const size_t N = dags.size();
+
+	std::vector<double> ends;
+	dag_brandes(dags, bc, ends);
+
+	// normalise
+	const size_t n_minus_1__chose_2 = ((N - 1)*(N - 2))/2;
+	for (node u = 0; u < N; ++u) {
+		bc[u] = (bc[u] + ends[u])/n_minus_1__chose_2;
+	}
+}
+
+} // -- namespace centralities
+} // -- namespace metrics
+} // -- namespace networks
+} // -- namespace lgraph
@@ -0,0 +1,427 @@
+/*********************************************************************
+ * lgraph
+ * Copyright (C) 2018-2019 Lluís Alemany Puig
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ * 
+ * Contact: Lluís Alemany Puig (lluis.alemany.puig@gmail.com)
+ * 
+ ********************************************************************/
+
+
+#pragma once
+
+// C includes
+#include <assert.h>
+
+// C++ includes
+#include <algorithm>
+#include <functional>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <vector>
+
+// lgraph includes
+#include <lgraph/data_structures/xxgraph.hpp>
+#include <lgraph/utils/parallel.hpp>
+#include <lgraph/utils/random_generator.hpp>
+
+namespace lgraph {
+namespace networks {
+namespace metrics {
+namespace centralities {
+
+/* SAMPLING OF SHORTEST PATHS */
+
+/// Generator used to choose among the predecessors of a node.
+typedef utils::crandom_generator<std::default_random_engine, double> path_crandom;
+
+/// Number of samples drawn with the same pair of random generators.
+static const size_t betweenness_sample_block = 1024;
+
+/**
+ * @brief Upper bound of the vertex diameter of a graph.
+ *
+ * The vertex diameter is the largest number of nodes of a shortest path.
+ * In undirected graphs, a shortest path lies within a connected
+ * component, and in unweighted undirected graphs a BFS from any node of a
+ * component whose farthest node is at distance @e e bounds the number of
+ * nodes of its shortest paths by 2@e e + 1. In directed graphs the bound
+ * is the number of nodes.
+ * @param G The graph.
+ * @param weighted Whether the shortest paths are weighted.
+ * @return Returns an upper bound of the vertex diameter of @e G.
+ */
+template<class G_t>
+inline size_t vertex_diameter_bound(const G_t *G, bool weighted) {
+	const size_t N = G->n_nodes();
+	if (G->is_directed()) {
+		return N;
+	}
+
+	std::vector<size_t> ds(N, std::numeric_limits<size_t>::max());
+	std::vector<node> S;
+	size_t vd = 1;
+
+	// a BFS for every connected component
+	for (node r = 0; r < N; ++r) {
+		if (ds[r] != std::numeric_limits<size_t>::max()) {
+			continue;
+		}
+
+		ds[r] = 0;
+		S.clear();
+		S.push_back(r);
+		for (size_t head = 0; head < S.size(); ++head) {
+			const node u = S[head];
+			for (node v : G->get_neighbours(u)) {
+				if (ds[v] == std::numeric_limits<size_t>::max()) {
+					ds[v] = ds[u] + 1;
+					S.push_back(v);
+				}
+			}
+		}
+
+		// the last node visited is the farthest from 'r'
+		const size_t bound = (weighted ? S.size() : std::min(S.size(), 2*ds[S.back()] + 1));
+		vd = std::max(vd, bound);
+	}
+	return vd;
+}
+
+/**
+ * @brief Approximate betweenness centrality from sampled paths.
+ *
+ * Estimates the betweenness centrality of every node following the
+ * algorithm in [1]: a pair of distinct nodes (s,t), with s < t, is drawn
+ * uniformly at random @e n_samples times, and one of the shortest paths
+ * from @e s to @e t, drawn uniformly at random among all of them, is
+ * sampled. The estimate of a node is the fraction of the sampled paths
+ * it belongs to (endpoints included), normalised as in the exact
+ * centrality.
+ *
+ * The samples are split into blocks of @ref betweenness_sample_block
+ * samples, and every block draws its random numbers from its own pair
+ * of generators, seeded with values drawn in order from @e rg before
+ * the sampling starts. Since the number of samples through every node
+ * is an integer, the result depends only on the state of @e rg and not
+ * on the number of threads.
+ *
+ * Function @e sample(tid, s, t, crg, path) has to store in @e path
+ * the nodes of one shortest path from @e s to @e t drawn with @e crg
+ * (a @ref path_crandom that generates numbers in [0,1)), or nothing if
+ * there is no path from @e s to @e t. Parameter @e tid is the thread
+ * calling the function (see @ref utils::parallel_for), which is in
+ * [0, @ref utils::n_threads_used(n_threads, n_blocks)) where @e n_blocks
+ * is the number of blocks.
+ *
+ * [1] Riondato, M. and Kornaropoulos, E. M., "Fast approximation of
+ * betweenness centrality through sampling", Data Mining and Knowledge
+ * Discovery, 2016.
+ *
+ * @param[in] N Number of nodes of the graph.
+ * @param[in] n_samples Number of paths sampled.
+ * @param[in] rg The generator that seeds the generators of the blocks.
+ * @param[in] n_threads Number of threads used to sample the paths.
+ * @param[in] sample The function that samples a path.
+ * @param[out] bc @e bc[i] contains the estimated betweenness centrality
+ * of the @e i-th node.
+ */
+template<class sample_t>
+inline void sampled_betweenness(
+	size_t N, size_t n_samples, utils::drandom_generator<>& rg,
+	size_t n_threads, sample_t sample, std::vector<double>& bc
+)
+{
+	bc.assign(N, 0.0);
+	// the centrality is not defined on less than 3 nodes
+	if (N < 3 or n_samples == 0) {
+		return;
+	}
+
+	// the seeds are drawn before sampling, in order of block
+	const size_t n_blocks =
+		(n_samples + betweenness_sample_block - 1)/betweenness_sample_block;
+	std::vector<size_t> seeds(2*n_blocks);
+	rg.init_uniform(0, std::numeric_limits<size_t>::max());
+	for (size_t& seed : seeds) {
+		seed = rg.get_uniform();
+	}
+
+	const size_t n_used = utils::n_threads_used(n_threads, n_blocks);
+	// number of sampled paths through every node, per thread
+	std::vector<std::vector<size_t> > counts(n_used, std::vector<size_t>(N, 0));
+	// nodes of the last path sampled by every thread
+	std::vector<std::vector<node> > paths(n_used);
+
+	utils::parallel_for(n_blocks, n_threads,
+	[&](size_t tid, size_t b) -> void
+	{
+		utils::drandom_generator<> drg;
+		drg.seed_random_engine(seeds[2*b]);
+		drg.init_uniform(0, N - 1);
+
+		path_crandom crg;
+		crg.seed_random_engine(seeds[2*b + 1]);
+		crg.init_uniform(0.0, 1.0);
+
+		const size_t last = std::min(n_samples, (b + 1)*betweenness_sample_block);
+		for (size_t i = b*betweenness_sample_block; i < last; ++i) {
+			const node s = drg.get_uniform();
+			node t = drg.get_uniform();
+			while (t == s) {
+				t = drg.get_uniform();
+			}
+
+			sample(tid, std::min(s, t), std::max(s, t), crg, paths[tid]);
+			for (node u : paths[tid]) {
+				++counts[tid][u];
+			}
+		}
+	}
+	);
+
+	// a sample estimates the fraction of the pairs (s,t) whose paths go
+	// through a node: normalise with "(n - 1) choose 2" instead of
+	// "n choose 2", the number of pairs
+	const double scale = (static_cast<double>(N)/(N - 2))/n_samples;
+	for (size_t tid = 0; tid < n_used; ++tid) {
+		for (node u = 0; u < N; ++u) {
+			bc[u] += counts[tid][u];
+		}
+	}
+	for (node u = 0; u < N; ++u) {
+		bc[u] *= scale;
+	}
+}
+
+/* SAMPLING OF PIVOTS */
+
+/**
+ * @brief Sample of nodes drawn uniformly at random.
+ * @param[in] N Number of nodes of the graph.
+ * @param[in] k Number of nodes sampled.
+ * @param[in] rg The random generator used to draw the nodes.
+ * @param[out] sample @e min(k,N) distinct nodes.
+ */
+inline void sample_nodes
+(size_t N, size_t k, utils::drandom_generator<>& rg, std::vector<node>& sample)
+{
+	k = std::min(k, N);
+
+	// the first k steps of a Fisher-Yates shuffle
+	std::vector<node> all(N);
+	std::iota(all.begin(), all.end(), 0);
+	for (size_t i = 0; i < k; ++i) {
+		rg.init_uniform(i, N - 1);
+		std::swap(all[i], all[rg.get_uniform()]);
+	}
+	sample.assign(all.begin(), all.begin() + k);
+}
+
+/**
+ * @brief Quantile of the normal distribution.
+ * @param confidence A probability in (0,1).
+ * @return Returns the value @e z such that a standard normal variable
+ * lies in [-@e z, @e z] with probability @e confidence.
+ */
+inline double normal_quantile(double confidence) {
+	assert(0.0 < confidence and confidence < 1.0);
+
+	// erf(z/sqrt(2)) is increasing: bisection
+	double a = 0.0;
+	double b = 40.0;
+	for (int it = 0; it < 100; ++it) {
+		const double z = 0.5*(a + b);
+		if (std::erf(z/std::sqrt(2.0)) < confidence) {
+			a = z;
+		}
+		else {
+			b = z;
+		}
+	}
+	return 0.5*(a + b);
+}
+
+/**
+ * @brief Mean of a population estimated from a sample.
+ *
+ * The confidence interval is the normal approximation for a sample
+ * drawn without replacement, which is exact when the whole population
+ * is sampled. The interval is infinite when less than two values are
+ * sampled from a larger population.
+ * @param[in] sum Sum of the values sampled.
+ * @param[in] squares Sum of the squares of the values sampled.
+ * @param[in] n Number of values sampled.
+ * @param[in] N Size of the population.
+ * @param[in] z Quantile of the confidence of the interval (see
+ * @ref normal_quantile).
+ * @param[out] mean Estimate of the mean of the population.
+ * @param[out] lo Lower bound of the confidence interval.
+ * @param[out] hi Upper bound of the confidence interval.
+ */
+inline void sample_mean(
+	double sum, double squares, size_t n, size_t N, double z,
+	double& mean, double& lo, double& hi
+)
+{
+	assert(0 < n and n <= N);
+	mean = sum/n;
+
+	double h = 0.0;
+	if (n < N) {
+		if (n < 2) {
+			h = std::numeric_limits<double>::infinity();
+		}
+		else {
+			const double var = std::max(0.0, (squares - n*mean*mean)/(n - 1));
+			const double fpc = static_cast<double>(N - n)/(N - 1);
+			h = z*std::sqrt((var/n)*fpc);
+		}
+	}
+	lo = mean - h;
+	hi = mean + h;
+}
+
+/**
+ * @brief Closeness centrality estimated from a sample of pivots.
+ *
+ * Estimates the closeness centrality of every node following [1]: the
+ * sum of the distances from a node to all others is estimated from its
+ * distances to @e k pivots, drawn uniformly at random, as @e N/@e k times
+ * their sum, where unreachable pivots count as 0, as in the exact
+ * centrality. The confidence interval of the mean distance to the
+ * pivots (see @ref sample_mean) gives the interval of the centrality.
+ * The centralities of the pivots are exact.
+ *
+ * [1] Eppstein, D. and Wang, J., "Fast approximation of centrality",
+ * Journal of Graph Algorithms and Applications, 8(1), 2004.
+ *
+ * @param[in] N Number of nodes of the graph.
+ * @param[in] pivots The pivots.
+ * @param[in] pivot_sums Sum of the distances from every pivot to all the
+ * nodes it reaches.
+ * @param[in] sums Sum of the distances from every node to the pivots.
+ * @param[in] squares Sum of the squares of the distances from every node
+ * to the pivots.
+ * @param[in] confidence Probability of the confidence intervals.
+ * @param[out] cc Estimated closeness centrality of every node.
+ * @param[out] cc_lo Lower bound of the closeness centrality of every node.
+ * @param[out] cc_hi Upper bound of the closeness centrality of every node.
+ */
+inline void closeness_from_pivots(
+	size_t N, const std::vector<node>& pivots,
+	const std::vector<double>& pivot_sums,
+	const std::vector<double>& sums, const std::vector<double>& squares,
+	double confidence,
+	std::vector<double>& cc, std::vector<double>& cc_lo, std::vector<double>& cc_hi
+)
+{
+	const size_t k = pivots.size();
+	const double z = normal_quantile(confidence);
+	cc.resize(N);
+	cc_lo.resize(N);
+	cc_hi.resize(N);
+
+	// the closeness is (n - 1)/S, where S = n*(mean distance):
+	// a decreasing function of the mean
+	const double nm1 = static_cast<double>(N - 1);
+	for (node u = 0; u < N; ++u) {
+		double mean, lo, hi;
+		sample_mean(sums[u], squares[u], k, N, z, mean, lo, hi);
+		cc[u] = nm1/(N*mean);
+		cc_lo[u] = nm1/(N*hi);
+		cc_hi[u] = (lo > 0.0 ? nm1/(N*lo) : std::numeric_limits<double>::infinity());
+	}
+
+	for (size_t i = 0; i < k; ++i) {
+		const node p = pivots[i];
+		cc[p] = cc_lo[p] = cc_hi[p] = nm1/pivot_sums[i];
+	}
+}
+
+/**
+ * @brief Mean closeness centrality estimated from a sample of pivots.
+ *
+ * The closeness centralities of the pivots, which are exact, are a
+ * sample of the closeness centralities of all nodes.
+ * @param[in] N Number of nodes of the graph.
+ * @param[in] pivot_sums Sum of the distances from every pivot to all the
+ * nodes it reaches.
+ * @param[in] confidence Probability of the confidence interval.
+ * @param[out] lo Lower bound of the mean closeness centrality.
+ * @param[out] hi Upper bound of the mean closeness centrality.
+ * @return Returns the estimated mean closeness centrality.
+ */
+inline double mcc_from_pivots(
+	size_t N, const std::vector<double>& pivot_sums, double confidence,
+	double& lo, double& hi
+)
+{
+	const double nm1 = static_cast<double>(N - 1);
+	double sum = 0.0;
+	double squares = 0.0;
+	for (double s : pivot_sums) {
+		const double c = nm1/s;
+		sum += c;
+		squares += c*c;
+	}
+
+	double mean;
+	sample_mean(sum, squares, pivot_sums.size(), N, normal_quantile(confidence), mean, lo, hi);
+	return mean;
+}
+
+/**
+ * @brief Nodes that may be among the @e k most central.
+ *
+ * If the centrality of every node lies within its interval, the @e k
+ * nodes of largest centrality are among the nodes whose upper bound is
+ * not smaller than the @e k-th largest lower bound.
+ * @param[in] lo Lower bound of the centrality of every node.
+ * @param[in] hi Upper bound of the centrality of every node.
+ * @param[in] k Number of most central nodes.
+ * @param[out] candidates The nodes that may be among the @e k most
+ * central, whose interval is not a single value, in increasing order.
+ */
+inline void top_k_candidates(
+	const std::vector<double>& lo, const std::vector<double>& hi, size_t k,
+	std::vector<node>& candidates
+)
+{
+	candidates.clear();
+	const size_t N = lo.size();
+	if (k == 0 or N == 0) {
+		return;
+	}
+	k = std::min(k, N);
+
+	std::vector<double> sorted_lo(lo);
+	std::nth_element
+	(sorted_lo.begin(), sorted_lo.begin() + (k - 1), sorted_lo.end(), std::greater<double>());
+	const double threshold = sorted_lo[k - 1];
+
+	for (node u = 0; u < N; ++u) {
+		if (hi[u] >= threshold and lo[u] != hi[u]) {
+			candidates.push_back(u);
+		}
+	}
+}
+
+} // -- namespace centralities
+} // -- namespace metrics
+} // -- namespace networks
+} // -- namespace lgraph
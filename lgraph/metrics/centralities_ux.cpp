@@ -22,12 +22,17 @@
 #include <lgraph/metrics/centralities_ux.hpp>
 
 // C++ includes
+#include <algorithm>
 #include <iostream>
 #include <numeric>
 using namespace std;
 
 // lgraph includes
+#include <lgraph/graph_traversal/bfs.hpp>
 #include <lgraph/graph_traversal/traversal_ux.hpp>
+#include <lgraph/metrics/centralities_sampling.hpp>
+#include <lgraph/metrics/centralities_xx.hpp>
+#include <lgraph/utils/parallel.hpp>
 
 namespace lgraph {
 namespace networks {
@@ -36,9 +41,9 @@ namespace centralities {
 
 /* CLOSENESS */
 
-double closeness(const uxgraph *G, node u) {
-	vector<_new_> ds;
-	traversal::uxdistance(G, u, ds);
+// closeness of a node given its distances to all other nodes
+template<class G_t>
+inline double generic_closeness(const G_t *G, const std::vector<_new_>& ds) {
 	double sum = accumulate
 	(
 		ds.begin(), ds.end(), 0.0,
@@ -54,14 +59,16 @@ double closeness(const uxgraph *G, node u) {
 	return 1.0/(sum/(G->n_nodes() - 1));
 }
 
-void closeness(const uxgraph *G, std::vector<double>& cc) {
-	vector<vector<_new_> > ds;
-	traversal::uxdistances(G, ds);
-	return closeness(G, ds, cc);
+template<class G_t>
+inline double generic_closeness(const G_t *G, node u) {
+	vector<_new_> ds;
+	traversal::uxdistance(G, u, ds);
+	return generic_closeness(G, ds);
 }
 
-void closeness(
-	const uxgraph *G,
+template<class G_t>
+inline void generic_closeness(
+	const G_t *G,
 	const std::vector<std::vector<_new_> >& ds,
 	std::vector<double>& cc
 )
@@ -75,61 +82,589 @@ void closeness(
 
 		// calculate closeness centrality
 		[&](const vector<_new_>& ds_i) {
-			double sum = accumulate
-			(
-				ds_i.begin(), ds_i.end(), 0.0,
-				[](double acc, _new_ d) {
-					// when d == inf, there is not path, so we
-					// should not accumulate this distance
-					if (d != inf_t<_new_>()) {
-						acc += static_cast<double>(d);
-					}
-					return acc;
-				}
-			);
-			return 1.0/(sum/(G->n_nodes() - 1));
+			return generic_closeness(G, ds_i);
 		}
 	);
 }
 
-double mcc(const uxgraph *G) {
-	vector<vector<_new_> > ds;
-	traversal::uxdistances(G, ds);
-	// compute sum of all the distance values.
+template<class G_t>
+inline void generic_closeness
+(const G_t *G, const distance_matrix& ds, std::vector<double>& cc)
+{
+	// the closeness of a node only needs
+	// the sum of its distances to the others
+	vector<double> sums;
+	ds.row_sums(sums);
+	for (double sum : sums) {
+		cc.push_back(1.0/(sum/(G->n_nodes() - 1)));
+	}
+}
+
+template<class G_t>
+inline void generic_closeness
+(const G_t *G, std::vector<double>& cc, size_t n_threads)
+{
+	const size_t N = G->n_nodes();
+
+	// the closeness of a node only needs
+	// the sum of its distances to the others
+	vector<_new_> sums;
+	traversal::uxdistance_sums(G, sums, n_threads);
+
+	cc.resize(N);
+	for (node s = 0; s < N; ++s) {
+		cc[s] = 1.0/(static_cast<double>(sums[s])/(N - 1));
+	}
+}
 
+template<class G_t>
+inline double generic_mcc(const G_t *G) {
+	vector<_new_> sums;
+	traversal::uxdistance_sums(G, sums);
+
+	// sum of inverse of distances
 	double sum = accumulate(
-		ds.begin(), ds.end(), 0.0,
-		[](double acc, const vector<_new_>& v) -> double {
-			// sum of a row, accumulate values below infinte
-			_new_ s = accumulate(
-				v.begin(), v.end(), static_cast<_new_>(0),
-				[](_new_ acc_inner, _new_ d) -> _new_ {
-					if (d != inf_t<_new_>()) {
-						acc_inner += d;
-					}
-					return acc_inner;
-				}
-			);
-			// sum of inverse of distances
-			return acc + 1.0/s;
-		}
+		sums.begin(), sums.end(), 0.0,
+		[](double acc, _new_ s) -> double { return acc + 1.0/s; }
 	);
 
 	double n = static_cast<double>(G->n_nodes());
 	return ((n - 1.0)/n)*sum;
 }
 
-double mcc(const uxgraph *G, const std::vector<double>& cc) {
+template<class G_t>
+inline double generic_mcc(const G_t *G, const std::vector<double>& cc) {
 	double S = accumulate(cc.begin(), cc.end(), 0.0);
 	return S/G->n_nodes();
 }
 
+/* APPROXIMATE CLOSENESS */
+
+// Sum of the distances from every pivot to all the nodes it reaches in
+// 'G', and sums of the distances, and of their squares, from every node
+// to the pivots, found with a BFS from the pivots in 'R', the reverse of
+// 'G'. In undirected graphs both are found with the same traversals. The
+// sums of every thread are added at the end: they are sums of integers,
+// so the result does not depend on the order of the traversals.
+template<class G_t, class R_t>
+inline void generic_pivot_distances(
+	const G_t *G, const R_t *R, const std::vector<node>& pivots,
+	std::vector<double>& pivot_sums,
+	std::vector<double>& sums, std::vector<double>& squares,
+	size_t n_threads
+)
+{
+	const size_t N = G->n_nodes();
+	const size_t n_used = utils::n_threads_used(n_threads, (pivots.size() + 63)/64);
+	const bool directed = G->is_directed();
+
+	pivot_sums.assign(pivots.size(), 0.0);
+	vector<vector<double> > thread_sums(n_used, vector<double>(N, 0.0));
+	vector<vector<double> > thread_squares(n_used, vector<double>(N, 0.0));
+
+	traversal::bfs::sources_BFS(R, pivots,
+	[&](size_t tid, size_t i, node v, _new_ d) -> void
+	{
+		thread_sums[tid][v] += d;
+		thread_squares[tid][v] += static_cast<double>(d)*d;
+		if (not directed) {
+			pivot_sums[i] += d;
+		}
+	},
+	n_threads
+	);
+
+	if (directed) {
+		traversal::bfs::sources_BFS(G, pivots,
+		[&](size_t, size_t i, node, _new_ d) -> void { pivot_sums[i] += d; },
+		n_threads
+		);
+	}
+
+	sums.assign(N, 0.0);
+	squares.assign(N, 0.0);
+	for (size_t tid = 0; tid < n_used; ++tid) {
+		for (node u = 0; u < N; ++u) {
+			sums[u] += thread_sums[tid][u];
+			squares[u] += thread_squares[tid][u];
+		}
+	}
+}
+
+// Closeness of every node estimated from the distances to a sample of
+// pivots (see centralities_sampling.hpp). The closeness of the nodes that
+// may be among the 'top_k' most central is then computed exactly.
+template<class G_t, class R_t>
+inline void generic_closeness(
+	const G_t *G, const R_t *R,
+	std::vector<double>& cc, std::vector<double>& cc_lo, std::vector<double>& cc_hi,
+	size_t n_pivots, utils::drandom_generator<>& rg,
+	double confidence, size_t top_k, size_t n_threads
+)
+{
+	const size_t N = G->n_nodes();
+	if (N == 0) {
+		cc.clear();
+		cc_lo.clear();
+		cc_hi.clear();
+		return;
+	}
+
+	vector<node> pivots;
+	sample_nodes(N, max<size_t>(n_pivots, 1), rg, pivots);
+
+	vector<double> pivot_sums, sums, squares;
+	generic_pivot_distances(G, R, pivots, pivot_sums, sums, squares, n_threads);
+	closeness_from_pivots(N, pivots, pivot_sums, sums, squares, confidence, cc, cc_lo, cc_hi);
+
+	vector<node> candidates;
+	top_k_candidates(cc_lo, cc_hi, top_k, candidates);
+
+	vector<double> exact_sums(candidates.size(), 0.0);
+	traversal::bfs::sources_BFS(G, candidates,
+	[&](size_t, size_t i, node, _new_ d) -> void { exact_sums[i] += d; },
+	n_threads
+	);
+	for (size_t i = 0; i < candidates.size(); ++i) {
+		const node u = candidates[i];
+		cc[u] = cc_lo[u] = cc_hi[u] = 1.0/(exact_sums[i]/(N - 1));
+	}
+}
+
+// the distances to the pivots in a directed
+// graph are found in the reverse graph
+template<class G_t>
+inline void generic_closeness(
+	const G_t *G,
+	std::vector<double>& cc, std::vector<double>& cc_lo, std::vector<double>& cc_hi,
+	size_t n_pivots, utils::drandom_generator<>& rg,
+	double confidence, size_t top_k, size_t n_threads
+)
+{
+	if (G->is_directed()) {
+		csr_uxgraph R;
+		R.init_reverse(G);
+		generic_closeness
+		(G, &R, cc, cc_lo, cc_hi, n_pivots, rg, confidence, top_k, n_threads);
+	}
+	else {
+		generic_closeness
+		(G, G, cc, cc_lo, cc_hi, n_pivots, rg, confidence, top_k, n_threads);
+	}
+}
+
+template<class G_t>
+inline double generic_mcc(
+	const G_t *G, size_t n_pivots, utils::drandom_generator<>& rg,
+	double& mcc_lo, double& mcc_hi, double confidence, size_t n_threads
+)
+{
+	const size_t N = G->n_nodes();
+
+	vector<node> pivots;
+	sample_nodes(N, max<size_t>(n_pivots, 1), rg, pivots);
+
+	// only the closeness of the pivots is needed
+	vector<double> pivot_sums(pivots.size(), 0.0);
+	traversal::bfs::sources_BFS(G, pivots,
+	[&](size_t, size_t i, node, _new_ d) -> void { pivot_sums[i] += d; },
+	n_threads
+	);
+	return mcc_from_pivots(N, pivot_sums, confidence, mcc_lo, mcc_hi);
+}
+
+/* BETWEENNES */
+
+// Brandes' algorithm [Brandes, 2001] for a single source 's'. A BFS from
+// 's' counts the shortest paths from 's' to every other node, and the
+// dependencies of 's' on each node are then accumulated visiting the
+// nodes in reverse order. Only the pairs (s,t) with s < t are considered.
+// Adds to 'inner[u]' the sum over all such pairs of the fraction of
+// shortest paths with 'u' as an intermediate node, and to 'ends[u]' the
+// number of pairs, connected by at least one path, where 'u' is an
+// endpoint. The other vectors are memory reused across sources.
+//
+// [Brandes, 2001] Brandes, U. (2001). A faster algorithm for betweenness
+// centrality. Journal of Mathematical Sociology, 25(2), 163-177.
+template<class G_t>
+inline void generic_brandes(
+	const G_t *G, node s,
+	std::vector<_new_>& ds, std::vector<double>& sigma,
+	std::vector<double>& delta, std::vector<node>& S,
+	std::vector<double>& inner, std::vector<double>& ends
+)
+{
+	// 'ds' is infinite and 'sigma' is 0 for every node,
+	// and so they are left at the end
+	ds[s] = 0;
+	sigma[s] = 1.0;
+
+	size_t head = 0;
+	size_t tail = 0;
+	S[tail++] = s;
+
+	while (head < tail) {
+		const node u = S[head++];
+		const _new_ d = ds[u] + 1;
+
+		for (node v : G->get_neighbours(u)) {
+			if (ds[v] == inf_t<_new_>()) {
+				ds[v] = d;
+				sigma[v] = sigma[u];
+				S[tail++] = v;
+			}
+			else if (ds[v] == d) {
+				sigma[v] += sigma[u];
+			}
+		}
+	}
+
+	// accumulate the dependencies in non-increasing order of
+	// distance: every node 'w' that follows 'v' in a shortest
+	// path has already been processed
+	for (size_t i = tail; i > 0; --i) {
+		const node v = S[i - 1];
+		const _new_ d = ds[v] + 1;
+
+		double dv = 0.0;
+		for (node w : G->get_neighbours(v)) {
+			if (ds[w] == d) {
+				// paths that end at 'w' only count if s < w
+				const double cw = (w > s ? 1.0 : 0.0);
+				dv += (sigma[v]/sigma[w])*(cw + delta[w]);
+			}
+		}
+		delta[v] = dv;
+
+		if (v != s) {
+			inner[v] += dv;
+		}
+		if (v > s) {
+			// the pair (s,v) is connected
+			ends[s] += 1.0;
+			ends[v] += 1.0;
+		}
+	}
+
+	// reset the memory of the visited nodes
+	for (size_t i = 0; i < tail; ++i) {
+		ds[S[i]] = inf_t<_new_>();
+		sigma[S[i]] = 0.0;
+	}
+}
+
+// The sources are split into as many ranges of consecutive nodes as
+// threads, and the dependencies of the sources of each range are
+// accumulated in their own vectors, which are added in order at the end:
+// for a fixed number of threads the result does not depend on which
+// thread does each range. The first range is accumulated directly in the
+// result, so that only (n_used - 1) extra pairs of vectors are needed.
+template<class G_t>
+inline void generic_brandes
+(const G_t *G, std::vector<double>& inner, std::vector<double>& ends, size_t n_threads)
+{
+	const size_t N = G->n_nodes();
+	inner.assign(N, 0.0);
+	ends.assign(N, 0.0);
+
+	const size_t n_used = utils::n_threads_used(n_threads, N);
+
+	// memory of every thread reused by all its traversals:
+	// distance from the source
+	vector<vector<_new_> > ds(n_used, vector<_new_>(N, inf_t<_new_>()));
+	// number of shortest paths from the source
+	vector<vector<double> > sigma(n_used, vector<double>(N, 0.0));
+	// dependency of the source on each node
+	vector<vector<double> > delta(n_used, vector<double>(N));
+	// nodes in order of visit (this is also the BFS queue)
+	vector<vector<node> > S(n_used, vector<node>(N));
+
+	// partial results of every range but the first
+	vector<vector<double> > part_inner(n_used - 1, vector<double>(N, 0.0));
+	vector<vector<double> > part_ends(n_used - 1, vector<double>(N, 0.0));
+
+	utils::parallel_for(n_used, n_threads,
+	[&](size_t tid, size_t r) -> void
+	{
+		vector<double>& r_inner = (r == 0 ? inner : part_inner[r - 1]);
+		vector<double>& r_ends = (r == 0 ? ends : part_ends[r - 1]);
+		for (node s = (r*N)/n_used; s < ((r + 1)*N)/n_used; ++s) {
+			generic_brandes
+			(G, s, ds[tid], sigma[tid], delta[tid], S[tid], r_inner, r_ends);
+		}
+	}
+	);
+
+	for (size_t r = 0; r + 1 < n_used; ++r) {
+		for (node u = 0; u < N; ++u) {
+			inner[u] += part_inner[r][u];
+			ends[u] += part_ends[r][u];
+		}
+	}
+}
+
+template<class G_t>
+inline double generic_betweenness(const G_t *G, node u, size_t n_threads) {
+	const size_t N = G->n_nodes();
+
+	vector<double> inner, ends;
+	generic_brandes(G, inner, ends, n_threads);
+
+	// every pair (s,t) with s == u or t == u adds 1
+	double B = inner[u] + (N - 1);
+
+	// normalise with "(n - 1) choose 2"
+	const size_t n_minus_1__chose_2 = ((N - 1)*(N - 2))/2;
+	B = B/n_minus_1__chose_2;
+	return B;
+}
+
+template<class G_t>
+inline void generic_betweenness
+(const G_t *G, std::vector<double>& bc, size_t n_threads)
+{
+	const size_t N = G->n_nodes();
+
+	vector<double> ends;
+	generic_brandes(G, bc, ends, n_threads);
+
+	// normalise
+	const size_t n_minus_1__chose_2 = ((N - 1)*(N - 2))/2;
+	for (node u = 0; u < N; ++u) {
+		bc[u] = (bc[u] + ends[u])/n_minus_1__chose_2;
+	}
+}
+
+/* APPROXIMATE BETWEENNESS */
+
+// Samples one of the shortest paths from 's' to 't' uniformly at random,
+// as in [Riondato and Kornaropoulos, 2016] (see centralities_sampling.hpp).
+// A BFS from 's' counts the shortest paths to every node up to the
+// distance of 't', and the path is then built backwards from 't': each
+// predecessor 'p' of a node 'w' is chosen with probability
+// sigma[p]/sigma[w]. The predecessors of 'w' are among its neighbours in
+// 'R', the reverse of 'G'. The other vectors are memory reused across
+// samples, as in Brandes' algorithm.
+template<class G_t, class R_t>
+inline void generic_sample_path(
+	const G_t *G, const R_t *R, node s, node t,
+	std::vector<_new_>& ds, std::vector<double>& sigma, std::vector<node>& S,
+	path_crandom& crg, std::vector<node>& path
+)
+{
+	ds[s] = 0;
+	sigma[s] = 1.0;
+	S.clear();
+	S.push_back(s);
+
+	// the nodes as far as 't' need not be expanded
+	for (size_t head = 0; head < S.size() and ds[S[head]] < ds[t]; ++head) {
+		const node u = S[head];
+		const _new_ d = ds[u] + 1;
+
+		for (node v : G->get_neighbours(u)) {
+			if (ds[v] == inf_t<_new_>()) {
+				ds[v] = d;
+				sigma[v] = sigma[u];
+				S.push_back(v);
+			}
+			else if (ds[v] == d) {
+				sigma[v] += sigma[u];
+			}
+		}
+	}
+
+	path.clear();
+	if (ds[t] != inf_t<_new_>()) {
+		node w = t;
+		path.push_back(w);
+		while (w != s) {
+			const _new_ d = ds[w] - 1;
+
+			// the last predecessor is chosen if rounding
+			// errors leave 'x' slightly above the sum
+			double x = crg.get_uniform()*sigma[w];
+			node p = w;
+			for (node q : R->get_neighbours(w)) {
+				if (ds[q] == d) {
+					p = q;
+					x -= sigma[q];
+					if (x < 0.0) {
+						break;
+					}
+				}
+			}
+			w = p;
+			path.push_back(w);
+		}
+	}
+
+	// reset the memory of the visited nodes
+	for (node u : S) {
+		ds[u] = inf_t<_new_>();
+		sigma[u] = 0.0;
+	}
+}
+
+template<class G_t, class R_t>
+inline void generic_sampled_betweenness(
+	const G_t *G, const R_t *R, std::vector<double>& bc,
+	size_t n_samples, utils::drandom_generator<>& rg, size_t n_threads
+)
+{
+	const size_t N = G->n_nodes();
+	const size_t n_blocks =
+		(n_samples + betweenness_sample_block - 1)/betweenness_sample_block;
+	const size_t n_used = utils::n_threads_used(n_threads, n_blocks);
+
+	// memory of every thread reused by all its samples
+	vector<vector<_new_> > ds(n_used, vector<_new_>(N, inf_t<_new_>()));
+	vector<vector<double> > sigma(n_used, vector<double>(N, 0.0));
+	vector<vector<node> > S(n_used);
+
+	sampled_betweenness(N, n_samples, rg, n_threads,
+	[&](size_t tid, node s, node t, path_crandom& crg, vector<node>& path) -> void
+	{
+		generic_sample_path(G, R, s, t, ds[tid], sigma[tid], S[tid], crg, path);
+	},
+	bc
+	);
+}
+
+// the predecessors of a node in a directed graph
+// are its neighbours in the reverse graph
+template<class G_t>
+inline void generic_sampled_betweenness(
+	const G_t *G, std::vector<double>& bc,
+	size_t n_samples, utils::drandom_generator<>& rg, size_t n_threads
+)
+{
+	if (G->is_directed()) {
+		csr_uxgraph R;
+		R.init_reverse(G);
+		generic_sampled_betweenness(G, &R, bc, n_samples, rg, n_threads);
+	}
+	else {
+		generic_sampled_betweenness(G, G, bc, n_samples, rg, n_threads);
+	}
+}
+
+template<class G_t>
+inline void generic_sampled_betweenness(
+	const G_t *G, std::vector<double>& bc, double epsilon, double delta,
+	utils::drandom_generator<>& rg, size_t n_threads
+)
+{
+	const size_t N = G->n_nodes();
+	const size_t n_samples = (N < 3 ? 0 :
+		betweenness_sample_size(epsilon, delta, N, vertex_diameter_bound(G, false)));
+	generic_sampled_betweenness(G, bc, n_samples, rg, n_threads);
+}
+
+/* CLOSENESS */
+
+double closeness(const uxgraph *G, node u) {
+	return generic_closeness(G, u);
+}
+
+void closeness(const uxgraph *G, std::vector<double>& cc, size_t n_threads) {
+	generic_closeness(G, cc, n_threads);
+}
+
+void closeness(
+	const uxgraph *G,
+	const std::vector<std::vector<_new_> >& ds,
+	std::vector<double>& cc
+)
+{
+	generic_closeness(G, ds, cc);
+}
+
+void closeness(const uxgraph *G, const distance_matrix& ds, std::vector<double>& cc) {
+	generic_closeness(G, ds, cc);
+}
+
+double closeness(const csr_uxgraph *G, node u) {
+	return generic_closeness(G, u);
+}
+
+void closeness(const csr_uxgraph *G, std::vector<double>& cc, size_t n_threads) {
+	generic_closeness(G, cc, n_threads);
+}
+
+void closeness(
+	const csr_uxgraph *G,
+	const std::vector<std::vector<_new_> >& ds,
+	std::vector<double>& cc
+)
+{
+	generic_closeness(G, ds, cc);
+}
+
+void closeness(const csr_uxgraph *G, const distance_matrix& ds, std::vector<double>& cc) {
+	generic_closeness(G, ds, cc);
+}
+
+/* APPROXIMATE CLOSENESS */
+
+void closeness(
+	const uxgraph *G,
+	std::vector<double>& cc, std::vector<double>& cc_lo, std::vector<double>& cc_hi,
+	size_t n_pivots, utils::drandom_generator<>& rg,
+	double confidence, size_t top_k, size_t n_threads
+)
+{
+	generic_closeness(G, cc, cc_lo, cc_hi, n_pivots, rg, confidence, top_k, n_threads);
+}
+
+void closeness(
+	const csr_uxgraph *G,
+	std::vector<double>& cc, std::vector<double>& cc_lo, std::vector<double>& cc_hi,
+	size_t n_pivots, utils::drandom_generator<>& rg,
+	double confidence, size_t top_k, size_t n_threads
+)
+{
+	generic_closeness(G, cc, cc_lo, cc_hi, n_pivots, rg, confidence, top_k, n_threads);
+}
+
+double mcc(
+	const uxgraph *G, size_t n_pivots, utils::drandom_generator<>& rg,
+	double& mcc_lo, double& mcc_hi, double confidence, size_t n_threads
+)
+{
+	return generic_mcc(G, n_pivots, rg, mcc_lo, mcc_hi, confidence, n_threads);
+}
+
+double mcc(
+	const csr_uxgraph *G, size_t n_pivots, utils::drandom_generator<>& rg,
+	double& mcc_lo, double& mcc_hi, double confidence, size_t n_threads
+)
+{
+	return generic_mcc(G, n_pivots, rg, mcc_lo, mcc_hi, confidence, n_threads);
+}
+
+/* MEAN CLOSENESS */
+
+double mcc(const uxgraph *G) {
+	return generic_mcc(G);
+}
+
+double mcc(const uxgraph *G, const std::vector<double>& cc) {
+	return generic_mcc(G, cc);
+}
+
+double mcc(const csr_uxgraph *G) {
+	return generic_mcc(G);
+}
+
+double mcc(const csr_uxgraph *G, const std::vector<double>& cc) {
+	return generic_mcc(G, cc);
+}
+
 /* BETWEENNES */
 
-double betweenness(const uxgraph *G, node u) {
-	vector<vector<boolean_path_set<_new_> > > all_to_all_paths;
-	traversal::uxpaths(G, all_to_all_paths);
-	return betweenness(G, all_to_all_paths, u);
+double betweenness(const uxgraph *G, node u, size_t n_threads) {
+	return generic_betweenness(G, u, n_threads);
 }
 
 double betweenness(
@@ -175,10 +710,8 @@ double betweenness(
 	return B;
 }
 
-void betweenness(const uxgraph *G, std::vector<double>& bc) {
-	vector<vector<boolean_path_set<_new_> > > all_to_all_paths;
-	traversal::uxpaths(G, all_to_all_paths);
-	betweenness(G, all_to_all_paths, bc);
+void betweenness(const uxgraph *G, std::vector<double>& bc, size_t n_threads) {
+	generic_betweenness(G, bc, n_threads);
 }
 
 void betweenness(
@@ -192,6 +725,8 @@ void betweenness(
 	// amount of shortest paths between s and t in
 	// which vertices of the graph lie on
 	vector<size_t> g_st_i(N);
+	// nodes of each of the shortest paths between s and t
+	vector<node> nodes_in_path;
 	// initialise data
 	bc = vector<double>(N, 0);
 
@@ -205,11 +740,10 @@ void betweenness(
 			// set vector to 0
 			fill(g_st_i.begin(), g_st_i.end(), 0);
 
-			for (node u = 0; u < N; ++u) {
-				for (const boolean_path<_new_>& bp : paths[s][t]) {
-					if (bp[u]) {
-						++g_st_i[u];
-					}
+			for (const boolean_path<_new_>& bp : paths[s][t]) {
+				bp.get_nodes(nodes_in_path);
+				for (node u : nodes_in_path) {
+					++g_st_i[u];
 				}
 			}
 
@@ -228,6 +762,48 @@ void betweenness(
 		bc[u] /= n_minus_1__chose_2;
 	}
 }
+
+double betweenness(const csr_uxgraph *G, node u, size_t n_threads) {
+	return generic_betweenness(G, u, n_threads);
+}
+
+void betweenness(const csr_uxgraph *G, std::vector<double>& bc, size_t n_threads) {
+	generic_betweenness(G, bc, n_threads);
+}
+
+/* APPROXIMATE BETWEENNESS */
+
+void betweenness(
+	const uxgraph *G, std::vector<double>& bc, double epsilon, double delta,
+	utils::drandom_generator<>& rg, size_t n_threads
+)
+{
+	generic_sampled_betweenness(G, bc, epsilon, delta, rg, n_threads);
+}
+
+void betweenness(
+	const uxgraph *G, std::vector<double>& bc, size_t n_samples,
+	utils::drandom_generator<>& rg, size_t n_threads
+)
+{
+	generic_sampled_betweenness(G, bc, n_samples, rg, n_threads);
+}
+
+void betweenness(
+	const csr_uxgraph *G, std::vector<double>& bc, double epsilon, double delta,
+	utils::drandom_generator<>& rg, size_t n_threads
+)
+{
+	generic_sampled_betweenness(G, bc, epsilon, delta, rg, n_threads);
+}
+
+void betweenness(
+	const csr_uxgraph *G, std::vector<double>& bc, size_t n_samples,
+	utils::drandom_generator<>& rg, size_t n_threads
+)
+{
+	generic_sampled_betweenness(G, bc, n_samples, rg, n_threads);
+}
 	
 } // -- namespace centralities
 } // -- namespace metrics
@@ -26,7 +26,10 @@
 
 // lgraph includes
 #include <lgraph/data_structures/boolean_path.hpp>
+#include <lgraph/data_structures/csr_uxgraph.hpp>
+#include <lgraph/data_structures/distance_matrix.hpp>
 #include <lgraph/data_structures/uxgraph.hpp>
+#include <lgraph/utils/random_generator.hpp>
 
 namespace lgraph {
 namespace networks {
@@ -60,12 +63,15 @@ double closeness(const uxgraph *G, node u);
  * See @ref closeness(const uxgraph*, node) for the details on this centrality's
  * definition.
  *
- * Computes the distance between each pair of nodes in the graph.
+ * Computes the distance between each pair of nodes in the graph, but
+ * only their sums are stored (see @ref traversal::uxdistance_sums).
  * @param[in] G The unweighted graph to be evaluated.
  * @param[out] cc The @e i-th position contains the
  * closeness centrality of the @e i-th node.
+ * @param[in] n_threads Number of threads used to run the traversals (see
+ * @ref utils::n_threads_used).
  */
-void closeness(const uxgraph *G, std::vector<double>& cc);
+void closeness(const uxgraph *G, std::vector<double>& cc, size_t n_threads = 1);
 
 /**
  * @brief Closeness centrality of all nodes in a graph.
@@ -85,11 +91,31 @@ void closeness(
 	const std::vector<std::vector<_new_> >& atad,
 	std::vector<double>& cc
 );
+/**
+ * @brief Closeness centrality of all nodes in a graph.
+ *
+ * See @ref closeness(const uxgraph*, node) for the details on this centrality's
+ * definition.
+ *
+ * Uses the parameter @e atad to avoid computing the all-to-all distances
+ * (see @ref traversal::uxdistances(const uxgraph*, distance_matrix&, size_t)).
+ * @param[in] G The unweighted graph to be evaluated.
+ * @param[in] atad The compact matrix with the distance between each pair
+ * of nodes.
+ * @param[out] cc The @e i-th position contains the
+ * closeness centrality of the @e i-th node.
+ */
+void closeness(
+	const uxgraph *G,
+	const distance_matrix& atad,
+	std::vector<double>& cc
+);
 
 /**
  * @brief Mean closeness centrality of a graph.
  *
- * Computes the distance between all pairs of nodes.
+ * Computes the distance between all pairs of nodes, but only their sums
+ * are stored (see @ref traversal::uxdistance_sums).
  * @param G The graph to be evaluated.
  * @return Returns the average of the closeness centralities.
  */
@@ -106,6 +132,66 @@ double mcc(const uxgraph *G);
  */
 double mcc(const uxgraph *G, const std::vector<double>& cc);
 
+/**
+ * @brief Approximate closeness centrality of all nodes in a graph.
+ *
+ * See @ref closeness(const uxgraph*, node) for the details on this centrality's
+ * definition.
+ *
+ * Applies a Breadth-First Search from @e n_pivots nodes drawn uniformly
+ * at random, 64 at a time (see @ref traversal::bfs::sources_BFS), instead
+ * of from every node, and estimates the centrality of every node from
+ * its distances to them (see @ref closeness_from_pivots). The centrality
+ * of every node comes with a confidence interval. The centralities of
+ * the pivots are exact.
+ *
+ * If @e top_k is not 0, the centrality of every node whose interval
+ * overlaps the intervals of the @e top_k most central nodes is then
+ * computed exactly (see @ref top_k_candidates): if all the intervals are
+ * correct, the @e top_k most central nodes and their centralities are
+ * exact. The nodes whose centrality is exact have a confidence interval
+ * of a single value.
+ *
+ * @param[in] G The unweighted graph to be evaluated.
+ * @param[out] cc @e cc[i] contains the estimated closeness centrality of the @e i-th node.
+ * @param[out] cc_lo @e cc_lo[i] contains the lower bound of the
+ * closeness centrality of the @e i-th node.
+ * @param[out] cc_hi @e cc_hi[i] contains the upper bound of the
+ * closeness centrality of the @e i-th node.
+ * @param[in] n_pivots Number of pivots.
+ * @param[in] rg The random generator used to draw the pivots.
+ * @param[in] confidence Probability of the confidence intervals.
+ * @param[in] top_k Number of most central nodes whose centrality is refined.
+ * @param[in] n_threads Number of threads used to run the traversals (see
+ * @ref utils::n_threads_used).
+ */
+void closeness(
+	const uxgraph *G,
+	std::vector<double>& cc, std::vector<double>& cc_lo, std::vector<double>& cc_hi,
+	size_t n_pivots, utils::drandom_generator<>& rg,
+	double confidence = 0.95, size_t top_k = 0, size_t n_threads = 1
+);
+
+/**
+ * @brief Approximate mean closeness centrality of a graph.
+ *
+ * Computes the closeness centrality of @e n_pivots nodes drawn uniformly
+ * at random (see @ref mcc_from_pivots), and their average is the estimate.
+ * @param[in] G The graph to be evaluated.
+ * @param[in] n_pivots Number of pivots.
+ * @param[in] rg The random generator used to draw the pivots.
+ * @param[out] mcc_lo Lower bound of the mean closeness centrality.
+ * @param[out] mcc_hi Upper bound of the mean closeness centrality.
+ * @param[in] confidence Probability of the confidence interval.
+ * @param[in] n_threads Number of threads used to run the traversals (see
+ * @ref utils::n_threads_used).
+ * @return Returns the estimated average of the closeness centralities.
+ */
+double mcc(
+	const uxgraph *G, size_t n_pivots, utils::drandom_generator<>& rg,
+	double& mcc_lo, double& mcc_hi, double confidence = 0.95, size_t n_threads = 1
+);
+
 /* BETWEENNESS CENTRALITY */
 
 /**
@@ -133,18 +219,21 @@ double mcc(const uxgraph *G, const std::vector<double>& cc);
  * [Newman, 2010] Newman, M. E. J. (2010). Networks. An introduction. Oxford
  * University Press, Oxford.
  *
- * This function computes all shortest paths between each pair of nodes.
+ * Applies Brandes' algorithm, which counts the shortest paths from every
+ * node without storing them.
  * @param G The unweighted graph to be evaluated.
  * @param u The node to be evaluated.
+ * @param n_threads Number of threads used to run the traversals (see
+ * @ref utils::n_threads_used).
  * @return Returns the betweenness centrality of a node, considering
  * that a path between @e u and @e v contains both @e u and @e v.
  */
-double betweenness(const uxgraph *G, node u);
+double betweenness(const uxgraph *G, node u, size_t n_threads = 1);
 
 /**
  * @brief Betweenness centrality of a node.
  *
- * See @ref betweenness(const uxgraph*, node) for the details on this centrality's
+ * See @ref betweenness(const uxgraph*, node, size_t) for the details on this centrality's
  * definition.
  *
  * This uses the parameter @e paths to avoid computing all the shortest paths between
@@ -166,20 +255,23 @@ double betweenness(
 /**
  * @brief Betweenness centrality of all nodes in a graph.
  *
- * See @ref betweenness(const uxgraph*, node) for the details on this centrality's
+ * See @ref betweenness(const uxgraph*, node, size_t) for the details on this centrality's
  * definition.
  *
- * This function computes all shortest paths between each pair of nodes.
+ * Applies Brandes' algorithm, which counts the shortest paths from every
+ * node without storing them.
  *
  * @param[in] G The unweighted graph to be evaluated.
  * @param[out] bc @e bc[i] contains the betweenness centrality of the @e i-th node.
+ * @param[in] n_threads Number of threads used to run the traversals (see
+ * @ref utils::n_threads_used).
  */
-void betweenness(const uxgraph *G, std::vector<double>& bc);
+void betweenness(const uxgraph *G, std::vector<double>& bc, size_t n_threads = 1);
 
 /**
  * @brief Betweenness centrality of all nodes in a graph.
  *
- * See @ref betweenness(const uxgraph*, node) for the details on this centrality's
+ * See @ref betweenness(const uxgraph*, node, size_t) for the details on this centrality's
  * definition.
  *
  * This uses the parameter @e paths to avoid computing all the shortest paths between
@@ -196,6 +288,239 @@ void betweenness(
 	std::vector<double>& bc
 );
 
+/**
+ * @brief Approximate betweenness centrality of all nodes in a graph.
+ *
+ * See @ref betweenness(const uxgraph*, node, size_t) for the details on this centrality's
+ * definition.
+ *
+ * Estimates the centrality of every node sampling shortest paths
+ * uniformly at random (see @ref sampled_betweenness). Enough paths
+ * are sampled (see @ref betweenness_sample_size) so that, with
+ * probability at least 1 - @e delta, all the estimates are within
+ * @e epsilon of the exact centralities. Then, the nodes whose
+ * centralities differ by more than 2 @e epsilon are ranked correctly.
+ *
+ * The result depends only on the state of @e rg: the same seed (see
+ * @ref utils::random_generator::seed_random_engine(typename G::result_type))
+ * gives the same estimates for any number of threads.
+ *
+ * @param[in] G The unweighted graph to be evaluated.
+ * @param[out] bc @e bc[i] contains the estimated betweenness centrality of the @e i-th node.
+ * @param[in] epsilon Maximum absolute error of the estimates.
+ * @param[in] delta Maximum probability that any estimate has a larger error.
+ * @param[in] rg The random generator used to sample the paths.
+ * @param[in] n_threads Number of threads used to sample the paths (see
+ * @ref utils::n_threads_used).
+ */
+void betweenness(
+	const uxgraph *G, std::vector<double>& bc, double epsilon, double delta,
+	utils::drandom_generator<>& rg, size_t n_threads = 1
+);
+
+/**
+ * @brief Approximate betweenness centrality of all nodes in a graph.
+ *
+ * Same as @ref betweenness(const uxgraph*, std::vector<double>&, double, double, utils::drandom_generator<>&, size_t)
+ * but with a fixed number of sampled paths instead of an accuracy target.
+ *
+ * @param[in] G The unweighted graph to be evaluated.
+ * @param[out] bc @e bc[i] contains the estimated betweenness centrality of the @e i-th node.
+ * @param[in] n_samples Number of paths sampled.
+ * @param[in] rg The random generator used to sample the paths.
+ * @param[in] n_threads Number of threads used to sample the paths (see
+ * @ref utils::n_threads_used).
+ */
+void betweenness(
+	const uxgraph *G, std::vector<double>& bc, size_t n_samples,
+	utils::drandom_generator<>& rg, size_t n_threads = 1
+);
+
+/* ---------------------------------------------- */
+/* CENTRALITIES FOR COMPRESSED UNWEIGHTED GRAPHS */
+
+/**
+ * @brief Closeness centrality of a node.
+ *
+ * See @ref closeness(const uxgraph*, node).
+ *
+ * @param G The compressed unweighted graph to be evaluated.
+ * @param u The node to be evaluated.
+ * @return Returns the closeness centrality of a node.
+ */
+double closeness(const csr_uxgraph *G, node u);
+
+/**
+ * @brief Closeness centrality of all nodes in a graph.
+ *
+ * See @ref closeness(const uxgraph*, std::vector<double>&, size_t).
+ *
+ * @param[in] G The compressed unweighted graph to be evaluated.
+ * @param[out] cc The @e i-th position contains the
+ * closeness centrality of the @e i-th node.
+ * @param[in] n_threads Number of threads used to run the traversals (see
+ * @ref utils::n_threads_used).
+ */
+void closeness(const csr_uxgraph *G, std::vector<double>& cc, size_t n_threads = 1);
+
+/**
+ * @brief Closeness centrality of all nodes in a graph.
+ *
+ * See @ref closeness(const uxgraph*, const std::vector<std::vector<_new_> >&, std::vector<double>&).
+ *
+ * @param[in] G The compressed unweighted graph to be evaluated.
+ * @param[in] atad The matrix with the distance between each pair of nodes.
+ * @param[out] cc The @e i-th position contains the
+ * closeness centrality of the @e i-th node.
+ */
+void closeness(
+	const csr_uxgraph *G,
+	const std::vector<std::vector<_new_> >& atad,
+	std::vector<double>& cc
+);
+/**
+ * @brief Closeness centrality of all nodes in a graph.
+ *
+ * See @ref closeness(const uxgraph*, const distance_matrix&, std::vector<double>&).
+ *
+ * @param[in] G The compressed unweighted graph to be evaluated.
+ * @param[in] atad The compact matrix with the distance between each pair
+ * of nodes.
+ * @param[out] cc The @e i-th position contains the
+ * closeness centrality of the @e i-th node.
+ */
+void closeness(
+	const csr_uxgraph *G,
+	const distance_matrix& atad,
+	std::vector<double>& cc
+);
+
+/**
+ * @brief Mean closeness centrality of a graph.
+ *
+ * See @ref mcc(const uxgraph*).
+ *
+ * @param G The compressed graph to be evaluated.
+ * @return Returns the average of the closeness centralities.
+ */
+double mcc(const csr_uxgraph *G);
+/**
+ * @brief Mean closeness centrality of a graph.
+ *
+ * See @ref mcc(const uxgraph*, const std::vector<double>&).
+ *
+ * @param G The compressed graph to be evaluated.
+ * @param cc @e cc[u] contains the closeness centrality of node @e u.
+ * @return Returns the average of the closeness centralities.
+ */
+double mcc(const csr_uxgraph *G, const std::vector<double>& cc);
+
+/**
+ * @brief Approximate closeness centrality of all nodes in a graph.
+ *
+ * See @ref closeness(const uxgraph*, std::vector<double>&, std::vector<double>&, std::vector<double>&, size_t, utils::drandom_generator<>&, double, size_t, size_t).
+ *
+ * @param[in] G The compressed unweighted graph to be evaluated.
+ * @param[out] cc @e cc[i] contains the estimated closeness centrality of the @e i-th node.
+ * @param[out] cc_lo @e cc_lo[i] contains the lower bound of the
+ * closeness centrality of the @e i-th node.
+ * @param[out] cc_hi @e cc_hi[i] contains the upper bound of the
+ * closeness centrality of the @e i-th node.
+ * @param[in] n_pivots Number of pivots.
+ * @param[in] rg The random generator used to draw the pivots.
+ * @param[in] confidence Probability of the confidence intervals.
+ * @param[in] top_k Number of most central nodes whose centrality is refined.
+ * @param[in] n_threads Number of threads used to run the traversals (see
+ * @ref utils::n_threads_used).
+ */
+void closeness(
+	const csr_uxgraph *G,
+	std::vector<double>& cc, std::vector<double>& cc_lo, std::vector<double>& cc_hi,
+	size_t n_pivots, utils::drandom_generator<>& rg,
+	double confidence = 0.95, size_t top_k = 0, size_t n_threads = 1
+);
+
+/**
+ * @brief Approximate mean closeness centrality of a graph.
+ *
+ * See @ref mcc(const uxgraph*, size_t, utils::drandom_generator<>&, double&, double&, double, size_t).
+ *
+ * @param[in] G The compressed graph to be evaluated.
+ * @param[in] n_pivots Number of pivots.
+ * @param[in] rg The random generator used to draw the pivots.
+ * @param[out] mcc_lo Lower bound of the mean closeness centrality.
+ * @param[out] mcc_hi Upper bound of the mean closeness centrality.
+ * @param[in] confidence Probability of the confidence interval.
+ * @param[in] n_threads Number of threads used to run the traversals (see
+ * @ref utils::n_threads_used).
+ * @return Returns the estimated average of the closeness centralities.
+ */
+double mcc(
+	const csr_uxgraph *G, size_t n_pivots, utils::drandom_generator<>& rg,
+	double& mcc_lo, double& mcc_hi, double confidence = 0.95, size_t n_threads = 1
+);
+
+/**
+ * @brief Betweenness centrality of a node.
+ *
+ * See @ref betweenness(const uxgraph*, node, size_t).
+ *
+ * @param G The compressed unweighted graph to be evaluated.
+ * @param u The node to be evaluated.
+ * @param n_threads Number of threads used to run the traversals (see
+ * @ref utils::n_threads_used).
+ * @return Returns the betweenness centrality of a node, considering
+ * that a path between @e u and @e v contains both @e u and @e v.
+ */
+double betweenness(const csr_uxgraph *G, node u, size_t n_threads = 1);
+
+/**
+ * @brief Betweenness centrality of all nodes in a graph.
+ *
+ * See @ref betweenness(const uxgraph*, std::vector<double>&, size_t).
+ *
+ * @param[in] G The compressed unweighted graph to be evaluated.
+ * @param[out] bc @e bc[i] contains the betweenness centrality of the @e i-th node.
+ * @param[in] n_threads Number of threads used to run the traversals (see
+ * @ref utils::n_threads_used).
+ */
+void betweenness(const csr_uxgraph *G, std::vector<double>& bc, size_t n_threads = 1);
+
+/**
+ * @brief Approximate betweenness centrality of all nodes in a graph.
+ *
+ * See @ref betweenness(const uxgraph*, std::vector<double>&, double, double, utils::drandom_generator<>&, size_t).
+ *
+ * @param[in] G The compressed unweighted graph to be evaluated.
+ * @param[out] bc @e bc[i] contains the estimated betweenness centrality of the @e i-th node.
+ * @param[in] epsilon Maximum absolute error of the estimates.
+ * @param[in] delta Maximum probability that any estimate has a larger error.
+ * @param[in] rg The random generator used to sample the paths.
+ * @param[in] n_threads Number of threads used to sample the paths (see
+ * @ref utils::n_threads_used).
+ */
+void betweenness(
+	const csr_uxgraph *G, std::vector<double>& bc, double epsilon, double delta,
+	utils::drandom_generator<>& rg, size_t n_threads = 1
+);
+
+/**
+ * @brief Approximate betweenness centrality of all nodes in a graph.
+ *
+ * See @ref betweenness(const uxgraph*, std::vector<double>&, size_t, utils::drandom_generator<>&, size_t).
+ *
+ * @param[in] G The compressed unweighted graph to be evaluated.
+ * @param[out] bc @e bc[i] contains the estimated betweenness centrality of the @e i-th node.
+ * @param[in] n_samples Number of paths sampled.
+ * @param[in] rg The random generator used to sample the paths.
+ * @param[in] n_threads Number of threads used to sample the paths (see
+ * @ref utils::n_threads_used).
+ */
+void betweenness(
+	const csr_uxgraph *G, std::vector<double>& bc, size_t n_samples,
+	utils::drandom_generator<>& rg, size_t n_threads = 1
+);
+
 } // -- namespace centralities
 } // -- namespace metrics
 } // -- namespace networks	
@@ -22,10 +22,16 @@
 #include <lgraph/metrics/centralities_ux.hpp>
 
 // C++ includes
+#include <algorithm>
+#include <cmath>
 #include <numeric>
 
 // lgraph includes
 #include <lgraph/graph_traversal/traversal_wx.hpp>
+#include <lgraph/graph_traversal/dijkstra.hpp>
+#include <lgraph/metrics/centralities_sampling.hpp>
+#include <lgraph/metrics/centralities_xx.hpp>
+#include <lgraph/utils/parallel.hpp>
 
 namespace lgraph {
 namespace networks {
@@ -34,17 +40,16 @@ namespace centralities {
 
 /* CLOSENESS */
 
-template<class T>
-double closeness(const wxgraph<T> *G, node u) {
-	std::vector<T> ds;
-	traversal::wxdistance(G, u, ds);
+// closeness of a node given its distances to all other nodes
+template<class T, class G_t>
+inline double generic_closeness(const G_t *G, const std::vector<T>& ds) {
 	double sum = std::accumulate
 	(
 		ds.begin(), ds.end(), 0.0,
-		[](double acc, _new_ d) {
+		[](double acc, const T& d) {
 			// if d is infinite 1.0/d equals 0:n no need to divide
-			if (d != inf_t<_new_>()) {
-				acc += static_cast<double>(d);
+			if (d != inf_t<T>()) {
+				acc += static_cast<double>(static_cast<_new_>(d));
 			}
 			return acc;
 		}
@@ -53,15 +58,16 @@ double closeness(const wxgraph<T> *G, node u) {
 	return 1.0/(sum/(G->n_nodes() - 1));
 }
 
-template<class T>
-void closeness(const wxgraph<T> *G, std::vector<double>& cc) {
-	std::vector<std::vector<T> > ds;
-	traversal::wxdistances(G, ds);
-	return closeness(G, ds, cc);
+template<class T, class G_t>
+inline double generic_closeness(const G_t *G, node u) {
+	std::vector<T> ds;
+	traversal::wxdistance(G, u, ds);
+	return generic_closeness(G, ds);
 }
 
-template<class T> void closeness
-(const wxgraph<T> *G, const std::vector<std::vector<T> >& ds, std::vector<double>& cc)
+template<class T, class G_t>
+inline void generic_closeness
+(const G_t *G, const std::vector<std::vector<T> >& ds, std::vector<double>& cc)
 {
 	transform(
 		// iterate through all nodes
@@ -71,23 +77,35 @@ template<class T> void closeness
 
 		// calculate closeness centrality
 		[&](const std::vector<T>& ds_i) {
-			double sum = std::accumulate
-			(
-				ds_i.begin(), ds_i.end(), 0.0,
-				[](double acc, _new_ d) {
-					if (d != inf_t<_new_>()) {
-						acc += static_cast<double>(d);
-					}
-					return acc;
-				}
-			);
-			return 1.0/(sum/(G->n_nodes() - 1));
+			return generic_closeness(G, ds_i);
 		}
 	);
 }
 
-template<class T>
-double mcc(const wxgraph<T> *G) {
+template<class T, class G_t>
+inline void generic_closeness
+(const G_t *G, std::vector<double>& cc, size_t n_threads)
+{
+	const size_t N = G->n_nodes();
+	cc.assign(N, 0.0);
+
+	// the distances from each source are computed in parallel,
+	// using one vector of distances and one workspace per thread.
+	const size_t n_used = utils::n_threads_used(n_threads, N);
+	std::vector<std::vector<T> > ds(n_used);
+	std::vector<traversal::workspace<T> > W(n_used);
+
+	utils::parallel_for(N, n_threads,
+	[&](size_t tid, node s) -> void
+	{
+		traversal::wxdistance(G, s, ds[tid], &W[tid]);
+		cc[s] = generic_closeness(G, ds[tid]);
+	}
+	);
+}
+
+template<class T, class G_t>
+inline double generic_mcc(const G_t *G) {
 	std::vector<std::vector<T> > ds;
 	traversal::wxdistances(G, ds);
 	// compute sum of all the distance values.
@@ -96,11 +114,11 @@ double mcc(const wxgraph<T> *G) {
 		ds.begin(), ds.end(), 0.0,
 		[](double acc, const std::vector<T>& v) -> double {
 			// sum of a row, accumulate values below infinte
-			T s = accumulate(
-				v.begin(), v.end(), static_cast<T>(0),
-				[](_new_ acc_inner, _new_ d) -> T {
+			_new_ s = accumulate(
+				v.begin(), v.end(), static_cast<_new_>(0),
+				[](_new_ acc_inner, const T& d) -> _new_ {
 					if (d != inf_t<T>()) {
-						acc_inner += d;
+						acc_inner += static_cast<_new_>(d);
 					}
 					return acc_inner;
 				}
@@ -114,19 +132,640 @@ double mcc(const wxgraph<T> *G) {
 	return ((n - 1.0)/n)*sum;
 }
 
-template<class T>
-double mcc(const wxgraph<T> *G, const std::vector<double>& cc) {
+template<class G_t>
+inline double generic_mcc(const G_t *G, const std::vector<double>& cc) {
 	double S = std::accumulate(cc.begin(), cc.end(), 0.0);
 	return S/G->n_nodes();
 }
 
+/* APPROXIMATE CLOSENESS */
+
+// Sum of the distances from every pivot to all the nodes it reaches in
+// 'G', and sums of the distances, and of their squares, from every node
+// to the pivots, found with Dijkstra's algorithm from the pivots in 'R',
+// the reverse of 'G', as in the unweighted version (see
+// centralities_ux.cpp). The pivots are split into blocks as the sources
+// in Brandes' algorithm: for a fixed number of threads the result does
+// not depend on the order in which the blocks are done.
+template<class T, class G_t, class R_t>
+inline void generic_pivot_distances(
+	const G_t *G, const R_t *R, const std::vector<node>& pivots,
+	std::vector<double>& pivot_sums,
+	std::vector<double>& sums, std::vector<double>& squares,
+	size_t n_threads
+)
+{
+	const size_t N = G->n_nodes();
+	const size_t k = pivots.size();
+	const size_t n_used = utils::n_threads_used(n_threads, k);
+	const size_t n_blocks = (n_used == 1 ? 1 : std::min(k, 4*n_used));
+	const bool directed = G->is_directed();
+
+	// memory of every thread reused by all its traversals
+	std::vector<traversal::workspace<T> > W(n_used);
+
+	// partial results of every block
+	pivot_sums.assign(k, 0.0);
+	std::vector<std::vector<double> > block_sums(n_blocks);
+	std::vector<std::vector<double> > block_squares(n_blocks);
+
+	utils::parallel_for(n_blocks, n_threads,
+	[&](size_t tid, size_t b) -> void
+	{
+		block_sums[b].assign(N, 0.0);
+		block_squares[b].assign(N, 0.0);
+		for (size_t i = (b*k)/n_blocks; i < ((b + 1)*k)/n_blocks; ++i) {
+			traversal::wxdistance(R, pivots[i], W[tid]);
+			for (node v : W[tid].visited_nodes()) {
+				const double d = static_cast<double>(W[tid].distance(v));
+				block_sums[b][v] += d;
+				block_squares[b][v] += d*d;
+			}
+
+			if (directed) {
+				traversal::wxdistance(G, pivots[i], W[tid]);
+			}
+			for (node v : W[tid].visited_nodes()) {
+				pivot_sums[i] += static_cast<double>(W[tid].distance(v));
+			}
+		}
+	}
+	);
+
+	sums.assign(N, 0.0);
+	squares.assign(N, 0.0);
+	for (size_t b = 0; b < n_blocks; ++b) {
+		for (node u = 0; u < N; ++u) {
+			sums[u] += block_sums[b][u];
+			squares[u] += block_squares[b][u];
+		}
+	}
+}
+
+// See the unweighted version in centralities_ux.cpp.
+template<class T, class G_t, class R_t>
+inline void generic_closeness(
+	const G_t *G, const R_t *R,
+	std::vector<double>& cc, std::vector<double>& cc_lo, std::vector<double>& cc_hi,
+	size_t n_pivots, utils::drandom_generator<>& rg,
+	double confidence, size_t top_k, size_t n_threads
+)
+{
+	const size_t N = G->n_nodes();
+	if (N == 0) {
+		cc.clear();
+		cc_lo.clear();
+		cc_hi.clear();
+		return;
+	}
+
+	std::vector<node> pivots;
+	sample_nodes(N, std::max<size_t>(n_pivots, 1), rg, pivots);
+
+	std::vector<double> pivot_sums, sums, squares;
+	generic_pivot_distances<T>(G, R, pivots, pivot_sums, sums, squares, n_threads);
+	closeness_from_pivots(N, pivots, pivot_sums, sums, squares, confidence, cc, cc_lo, cc_hi);
+
+	std::vector<node> candidates;
+	top_k_candidates(cc_lo, cc_hi, top_k, candidates);
+
+	const size_t n_used = utils::n_threads_used(n_threads, candidates.size());
+	std::vector<traversal::workspace<T> > W(n_used);
+
+	utils::parallel_for(candidates.size(), n_threads,
+	[&](size_t tid, size_t i) -> void
+	{
+		const node u = candidates[i];
+		traversal::wxdistance(G, u, W[tid]);
+
+		double sum = 0.0;
+		for (node v : W[tid].visited_nodes()) {
+			sum += static_cast<double>(W[tid].distance(v));
+		}
+		cc[u] = cc_lo[u] = cc_hi[u] = 1.0/(sum/(N - 1));
+	}
+	);
+}
+
+// the distances to the pivots in a directed
+// graph are found in the reverse graph
+template<class T, class G_t>
+inline void generic_closeness(
+	const G_t *G,
+	std::vector<double>& cc, std::vector<double>& cc_lo, std::vector<double>& cc_hi,
+	size_t n_pivots, utils::drandom_generator<>& rg,
+	double confidence, size_t top_k, size_t n_threads
+)
+{
+	if (G->is_directed()) {
+		csr_wxgraph<T> R;
+		R.init_reverse(G);
+		generic_closeness<T>
+		(G, &R, cc, cc_lo, cc_hi, n_pivots, rg, confidence, top_k, n_threads);
+	}
+	else {
+		generic_closeness<T>
+		(G, G, cc, cc_lo, cc_hi, n_pivots, rg, confidence, top_k, n_threads);
+	}
+}
+
+template<class T, class G_t>
+inline double generic_mcc(
+	const G_t *G, size_t n_pivots, utils::drandom_generator<>& rg,
+	double& mcc_lo, double& mcc_hi, double confidence, size_t n_threads
+)
+{
+	const size_t N = G->n_nodes();
+
+	std::vector<node> pivots;
+	sample_nodes(N, std::max<size_t>(n_pivots, 1), rg, pivots);
+
+	// only the closeness of the pivots is needed
+	const size_t n_used = utils::n_threads_used(n_threads, pivots.size());
+	std::vector<traversal::workspace<T> > W(n_used);
+	std::vector<double> pivot_sums(pivots.size(), 0.0);
+
+	utils::parallel_for(pivots.size(), n_threads,
+	[&](size_t tid, size_t i) -> void
+	{
+		traversal::wxdistance(G, pivots[i], W[tid]);
+		for (node v : W[tid].visited_nodes()) {
+			pivot_sums[i] += static_cast<double>(W[tid].distance(v));
+		}
+	}
+	);
+	return mcc_from_pivots(N, pivot_sums, confidence, mcc_lo, mcc_hi);
+}
+
+/* BETWEENNES */
+
+// Brandes' algorithm [Brandes, 2001] for a single source 's' with
+// Dijkstra's algorithm instead of a BFS. See the unweighted version in
+// centralities_ux.cpp for the meaning of the parameters. Ties between
+// paths are detected with equal_lengths, as in traversal::wxpaths. The
+// paths to a node only come from the nodes visited before it, whose
+// position in the order of visit is stored in 'pos', so that edges of
+// weight 0 cannot make two nodes predecessors of each other.
+//
+// [Brandes, 2001] Brandes, U. (2001). A faster algorithm for betweenness
+// centrality. Journal of Mathematical Sociology, 25(2), 163-177.
+template<class T, class G_t>
+inline void generic_brandes(
+	const G_t *G, node s,
+	std::vector<T>& ds, std::vector<double>& sigma,
+	std::vector<double>& delta, std::vector<node>& S, std::vector<size_t>& pos,
+	std::vector<double>& inner, std::vector<double>& ends,
+	traversal::workspace<T>& W
+)
+{
+	const T tol = static_cast<T>(1.0e-5);
+
+	// 'ds' is infinite and 'sigma' is 0 for every node,
+	// and so they are left at the end
+	ds[s] = 0;
+	sigma[s] = 1.0;
+	S.clear();
+
+	// store the nodes in order of visit (non-decreasing distance)
+	auto proc_curr =
+	[&S, &pos]
+	(const G_t *, const traversal::dijkstra::djka_node<T>& u, const std::vector<bool>&)
+	-> void
+	{
+		pos[u.second] = S.size();
+		S.push_back(u.second);
+	};
+
+	// count the shortest paths from the source to 'v'
+	auto proc_neig =
+	[&ds, &sigma, &tol]
+	(const G_t *, node u, node v, const T& w, const std::vector<bool>& vis)
+	-> bool
+	{
+		if (vis[v]) {
+			return false;
+		}
+		if (ds[u] + w + tol < ds[v]) {
+			// shorter path from u to v
+			ds[v] = ds[u] + w;
+			sigma[v] = sigma[u];
+			return true;
+		}
+		if (equal_lengths<T>(ds[u] + w, ds[v])) {
+			// equally long path from u to v
+			sigma[v] += sigma[u];
+		}
+		return false;
+	};
+
+	traversal::dijkstra::Dijkstra<T>
+	(G, s, traversal::dijkstra::djka_no_op(), proc_curr, proc_neig, &W);
+
+	// accumulate the dependencies in non-increasing order of
+	// distance: every node 'w' that follows 'v' in a shortest
+	// path has already been processed
+	for (auto v_it = S.rbegin(); v_it != S.rend(); ++v_it) {
+		const node v = *v_it;
+
+		const auto& Nv = G->get_neighbours(v);
+		const auto& wv = G->get_weights(v);
+
+		double dv = 0.0;
+		auto wv_it = wv.begin();
+		for (auto Nv_it = Nv.begin(); Nv_it != Nv.end(); ++Nv_it, ++wv_it) {
+			const node w = *Nv_it;
+			if (pos[v] < pos[w] and equal_lengths<T>(ds[v] + *wv_it, ds[w])) {
+				// paths that end at 'w' only count if s < w
+				const double cw = (w > s ? 1.0 : 0.0);
+				dv += (sigma[v]/sigma[w])*(cw + delta[w]);
+			}
+		}
+		delta[v] = dv;
+
+		if (v != s) {
+			inner[v] += dv;
+		}
+		if (v > s) {
+			// the pair (s,v) is connected
+			ends[s] += 1.0;
+			ends[v] += 1.0;
+		}
+	}
+
+	// reset the memory of the visited nodes: every node whose
+	// distance was updated was added to the queue, hence visited
+	for (node v : S) {
+		ds[v] = inf_t<T>();
+		sigma[v] = 0.0;
+	}
+}
+
+// The sources are split into ranges of consecutive nodes, one per
+// thread, as in the unweighted version (see centralities_ux.cpp).
+template<class T, class G_t>
+inline void generic_brandes
+(const G_t *G, std::vector<double>& inner, std::vector<double>& ends, size_t n_threads)
+{
+	const size_t N = G->n_nodes();
+	inner.assign(N, 0.0);
+	ends.assign(N, 0.0);
+
+	const size_t n_used = utils::n_threads_used(n_threads, N);
+
+	// memory of every thread reused by all its traversals:
+	// distance from the source
+	std::vector<std::vector<T> > ds(n_used, std::vector<T>(N, inf_t<T>()));
+	// number of shortest paths from the source
+	std::vector<std::vector<double> > sigma(n_used, std::vector<double>(N, 0.0));
+	// dependency of the source on each node
+	std::vector<std::vector<double> > delta(n_used, std::vector<double>(N));
+	// nodes in order of visit
+	std::vector<std::vector<node> > S(n_used);
+	// position of every node in the order of visit
+	std::vector<std::vector<size_t> > pos(n_used, std::vector<size_t>(N, 0));
+	// visited markers and priority queue
+	std::vector<traversal::workspace<T> > W(n_used);
+
+	// partial results of every range but the first
+	std::vector<std::vector<double> > part_inner
+		(n_used - 1, std::vector<double>(N, 0.0));
+	std::vector<std::vector<double> > part_ends
+		(n_used - 1, std::vector<double>(N, 0.0));
+
+	utils::parallel_for(n_used, n_threads,
+	[&](size_t tid, size_t r) -> void
+	{
+		std::vector<double>& r_inner = (r == 0 ? inner : part_inner[r - 1]);
+		std::vector<double>& r_ends = (r == 0 ? ends : part_ends[r - 1]);
+		for (node s = (r*N)/n_used; s < ((r + 1)*N)/n_used; ++s) {
+			generic_brandes<T>
+			(
+				G, s, ds[tid], sigma[tid], delta[tid], S[tid], pos[tid],
+				r_inner, r_ends, W[tid]
+			);
+		}
+	}
+	);
+
+	for (size_t r = 0; r + 1 < n_used; ++r) {
+		for (node u = 0; u < N; ++u) {
+			inner[u] += part_inner[r][u];
+			ends[u] += part_ends[r][u];
+		}
+	}
+}
+
+template<class T, class G_t>
+inline double generic_betweenness(const G_t *G, node u, size_t n_threads) {
+	const size_t N = G->n_nodes();
+
+	std::vector<double> inner, ends;
+	generic_brandes<T>(G, inner, ends, n_threads);
+
+	// every pair (s,t) with s == u or t == u adds 1
+	double B = inner[u] + (N - 1);
+
+	// normalise with "(n - 1) choose 2"
+	const size_t n_minus_1__chose_2 = ((N - 1)*(N - 2))/2;
+	B = B/n_minus_1__chose_2;
+	return B;
+}
+
+template<class T, class G_t>
+inline void generic_betweenness
+(const G_t *G, std::vector<double>& bc, size_t n_threads)
+{
+	const size_t N = G->n_nodes();
+
+	std::vector<double> ends;
+	generic_brandes<T>(G, bc, ends, n_threads);
+
+	// normalise
+	const size_t n_minus_1__chose_2 = ((N - 1)*(N - 2))/2;
+	for (node u = 0; u < N; ++u) {
+		bc[u] = (bc[u] + ends[u])/n_minus_1__chose_2;
+	}
+}
+
+/* APPROXIMATE BETWEENNESS */
+
+// Samples one of the shortest paths from 's' to 't' uniformly at random
+// as in the unweighted version (see centralities_ux.cpp), counting the
+// shortest paths with Dijkstra's algorithm until 't' is visited. Paths
+// whose lengths differ by at most 1e-5 are equally long, as in Brandes'
+// algorithm. The paths to a node are only counted from the nodes visited
+// before it, whose order of visit is stored in 'pos', so that edges of
+// weight 0 cannot make the predecessors of a node form a cycle. Every
+// node whose distance was set is stored in 'touched'.
+template<class T, class G_t, class R_t>
+inline void generic_sample_path(
+	const G_t *G, const R_t *R, node s, node t,
+	std::vector<T>& ds, std::vector<double>& sigma, std::vector<size_t>& pos,
+	std::vector<node>& touched, traversal::workspace<T>& W,
+	path_crandom& crg, std::vector<node>& path
+)
+{
+	const T tol = static_cast<T>(1.0e-5);
+	const size_t N = G->n_nodes();
+
+	ds[s] = 0;
+	sigma[s] = 1.0;
+	touched.clear();
+	touched.push_back(s);
+	size_t n_visited = 0;
+
+	auto term =
+	[t](const G_t *, const traversal::dijkstra::djka_node<T>& u, const std::vector<bool>&)
+	-> bool
+	{
+		return u.second == t;
+	};
+
+	auto proc_curr =
+	[&pos, &n_visited]
+	(const G_t *, const traversal::dijkstra::djka_node<T>& u, const std::vector<bool>&)
+	-> void
+	{
+		pos[u.second] = n_visited++;
+	};
+
+	// count the shortest paths from the source to 'v'
+	auto proc_neig =
+	[&ds, &sigma, &touched, &tol]
+	(const G_t *, node u, node v, const T& w, const std::vector<bool>& vis)
+	-> bool
+	{
+		if (vis[v]) {
+			return false;
+		}
+		if (ds[v] == inf_t<T>()) {
+			touched.push_back(v);
+		}
+		if (ds[v] == inf_t<T>() or ds[u] + w + tol < ds[v]) {
+			// shorter path from u to v
+			ds[v] = ds[u] + w;
+			sigma[v] = sigma[u];
+			return true;
+		}
+		if (equal_lengths<T>(ds[u] + w, ds[v])) {
+			// equally long path from u to v
+			sigma[v] += sigma[u];
+		}
+		return false;
+	};
+
+	traversal::dijkstra::Dijkstra<T>(G, s, term, proc_curr, proc_neig, &W);
+
+	path.clear();
+	if (pos[t] != N) {
+		node w = t;
+		path.push_back(w);
+		while (w != s) {
+			const auto& Rw = R->get_neighbours(w);
+			const auto& ww = R->get_weights(w);
+
+			// 'q' is a predecessor of 'w' if it was visited before
+			// 'w' and the edge (q,w) is on a shortest path
+			auto is_predecessor =
+			[&](node q, const T& wq) -> bool {
+				return pos[q] < pos[w] and equal_lengths<T>(ds[q] + wq, ds[w]);
+			};
+
+			double total = 0.0;
+			auto ww_it = ww.begin();
+			for (auto Rw_it = Rw.begin(); Rw_it != Rw.end(); ++Rw_it, ++ww_it) {
+				if (is_predecessor(*Rw_it, *ww_it)) {
+					total += sigma[*Rw_it];
+				}
+			}
+
+			// the last predecessor is chosen if rounding
+			// errors leave 'x' slightly above the sum
+			double x = crg.get_uniform()*total;
+			node p = w;
+			ww_it = ww.begin();
+			for (auto Rw_it = Rw.begin(); Rw_it != Rw.end(); ++Rw_it, ++ww_it) {
+				if (is_predecessor(*Rw_it, *ww_it)) {
+					p = *Rw_it;
+					x -= sigma[p];
+					if (x < 0.0) {
+						break;
+					}
+				}
+			}
+			w = p;
+			path.push_back(w);
+		}
+	}
+
+	// reset the memory of the nodes reached
+	for (node v : touched) {
+		ds[v] = inf_t<T>();
+		sigma[v] = 0.0;
+		pos[v] = N;
+	}
+}
+
+template<class T, class G_t, class R_t>
+inline void generic_sampled_betweenness(
+	const G_t *G, const R_t *R, std::vector<double>& bc,
+	size_t n_samples, utils::drandom_generator<>& rg, size_t n_threads
+)
+{
+	const size_t N = G->n_nodes();
+	const size_t n_blocks =
+		(n_samples + betweenness_sample_block - 1)/betweenness_sample_block;
+	const size_t n_used = utils::n_threads_used(n_threads, n_blocks);
+
+	// memory of every thread reused by all its samples
+	std::vector<std::vector<T> > ds(n_used, std::vector<T>(N, inf_t<T>()));
+	std::vector<std::vector<double> > sigma(n_used, std::vector<double>(N, 0.0));
+	std::vector<std::vector<size_t> > pos(n_used, std::vector<size_t>(N, N));
+	std::vector<std::vector<node> > touched(n_used);
+	std::vector<traversal::workspace<T> > W(n_used);
+
+	sampled_betweenness(N, n_samples, rg, n_threads,
+	[&](size_t tid, node s, node t, path_crandom& crg, std::vector<node>& path) -> void
+	{
+		generic_sample_path<T>
+		(
+			G, R, s, t, ds[tid], sigma[tid], pos[tid], touched[tid], W[tid],
+			crg, path
+		);
+	},
+	bc
+	);
+}
+
+// the predecessors of a node in a directed graph
+// are its neighbours in the reverse graph
+template<class T, class G_t>
+inline void generic_sampled_betweenness(
+	const G_t *G, std::vector<double>& bc,
+	size_t n_samples, utils::drandom_generator<>& rg, size_t n_threads
+)
+{
+	if (G->is_directed()) {
+		csr_wxgraph<T> R;
+		R.init_reverse(G);
+		generic_sampled_betweenness<T>(G, &R, bc, n_samples, rg, n_threads);
+	}
+	else {
+		generic_sampled_betweenness<T>(G, G, bc, n_samples, rg, n_threads);
+	}
+}
+
+template<class T, class G_t>
+inline void generic_sampled_betweenness(
+	const G_t *G, std::vector<double>& bc, double epsilon, double delta,
+	utils::drandom_generator<>& rg, size_t n_threads
+)
+{
+	const size_t N = G->n_nodes();
+	const size_t n_samples = (N < 3 ? 0 :
+		betweenness_sample_size(epsilon, delta, N, vertex_diameter_bound(G, true)));
+	generic_sampled_betweenness<T>(G, bc, n_samples, rg, n_threads);
+}
+
+/* CLOSENESS */
+
+template<class T>
+double closeness(const wxgraph<T> *G, node u) {
+	return generic_closeness<T>(G, u);
+}
+
+template<class T>
+void closeness(const wxgraph<T> *G, std::vector<double>& cc, size_t n_threads) {
+	generic_closeness<T>(G, cc, n_threads);
+}
+
+template<class T> void closeness
+(const wxgraph<T> *G, const std::vector<std::vector<T> >& ds, std::vector<double>& cc)
+{
+	generic_closeness(G, ds, cc);
+}
+
+template<class T>
+double closeness(const csr_wxgraph<T> *G, node u) {
+	return generic_closeness<T>(G, u);
+}
+
+template<class T>
+void closeness(const csr_wxgraph<T> *G, std::vector<double>& cc, size_t n_threads) {
+	generic_closeness<T>(G, cc, n_threads);
+}
+
+template<class T> void closeness
+(const csr_wxgraph<T> *G, const std::vector<std::vector<T> >& ds, std::vector<double>& cc)
+{
+	generic_closeness(G, ds, cc);
+}
+
+/* APPROXIMATE CLOSENESS */
+
+template<class T> void closeness(
+	const wxgraph<T> *G,
+	std::vector<double>& cc, std::vector<double>& cc_lo, std::vector<double>& cc_hi,
+	size_t n_pivots, utils::drandom_generator<>& rg,
+	double confidence, size_t top_k, size_t n_threads
+)
+{
+	generic_closeness<T>(G, cc, cc_lo, cc_hi, n_pivots, rg, confidence, top_k, n_threads);
+}
+
+template<class T> void closeness(
+	const csr_wxgraph<T> *G,
+	std::vector<double>& cc, std::vector<double>& cc_lo, std::vector<double>& cc_hi,
+	size_t n_pivots, utils::drandom_generator<>& rg,
+	double confidence, size_t top_k, size_t n_threads
+)
+{
+	generic_closeness<T>(G, cc, cc_lo, cc_hi, n_pivots, rg, confidence, top_k, n_threads);
+}
+
+template<class T> double mcc(
+	const wxgraph<T> *G, size_t n_pivots, utils::drandom_generator<>& rg,
+	double& mcc_lo, double& mcc_hi, double confidence, size_t n_threads
+)
+{
+	return generic_mcc<T>(G, n_pivots, rg, mcc_lo, mcc_hi, confidence, n_threads);
+}
+
+template<class T> double mcc(
+	const csr_wxgraph<T> *G, size_t n_pivots, utils::drandom_generator<>& rg,
+	double& mcc_lo, double& mcc_hi, double confidence, size_t n_threads
+)
+{
+	return generic_mcc<T>(G, n_pivots, rg, mcc_lo, mcc_hi, confidence, n_threads);
+}
+
+/* MEAN CLOSENESS */
+
+template<class T>
+double mcc(const wxgraph<T> *G) {
+	return generic_mcc<T>(G);
+}
+
+template<class T>
+double mcc(const wxgraph<T> *G, const std::vector<double>& cc) {
+	return generic_mcc(G, cc);
+}
+
+template<class T>
+double mcc(const csr_wxgraph<T> *G) {
+	return generic_mcc<T>(G);
+}
+
+template<class T>
+double mcc(const csr_wxgraph<T> *G, const std::vector<double>& cc) {
+	return generic_mcc(G, cc);
+}
+
 /* BETWEENNES */
 
 template<class T>
-double betweenness(const wxgraph<T> *G, node u) {
-	std::vector<std::vector<boolean_path_set<T> > > all_to_all_paths;
-	traversal::wxpaths(G, all_to_all_paths);
-	return betweenness(G, all_to_all_paths, u);
+double betweenness(const wxgraph<T> *G, node u, size_t n_threads) {
+	return generic_betweenness<T>(G, u, n_threads);
 }
 
 template<class T> double betweenness(
@@ -173,10 +812,8 @@ template<class T> double betweenness(
 }
 
 template<class T>
-void betweenness(const wxgraph<T> *G, std::vector<double>& bc) {
-	std::vector<std::vector<boolean_path_set<T> > > all_to_all_paths;
-	traversal::wxpaths(G, all_to_all_paths);
-	betweenness(G, all_to_all_paths, bc);
+void betweenness(const wxgraph<T> *G, std::vector<double>& bc, size_t n_threads) {
+	generic_betweenness<T>(G, bc, n_threads);
 }
 
 template<class T> void betweenness(
@@ -190,6 +827,8 @@ template<class T> void betweenness(
 	// amount of shortest paths between s and t in
 	// which vertices of the graph lie on
 	std::vector<size_t> g_st_i(N);
+	// nodes of each of the shortest paths between s and t
+	std::vector<node> nodes_in_path;
 	// initialise data
 	bc = std::vector<double>(N, 0);
 
@@ -203,11 +842,10 @@ template<class T> void betweenness(
 			// set std::vector to 0
 			std::fill(g_st_i.begin(), g_st_i.end(), 0);
 
-			for (node u = 0; u < N; ++u) {
-				for (const boolean_path<T>& bp : paths[s][t]) {
-					if (bp[u]) {
-						++g_st_i[u];
-					}
+			for (const boolean_path<T>& bp : paths[s][t]) {
+				bp.get_nodes(nodes_in_path);
+				for (node u : nodes_in_path) {
+					++g_st_i[u];
 				}
 			}
 
@@ -227,6 +865,50 @@ template<class T> void betweenness(
 	}
 }
 
+template<class T>
+double betweenness(const csr_wxgraph<T> *G, node u, size_t n_threads) {
+	return generic_betweenness<T>(G, u, n_threads);
+}
+
+template<class T>
+void betweenness(const csr_wxgraph<T> *G, std::vector<double>& bc, size_t n_threads) {
+	generic_betweenness<T>(G, bc, n_threads);
+}
+
+/* APPROXIMATE BETWEENNESS */
+
+template<class T> void betweenness(
+	const wxgraph<T> *G, std::vector<double>& bc, double epsilon, double delta,
+	utils::drandom_generator<>& rg, size_t n_threads
+)
+{
+	generic_sampled_betweenness<T>(G, bc, epsilon, delta, rg, n_threads);
+}
+
+template<class T> void betweenness(
+	const wxgraph<T> *G, std::vector<double>& bc, size_t n_samples,
+	utils::drandom_generator<>& rg, size_t n_threads
+)
+{
+	generic_sampled_betweenness<T>(G, bc, n_samples, rg, n_threads);
+}
+
+template<class T> void betweenness(
+	const csr_wxgraph<T> *G, std::vector<double>& bc, double epsilon, double delta,
+	utils::drandom_generator<>& rg, size_t n_threads
+)
+{
+	generic_sampled_betweenness<T>(G, bc, epsilon, delta, rg, n_threads);
+}
+
+template<class T> void betweenness(
+	const csr_wxgraph<T> *G, std::vector<double>& bc, size_t n_samples,
+	utils::drandom_generator<>& rg, size_t n_threads
+)
+{
+	generic_sampled_betweenness<T>(G, bc, n_samples, rg, n_threads);
+}
+
 } // -- namespace centralities
 } // -- namespace metrics
 } // -- namespace networks
@@ -26,7 +26,9 @@
 
 // lgraph includes
 #include <lgraph/data_structures/boolean_path.hpp>
+#include <lgraph/data_structures/csr_wxgraph.hpp>
 #include <lgraph/data_structures/wxgraph.hpp>
+#include <lgraph/utils/random_generator.hpp>
 
 namespace lgraph {
 namespace networks {
@@ -64,9 +66,11 @@ double closeness(const wxgraph<T> *G, node u);
  * @param[in] G The weighted graph to be evaluated.
  * @param[out] cc The @e i-th position contains the
  * closeness centrality of the @e i-th node.
+ * @param[in] n_threads Number of threads used to run the traversals (see
+ * @ref utils::n_threads_used).
  */
 template<class T>
-void closeness(const wxgraph<T> *G, std::vector<double>& cc);
+void closeness(const wxgraph<T> *G, std::vector<double>& cc, size_t n_threads = 1);
 
 /**
  * @brief Closeness centrality of all nodes in a graph.
@@ -108,6 +112,56 @@ double mcc(const wxgraph<T> *G);
 template<class T>
 double mcc(const wxgraph<T> *G, const std::vector<double>& cc);
 
+/**
+ * @brief Approximate closeness centrality of all nodes in a graph.
+ *
+ * See @ref closeness(const wxgraph<T>*, node) for the details on this centrality's
+ * definition.
+ *
+ * Applies Dijkstra's algorithm from @e n_pivots nodes drawn uniformly at
+ * random instead of from every node, as in
+ * @ref closeness(const uxgraph*, std::vector<double>&, std::vector<double>&, std::vector<double>&, size_t, utils::drandom_generator<>&, double, size_t, size_t).
+ *
+ * @param[in] G The weighted graph to be evaluated.
+ * @param[out] cc @e cc[i] contains the estimated closeness centrality of the @e i-th node.
+ * @param[out] cc_lo @e cc_lo[i] contains the lower bound of the
+ * closeness centrality of the @e i-th node.
+ * @param[out] cc_hi @e cc_hi[i] contains the upper bound of the
+ * closeness centrality of the @e i-th node.
+ * @param[in] n_pivots Number of pivots.
+ * @param[in] rg The random generator used to draw the pivots.
+ * @param[in] confidence Probability of the confidence intervals.
+ * @param[in] top_k Number of most central nodes whose centrality is refined.
+ * @param[in] n_threads Number of threads used to run the traversals (see
+ * @ref utils::n_threads_used).
+ */
+template<class T> void closeness(
+	const wxgraph<T> *G,
+	std::vector<double>& cc, std::vector<double>& cc_lo, std::vector<double>& cc_hi,
+	size_t n_pivots, utils::drandom_generator<>& rg,
+	double confidence = 0.95, size_t top_k = 0, size_t n_threads = 1
+);
+
+/**
+ * @brief Approximate mean closeness centrality of a graph.
+ *
+ * See @ref mcc(const uxgraph*, size_t, utils::drandom_generator<>&, double&, double&, double, size_t).
+ *
+ * @param[in] G The graph to be evaluated.
+ * @param[in] n_pivots Number of pivots.
+ * @param[in] rg The random generator used to draw the pivots.
+ * @param[out] mcc_lo Lower bound of the mean closeness centrality.
+ * @param[out] mcc_hi Upper bound of the mean closeness centrality.
+ * @param[in] confidence Probability of the confidence interval.
+ * @param[in] n_threads Number of threads used to run the traversals (see
+ * @ref utils::n_threads_used).
+ * @return Returns the estimated average of the closeness centralities.
+ */
+template<class T> double mcc(
+	const wxgraph<T> *G, size_t n_pivots, utils::drandom_generator<>& rg,
+	double& mcc_lo, double& mcc_hi, double confidence = 0.95, size_t n_threads = 1
+);
+
 /* BETWEENNESS CENTRALITY */
 
 /**
@@ -135,19 +189,22 @@ double mcc(const wxgraph<T> *G, const std::vector<double>& cc);
  * [Newman, 2010] Newman, M. E. J. (2010). Networks. An introduction. Oxford
  * University Press, Oxford.
  *
- * This function computes all shortest paths between each pair of nodes.
+ * Applies Brandes' algorithm (with Dijkstra's algorithm), which counts the
+ * shortest paths from every node without storing them.
  * @param G The weighted graph to be evaluated.
  * @param u The node to be evaluated.
+ * @param n_threads Number of threads used to run the traversals (see
+ * @ref utils::n_threads_used).
  * @return Returns the betweenness centrality of a node, considering
  * that a path between @e u and @e v contains both @e u and @e v.
  */
 template<class T>
-double betweenness(const wxgraph<T> *G, node u);
+double betweenness(const wxgraph<T> *G, node u, size_t n_threads = 1);
 
 /**
  * @brief Betweenness centrality of a node.
  *
- * See @ref betweenness(const wxgraph<T>*, node) for the details on this centrality's
+ * See @ref betweenness(const wxgraph<T>*, node, size_t) for the details on this centrality's
  * definition.
  *
  * This uses the parameter @e paths to avoid computing all the shortest paths between
@@ -169,7 +226,7 @@ template<class T> double betweenness(
 /**
  * @brief Betweenness centrality of a node.
  *
- * See @ref betweenness(const wxgraph<T>*, node) for the details on this centrality's
+ * See @ref betweenness(const wxgraph<T>*, node, size_t) for the details on this centrality's
  * definition.
  *
  * This uses the parameter @e paths to avoid computing all the shortest paths between
@@ -191,21 +248,24 @@ template<class T> double betweenness(
 /**
  * @brief Betweenness centrality of all nodes in a graph.
  *
- * See @ref betweenness(const wxgraph<T>*, node) for the details on this centrality's
+ * See @ref betweenness(const wxgraph<T>*, node, size_t) for the details on this centrality's
  * definition.
  *
- * This function computes all shortest paths between each pair of nodes.
+ * Applies Brandes' algorithm (with Dijkstra's algorithm), which counts the
+ * shortest paths from every node without storing them.
  *
  * @param[in] G The weighted graph to be evaluated.
  * @param[out] bc @e bc[i] contains the betweenness centrality of the @e i-th node.
+ * @param[in] n_threads Number of threads used to run the traversals (see
+ * @ref utils::n_threads_used).
  */
 template<class T>
-void betweenness(const wxgraph<T> *G, std::vector<double>& bc);
+void betweenness(const wxgraph<T> *G, std::vector<double>& bc, size_t n_threads = 1);
 
 /**
  * @brief Betweenness centrality of all nodes in a graph
  *
- * See @ref betweenness(const wxgraph<T>*, node) for the details on this centrality's
+ * See @ref betweenness(const wxgraph<T>*, node, size_t) for the details on this centrality's
  * definition.
  *
  * This uses the parameter @e paths to avoid computing all the shortest paths between
@@ -222,6 +282,223 @@ template<class T> void betweenness(
 	std::vector<double>& bc
 );
 
+/**
+ * @brief Approximate betweenness centrality of all nodes in a graph.
+ *
+ * See @ref betweenness(const wxgraph<T>*, node, size_t) for the details on this centrality's
+ * definition.
+ *
+ * Estimates the centrality of every node sampling shortest paths
+ * uniformly at random, as in
+ * @ref betweenness(const uxgraph*, std::vector<double>&, double, double, utils::drandom_generator<>&, size_t),
+ * counting the shortest paths with Dijkstra's algorithm.
+ *
+ * @param[in] G The weighted graph to be evaluated.
+ * @param[out] bc @e bc[i] contains the estimated betweenness centrality of the @e i-th node.
+ * @param[in] epsilon Maximum absolute error of the estimates.
+ * @param[in] delta Maximum probability that any estimate has a larger error.
+ * @param[in] rg The random generator used to sample the paths.
+ * @param[in] n_threads Number of threads used to sample the paths (see
+ * @ref utils::n_threads_used).
+ */
+template<class T> void betweenness(
+	const wxgraph<T> *G, std::vector<double>& bc, double epsilon, double delta,
+	utils::drandom_generator<>& rg, size_t n_threads = 1
+);
+
+/**
+ * @brief Approximate betweenness centrality of all nodes in a graph.
+ *
+ * Same as @ref betweenness(const wxgraph<T>*, std::vector<double>&, double, double, utils::drandom_generator<>&, size_t)
+ * but with a fixed number of sampled paths instead of an accuracy target.
+ *
+ * @param[in] G The weighted graph to be evaluated.
+ * @param[out] bc @e bc[i] contains the estimated betweenness centrality of the @e i-th node.
+ * @param[in] n_samples Number of paths sampled.
+ * @param[in] rg The random generator used to sample the paths.
+ * @param[in] n_threads Number of threads used to sample the paths (see
+ * @ref utils::n_threads_used).
+ */
+template<class T> void betweenness(
+	const wxgraph<T> *G, std::vector<double>& bc, size_t n_samples,
+	utils::drandom_generator<>& rg, size_t n_threads = 1
+);
+
+/* -------------------------------------------- */
+/* CENTRALITIES FOR COMPRESSED WEIGHTED GRAPHS */
+
+/**
+ * @brief Closeness centrality of a node.
+ *
+ * See @ref closeness(const wxgraph<T>*, node).
+ *
+ * @param G The compressed weighted graph to be evaluated.
+ * @param u The node to be evaluated.
+ * @return Returns the closeness centrality of a node.
+ */
+template<class T>
+double closeness(const csr_wxgraph<T> *G, node u);
+
+/**
+ * @brief Closeness centrality of all nodes in a graph.
+ *
+ * See @ref closeness(const wxgraph<T>*, std::vector<double>&, size_t).
+ *
+ * @param[in] G The compressed weighted graph to be evaluated.
+ * @param[out] cc The @e i-th position contains the
+ * closeness centrality of the @e i-th node.
+ * @param[in] n_threads Number of threads used to run the traversals (see
+ * @ref utils::n_threads_used).
+ */
+template<class T>
+void closeness(const csr_wxgraph<T> *G, std::vector<double>& cc, size_t n_threads = 1);
+
+/**
+ * @brief Closeness centrality of all nodes in a graph.
+ *
+ * See @ref closeness(const wxgraph<T>*, const std::vector<std::vector<T> >&, std::vector<double>&).
+ *
+ * @param[in] G The compressed weighted graph to be evaluated.
+ * @param[in] atad The matrix with the distance between each pair of nodes.
+ * @param[out] cc The @e i-th position contains the
+ * closeness centrality of the @e i-th node.
+ */
+template<class T> void closeness(
+	const csr_wxgraph<T> *G,
+	const std::vector<std::vector<T> >& atad,
+	std::vector<double>& cc
+);
+
+/**
+ * @brief Mean closeness centrality of a graph.
+ *
+ * See @ref mcc(const wxgraph<T>*).
+ *
+ * @param G The compressed weighted graph to be evaluated.
+ * @return Returns the average of the closeness centralities.
+ */
+template<class T>
+double mcc(const csr_wxgraph<T> *G);
+/**
+ * @brief Mean closeness centrality of a graph.
+ *
+ * See @ref mcc(const wxgraph<T>*, const std::vector<double>&).
+ *
+ * @param G The compressed weighted graph to be evaluated.
+ * @param cc @e cc[u] contains the closeness centrality of node @e u.
+ * @return Returns the average of the closeness centralities.
+ */
+template<class T>
+double mcc(const csr_wxgraph<T> *G, const std::vector<double>& cc);
+
+/**
+ * @brief Approximate closeness centrality of all nodes in a graph.
+ *
+ * See @ref closeness(const wxgraph<T>*, std::vector<double>&, std::vector<double>&, std::vector<double>&, size_t, utils::drandom_generator<>&, double, size_t, size_t).
+ *
+ * @param[in] G The compressed weighted graph to be evaluated.
+ * @param[out] cc @e cc[i] contains the estimated closeness centrality of the @e i-th node.
+ * @param[out] cc_lo @e cc_lo[i] contains the lower bound of the
+ * closeness centrality of the @e i-th node.
+ * @param[out] cc_hi @e cc_hi[i] contains the upper bound of the
+ * closeness centrality of the @e i-th node.
+ * @param[in] n_pivots Number of pivots.
+ * @param[in] rg The random generator used to draw the pivots.
+ * @param[in] confidence Probability of the confidence intervals.
+ * @param[in] top_k Number of most central nodes whose centrality is refined.
+ * @param[in] n_threads Number of threads used to run the traversals (see
+ * @ref utils::n_threads_used).
+ */
+template<class T> void closeness(
+	const csr_wxgraph<T> *G,
+	std::vector<double>& cc, std::vector<double>& cc_lo, std::vector<double>& cc_hi,
+	size_t n_pivots, utils::drandom_generator<>& rg,
+	double confidence = 0.95, size_t top_k = 0, size_t n_threads = 1
+);
+
+/**
+ * @brief Approximate mean closeness centrality of a graph.
+ *
+ * See @ref mcc(const wxgraph<T>*, size_t, utils::drandom_generator<>&, double&, double&, double, size_t).
+ *
+ * @param[in] G The compressed graph to be evaluated.
+ * @param[in] n_pivots Number of pivots.
+ * @param[in] rg The random generator used to draw the pivots.
+ * @param[out] mcc_lo Lower bound of the mean closeness centrality.
+ * @param[out] mcc_hi Upper bound of the mean closeness centrality.
+ * @param[in] confidence Probability of the confidence interval.
+ * @param[in] n_threads Number of threads used to run the traversals (see
+ * @ref utils::n_threads_used).
+ * @return Returns the estimated average of the closeness centralities.
+ */
+template<class T> double mcc(
+	const csr_wxgraph<T> *G, size_t n_pivots, utils::drandom_generator<>& rg,
+	double& mcc_lo, double& mcc_hi, double confidence = 0.95, size_t n_threads = 1
+);
+
+/**
+ * @brief Betweenness centrality of a node.
+ *
+ * See @ref betweenness(const wxgraph<T>*, node, size_t).
+ *
+ * @param G The compressed weighted graph to be evaluated.
+ * @param u The node to be evaluated.
+ * @param n_threads Number of threads used to run the traversals (see
+ * @ref utils::n_threads_used).
+ * @return Returns the betweenness centrality of a node, considering
+ * that a path between @e u and @e v contains both @e u and @e v.
+ */
+template<class T>
+double betweenness(const csr_wxgraph<T> *G, node u, size_t n_threads = 1);
+
+/**
+ * @brief Betweenness centrality of all nodes in a graph.
+ *
+ * See @ref betweenness(const wxgraph<T>*, std::vector<double>&, size_t).
+ *
+ * @param[in] G The compressed weighted graph to be evaluated.
+ * @param[out] bc @e bc[i] contains the betweenness centrality of the @e i-th node.
+ * @param[in] n_threads Number of threads used to run the traversals (see
+ * @ref utils::n_threads_used).
+ */
+template<class T>
+void betweenness(const csr_wxgraph<T> *G, std::vector<double>& bc, size_t n_threads = 1);
+
+/**
+ * @brief Approximate betweenness centrality of all nodes in a graph.
+ *
+ * See @ref betweenness(const wxgraph<T>*, std::vector<double>&, double, double, utils::drandom_generator<>&, size_t).
+ *
+ * @param[in] G The compressed weighted graph to be evaluated.
+ * @param[out] bc @e bc[i] contains the estimated betweenness centrality of the @e i-th node.
+ * @param[in] epsilon Maximum absolute error of the estimates.
+ * @param[in] delta Maximum probability that any estimate has a larger error.
+ * @param[in] rg The random generator used to sample the paths.
+ * @param[in] n_threads Number of threads used to sample the paths (see
+ * @ref utils::n_threads_used).
+ */
+template<class T> void betweenness(
+	const csr_wxgraph<T> *G, std::vector<double>& bc, double epsilon, double delta,
+	utils::drandom_generator<>& rg, size_t n_threads = 1
+);
+
+/**
+ * @brief Approximate betweenness centrality of all nodes in a graph.
+ *
+ * See @ref betweenness(const wxgraph<T>*, std::vector<double>&, size_t, utils::drandom_generator<>&, size_t).
+ *
+ * @param[in] G The compressed weighted graph to be evaluated.
+ * @param[out] bc @e bc[i] contains the estimated betweenness centrality of the @e i-th node.
+ * @param[in] n_samples Number of paths sampled.
+ * @param[in] rg The random generator used to sample the paths.
+ * @param[in] n_threads Number of threads used to sample the paths (see
+ * @ref utils::n_threads_used).
+ */
+template<class T> void betweenness(
+	const csr_wxgraph<T> *G, std::vector<double>& bc, size_t n_samples,
+	utils::drandom_generator<>& rg, size_t n_threads = 1
+);
+
 } // -- namespace centralities
 } // -- namespace metrics
 } // -- namespace networks
@@ -21,7 +21,12 @@
 
 #include <lgraph/metrics/centralities_xx.hpp>
 
+// C includes
+#include <assert.h>
+
 // C++ includes
+#include <algorithm>
+#include <cmath>
 using namespace std;
 
 namespace lgraph {
@@ -31,32 +36,56 @@ namespace centralities {
 
 /* DEGREE */
 
-double degree(const xxgraph *G, node u) {
+template<class G_t>
+inline double generic_degree(const G_t *G, node u) {
 	// number of nodes minus 1
 	const double nm1 = G->n_nodes() - 1;
 	return G->degree(u)/nm1;
 }
 
-void degree(const xxgraph *G, std::vector<double>& dc) {
-	vector<node> nds;
-	G->nodes(nds);
-
+template<class G_t>
+inline void generic_degree(const G_t *G, std::vector<double>& dc) {
 	// number of nodes minus 1
 	const double nm1 = G->n_nodes() - 1;
 	dc.clear();
+	dc.reserve(G->n_nodes());
+
+	// calculate degree centrality of every node
+	for (node u = 0; u < G->n_nodes(); ++u) {
+		dc.push_back(G->degree(u)/nm1);
+	}
+}
+
+double degree(const xxgraph *G, node u) {
+	return generic_degree(G, u);
+}
+
+void degree(const xxgraph *G, std::vector<double>& dc) {
+	generic_degree(G, dc);
+}
+
+double degree(const csr_xxgraph *G, node u) {
+	return generic_degree(G, u);
+}
+
+void degree(const csr_xxgraph *G, std::vector<double>& dc) {
+	generic_degree(G, dc);
+}
 
-	transform(
-		// iterate through all nodes
-		nds.begin(), nds.end(),
+/* BETWEENNESS */
 
-		// append value at the back of dc
-		back_inserter(dc),
+size_t betweenness_sample_size
+(double epsilon, double delta, size_t n, size_t vertex_diameter)
+{
+	assert(epsilon > 0.0);
+	assert(0.0 < delta and delta < 1.0);
+	assert(n > 2);
 
-		// calculate degree centrality
-		[&](node u) {
-			return G->degree(u)/nm1;
-		}
-	);
+	// the estimates are scaled by n/(n - 2) (see centralities_sampling.hpp)
+	const double eps = epsilon*(n - 2)/n;
+	const double vd = static_cast<double>(max<size_t>(vertex_diameter, 2));
+	const double r = (0.5/(eps*eps))*(floor(log2(vd)) + 1.0 + log(1.0/delta));
+	return static_cast<size_t>(ceil(r));
 }
 
 } // -- namespace centralities
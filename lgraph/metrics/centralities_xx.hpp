@@ -25,6 +25,8 @@
 #include <vector>
 
 // lgraph includes
+#include <lgraph/data_structures/csr_xxgraph.hpp>
+#include <lgraph/data_structures/shortest_path_dag.hpp>
 #include <lgraph/data_structures/xxgraph.hpp>
 
 namespace lgraph {
@@ -51,7 +53,98 @@ double degree(const xxgraph *G, node u);
  */
 void degree(const xxgraph *G, std::vector<double>& dc);
 
+/**
+ * @brief Normalised degree centrality of a single node.
+ *
+ * See @ref degree(const xxgraph*, node).
+ *
+ * @param G The compressed graph to be evaluated.
+ * @param u The node to be evaluated.
+ * @return Returns the degree of node @e u divided by the
+ * number of nodes (minus 1).
+ */
+double degree(const csr_xxgraph *G, node u);
+
+/**
+ * @brief Normalised degree centrality of all nodes in a graph.
+ *
+ * See @ref degree(const xxgraph*, std::vector<double>&).
+ *
+ * @param[in] G The compressed graph to be evaluated.
+ * @param[out] dc The i-th position contains the normalised degree
+ * centrality of the i-th node.
+ */
+void degree(const csr_xxgraph *G, std::vector<double>& dc);
+
+/* BETWEENNESS CENTRALITY */
+
+/**
+ * @brief Number of samples for an approximate betweenness centrality.
+ *
+ * Number of shortest paths that have to be sampled so that, with
+ * probability at least 1 - @e delta, the betweenness centrality of every
+ * node estimated from them (see
+ * @ref betweenness(const uxgraph*, std::vector<double>&, double, double, utils::drandom_generator<>&, size_t))
+ * differs from the exact one by at most @e epsilon. Following [1], it
+ * depends on the number of nodes of the longest shortest path of the
+ * graph, its vertex diameter, and not on the size of the graph:
+ *
+ * \f$r = \left\lceil \frac{c}{\epsilon'^2} \left( \lfloor \log_2 VD \rfloor + 1 + \ln\frac{1}{\delta} \right) \right\rceil\f$
+ *
+ * where \f$c = 1/2\f$, \f$VD\f$ is (an upper bound of) the vertex
+ * diameter and \f$\epsilon' = \epsilon (n - 2)/n\f$ accounts for the
+ * normalisation of the centrality.
+ *
+ * [1] Riondato, M. and Kornaropoulos, E. M., "Fast approximation of
+ * betweenness centrality through sampling", Data Mining and Knowledge
+ * Discovery, 2016.
+ *
+ * @param epsilon Maximum absolute error of the estimates.
+ * @param delta Maximum probability that any estimate has a larger error.
+ * @param n Number of nodes of the graph.
+ * @param vertex_diameter Upper bound of the number of nodes of any
+ * shortest path.
+ * @return Returns the number of paths to be sampled.
+ * @pre @e epsilon > 0, 0 < @e delta < 1, @e n > 2.
+ */
+size_t betweenness_sample_size
+(double epsilon, double delta, size_t n, size_t vertex_diameter);
+
+/**
+ * @brief Betweenness centrality of a node.
+ *
+ * See @ref betweenness(const uxgraph*, node, size_t) for the details on
+ * this centrality's definition.
+ *
+ * This uses the shortest paths from every node, stored compactly, to
+ * avoid computing them. The paths are never enumerated: the number of
+ * shortest paths through every node is accumulated over the predecessors
+ * of the nodes, as in Brandes' algorithm.
+ *
+ * @param dags @e dags[s] contains all shortest paths from node @e s (see
+ * @ref traversal::uxpaths(const uxgraph*, std::vector<shortest_path_dag<_new_> >&, size_t)
+ * and @ref traversal::wxpaths(const wxgraph<T>*, std::vector<shortest_path_dag<T> >&, size_t)).
+ * @param u The node to be evaluated.
+ * @return Returns the betweenness centrality of a node, considering
+ * that a path between @e u and @e v contains both @e u and @e v.
+ */
+template<class T>
+double betweenness(const std::vector<shortest_path_dag<T> >& dags, node u);
+
+/**
+ * @brief Betweenness centrality of all nodes in a graph.
+ *
+ * See @ref betweenness(const std::vector<shortest_path_dag<T> >&, node).
+ *
+ * @param[in] dags @e dags[s] contains all shortest paths from node @e s.
+ * @param[out] bc @e bc[i] contains the betweenness centrality of the @e i-th node.
+ */
+template<class T>
+void betweenness(const std::vector<shortest_path_dag<T> >& dags, std::vector<double>& bc);
+
 } // -- namespace centralities
 } // -- namespace metrics
 } // -- namespace networks
 } // -- namespace lgraph
+
+#include <lgraph/metrics/centralities_dag.cpp>
@@ -24,36 +24,36 @@
 // C includes
 #include <assert.h>
 
+// C++ includes
+#include <vector>
+
+// lgraph includes
+#include <lgraph/data_structures/triangles.hpp>
+
 namespace lgraph {
 namespace networks {
 namespace metrics {
 namespace clustering {
 
-double gcc(const xxgraph *G) {
+template<class G_t>
+inline double generic_gcc(const G_t *G) {
 	assert(not G->is_directed());
 
 	size_t T = 0;
 	size_t connected_triples = 0;
 	const size_t N = G->n_nodes();
 
+	// number of triangles of each vertex
+	std::vector<size_t> tris;
+	node_triangles(G, tris);
+
 	// for each vertex u ...
 	for (size_t u = 0; u < N; ++u) {
+		T += tris[u];
 
-		const neighbourhood& nu = G->get_neighbours(u);
-		for (size_t v_it = 0; v_it < nu.size(); ++v_it) {
-			node v = nu[v_it];
-
-			for (size_t w_it = v_it + 1; w_it < nu.size(); ++w_it) {
-				node w = nu[w_it];
-				// ... get two different neighbours of u (v, w) and
-				// check if they are connected. If so, we found a triangle
-				if (v != w and G->has_edge(v, w)) {
-					++T;
-				}
-			}
-
-			// ... and count the connected triples as the number of
-			// neighbours minus one (because one vertex is u)
+		// ... count the connected triples as the number of
+		// neighbours minus one (because one vertex is u)
+		for (node v : G->get_neighbours(u)) {
 			connected_triples += G->degree(v) - 1;
 		}
 	}
@@ -66,12 +66,18 @@ double gcc(const xxgraph *G) {
 	return (1.0*T)/(connected_triples);
 }
 
-double mlcc(const xxgraph *G) {
+template<class G_t>
+inline double generic_mlcc(const G_t *G) {
 	assert(not G->is_directed());
 
 	double Cws = 0.0;
 	const size_t N = G->n_nodes();
 
+	// number of triangles of each vertex: the number of pairs
+	// of neighbours of the vertex that are connected
+	std::vector<size_t> tris;
+	node_triangles(G, tris);
+
 	// for each vertex u ...
 	for (size_t u = 0; u < N; ++u) {
 
@@ -84,32 +90,31 @@ double mlcc(const xxgraph *G) {
 			continue;
 		}
 
-		size_t T = 0;
-
-		const neighbourhood& nu = G->get_neighbours(u);
-		for (size_t v_it = 0; v_it < nu.size(); ++v_it) {
-			node v = nu[v_it];
-
-			for (size_t w_it = v_it + 1; w_it < nu.size(); ++w_it) {
-				node w = nu[w_it];
-
-				// ... get two different neighbours of u (v, w) and
-				// check if there is a connection.
-				if (v != w and G->has_edge(v, w)) {
-					++T;
-				}
-			}
-		}
-
 		// double n_pairs = nu*(nu - 1)/2.0;
 		// Cws += T/n_pairs;
 		// we know that n_pairs > 0 because nu >= 2
-		Cws += (2.0*T)/(du*(du - 1));
+		Cws += (2.0*tris[u])/(du*(du - 1));
 	}
 
 	return Cws/N;
 }
 
+double gcc(const xxgraph *G) {
+	return generic_gcc(G);
+}
+
+double gcc(const csr_xxgraph *G) {
+	return generic_gcc(G);
+}
+
+double mlcc(const xxgraph *G) {
+	return generic_mlcc(G);
+}
+
+double mlcc(const csr_xxgraph *G) {
+	return generic_mlcc(G);
+}
+
 } // -- namespace clustering
 } // -- namespace metrics
 } // -- namespace networks	
@@ -22,6 +22,7 @@
 #pragma once
 
 // lgraph includes
+#include <lgraph/data_structures/csr_xxgraph.hpp>
 #include <lgraph/data_structures/xxgraph.hpp>
 
 namespace lgraph {
@@ -45,6 +46,8 @@ namespace clustering {
  University Press, Oxford.
  \endverbatim
  *
+ * The triangles are counted with @ref node_triangles.
+ *
  * @param G The unweighted graph to be evaluated.
  * @return Returns the global clustering coefficient of G.
  * @pre The graph is undirected.
@@ -68,12 +71,37 @@ double gcc(const xxgraph *G);
  dynamics of ’small-world’ networks. Nature, 393:440–442.
  \endverbatim
  *
+ * The connected neighbours of every vertex are counted with
+ * @ref node_triangles.
+ *
  * @param G The unweighted graph to be evaluated.
  * @return Returns the local clustering coefficient of G.
  * @pre The graph is undirected.
  */
 double mlcc(const xxgraph *G);
 
+/**
+ * @brief Global Clustering Coefficient of an undirected compressed graph.
+ *
+ * See @ref gcc(const xxgraph*).
+ *
+ * @param G The compressed graph to be evaluated.
+ * @return Returns the global clustering coefficient of G.
+ * @pre The graph is undirected.
+ */
+double gcc(const csr_xxgraph *G);
+
+/**
+ * @brief Mean Local Clustering Coefficient of an undirected compressed graph.
+ *
+ * See @ref mlcc(const xxgraph*).
+ *
+ * @param G The compressed graph to be evaluated.
+ * @return Returns the local clustering coefficient of G.
+ * @pre The graph is undirected.
+ */
+double mlcc(const csr_xxgraph *G);
+
 } // -- namespace clustering
 } // -- namespace metrics
 } // -- namespace networks	
@@ -0,0 +1,215 @@
+/*********************************************************************
+ * lgraph
+ * Copyright (C) 2018-2019 Lluís Alemany Puig
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ * 
+ * Contact: Lluís Alemany Puig (lluis.alemany.puig@gmail.com)
+ * 
+ ********************************************************************/
+
+
+#pragma once
+
+// C includes
+#include <assert.h>
+
+// C++ includes
+#include <algorithm>
+#include <vector>
+
+// lgraph includes
+#include <lgraph/graph_traversal/workspace.hpp>
+#include <lgraph/utils/definitions.hpp>
+
+namespace lgraph {
+namespace networks {
+namespace metrics {
+namespace distance {
+
+/* BOUNDS OF THE ECCENTRICITIES */
+
+/**
+ * @brief Diameter and radius of an undirected graph.
+ *
+ * The eccentricity of a node is the largest distance to the nodes
+ * reachable from it, the diameter is the largest eccentricity and the
+ * radius the smallest. Every node keeps a lower and an upper bound of its
+ * eccentricity, and the eccentricity @e e of a node @e v bounds that of
+ * every node @e w reachable from it:
+ *
+ *		max(d(v,w), e - d(v,w)) <= ecc(w) <= e + d(v,w)
+ *
+ * The first two traversals are a double sweep: from the node of largest
+ * degree and from the node farthest from it. Then, as in [1], the
+ * traversals alternate between the node with the largest upper bound and
+ * the node with the smallest lower bound, and the nodes whose bounds can
+ * no longer change the diameter (or the radius) are discarded. The
+ * distances from the most central node traversed also bound the distance
+ * between every two nodes not discarded, as in [2]. On real-world graphs
+ * only a handful of traversals are needed.
+ *
+ * [1] F. W. Takes and W. A. Kosters, "Determining the diameter of small
+ * world networks", CIKM, 2011.
+ *
+ * [2] P. Crescenzi, R. Grossi, M. Habib, L. Lanzi and A. Marino, "On
+ * computing the diameter of real-world undirected graphs", Theoretical
+ * Computer Science, 2013.
+ *
+ * @param G The undirected graph.
+ * @param sssp The traversal, called as @e sssp(@e s, @e W), that leaves
+ * in the workspace @e W the distances from @e s to the nodes reachable
+ * from it (see @ref traversal::workspace::visited_nodes).
+ * @param with_radius Whether the radius is computed too. If not, the
+ * nodes are discarded as soon as they can no longer change the diameter.
+ * @param[out] diameter The diameter of @e G.
+ * @param[out] radius The radius of @e G, if @e with_radius.
+ * @param[out] lo Lower bound of the eccentricity of every node.
+ * @param[out] hi Upper bound of the eccentricity of every node.
+ */
+template<class T, class G_t, class sssp_t>
+void bounding_diameters(
+	const G_t *G, sssp_t sssp, bool with_radius,
+	T& diameter, T& radius,
+	std::vector<T>& lo, std::vector<T>& hi
+)
+{
+	assert(not G->is_directed());
+
+	const size_t N = G->n_nodes();
+	lo = std::vector<T>(N, 0);
+	hi = std::vector<T>(N, inf_t<T>());
+	diameter = 0;
+	radius = (N == 0 ? 0 : inf_t<T>());
+	if (N == 0) {
+		return;
+	}
+
+	// lower bound of the diameter, upper bound of the radius
+	T D_lo = 0;
+	T R_hi = inf_t<T>();
+
+	traversal::workspace<T> W;
+	std::vector<node> candidates(N);
+	for (node u = 0; u < N; ++u) {
+		candidates[u] = u;
+	}
+
+	// distances from the reference node: the traversed node of smallest
+	// eccentricity of the first connected component traversed
+	std::vector<T> ref(N, inf_t<T>());
+	T ref_e = inf_t<T>();
+
+	// the first node is the one of largest degree
+	node v = *std::max_element(candidates.begin(), candidates.end(),
+		[&](node a, node b) -> bool { return G->degree(a) < G->degree(b); }
+	);
+
+	for (size_t step = 0; not candidates.empty(); ++step) {
+		sssp(v, W);
+
+		T e = 0;
+		node farthest = v;
+		for (node w : W.visited_nodes()) {
+			if (W.distance(w) > e) {
+				e = W.distance(w);
+				farthest = w;
+			}
+		}
+
+		for (node w : W.visited_nodes()) {
+			const T d = W.distance(w);
+			lo[w] = std::max(lo[w], std::max(d, e - d));
+			hi[w] = std::min(hi[w], e + d);
+			D_lo = std::max(D_lo, lo[w]);
+			R_hi = std::min(R_hi, hi[w]);
+		}
+
+		if (ref_e == inf_t<T>() or (e < ref_e and ref[v] != inf_t<T>())) {
+			std::fill(ref.begin(), ref.end(), inf_t<T>());
+			for (node w : W.visited_nodes()) {
+				ref[w] = W.distance(w);
+			}
+			ref_e = e;
+		}
+
+		// A node is still needed for the diameter if its eccentricity
+		// could be larger than the lower bound. As in iFUB [2], if the
+		// nodes still needed are at distance at most L from the reference
+		// node, then two of them are at distance at most ref(w) + L.
+		T L = 0;
+		for (node w : candidates) {
+			if (hi[w] > D_lo and ref[w] != inf_t<T>()) {
+				L = std::max(L, ref[w]);
+			}
+		}
+
+		// a node is still needed if its eccentricity is not known and it
+		// could be larger than the diameter or smaller than the radius
+		// found so far
+		candidates.erase(std::remove_if(candidates.begin(), candidates.end(),
+			[&](node w) -> bool {
+				const bool for_diameter =
+					hi[w] > D_lo and
+					(ref[w] == inf_t<T>() or ref[w] + L > D_lo);
+				const bool for_radius = with_radius and lo[w] < R_hi;
+				return lo[w] == hi[w] or (not for_diameter and not for_radius);
+			}),
+			candidates.end()
+		);
+		if (candidates.empty()) {
+			break;
+		}
+
+		if (step == 0 and lo[farthest] != hi[farthest]) {
+			// second half of the double sweep
+			v = farthest;
+		}
+		else if (step%2 == 0) {
+			// the largest upper bound, a peripheral node
+			v = *std::max_element(candidates.begin(), candidates.end(),
+				[&](node a, node b) -> bool {
+					return hi[a] < hi[b] or
+						(hi[a] == hi[b] and G->degree(a) < G->degree(b));
+				}
+			);
+		}
+		else {
+			// The smallest lower bound, a central node. Its eccentricity
+			// is not needed for the diameter, but its traversal lowers the
+			// upper bounds of the peripheral nodes.
+			v = candidates[0];
+			for (node w = 0; w < N; ++w) {
+				if (lo[w] != hi[w] and (
+					lo[w] < lo[v] or
+					(lo[w] == lo[v] and G->degree(w) > G->degree(v))))
+				{
+					v = w;
+				}
+			}
+		}
+	}
+
+	// every node not traversed has an eccentricity between bounds that
+	// cannot improve the bounds found, which are attained by some node
+	diameter = D_lo;
+	if (with_radius) {
+		radius = R_hi;
+	}
+}
+
+} // -- namespace distance
+} // -- namespace metrics
+} // -- namespace networks
+} // -- namespace lgraph
@@ -21,32 +21,41 @@
 
 #include <lgraph/metrics/distance_ux.hpp>
 
+// C includes
+#include <assert.h>
+
 // C++ includes
+#include <algorithm>
+#include <limits>
 #include <numeric>
 using namespace std;
 
 // lgraph includes
+#include <lgraph/data_structures/hyperloglog.hpp>
+#include <lgraph/graph_traversal/bfs.hpp>
 #include <lgraph/graph_traversal/traversal_ux.hpp>
 #include <lgraph/metrics/centralities_ux.hpp>
+#include <lgraph/metrics/distance_bounds.hpp>
+#include <lgraph/utils/parallel.hpp>
 
 namespace lgraph {
 namespace networks {
 namespace metrics {
 namespace distance {
 
-_new_ max_distance(const uxgraph *G) {
-	std::vector<std::vector<_new_> > ds;
-	traversal::uxdistances(G, ds);
-	return max_distance(G, ds);
-}
-
-_new_ max_distance(const uxgraph *G, const std::vector<std::vector<_new_> >& ds) {
+template<class G_t>
+inline _new_ generic_max_distance
+(const G_t *G, const std::vector<std::vector<_new_> >& ds)
+{
+	// in undirected graphs the distances are symmetric: only the
+	// pairs (i,j) with i < j are scanned
+	const bool directed = G->is_directed();
 	const size_t N = G->n_nodes();
 	_new_ D = 0;
 	for (size_t i = 0; i < N; ++i) {
 		D = accumulate
 		(
-			ds[i].begin() + i + 1, ds[i].end(), D,
+			ds[i].begin() + (directed ? 0 : i + 1), ds[i].end(), D,
 			[](_new_ M, _new_ d) {
 				if (d != inf_t<_new_>()) {
 					M = std::max(M, d);
@@ -58,13 +67,49 @@ _new_ max_distance(const uxgraph *G, const std::vector<std::vector<_new_> >& ds)
 	return D;
 }
 
-double mean_distance(const uxgraph *G) {
-	std::vector<std::vector<_new_> > ds;
-	traversal::uxdistances(G, ds);
-	return mean_distance(G, ds);
+template<class G_t>
+inline void generic_diameter_radius(
+	const G_t *G, bool with_radius, _new_& D, _new_& R,
+	std::vector<_new_> *ecc_lo, std::vector<_new_> *ecc_hi
+)
+{
+	std::vector<_new_> local_lo, local_hi;
+	bounding_diameters(G,
+		[&](node s, traversal::workspace<>& W) -> void {
+			traversal::uxdistance(G, s, W);
+		},
+		with_radius, D, R,
+		(ecc_lo == nullptr ? local_lo : *ecc_lo),
+		(ecc_hi == nullptr ? local_hi : *ecc_hi)
+	);
 }
 
-double mean_distance(const uxgraph *G, const std::vector<std::vector<_new_> >& ds) {
+template<class G_t>
+inline _new_ generic_max_distance(const G_t *G) {
+	if (not G->is_directed()) {
+		_new_ D, R;
+		generic_diameter_radius(G, false, D, R, nullptr, nullptr);
+		return D;
+	}
+
+	// largest distance from every node s to the nodes
+	// it reaches, without storing all the distances
+	std::vector<_new_> M(G->n_nodes(), 0);
+	traversal::bfs::all_sources_BFS(G,
+	[&](node s, node, _new_ d) -> void { M[s] = std::max(M[s], d); }
+	);
+
+	_new_ D = 0;
+	for (_new_ m : M) {
+		D = std::max(D, m);
+	}
+	return D;
+}
+
+template<class G_t>
+inline double generic_mean_distance
+(const G_t *G, const std::vector<std::vector<_new_> >& ds)
+{
 	const size_t N = G->n_nodes();
 	double m = 0;
 	for (size_t i = 0; i < N; ++i) {
@@ -88,6 +133,277 @@ double mean_distance(const uxgraph *G, const std::vector<std::vector<_new_> >& d
 	return m/N;
 }
 
+template<class G_t>
+inline double generic_mean_distance(const G_t *G, const distance_matrix& ds) {
+	const size_t N = G->n_nodes();
+	vector<double> sums;
+	ds.row_sums(sums);
+
+	double m = 0;
+	for (double sum : sums) {
+		// divide by (N - 1) because d(u,u) = 0
+		m += sum/(N - 1);
+	}
+	return m/N;
+}
+
+template<class G_t>
+inline double generic_mean_distance(const G_t *G) {
+	// only the sum of the distances from each node is needed
+	std::vector<_new_> sums;
+	traversal::uxdistance_sums(G, sums);
+
+	const size_t N = G->n_nodes();
+	double m = 0;
+	for (size_t i = 0; i < N; ++i) {
+		// divide by (N - 1) because the distance from i to i is 0
+		m += static_cast<double>(sums[i])/(N - 1);
+	}
+	return m/N;
+}
+
+/* HYPERANF */
+
+// HyperANF [Boldi, Rosa and Vigna, 2011]. The counter of a node in round
+// 't' holds the nodes at distance at most 't' from it: the union of its
+// own counter and those of its neighbours in the previous round. Two
+// arrays of counters are kept, those of the previous round and those of
+// the current one, and they are equal at the beginning of every round. A
+// node only takes the union with the neighbours whose counter changed in
+// the previous round, and only the counters that changed are copied to
+// the previous round at the end. Adds to 'hc[u]', if not null, the sum
+// of the inverse of the distances from 'u' to the other nodes.
+//
+// [Boldi, Rosa and Vigna, 2011] Boldi, P., Rosa, M. and Vigna, S. (2011).
+// HyperANF: approximating the neighbourhood function of very large graphs
+// on a budget. Proceedings of WWW, 625-634.
+template<class G_t>
+inline void generic_hyperanf(
+	const G_t *G, std::vector<double>& nf, std::vector<double> *hc,
+	utils::drandom_generator<>& rg, size_t log2m, size_t n_threads
+)
+{
+	const size_t N = G->n_nodes();
+
+	// the ball of radius 0 of every node is the node itself
+	nf.assign(1, static_cast<double>(N));
+	if (hc != nullptr) {
+		hc->assign(N, 0.0);
+	}
+	if (N == 0) {
+		return;
+	}
+
+	rg.init_uniform(0, numeric_limits<size_t>::max());
+	hyperloglog_counters prev;
+	prev.init(N, log2m, rg.get_uniform());
+	for (node u = 0; u < N; ++u) {
+		prev.add(u, u);
+	}
+	hyperloglog_counters next(prev);
+
+	// estimated size of the ball of every node
+	vector<double> size(N, 1.0);
+	// the counters changed in the previous round and in this one
+	vector<char> changed(N, 1);
+	vector<char> changed_next(N, 0);
+
+	const size_t n_used = utils::n_threads_used(n_threads, N);
+	const size_t n_blocks = (n_used == 1 ? 1 : min(N, 4*n_used));
+
+	for (size_t t = 1; ; ++t) {
+		// every node only writes its own data
+		utils::parallel_for(n_blocks, n_threads,
+		[&](size_t, size_t b) -> void
+		{
+			for (node u = (b*N)/n_blocks; u < ((b + 1)*N)/n_blocks; ++u) {
+				bool c = false;
+				for (node v : G->get_neighbours(u)) {
+					if (changed[v]) {
+						c = next.merge(u, prev.registers(v)) or c;
+					}
+				}
+				changed_next[u] = c;
+				if (c) {
+					const double e = next.estimate(u);
+					if (hc != nullptr) {
+						(*hc)[u] += (e - size[u])/t;
+					}
+					size[u] = e;
+				}
+			}
+		}
+		);
+
+		bool any = false;
+		for (node u = 0; u < N and not any; ++u) {
+			any = changed_next[u];
+		}
+		if (not any) {
+			break;
+		}
+
+		utils::parallel_for(n_blocks, n_threads,
+		[&](size_t, size_t b) -> void
+		{
+			for (node u = (b*N)/n_blocks; u < ((b + 1)*N)/n_blocks; ++u) {
+				if (changed_next[u]) {
+					prev.assign(u, next.registers(u));
+				}
+			}
+		}
+		);
+
+		nf.push_back(accumulate(size.begin(), size.end(), 0.0));
+		changed.swap(changed_next);
+	}
+
+	if (hc != nullptr and N > 1) {
+		for (node u = 0; u < N; ++u) {
+			(*hc)[u] /= (N - 1);
+		}
+	}
+}
+
+_new_ max_distance(const uxgraph *G) {
+	return generic_max_distance(G);
+}
+
+_new_ max_distance(const uxgraph *G, const std::vector<std::vector<_new_> >& ds) {
+	return generic_max_distance(G, ds);
+}
+
+_new_ max_distance(const uxgraph *G, const distance_matrix& ds) {
+	assert(ds.size() == G->n_nodes());
+	UNUSED(G);
+	return ds.max_distance();
+}
+
+_new_ max_distance(const csr_uxgraph *G) {
+	return generic_max_distance(G);
+}
+
+_new_ max_distance(const csr_uxgraph *G, const std::vector<std::vector<_new_> >& ds) {
+	return generic_max_distance(G, ds);
+}
+
+_new_ max_distance(const csr_uxgraph *G, const distance_matrix& ds) {
+	assert(ds.size() == G->n_nodes());
+	UNUSED(G);
+	return ds.max_distance();
+}
+
+void diameter_radius(
+	const uxgraph *G, _new_& D, _new_& R,
+	std::vector<_new_> *ecc_lo, std::vector<_new_> *ecc_hi
+)
+{
+	generic_diameter_radius(G, true, D, R, ecc_lo, ecc_hi);
+}
+
+void diameter_radius(
+	const csr_uxgraph *G, _new_& D, _new_& R,
+	std::vector<_new_> *ecc_lo, std::vector<_new_> *ecc_hi
+)
+{
+	generic_diameter_radius(G, true, D, R, ecc_lo, ecc_hi);
+}
+
+double mean_distance(const uxgraph *G) {
+	return generic_mean_distance(G);
+}
+
+double mean_distance(const uxgraph *G, const std::vector<std::vector<_new_> >& ds) {
+	return generic_mean_distance(G, ds);
+}
+
+double mean_distance(const uxgraph *G, const distance_matrix& ds) {
+	return generic_mean_distance(G, ds);
+}
+
+double mean_distance(const csr_uxgraph *G) {
+	return generic_mean_distance(G);
+}
+
+double mean_distance(const csr_uxgraph *G, const std::vector<std::vector<_new_> >& ds) {
+	return generic_mean_distance(G, ds);
+}
+
+double mean_distance(const csr_uxgraph *G, const distance_matrix& ds) {
+	return generic_mean_distance(G, ds);
+}
+
+void neighbourhood_function(
+	const uxgraph *G, std::vector<double>& nf,
+	utils::drandom_generator<>& rg, size_t log2m, size_t n_threads
+)
+{
+	generic_hyperanf(G, nf, nullptr, rg, log2m, n_threads);
+}
+
+void neighbourhood_function(
+	const uxgraph *G, std::vector<double>& nf, std::vector<double>& hc,
+	utils::drandom_generator<>& rg, size_t log2m, size_t n_threads
+)
+{
+	generic_hyperanf(G, nf, &hc, rg, log2m, n_threads);
+}
+
+void neighbourhood_function(
+	const csr_uxgraph *G, std::vector<double>& nf,
+	utils::drandom_generator<>& rg, size_t log2m, size_t n_threads
+)
+{
+	generic_hyperanf(G, nf, nullptr, rg, log2m, n_threads);
+}
+
+void neighbourhood_function(
+	const csr_uxgraph *G, std::vector<double>& nf, std::vector<double>& hc,
+	utils::drandom_generator<>& rg, size_t log2m, size_t n_threads
+)
+{
+	generic_hyperanf(G, nf, &hc, rg, log2m, n_threads);
+}
+
+double mean_distance(const std::vector<double>& nf) {
+	assert(nf.size() > 0);
+
+	const double N = nf[0];
+	const double connected = nf.back() - N;
+	if (connected <= 0.0) {
+		return 0.0;
+	}
+
+	// the number of pairs at distance t is nf[t] - nf[t - 1]
+	double sum = 0.0;
+	for (size_t t = 1; t < nf.size(); ++t) {
+		sum += t*(nf[t] - nf[t - 1]);
+	}
+
+	// the mean over the pairs connected by a path is a ratio of
+	// estimates, whose (multiplicative) errors cancel out, times the
+	// fraction of connected pairs, which is at most 1
+	const double fraction = min(1.0, connected/(N*(N - 1)));
+	return (sum/connected)*fraction;
+}
+
+double effective_diameter(const std::vector<double>& nf, double alpha) {
+	assert(nf.size() > 0);
+	assert(0.0 < alpha and alpha <= 1.0);
+
+	// interpolate between the first distance where the fraction of
+	// pairs is reached and the previous one
+	const double target = alpha*nf.back();
+	if (nf[0] >= target) {
+		return 0.0;
+	}
+	size_t t = 1;
+	while (nf[t] < target) {
+		++t;
+	}
+	return (t - 1) + (target - nf[t - 1])/(nf[t] - nf[t - 1]);
+}
+
 } // -- namespace distance
 } // -- namespace metrics
 } // -- namespace networks	
@@ -25,7 +25,10 @@
 #include <vector>
 
 // lgraph includes
+#include <lgraph/data_structures/csr_uxgraph.hpp>
+#include <lgraph/data_structures/distance_matrix.hpp>
 #include <lgraph/data_structures/uxgraph.hpp>
+#include <lgraph/utils/random_generator.hpp>
 
 namespace lgraph {
 namespace networks {
@@ -38,7 +41,11 @@ namespace distance {
 /**
  * @brief Diameter of a graph.
  *
- * Computes the distance between all pairs of nodes.
+ * In undirected graphs, bounds the eccentricities of the nodes with a
+ * few BFS (see @ref diameter_radius(const uxgraph*, _new_&, _new_&, std::vector<_new_>*, std::vector<_new_>*)).
+ * In directed graphs, computes the distance between all pairs of nodes,
+ * 64 sources at a time, without storing them (see
+ * @ref traversal::bfs::all_sources_BFS).
  *
  * @param G The graph to be evaluated.
  * @return Returns the largest distance between all pairs of nodes.
@@ -55,11 +62,48 @@ _new_ max_distance(const uxgraph *G);
  * @return Returns the largest distance between all pairs of nodes.
  */
 _new_ max_distance(const uxgraph *G, const std::vector<std::vector<_new_> >& ds);
+/**
+ * @brief Diameter of a graph.
+ *
+ * Uses the compact matrix @e ds to avoid computing the distance between
+ * all pairs of nodes (see @ref traversal::uxdistances(const uxgraph*, distance_matrix&, size_t)).
+ *
+ * @param G The graph to be evaluated.
+ * @param ds The distance between every pair of nodes.
+ * @return Returns the largest distance between all pairs of nodes.
+ */
+_new_ max_distance(const uxgraph *G, const distance_matrix& ds);
+
+/**
+ * @brief Diameter and radius of an undirected graph.
+ *
+ * The eccentricity of a node is the largest distance to the nodes
+ * reachable from it. The diameter is the largest eccentricity and the
+ * radius the smallest. Instead of a BFS from every node, a double sweep
+ * gives a lower bound of the diameter, and every further BFS bounds the
+ * eccentricities of the nodes it reaches. Only the nodes whose bounds
+ * could still change the diameter or the radius are traversed (see
+ * @ref bounding_diameters).
+ *
+ * @param[in] G The undirected graph to be evaluated.
+ * @param[out] D The diameter of @e G.
+ * @param[out] R The radius of @e G.
+ * @param[out] ecc_lo If not null, a lower bound of the eccentricity of
+ * every node.
+ * @param[out] ecc_hi If not null, an upper bound of the eccentricity of
+ * every node.
+ * @pre @e G is undirected.
+ */
+void diameter_radius(
+	const uxgraph *G, _new_& D, _new_& R,
+	std::vector<_new_> *ecc_lo = nullptr, std::vector<_new_> *ecc_hi = nullptr
+);
 
 /**
  * @brief Mean distance between all pairs of nodes.
  *
- * Computes the distance between all pairs of nodes.
+ * Computes the distance between all pairs of nodes, but only their sums
+ * are stored (see @ref traversal::uxdistance_sums).
  *
  * @param G The graph to be evaluated.
  * @return Returns the average of the distance between all pairs of nodes.
@@ -76,6 +120,228 @@ double mean_distance(const uxgraph *G);
  * @return Returns the average of the distance between all pairs of nodes.
  */
 double mean_distance(const uxgraph *G, const std::vector<std::vector<_new_> >& ds);
+/**
+ * @brief Mean distance between all pairs of nodes.
+ *
+ * Uses the compact matrix @e ds to avoid computing the distance between
+ * all pairs of nodes (see @ref traversal::uxdistances(const uxgraph*, distance_matrix&, size_t)).
+ *
+ * @param G The graph to be evaluated.
+ * @param ds The distance between every pair of nodes.
+ * @return Returns the average of the distance between all pairs of nodes.
+ */
+double mean_distance(const uxgraph *G, const distance_matrix& ds);
+
+/* ------------------------------------------ */
+/* DISTANCES FOR COMPRESSED UNWEIGHTED GRAPHS */
+
+/**
+ * @brief Diameter of a graph.
+ *
+ * See @ref max_distance(const uxgraph*).
+ *
+ * @param G The compressed graph to be evaluated.
+ * @return Returns the largest distance between all pairs of nodes.
+ */
+_new_ max_distance(const csr_uxgraph *G);
+/**
+ * @brief Diameter of a graph.
+ *
+ * See @ref max_distance(const uxgraph*, const std::vector<std::vector<_new_> >&).
+ *
+ * @param G The compressed graph to be evaluated.
+ * @param ds @e ds[u][v] contains the distance between nodes @e u and @e v.
+ * @return Returns the largest distance between all pairs of nodes.
+ */
+_new_ max_distance(const csr_uxgraph *G, const std::vector<std::vector<_new_> >& ds);
+/**
+ * @brief Diameter of a graph.
+ *
+ * See @ref max_distance(const uxgraph*, const distance_matrix&).
+ *
+ * @param G The compressed graph to be evaluated.
+ * @param ds The distance between every pair of nodes.
+ * @return Returns the largest distance between all pairs of nodes.
+ */
+_new_ max_distance(const csr_uxgraph *G, const distance_matrix& ds);
+
+/**
+ * @brief Diameter and radius of an undirected graph.
+ *
+ * See @ref diameter_radius(const uxgraph*, _new_&, _new_&, std::vector<_new_>*, std::vector<_new_>*).
+ *
+ * @param[in] G The undirected compressed graph to be evaluated.
+ * @param[out] D The diameter of @e G.
+ * @param[out] R The radius of @e G.
+ * @param[out] ecc_lo If not null, a lower bound of the eccentricity of
+ * every node.
+ * @param[out] ecc_hi If not null, an upper bound of the eccentricity of
+ * every node.
+ * @pre @e G is undirected.
+ */
+void diameter_radius(
+	const csr_uxgraph *G, _new_& D, _new_& R,
+	std::vector<_new_> *ecc_lo = nullptr, std::vector<_new_> *ecc_hi = nullptr
+);
+
+/**
+ * @brief Mean distance between all pairs of nodes.
+ *
+ * See @ref mean_distance(const uxgraph*).
+ *
+ * @param G The compressed graph to be evaluated.
+ * @return Returns the average of the distance between all pairs of nodes.
+ */
+double mean_distance(const csr_uxgraph *G);
+/**
+ * @brief Mean distance between all pairs of nodes.
+ *
+ * See @ref mean_distance(const uxgraph*, const std::vector<std::vector<_new_> >&).
+ *
+ * @param G The compressed graph to be evaluated.
+ * @param ds @e ds[u][v] contains the distance between nodes @e u and @e v.
+ * @return Returns the average of the distance between all pairs of nodes.
+ */
+double mean_distance(const csr_uxgraph *G, const std::vector<std::vector<_new_> >& ds);
+/**
+ * @brief Mean distance between all pairs of nodes.
+ *
+ * See @ref mean_distance(const uxgraph*, const distance_matrix&).
+ *
+ * @param G The compressed graph to be evaluated.
+ * @param ds The distance between every pair of nodes.
+ * @return Returns the average of the distance between all pairs of nodes.
+ */
+double mean_distance(const csr_uxgraph *G, const distance_matrix& ds);
+
+/* ----------------------------------------- */
+/* APPROXIMATE DISTANCES FOR UNWEIGHTED GRAPHS */
+
+/**
+ * @brief Approximate neighbourhood function of a graph.
+ *
+ * The neighbourhood function @e N(t) of a graph is the number of pairs of
+ * nodes (u,v) such that @e v is at distance at most @e t of @e u, where
+ * every node is paired with itself at distance 0. It gives the
+ * distribution of the distances between all pairs of nodes, from which
+ * the mean distance (see @ref mean_distance(const std::vector<double>&))
+ * and the effective diameter (see @ref effective_diameter) are obtained.
+ *
+ * Applies the HyperANF algorithm [1]. Every node has a HyperLogLog
+ * counter (see @ref hyperloglog_counters) of the nodes at distance at
+ * most @e t of it, which in round @e t is the union of the counters of
+ * its neighbours in round @e t - 1. Every round takes time O(m) and the
+ * counters take 2n*2^@e log2m bytes. The rounds stop when no counter
+ * changes, so the number of rounds is usually the diameter of the graph
+ * plus one, and the last value of the function is the number of pairs
+ * of nodes connected by a path. The relative standard error of the
+ * size of every neighbourhood is about 1.04/sqrt(2^@e log2m).
+ *
+ * [1] Boldi, P., Rosa, M. and Vigna, S., "HyperANF: approximating the
+ * neighbourhood function of very large graphs on a budget", Proceedings
+ * of the 20th International Conference on World Wide Web (WWW), 2011.
+ *
+ * @param[in] G The graph to be evaluated.
+ * @param[out] nf @e nf[t] is the estimate of @e N(t). The number of
+ * nodes is @e nf[0], and the size of @e nf minus 1 is a lower bound of
+ * the diameter of the graph with high probability.
+ * @param[in] rg The random generator used to draw the hash function of
+ * the counters.
+ * @param[in] log2m Base 2 logarithm of the number of registers of every
+ * counter, in [4,16].
+ * @param[in] n_threads Number of threads used to update the counters (see
+ * @ref utils::n_threads_used).
+ */
+void neighbourhood_function(
+	const uxgraph *G, std::vector<double>& nf,
+	utils::drandom_generator<>& rg, size_t log2m = 7, size_t n_threads = 1
+);
+/**
+ * @brief Approximate neighbourhood function and harmonic centrality.
+ *
+ * Same as @ref neighbourhood_function(const uxgraph*, std::vector<double>&, utils::drandom_generator<>&, size_t, size_t),
+ * but also estimates the harmonic centrality of every node @e u:
+ *
+ * \f$H_u = \frac{1}{n - 1} \sum_{v \neq u} \frac{1}{d_{uv}}\f$
+ *
+ * from the number of nodes at every distance of @e u.
+ * @param[in] G The graph to be evaluated.
+ * @param[out] nf @e nf[t] is the estimate of @e N(t).
+ * @param[out] hc @e hc[u] is the estimated harmonic centrality of node @e u.
+ * @param[in] rg The random generator used to draw the hash function of
+ * the counters.
+ * @param[in] log2m Base 2 logarithm of the number of registers of every
+ * counter, in [4,16].
+ * @param[in] n_threads Number of threads used to update the counters (see
+ * @ref utils::n_threads_used).
+ */
+void neighbourhood_function(
+	const uxgraph *G, std::vector<double>& nf, std::vector<double>& hc,
+	utils::drandom_generator<>& rg, size_t log2m = 7, size_t n_threads = 1
+);
+
+/**
+ * @brief Approximate neighbourhood function of a graph.
+ *
+ * See @ref neighbourhood_function(const uxgraph*, std::vector<double>&, utils::drandom_generator<>&, size_t, size_t).
+ *
+ * @param[in] G The compressed graph to be evaluated.
+ * @param[out] nf @e nf[t] is the estimate of @e N(t).
+ * @param[in] rg The random generator used to draw the hash function of
+ * the counters.
+ * @param[in] log2m Base 2 logarithm of the number of registers of every
+ * counter, in [4,16].
+ * @param[in] n_threads Number of threads used to update the counters (see
+ * @ref utils::n_threads_used).
+ */
+void neighbourhood_function(
+	const csr_uxgraph *G, std::vector<double>& nf,
+	utils::drandom_generator<>& rg, size_t log2m = 7, size_t n_threads = 1
+);
+/**
+ * @brief Approximate neighbourhood function and harmonic centrality.
+ *
+ * See @ref neighbourhood_function(const uxgraph*, std::vector<double>&, std::vector<double>&, utils::drandom_generator<>&, size_t, size_t).
+ *
+ * @param[in] G The compressed graph to be evaluated.
+ * @param[out] nf @e nf[t] is the estimate of @e N(t).
+ * @param[out] hc @e hc[u] is the estimated harmonic centrality of node @e u.
+ * @param[in] rg The random generator used to draw the hash function of
+ * the counters.
+ * @param[in] log2m Base 2 logarithm of the number of registers of every
+ * counter, in [4,16].
+ * @param[in] n_threads Number of threads used to update the counters (see
+ * @ref utils::n_threads_used).
+ */
+void neighbourhood_function(
+	const csr_uxgraph *G, std::vector<double>& nf, std::vector<double>& hc,
+	utils::drandom_generator<>& rg, size_t log2m = 7, size_t n_threads = 1
+);
+
+/**
+ * @brief Mean distance between all pairs of nodes.
+ *
+ * Same value as @ref mean_distance(const uxgraph*) obtained from the
+ * neighbourhood function of the graph: pairs of nodes not connected by
+ * a path count as distance 0.
+ * @param nf The (approximate) neighbourhood function of a graph (see
+ * @ref neighbourhood_function).
+ * @return Returns the average of the distance between all pairs of nodes.
+ */
+double mean_distance(const std::vector<double>& nf);
+
+/**
+ * @brief Effective diameter of a graph.
+ *
+ * The smallest distance @e d such that a fraction @e alpha of the pairs
+ * of nodes connected by a path are at distance at most @e d, linearly
+ * interpolated between consecutive distances.
+ * @param nf The (approximate) neighbourhood function of a graph (see
+ * @ref neighbourhood_function).
+ * @param alpha The fraction of pairs of nodes, in (0,1].
+ * @return Returns the effective diameter of the graph.
+ */
+double effective_diameter(const std::vector<double>& nf, double alpha = 0.9);
 
 } // -- namespace distance
 } // -- namespace metrics
@@ -27,27 +27,24 @@
 // lgraph includes
 #include <lgraph/graph_traversal/traversal_wx.hpp>
 #include <lgraph/metrics/centralities_wx.hpp>
+#include <lgraph/metrics/distance_bounds.hpp>
 
 namespace lgraph {
 namespace networks {
 namespace metrics {
 namespace distance {
 
-template<class T>
-T max_distance(const wxgraph<T> *G) {
-	std::vector<std::vector<T> > ds;
-	traversal::wxdistances(G, ds);
-	return max_distance(G, ds);
-}
-
-template<class T>
-T max_distance(const wxgraph<T> *G, const std::vector<std::vector<T> >& ds) {
+template<class T, class G_t>
+inline T generic_max_distance(const G_t *G, const std::vector<std::vector<T> >& ds) {
+	// in undirected graphs the distances are symmetric: only the
+	// pairs (i,j) with i < j are scanned
+	const bool directed = G->is_directed();
 	const size_t N = G->n_nodes();
 	T D = 0;
 	for (size_t i = 0; i < N; ++i) {
 		D = accumulate
 		(
-			ds[i].begin() + i + 1, ds[i].end(), D,
+			ds[i].begin() + (directed ? 0 : i + 1), ds[i].end(), D,
 			[](T M, T d) {
 				if (d != inf_t<T>()) {
 					M = std::max(M, d);
@@ -59,15 +56,38 @@ T max_distance(const wxgraph<T> *G, const std::vector<std::vector<T> >& ds) {
 	return D;
 }
 
-template<class T>
-double mean_distance(const wxgraph<T> *G) {
+template<class T, class G_t>
+inline void generic_diameter_radius(
+	const G_t *G, bool with_radius, T& D, T& R,
+	std::vector<T> *ecc_lo, std::vector<T> *ecc_hi
+)
+{
+	std::vector<T> local_lo, local_hi;
+	bounding_diameters(G,
+		[&](node s, traversal::workspace<T>& W) -> void {
+			traversal::wxdistance(G, s, W);
+		},
+		with_radius, D, R,
+		(ecc_lo == nullptr ? local_lo : *ecc_lo),
+		(ecc_hi == nullptr ? local_hi : *ecc_hi)
+	);
+}
+
+template<class T, class G_t>
+inline T generic_max_distance(const G_t *G) {
+	if (not G->is_directed()) {
+		T D, R;
+		generic_diameter_radius<T>(G, false, D, R, nullptr, nullptr);
+		return D;
+	}
+
 	std::vector<std::vector<T> > ds;
 	traversal::wxdistances(G, ds);
-	return mean_distance(G, ds);
+	return generic_max_distance(G, ds);
 }
 
-template<class T>
-double mean_distance(const wxgraph<T> *G, const std::vector<std::vector<T> >& ds) {
+template<class T, class G_t>
+inline double generic_mean_distance(const G_t *G, const std::vector<std::vector<T> >& ds) {
 	const size_t N = G->n_nodes();
 	double m = 0;
 	for (size_t i = 0; i < N; ++i) {
@@ -91,6 +111,71 @@ double mean_distance(const wxgraph<T> *G, const std::vector<std::vector<T> >& ds
 	return m/N;
 }
 
+template<class T, class G_t>
+inline double generic_mean_distance(const G_t *G) {
+	std::vector<std::vector<T> > ds;
+	traversal::wxdistances(G, ds);
+	return generic_mean_distance(G, ds);
+}
+
+template<class T>
+T max_distance(const wxgraph<T> *G) {
+	return generic_max_distance<T>(G);
+}
+
+template<class T>
+T max_distance(const wxgraph<T> *G, const std::vector<std::vector<T> >& ds) {
+	return generic_max_distance(G, ds);
+}
+
+template<class T>
+T max_distance(const csr_wxgraph<T> *G) {
+	return generic_max_distance<T>(G);
+}
+
+template<class T>
+T max_distance(const csr_wxgraph<T> *G, const std::vector<std::vector<T> >& ds) {
+	return generic_max_distance(G, ds);
+}
+
+template<class T>
+void diameter_radius(
+	const wxgraph<T> *G, T& D, T& R,
+	std::vector<T> *ecc_lo, std::vector<T> *ecc_hi
+)
+{
+	generic_diameter_radius(G, true, D, R, ecc_lo, ecc_hi);
+}
+
+template<class T>
+void diameter_radius(
+	const csr_wxgraph<T> *G, T& D, T& R,
+	std::vector<T> *ecc_lo, std::vector<T> *ecc_hi
+)
+{
+	generic_diameter_radius(G, true, D, R, ecc_lo, ecc_hi);
+}
+
+template<class T>
+double mean_distance(const wxgraph<T> *G) {
+	return generic_mean_distance<T>(G);
+}
+
+template<class T>
+double mean_distance(const wxgraph<T> *G, const std::vector<std::vector<T> >& ds) {
+	return generic_mean_distance(G, ds);
+}
+
+template<class T>
+double mean_distance(const csr_wxgraph<T> *G) {
+	return generic_mean_distance<T>(G);
+}
+
+template<class T>
+double mean_distance(const csr_wxgraph<T> *G, const std::vector<std::vector<T> >& ds) {
+	return generic_mean_distance(G, ds);
+}
+
 } // -- namespace distance
 } // -- namespace metrics
 } // -- namespace networks
@@ -25,6 +25,7 @@
 #include <vector>
 
 // lgraph includes
+#include <lgraph/data_structures/csr_wxgraph.hpp>
 #include <lgraph/data_structures/wxgraph.hpp>
 
 namespace lgraph {
@@ -38,7 +39,9 @@ namespace distance {
 /**
  * @brief Diameter of a graph.
  *
- * Computes the distance between all pairs of nodes.
+ * In undirected graphs, bounds the eccentricities of the nodes with a
+ * few runs of Dijkstra's algorithm (see @ref diameter_radius(const wxgraph<T>*, T&, T&, std::vector<T>*, std::vector<T>*)).
+ * In directed graphs, computes the distance between all pairs of nodes.
  *
  * @param G The weighted graph to be evaluated.
  * @return Returns the largest distance between all pairs of nodes.
@@ -58,6 +61,32 @@ T max_distance(const wxgraph<T> *G);
 template<class T>
 T max_distance(const wxgraph<T> *G, const std::vector<std::vector<T> >& ds);
 
+/**
+ * @brief Diameter and radius of an undirected graph.
+ *
+ * The eccentricity of a node is the largest distance to the nodes
+ * reachable from it. The diameter is the largest eccentricity and the
+ * radius the smallest. Instead of running Dijkstra's algorithm from
+ * every node, a double sweep gives a lower bound of the diameter, and
+ * every further run bounds the eccentricities of the nodes it reaches.
+ * Only the nodes whose bounds could still change the diameter or the
+ * radius are traversed (see @ref bounding_diameters).
+ *
+ * @param[in] G The undirected weighted graph to be evaluated.
+ * @param[out] D The diameter of @e G.
+ * @param[out] R The radius of @e G.
+ * @param[out] ecc_lo If not null, a lower bound of the eccentricity of
+ * every node.
+ * @param[out] ecc_hi If not null, an upper bound of the eccentricity of
+ * every node.
+ * @pre @e G is undirected.
+ */
+template<class T>
+void diameter_radius(
+	const wxgraph<T> *G, T& D, T& R,
+	std::vector<T> *ecc_lo = nullptr, std::vector<T> *ecc_hi = nullptr
+);
+
 /**
  * @brief Mean distance between all pairs of nodes.
  *
@@ -81,6 +110,73 @@ double mean_distance(const wxgraph<T> *G);
 template<class T>
 double mean_distance(const wxgraph<T> *G, const std::vector<std::vector<T> >& ds);
 
+/* ---------------------------------------- */
+/* DISTANCES FOR COMPRESSED WEIGHTED GRAPHS */
+
+/**
+ * @brief Diameter of a graph.
+ *
+ * See @ref max_distance(const wxgraph<T>*).
+ *
+ * @param G The compressed weighted graph to be evaluated.
+ * @return Returns the largest distance between all pairs of nodes.
+ */
+template<class T>
+T max_distance(const csr_wxgraph<T> *G);
+/**
+ * @brief Diameter of a graph.
+ *
+ * See @ref max_distance(const wxgraph<T>*, const std::vector<std::vector<T> >&).
+ *
+ * @param G The compressed weighted graph to be evaluated.
+ * @param ds @e ds[u][v] contains the distance between nodes @e u and @e v.
+ * @return Returns the largest distance between all pairs of nodes.
+ */
+template<class T>
+T max_distance(const csr_wxgraph<T> *G, const std::vector<std::vector<T> >& ds);
+
+/**
+ * @brief Diameter and radius of an undirected graph.
+ *
+ * See @ref diameter_radius(const wxgraph<T>*, T&, T&, std::vector<T>*, std::vector<T>*).
+ *
+ * @param[in] G The undirected compressed weighted graph to be evaluated.
+ * @param[out] D The diameter of @e G.
+ * @param[out] R The radius of @e G.
+ * @param[out] ecc_lo If not null, a lower bound of the eccentricity of
+ * every node.
+ * @param[out] ecc_hi If not null, an upper bound of the eccentricity of
+ * every node.
+ * @pre @e G is undirected.
+ */
+template<class T>
+void diameter_radius(
+	const csr_wxgraph<T> *G, T& D, T& R,
+	std::vector<T> *ecc_lo = nullptr, std::vector<T> *ecc_hi = nullptr
+);
+
+/**
+ * @brief Mean distance between all pairs of nodes.
+ *
+ * See @ref mean_distance(const wxgraph<T>*).
+ *
+ * @param G The compressed weighted graph to be evaluated.
+ * @return Returns the average of the distance between all pairs of nodes.
+ */
+template<class T>
+double mean_distance(const csr_wxgraph<T> *G);
+/**
+ * @brief Mean distance between all pairs of nodes.
+ *
+ * See @ref mean_distance(const wxgraph<T>*, const std::vector<std::vector<T> >&).
+ *
+ * @param G The compressed weighted graph to be evaluated.
+ * @param ds @e ds[u][v] contains the distance between nodes @e u and @e v.
+ * @return Returns the average of the distance between all pairs of nodes.
+ */
+template<class T>
+double mean_distance(const csr_wxgraph<T> *G, const std::vector<std::vector<T> >& ds);
+
 } // -- namespace distance
 } // -- namespace metrics
 } // -- namespace networks
@@ -24,6 +24,7 @@
 // C++ includes
 #include <cstdint>
 #include <limits>
+#include <type_traits>
 #include <vector>
 
 // lgraph includes
@@ -51,6 +52,28 @@ template<class T> inline void UNUSED(const T& t) { (void)t; }
 /// Shorthand for the maximum value of any type.
 template<typename T> inline T inf_t() { return std::numeric_limits<T>::max(); }
 
+/// Equality of integral path lengths: exact.
+template<typename T>
+inline bool equal_lengths(const T& a, const T& b, std::true_type) {
+	return a == b;
+}
+/// Equality of floating-point path lengths: up to a tolerance of 1e-5.
+template<typename T>
+inline bool equal_lengths(const T& a, const T& b, std::false_type) {
+	return (a < b ? b - a : a - b) <= static_cast<T>(1.0e-5);
+}
+/**
+ * @brief Whether two path lengths are equal.
+ *
+ * Used to detect ties between shortest paths. Integral lengths (of
+ * unsigned types too) are compared exactly, and floating-point lengths
+ * with a tolerance of 1e-5.
+ */
+template<typename T>
+inline bool equal_lengths(const T& a, const T& b) {
+	return equal_lengths(a, b, std::is_integral<T>());
+}
+
 /**
  * @brief Typedef for the type of weight in unweighted graphs.
  *
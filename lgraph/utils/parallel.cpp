@@ -0,0 +1,95 @@
+/*********************************************************************
+ * lgraph
+ * Copyright (C) 2018-2019 Lluís Alemany Puig
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ * 
+ * Contact: Lluís Alemany Puig (lluis.alemany.puig@gmail.com)
+ * 
+ ********************************************************************/
+
+
+#include <lgraph/utils/parallel.hpp>
+
+// C++ includes
+#include <algorithm>
+#include <thread>
+
+namespace lgraph {
+namespace utils {
+
+size_t n_threads_used(size_t n_threads, size_t n_tasks) {
+	if (n_threads == 0) {
+		n_threads = std::thread::hardware_concurrency();
+	}
+	return std::max<size_t>(1, std::min(n_threads, n_tasks));
+}
+
+/* WORK-STEALING SCHEDULER */
+
+work_stealing_scheduler::work_stealing_scheduler(size_t n_tasks, size_t n_threads)
+	: m_ranges(n_threads)
+{
+	// split the tasks into ranges of (almost) equal size
+	for (size_t t = 0; t < n_threads; ++t) {
+		m_ranges[t].begin = (t*n_tasks)/n_threads;
+		m_ranges[t].end = ((t + 1)*n_tasks)/n_threads;
+	}
+}
+
+bool work_stealing_scheduler::next(size_t tid, size_t& task) {
+	task_range& own = m_ranges[tid];
+
+	own.m.lock();
+	if (own.begin < own.end) {
+		task = own.begin++;
+		own.m.unlock();
+		return true;
+	}
+	own.m.unlock();
+
+	// no tasks left in this thread's range
+	return steal(tid, task);
+}
+
+bool work_stealing_scheduler::steal(size_t tid, size_t& task) {
+	const size_t n_threads = m_ranges.size();
+
+	for (size_t k = 1; k < n_threads; ++k) {
+		task_range& victim = m_ranges[(tid + k)%n_threads];
+
+		victim.m.lock();
+		if (victim.begin == victim.end) {
+			victim.m.unlock();
+			continue;
+		}
+		// take the upper half of the victim's range, rounded up
+		const size_t end = victim.end;
+		const size_t begin = victim.end - (victim.end - victim.begin + 1)/2;
+		victim.end = begin;
+		victim.m.unlock();
+
+		task_range& own = m_ranges[tid];
+		own.m.lock();
+		task = begin;
+		own.begin = begin + 1;
+		own.end = end;
+		own.m.unlock();
+		return true;
+	}
+	return false;
+}
+
+} // -- namespace utils
+} // -- namespace lgraph
@@ -0,0 +1,123 @@
+/*********************************************************************
+ * lgraph
+ * Copyright (C) 2018-2019 Lluís Alemany Puig
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ * 
+ * Contact: Lluís Alemany Puig (lluis.alemany.puig@gmail.com)
+ * 
+ ********************************************************************/
+
+
+#pragma once
+
+// C++ includes
+#include <mutex>
+#include <vector>
+
+namespace lgraph {
+namespace utils {
+
+/**
+ * @brief Number of threads used to carry out @e n_tasks tasks.
+ *
+ * @param n_threads Number of threads requested. If it is 0 then the
+ * number of concurrent threads supported by the hardware is used.
+ * @param n_tasks Number of tasks to be carried out.
+ * @return Returns the number of threads that will actually be used:
+ * never more than @e n_tasks and at least 1.
+ */
+size_t n_threads_used(size_t n_threads, size_t n_tasks);
+
+/**
+ * @brief Work-stealing scheduler of independent tasks.
+ *
+ * The tasks, identified by the integers in [0, @e n_tasks), are split
+ * into as many contiguous ranges as threads. Each thread takes the tasks
+ * of its own range in increasing order. When its range is empty, the
+ * thread steals the upper half of the range of another thread.
+ */
+class work_stealing_scheduler {
+	private:
+		/// Range of tasks [begin, end) owned by a thread.
+		struct task_range {
+			/// Mutual exclusion for the owner and the thieves.
+			std::mutex m;
+			/// First task of the range.
+			size_t begin = 0;
+			/// Task after the last task of the range.
+			size_t end = 0;
+			/// Avoid false sharing between ranges of different threads.
+			char padding[64];
+		};
+
+	private:
+		/// The range of tasks of every thread.
+		std::vector<task_range> m_ranges;
+
+	private:
+		/**
+		 * @brief Steals tasks from another thread.
+		 *
+		 * Moves the upper half of the range of some other thread to
+		 * the range of thread @e tid.
+		 * @param tid Thread that steals.
+		 * @param[out] task The first task stolen.
+		 * @return Returns false if no range had tasks left.
+		 */
+		bool steal(size_t tid, size_t& task);
+
+	public:
+		/**
+		 * @brief Constructor.
+		 * @param n_tasks Number of tasks.
+		 * @param n_threads Number of threads, at least 1.
+		 */
+		work_stealing_scheduler(size_t n_tasks, size_t n_threads);
+
+		/**
+		 * @brief Next task of a thread.
+		 * @param tid The thread asking for work.
+		 * @param[out] task The task to be carried out by thread @e tid.
+		 * @return Returns false if there are no tasks left.
+		 */
+		bool next(size_t tid, size_t& task);
+};
+
+/**
+ * @brief Runs independent tasks in parallel.
+ *
+ * Calls @e f(tid, t) for every task @e t in [0, @e n_tasks), where
+ * @e tid in [0, @ref n_threads_used(n_threads, n_tasks)) identifies the
+ * thread that calls the function. The tasks are distributed with a
+ * @ref work_stealing_scheduler. The calling thread is one of the threads
+ * used, and no other thread is created when only one thread is used.
+ *
+ * Function @e f must be safe to call concurrently: in general, every
+ * task writes only to its own part of the output and every thread uses
+ * its own scratch memory, indexed by @e tid. The order in which the
+ * tasks are carried out is not deterministic, so a reduction over the
+ * tasks should be done afterwards following the order of the tasks.
+ *
+ * @param n_tasks Number of tasks.
+ * @param n_threads Number of threads requested (see @ref n_threads_used).
+ * @param f Function to carry out a task.
+ */
+template<class F>
+void parallel_for(size_t n_tasks, size_t n_threads, F f);
+
+} // -- namespace utils
+} // -- namespace lgraph
+
+#include <lgraph/utils/parallel_for.cpp>
@@ -0,0 +1,68 @@
+/*********************************************************************
+ * lgraph
+ * Copyright (C) 2018-2019 Lluís Alemany Puig
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ * 
+ * Contact: Lluís Alemany Puig (lluis.alemany.puig@gmail.com)
+ * 
+ ********************************************************************/
+
+
+#include <lgraph/utils/parallel.hpp>
+
+// C++ includes
+#include <thread>
+#include <vector>
+
+namespace lgraph {
+namespace utils {
+
+template<class F>
+void parallel_for(size_t n_tasks, size_t n_threads, F f) {
+	n_threads = n_threads_used(n_threads, n_tasks);
+
+	if (n_threads == 1) {
+		// no need to create any thread
+		for (size_t t = 0; t < n_tasks; ++t) {
+			f(0, t);
+		}
+		return;
+	}
+
+	work_stealing_scheduler scheduler(n_tasks, n_threads);
+	auto work =
+	[&scheduler, &f](size_t tid) -> void
+	{
+		size_t t;
+		while (scheduler.next(tid, t)) {
+			f(tid, t);
+		}
+	};
+
+	// the calling thread is thread 0
+	std::vector<std::thread> threads;
+	threads.reserve(n_threads - 1);
+	for (size_t tid = 1; tid < n_threads; ++tid) {
+		threads.emplace_back(work, tid);
+	}
+	work(0);
+
+	for (std::thread& th : threads) {
+		th.join();
+	}
+}
+
+} // -- namespace utils
+} // -- namespace lgraph
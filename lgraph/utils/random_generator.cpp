@@ -38,6 +38,11 @@ void random_generator<G,T>::seed_random_engine() {
 	gen = G(r());
 }
 
+template<class G, typename T>
+void random_generator<G,T>::seed_random_engine(typename G::result_type seed) {
+	gen = G(seed);
+}
+
 } // -- namespace utils
 } // -- namespace lgraph
 
@@ -35,7 +35,8 @@ namespace utils {
  *
  * Interface for random number generators using the C++11 header \<random\>.
  *
- * Seed the random engine calling method @ref seed_random_engine().
+ * Seed the random engine calling method @ref seed_random_engine(), either
+ * with a non-deterministic seed or with a given one.
  *
  * Initialise whatever distribution is needed with the appropriate
  * method:
@@ -67,6 +68,15 @@ class random_generator {
 		
 		/// Initialises the random engine.
 		virtual void seed_random_engine();
+
+		/**
+		 * @brief Initialises the random engine with a given seed.
+		 *
+		 * Two generators seeded with the same value generate the
+		 * same sequence of numbers.
+		 * @param seed The seed of the random engine.
+		 */
+		virtual void seed_random_engine(typename G::result_type seed);
 		
 		/**
 		 * @brief Initialise the uniform distribution.
@@ -25,66 +25,100 @@
 #include <stdlib.h>
 #include <string.h>
 
+// C++ includes
+#include <utility>
+
 // MACROS
 
-#define __uns_char__ unsigned char
+#define mod_64(i) ((i) & 0x3f)
+#define div_64(i) ((i) >> 6)
 
-#define mod_8(i) (i & 0x07)
-#define div_8(i) (i >> 3)
-#define is_div_8(i) (mod_8(i) == 0x00)
+// returns the word where the i-th bit is located at
+#define word(i) div_64(i)
+// returns a word with only the bit corresponding to the i-th bit set
+#define bit_mask(i) (uint64_t(1) << mod_64(i))
 
-// ordinary system: 0123 4567 89...
-// binary system:   7654 3210 76..
+// number of words needed to store b bits
+#define words_for(b) (div_64(b) + (mod_64(b) != 0))
+// number of bytes needed to store b bits
+#define bytes_for(b) (((b) >> 3) + (((b) & 0x07) != 0))
 
-// returns the byte where the i-th bit (in ordinary system) is located at
-#define byte(i) div_8(i)
+inline size_t popcount(uint64_t w) {
+	return static_cast<size_t>(__builtin_popcountll(w));
+}
 
-// returns the corresponding bit position (in ordinary system) of the
-// corresponding byte in binary system
-#define bit_pos(i) (7 - mod_8(i))
+inline size_t ctz(uint64_t w) {
+	return static_cast<size_t>(__builtin_ctzll(w));
+}
 
-// returns the byte corresponding to the i-th bit (in ordinary system)
-// with the corresponding bit b set to the specified value
-#define   _set_bit(val, i) static_cast<__uns_char__>(val |  (1 << bit_pos(mod_8(i))))
-#define _unset_bit(val, i) static_cast<__uns_char__>(val & ~(1 << bit_pos(mod_8(i))))
+// Bytes are read and written with the first bit in the most
+// significant position, while words store the first bit in the
+// least significant position.
+inline unsigned char reverse_byte(unsigned char b) {
+	b = static_cast<unsigned char>(((b & 0xf0) >> 4) | ((b & 0x0f) << 4));
+	b = static_cast<unsigned char>(((b & 0xcc) >> 2) | ((b & 0x33) << 2));
+	b = static_cast<unsigned char>(((b & 0xaa) >> 1) | ((b & 0x55) << 1));
+	return b;
+}
 
-// returns the i-th bit's value
-#define get_bit(val, i) ((val & (0x80 >> mod_8(i))) >> bit_pos(i))
+// returns the k-th byte (bits 8k..8k+7) in the byte order
+inline unsigned char get_byte(const uint64_t *words, size_t k) {
+	const size_t shift = 8*(k & 0x07);
+	return reverse_byte(static_cast<unsigned char>(words[k >> 3] >> shift));
+}
 
-// returns the last byte's bits: if we use this class to store eleven
-// bits then the last byte's bits are:  111* **** and returns 0000 0111
-#define last_byte(val, nbits) (val >> (8 - mod_8(nbits)))
+// sets the k-th byte (bits 8k..8k+7) given in the byte order
+inline void set_byte(uint64_t *words, size_t k, unsigned char b) {
+	const size_t shift = 8*(k & 0x07);
+	uint64_t& w = words[k >> 3];
+	w &= ~(uint64_t(0xff) << shift);
+	w |= uint64_t(reverse_byte(b)) << shift;
+}
+
+namespace lgraph {
+namespace utils {
 
 // PRIVATE
 
-// PUBLIC
+void static_bitset::clear_padding() {
+	if (mod_64(n_bits) != 0) {
+		words[n_words - 1] &= bit_mask(n_bits) - 1;
+	}
+}
 
-namespace lgraph {
-namespace utils {
+// PUBLIC
 
 static_bitset::static_bitset() {
-	bytes = nullptr;
-	n_bytes = n_bits = 0;
+	words = nullptr;
+	n_words = n_bits = 0;
 }
 
 static_bitset::static_bitset(const std::string& bs) {
-	bytes = nullptr;
-	n_bytes = n_bits = 0;
+	words = nullptr;
+	n_words = n_bits = 0;
 	init_01(bs);
 }
 
 static_bitset::static_bitset(const std::vector<bool>& bits) {
-	bytes = nullptr;
-	n_bytes = n_bits = 0;
+	words = nullptr;
+	n_words = n_bits = 0;
 	init_01(bits);
 }
 
 static_bitset::static_bitset(const static_bitset& bs) {
-	bytes = nullptr;
-	n_bytes = n_bits = 0;
+	words = nullptr;
+	n_words = n_bits = 0;
 	*this = bs;
 }
 
+static_bitset::static_bitset(static_bitset&& bs) {
+	words = bs.words;
+	n_words = bs.n_words;
+	n_bits = bs.n_bits;
+	bs.words = nullptr;
+	bs.n_words = bs.n_bits = 0;
+}
+
 static_bitset::~static_bitset() {
 	clear();
 }
@@ -92,45 +126,50 @@ static_bitset::~static_bitset() {
 // INITIALIZERS
 
 void static_bitset::init(size_t b) {
-	// k_bytes = # bytes to be reserved
-	size_t k_bytes = (is_div_8(b) ? div_8(b) : div_8(b) + 1);
+	// k_words = # words to be reserved
+	size_t k_words = words_for(b);
 
-	// if we already have as many bytes as k_bytes do nothing
-	if (n_bytes == k_bytes) {
+	// if we already have as many words as k_words do nothing
+	if (n_words == k_words) {
 		n_bits = b;
+		if (n_words > 0) {
+			clear_padding();
+		}
 	}
 	else {
 		// destroy the currently used memory if necessary ...
-		if (bytes != nullptr) {
+		if (words != nullptr) {
 			clear();
 		}
 
 		// ... and reserve the new space
 		n_bits = b;
-		n_bytes = k_bytes;
-		bytes = static_cast<__uns_char__ *>(malloc(n_bytes*sizeof(unsigned char)));
+		n_words = k_words;
+		words = static_cast<uint64_t *>(malloc(n_words*sizeof(uint64_t)));
+
+		// the new memory is uninitialised: clear the last word
+		// instead of masking it, so that its padding is zero
+		if (n_words > 0) {
+			words[n_words - 1] = 0;
+		}
 	}
 }
 
 void static_bitset::init_set(size_t n_bits) {
 	init(n_bits);
-	for (size_t i = 0; i < n_bytes; ++i) {
-		bytes[i] = 0xff;
-	}
+	set_all();
 }
 
 void static_bitset::init_unset(size_t n_bits) {
 	init(n_bits);
-	for (size_t i = 0; i < n_bytes; ++i) {
-		bytes[i] = 0;
-	}
+	unset_all();
 }
 
 void static_bitset::init_01(const std::string& zerones) {
 	init_unset(zerones.length());
 	for (size_t i = 0; i < n_bits; ++i) {
 		if (zerones[i] == '1') {
-			bytes[byte(i)] = _set_bit(bytes[byte(i)], i);
+			words[word(i)] |= bit_mask(i);
 		}
 	}
 }
@@ -139,55 +178,65 @@ void static_bitset::init_01(const std::vector<bool>& bits) {
 	init_unset(bits.size());
 	for (size_t i = 0; i < n_bits; ++i) {
 		if (bits[i]) {
-			bytes[byte(i)] = _set_bit(bytes[byte(i)], i);
+			words[word(i)] |= bit_mask(i);
 		}
 	}
 }
 
 void static_bitset::init_bytes(const std::vector<char>& bts) {
-	init(8*bts.size());
-	for (size_t i = 0; i < n_bytes; ++i) {
-		bytes[i] = static_cast<__uns_char__>(bts[i]);
+	init_unset(8*bts.size());
+	for (size_t k = 0; k < bts.size(); ++k) {
+		set_byte(words, k, static_cast<unsigned char>(bts[k]));
 	}
 }
 
 void static_bitset::init_bytes(const std::string& bts) {
-	init(8*bts.length());
-	for (size_t i = 0; i < n_bytes; ++i) {
-		bytes[i] = static_cast<__uns_char__>(bts[i]);
+	init_unset(8*bts.length());
+	for (size_t k = 0; k < bts.length(); ++k) {
+		set_byte(words, k, static_cast<unsigned char>(bts[k]));
 	}
 }
 
 void static_bitset::clear() {
-	if (bytes != nullptr) {
-		free(bytes);
-		bytes = nullptr;
+	if (words != nullptr) {
+		free(words);
+		words = nullptr;
 	}
+	n_words = n_bits = 0;
 }
 
 // OPERATORS
 
 static_bitset& static_bitset::operator= (const static_bitset& bs) {
+	if (this == &bs) {
+		return *this;
+	}
 	init(bs.n_bits);
-	bytes = static_cast<__uns_char__ *>(
-		memcpy(
-			static_cast<void *>(bytes),
-			static_cast<void *>(bs.bytes),
-			n_bytes
-		)
-	);
+	if (n_words > 0) {
+		memcpy(words, bs.words, n_words*sizeof(uint64_t));
+	}
+	return *this;
+}
+
+static_bitset& static_bitset::operator= (static_bitset&& bs) {
+	if (this != &bs) {
+		clear();
+		swap(bs);
+	}
 	return *this;
 }
 
 bool static_bitset::operator[] (size_t i) const {
-	return get_bit(bytes[byte(i)], i);
+	return (words[word(i)] & bit_mask(i)) != 0;
 }
 
 static_bitset static_bitset::operator<= (const static_bitset& bs) const {
-	static_bitset copy = *this;
-	for (size_t b = 0; b < n_bytes; ++b) {
-		copy.bytes[b] = ~bytes[b] | bs.bytes[b];
+	static_bitset copy;
+	copy.init(n_bits);
+	for (size_t w = 0; w < n_words; ++w) {
+		copy.words[w] = ~words[w] | bs.words[w];
 	}
+	copy.clear_padding();
 	return copy;
 }
 
@@ -198,103 +247,140 @@ static_bitset static_bitset::operator~ () const {
 }
 
 static_bitset static_bitset::operator- (const static_bitset& bs) const {
-	static_bitset copy = *this;
-	copy -= bs;
+	static_bitset copy;
+	copy.assign_difference(*this, bs);
 	return copy;
 }
 
 static_bitset static_bitset::operator& (const static_bitset& bs) const {
-	static_bitset copy = *this;
-	copy &= bs;
+	static_bitset copy;
+	copy.assign_and(*this, bs);
 	return copy;
 }
 
 static_bitset static_bitset::operator| (const static_bitset& bs) const {
-	static_bitset copy = *this;
-	copy |= bs;
+	static_bitset copy;
+	copy.assign_or(*this, bs);
 	return copy;
 }
+
 static_bitset static_bitset::operator^ (const static_bitset& bs) const {
-	static_bitset copy = *this;
-	copy ^= bs;
+	static_bitset copy;
+	copy.assign_xor(*this, bs);
 	return copy;
 }
 
 static_bitset static_bitset::operator== (const static_bitset& bs) const {
-	static_bitset copy = *this;
-	for (size_t b = 0; b < n_bytes; ++b) {
-		copy.bytes[b] = ~(bytes[b]^bs.bytes[b]);
+	static_bitset copy;
+	copy.init(n_bits);
+	for (size_t w = 0; w < n_words; ++w) {
+		copy.words[w] = ~(words[w]^bs.words[w]);
 	}
+	copy.clear_padding();
 	return copy;
 }
 
 static_bitset& static_bitset::operator-= (const static_bitset& bs) {
-	for (size_t b = 0; b < n_bytes; ++b) {
-		bytes[b] &= ~bs.bytes[b];
+	for (size_t w = 0; w < n_words; ++w) {
+		words[w] &= ~bs.words[w];
 	}
 	return *this;
 }
 
 static_bitset& static_bitset::operator&= (const static_bitset& bs) {
-	for (size_t b = 0; b < n_bytes; ++b) {
-		bytes[b] &= bs.bytes[b];
+	for (size_t w = 0; w < n_words; ++w) {
+		words[w] &= bs.words[w];
 	}
 	return *this;
 }
 
 static_bitset& static_bitset::operator|= (const static_bitset& bs) {
-	for (size_t b = 0; b < n_bytes; ++b) {
-		bytes[b] |= bs.bytes[b];
+	for (size_t w = 0; w < n_words; ++w) {
+		words[w] |= bs.words[w];
 	}
 	return *this;
 }
 
 static_bitset& static_bitset::operator^= (const static_bitset& bs) {
-	for (size_t b = 0; b < n_bytes; ++b) {
-		bytes[b] ^= bs.bytes[b];
+	for (size_t w = 0; w < n_words; ++w) {
+		words[w] ^= bs.words[w];
 	}
 	return *this;
 }
 
 static_bitset& static_bitset::operator+= (char k) {
+	const size_t n_bytes = bytes_for(n_bits);
 	for (size_t b = 0; b < n_bytes; ++b) {
-		bytes[b] += k;
+		set_byte(words, b, static_cast<unsigned char>(get_byte(words, b) + k));
 	}
+	clear_padding();
 	return *this;
 }
 
+void static_bitset::assign_and(const static_bitset& a, const static_bitset& b) {
+	init(a.n_bits);
+	for (size_t w = 0; w < n_words; ++w) {
+		words[w] = a.words[w] & b.words[w];
+	}
+}
+
+void static_bitset::assign_or(const static_bitset& a, const static_bitset& b) {
+	init(a.n_bits);
+	for (size_t w = 0; w < n_words; ++w) {
+		words[w] = a.words[w] | b.words[w];
+	}
+}
+
+void static_bitset::assign_xor(const static_bitset& a, const static_bitset& b) {
+	init(a.n_bits);
+	for (size_t w = 0; w < n_words; ++w) {
+		words[w] = a.words[w] ^ b.words[w];
+	}
+}
+
+void static_bitset::assign_difference(const static_bitset& a, const static_bitset& b) {
+	init(a.n_bits);
+	for (size_t w = 0; w < n_words; ++w) {
+		words[w] = a.words[w] & ~b.words[w];
+	}
+}
+
 // SETTERS
 
 void static_bitset::set_all() {
-	for (size_t i = 0; i < n_bytes; ++i) {
-		bytes[i] = 0xff;
+	if (n_words > 0) {
+		memset(words, 0xff, n_words*sizeof(uint64_t));
+		clear_padding();
 	}
 }
 
 void static_bitset::unset_all() {
-	for (size_t i = 0; i < n_bytes; ++i) {
-		bytes[i] = 0;
+	if (n_words > 0) {
+		memset(words, 0, n_words*sizeof(uint64_t));
 	}
 }
 
 void static_bitset::set_bit(size_t i) {
-	bytes[byte(i)] = _set_bit(bytes[byte(i)], i);
+	words[word(i)] |= bit_mask(i);
 }
 
 void static_bitset::unset_bit(size_t i) {
-	bytes[byte(i)] = _unset_bit(bytes[byte(i)], i);
+	words[word(i)] &= ~bit_mask(i);
 }
 
 void static_bitset::flip() {
-	for (size_t b = 0; b < n_bytes; ++b) {
-		bytes[b] = ~bytes[b];
+	for (size_t w = 0; w < n_words; ++w) {
+		words[w] = ~words[w];
+	}
+	if (n_words > 0) {
+		clear_padding();
 	}
 }
 
 void static_bitset::swap(static_bitset& bs) {
-	for (size_t b = 0; b < n_bytes; ++b) {
-		std::swap(bytes[b], bs.bytes[b]);
-	}
+	std::swap(words, bs.words);
+	std::swap(n_words, bs.n_words);
+	std::swap(n_bits, bs.n_bits);
 }
 
 // GETTERS
@@ -304,186 +390,124 @@ size_t static_bitset::size() const {
 }
 
 bool static_bitset::equal(const static_bitset& bs) const {
-	size_t b = 0;
-	size_t check_last = mod_8(n_bits) != 0;
-
-	while ((b < n_bytes - check_last) and bytes[b] == bs.bytes[b]) {
-		++b;
-	}
-
-	if (check_last == 0) {
-		//if (b < n_bytes) return false;
-		//return true;
-		return b >= n_bytes;
-	}
-	if (b < n_bytes - check_last) {
-		return false;
+	for (size_t w = 0; w < n_words; ++w) {
+		if (words[w] != bs.words[w]) {
+			return false;
+		}
 	}
-
-	unsigned char last_this = last_byte(bytes[n_bytes - 1], n_bits);
-	unsigned char last_bs = last_byte(bs.bytes[bs.n_bytes - 1], n_bits);
-	return last_this == last_bs;
+	return true;
 }
 
 bool static_bitset::included(const static_bitset& bs) const {
-	unsigned char IN = 0xff;
-	size_t b = 0;
-	size_t check_last = mod_8(n_bits) != 0;
-
-	while ((b < n_bytes - check_last) and IN == 0xff) {
-		IN = (~bytes[b] | bs.bytes[b]);
-		++b;
-	}
-
-	if (IN != 0xff) {
-		return false;
-	}
-	if (check_last == 0) {
-		return IN;
+	for (size_t w = 0; w < n_words; ++w) {
+		if ((words[w] & ~bs.words[w]) != 0) {
+			return false;
+		}
 	}
-
-	unsigned char last_this = last_byte(bytes[n_bytes - 1], n_bits);
-	unsigned char last_bs = last_byte(bs.bytes[bs.n_bytes - 1], n_bits);
-	unsigned char last_bits_mask = 0xff >> (8 - mod_8(n_bits));
-	return ((~last_this | last_bs) & last_bits_mask) == last_bits_mask;
+	return true;
 }
 
 bool static_bitset::all() const {
-	size_t b = 0;
-	size_t check_last = mod_8(n_bits) != 0;
-
-	while ((b < n_bytes - check_last) and bytes[b] == 0xff) {
-		++b;
-	}
-
-	if (check_last == 0) {
-		//if (b < n_bytes) return false;
-		//return true;
-		return b >= n_bytes;
+	if (n_words == 0) {
+		return true;
 	}
-	if (b < n_bytes - check_last) {
-		return false;
+	for (size_t w = 0; w < n_words - 1; ++w) {
+		if (words[w] != ~uint64_t(0)) {
+			return false;
+		}
 	}
-
-	unsigned char last = last_byte(bytes[n_bytes - 1], n_bits);
-	unsigned char sign = static_cast<__uns_char__>(1 << mod_8(n_bits)) - 1;
-	return last == sign;
+	const uint64_t last =
+		(mod_64(n_bits) == 0 ? ~uint64_t(0) : bit_mask(n_bits) - 1);
+	return words[n_words - 1] == last;
 }
 
 bool static_bitset::any() const {
-	size_t b = 0;
-	size_t check_last = size_t(mod_8(n_bits) != 0);
-
-	while ((b < n_bytes - check_last) and bytes[b] == 0x00) {
-		++b;
-	}
-
-	if (check_last == 0) {
-		//if (b < n_bytes) return true;
-		//return false;
-		return b < n_bytes;
-	}
-	if (b < n_bytes - check_last) {
-		return true;
+	for (size_t w = 0; w < n_words; ++w) {
+		if (words[w] != 0) {
+			return true;
+		}
 	}
-
-	// the last byte may no be complete: 9 bits are: 1 byte and 1 bit
-	return last_byte(bytes[n_bytes - 1], n_bits) != 0x00;
+	return false;
 }
 
 bool static_bitset::none() const {
-	size_t b = 0;
-	size_t check_last = mod_8(n_bits) != 0;
-
-	while ((b < n_bytes - check_last) and bytes[b] == 0x00) {
-		++b;
-	}
-
-	if (check_last == 0) {
-		//if (b < n_bytes) return false;
-		//return true;
-		return b == n_bytes;
-	}
-	if (b < n_bytes - check_last) {
-		return false;
-	}
-
-	// the last byte may no be complete: 9 bits are: 1 byte and 1 bit
-	return last_byte(bytes[n_bytes - 1], n_bits) == 0x00;
+	return not any();
 }
 
 void static_bitset::which(std::vector<size_t>& w) const {
 	w.resize(0);
-	for (size_t b = 0; b < n_bits; ++b) {
-		if (get_bit(bytes[byte(b)], b)) {
-			w.push_back(b);
+	for (size_t k = 0; k < n_words; ++k) {
+		uint64_t bits = words[k];
+		while (bits != 0) {
+			w.push_back((k << 6) + ctz(bits));
+			// unset the lowest bit set
+			bits &= bits - 1;
 		}
 	}
 }
 
 size_t static_bitset::count() const {
-	const size_t rem = mod_8(n_bits);
-	const size_t check_last = rem != 0;
+	size_t c = 0;
+	for (size_t w = 0; w < n_words; ++w) {
+		c += popcount(words[w]);
+	}
+	return c;
+}
 
+size_t static_bitset::count_and(const static_bitset& bs) const {
 	size_t c = 0;
-	for (size_t b = 0; b < n_bytes - check_last; ++b) {
-		c +=	((0x80 & bytes[b]) >> 7) +
-				((0x40 & bytes[b]) >> 6) +
-				((0x20 & bytes[b]) >> 5) +
-				((0x10 & bytes[b]) >> 4) +
-				((0x08 & bytes[b]) >> 3) +
-				((0x04 & bytes[b]) >> 2) +
-				((0x02 & bytes[b]) >> 1) +
-				((0x01 & bytes[b]) >> 0);
-	}
-
-	unsigned char last = bytes[n_bytes - 1];
-
-	switch (rem) {
-		case 7: c += ((0x02 & last) >> 1); [[clang::fallthrough]];
-		case 6: c += ((0x04 & last) >> 2); [[clang::fallthrough]];
-		case 5: c += ((0x08 & last) >> 3); [[clang::fallthrough]];
-		case 4: c += ((0x10 & last) >> 4); [[clang::fallthrough]];
-		case 3: c += ((0x20 & last) >> 5); [[clang::fallthrough]];
-		case 2: c += ((0x40 & last) >> 6); [[clang::fallthrough]];
-		case 1: c += ((0x80 & last) >> 7); [[clang::fallthrough]];
-		default: break;
+	for (size_t w = 0; w < n_words; ++w) {
+		c += popcount(words[w] & bs.words[w]);
 	}
 	return c;
 }
 
-void static_bitset::get_01(std::string& s, const std::string& sep) const {
-	const size_t rem = mod_8(n_bits);
-	const size_t check_last = rem != 0;
+bool static_bitset::intersects(const static_bitset& bs) const {
+	for (size_t w = 0; w < n_words; ++w) {
+		if ((words[w] & bs.words[w]) != 0) {
+			return true;
+		}
+	}
+	return false;
+}
 
-	s = "";
-	for (size_t b = 0; b < n_bytes - check_last; ++b) {
-		s += char('0' + ((0x80 & bytes[b]) >> 7));
-		s += char('0' + ((0x40 & bytes[b]) >> 6));
-		s += char('0' + ((0x20 & bytes[b]) >> 5));
-		s += char('0' + ((0x10 & bytes[b]) >> 4));
-		s += char('0' + ((0x08 & bytes[b]) >> 3));
-		s += char('0' + ((0x04 & bytes[b]) >> 2));
-		s += char('0' + ((0x02 & bytes[b]) >> 1));
-		s += char('0' + ((0x01 & bytes[b]) >> 0));
-		s += sep;
+size_t static_bitset::find_first() const {
+	for (size_t w = 0; w < n_words; ++w) {
+		if (words[w] != 0) {
+			return (w << 6) + ctz(words[w]);
+		}
+	}
+	return n_bits;
+}
+
+size_t static_bitset::find_next(size_t i) const {
+	++i;
+	if (i >= n_bits) {
+		return n_bits;
 	}
 
-	if (rem == 0) {
-		// remove the last sep
-		s.pop_back();
+	// the rest of the word of the i-th bit
+	size_t w = word(i);
+	const uint64_t bits = words[w] & ~(bit_mask(i) - 1);
+	if (bits != 0) {
+		return (w << 6) + ctz(bits);
+	}
+	for (++w; w < n_words; ++w) {
+		if (words[w] != 0) {
+			return (w << 6) + ctz(words[w]);
+		}
 	}
+	return n_bits;
+}
 
-	unsigned char last = bytes[n_bytes - 1];
-	switch (rem) {
-		case 7: s += char('0' + ((0x02 & last) >> 1)); [[clang::fallthrough]];
-		case 6: s += char('0' + ((0x04 & last) >> 2)); [[clang::fallthrough]];
-		case 5: s += char('0' + ((0x08 & last) >> 3)); [[clang::fallthrough]];
-		case 4: s += char('0' + ((0x10 & last) >> 4)); [[clang::fallthrough]];
-		case 3: s += char('0' + ((0x20 & last) >> 5)); [[clang::fallthrough]];
-		case 2: s += char('0' + ((0x40 & last) >> 6)); [[clang::fallthrough]];
-		case 1: s += char('0' + ((0x80 & last) >> 7)); [[clang::fallthrough]];
-		default: break;
+void static_bitset::get_01(std::string& s, const std::string& sep) const {
+	s = "";
+	for (size_t i = 0; i < n_bits; ++i) {
+		if (i > 0 and (i & 0x07) == 0) {
+			// a separator every 8 bits
+			s += sep;
+		}
+		s += ((*this)[i] ? '1' : '0');
 	}
 }
 
@@ -494,35 +518,9 @@ std::string static_bitset::get_01(const std::string& sep) const {
 }
 
 void static_bitset::get_01(std::vector<bool>& v) const {
-	const size_t rem = mod_8(n_bits);
-	const size_t check_last = rem != 0;
-	size_t b8;
-
 	v.resize(n_bits, false);
-	for (size_t b = 0; b < n_bytes - check_last; ++b) {
-		b8 = b << 3;
-
-		v[b8    ] = ((0x80 & bytes[b]) >> 7);
-		v[b8 + 1] = ((0x40 & bytes[b]) >> 6);
-		v[b8 + 2] = ((0x20 & bytes[b]) >> 5);
-		v[b8 + 3] = ((0x10 & bytes[b]) >> 4);
-		v[b8 + 4] = ((0x08 & bytes[b]) >> 3);
-		v[b8 + 5] = ((0x04 & bytes[b]) >> 2);
-		v[b8 + 6] = ((0x02 & bytes[b]) >> 1);
-		v[b8 + 7] = ((0x01 & bytes[b]) >> 0);
-	}
-
-	b8 = 8*(n_bytes - 1);
-	unsigned char last = bytes[n_bytes - 1];
-	switch (rem) {
-		case 7: v[b8 + 6] = ((0x02 & last) >> 1); [[clang::fallthrough]];
-		case 6: v[b8 + 5] = ((0x04 & last) >> 2); [[clang::fallthrough]];
-		case 5: v[b8 + 4] = ((0x08 & last) >> 3); [[clang::fallthrough]];
-		case 4: v[b8 + 3] = ((0x10 & last) >> 4); [[clang::fallthrough]];
-		case 3: v[b8 + 2] = ((0x20 & last) >> 5); [[clang::fallthrough]];
-		case 2: v[b8 + 1] = ((0x40 & last) >> 6); [[clang::fallthrough]];
-		case 1: v[b8    ] = ((0x80 & last) >> 7); [[clang::fallthrough]];
-		default: break;
+	for (size_t i = 0; i < n_bits; ++i) {
+		v[i] = (*this)[i];
 	}
 }
 
@@ -533,15 +531,17 @@ std::vector<bool> static_bitset::get_01() const {
 }
 
 void static_bitset::append_bytes(std::string& s) const {
+	const size_t n_bytes = bytes_for(n_bits);
 	for (size_t k = 0; k < n_bytes; ++k) {
-		s += bytes[k];
+		s += static_cast<char>(get_byte(words, k));
 	}
 }
 
 void static_bitset::get_bytes(std::string& s) const {
+	const size_t n_bytes = bytes_for(n_bits);
 	s.resize(n_bytes);
 	for (size_t k = 0; k < n_bytes; ++k) {
-		s[k] = static_cast<char>(bytes[k]);
+		s[k] = static_cast<char>(get_byte(words, k));
 	}
 }
 
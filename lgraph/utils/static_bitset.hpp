@@ -21,15 +21,14 @@
 
 #pragma once
 
+// C includes
+#include <stdint.h>
+
 // C++ includes
 #include <fstream>
 #include <string>
 #include <vector>
 
-// The order of bits of a byte is the following
-// order: 7654 3210
-// byte:  0110 1001
-
 namespace lgraph {
 namespace utils {
 
@@ -40,20 +39,35 @@ namespace utils {
  * whose size must be known at compilation time.
  *
  * Basically, allows to store as many bits as indicated in one of the
- * @ref init methods. These bits are stored in a C array of elements
- * of type 'char'. For b bits
- *	* b <= 8, the bitset allocates 1 char,
- *	* 8 < b <= 16, the bitset allocates 2 chars,
- *	* 16 < b <= 24, the bitset allocates 3 chars,
+ * @ref init methods. These bits are stored in a C array of 64-bit
+ * words. For b bits
+ *	* b <= 64, the bitset allocates 1 word,
+ *	* 64 < b <= 128, the bitset allocates 2 words,
+ *	* 128 < b <= 192, the bitset allocates 3 words,
  *	* ...
  *
+ * The i-th bit is the (i mod 64)-th least significant bit of the
+ * (i div 64)-th word. The bits of the last word beyond @ref n_bits
+ * are always kept to 0, so that whole-word operations (counting,
+ * comparing, finding set bits) need no special treatment of the last
+ * word.
+ *
  * This class implements logical operations between two bitsets, like
  * the bit-wise and, or, xor, difference, equality, negation, ...
+ * Every binary operator has an in-place variant (@ref operator&=, ...)
+ * and a variant that stores the result of operating two bitsets into
+ * a third one (@ref assign_and, ...). These two do not allocate memory
+ * when this bitset already has the right size, and should be preferred
+ * over the operators that return a new bitset in performance-critical
+ * code.
  *
  * This class must be first initialised before its use, using one of
  * the @ref init methods.
  *
- * Assuming the bits store are 0110 1001, the
+ * Bitsets can also be read from and written to strings of bytes (see
+ * @ref init_bytes and @ref get_bytes). In these, the bits of a byte
+ * are ordered from the most significant to the least significant.
+ * Assuming the byte is 0110 1001, the
  *	* 0th bit is 0
  *	* 1st bit is 1
  *	* 2nd bit is 1
@@ -66,17 +80,7 @@ namespace utils {
  * If we interpreted '0110 1001' as a number in binary, then
  * there is a fundamental difference between this way of accessing the
  * bits and the way we would do it in base-2 numbers: the order is
- * reversed:
- *	* 0th bit is 1
- *	* 1st bit is 0
- *	* 2nd bit is 0
- *	* 3rd bit is 1
- *	* 4th bit is 0
- *	* 5th bit is 1
- *	* 6th bit is 1
- *	* 7th bit is 0
- *
- * However, a bitset is not a number in base 2.
+ * reversed. However, a bitset is not a number in base 2.
  *
  * In the following methods, it will be assumed that:
  *	* ~ represents the unary NOT operator
@@ -84,28 +88,34 @@ namespace utils {
  */
 class static_bitset {
 	private:
-		/// The number of bytes (or of chars) of this bitset.
-		size_t n_bytes;
+		/// The number of words of this bitset.
+		size_t n_words;
 		/// The number of bits this bitset stores.
 		size_t n_bits;
-		/// The bits of this bitset, grouped by bytes (chars).
-		unsigned char *bytes;
+		/// The bits of this bitset, grouped in 64-bit words.
+		uint64_t *words;
+
+	private:
+		/// Sets to 0 the bits of the last word beyond @ref n_bits.
+		void clear_padding();
 
 	public:
 		/// Empty constructor.
 		static_bitset();
 		/**
 		 * @brief Construct a bitset from a string of zeros and ones.
-		 * @ref bytes[i] = @e bs[i].
+		 * the i-th bit is @e bs[i].
 		 */
 		static_bitset(const std::string& bs);
 		/**
 		 * @brief Construct a bitset from a list of Boolean values.
-		 * @ref bytes[i] = @e bits[i].
+		 * the i-th bit is @e bits[i].
 		 */
 		static_bitset(const std::vector<bool>& bits);
 		/// Copy-constructor.
 		static_bitset(const static_bitset& bs);
+		/// Move-constructor.
+		static_bitset(static_bitset&& bs);
 		/// Destructor.
 		~static_bitset();
 
@@ -142,13 +152,13 @@ class static_bitset {
 		 *
 		 * Each character of the string is interpreted as a single bit.
 		 *
-		 * @ref bytes[i] = @e zerones[i].
+		 * the i-th bit is @e zerones[i].
 		 */
 		void init_01(const std::string& zerones);
 		/**
 		 * @brief Initialise the bitset from a list of Boolean values.
 		 *
-		 * @ref bytes[i] = @e bits[i].
+		 * the i-th bit is @e bits[i].
 		 */
 		void init_01(const std::vector<bool>& bits);
 		/**
@@ -156,9 +166,7 @@ class static_bitset {
 		 *
 		 * Each character of the vector is interpreted as a byte.
 		 *
-		 * @ref bytes[0..7] = @e bytes[0].
-		 *
-		 * @ref bytes[8..15] = @e bytes[1].
+		 * Bits 0..7 are @e bytes[0], bits 8..15 are @e bytes[1], ...
 		 */
 		void init_bytes(const std::vector<char>& bytes);
 		/**
@@ -166,17 +174,15 @@ class static_bitset {
 		 *
 		 * Each character of the string is interpreted as a byte.
 		 *
-		 * @ref bytes[0..7] = @e bytes[0].
-		 *
-		 * @ref bytes[8..15] = @e bytes[1].
+		 * Bits 0..7 are @e bytes[0], bits 8..15 are @e bytes[1], ...
 		 */
 		void init_bytes(const std::string& bytes);
 
 		/**
 		 * @brief Frees the memory occupied by the bitset.
 		 *
-		 * The values @ref n_bytes and @ref n_bits are set to 0, and
-		 * the pointer @ref bytes to null.
+		 * The values @ref n_words and @ref n_bits are set to 0, and
+		 * the pointer @ref words to null.
 		 */
 		void clear();
 
@@ -193,6 +199,14 @@ class static_bitset {
 		 * @return Returns a reference to this bitset.
 		 */
 		static_bitset& operator= (const static_bitset& bs);
+		/**
+		 * @brief Moves the contents of @e bs to this bitset.
+		 *
+		 * The memory of this bitset is freed and @e bs is left empty.
+		 * @param bs The bitset to be moved.
+		 * @return Returns a reference to this bitset.
+		 */
+		static_bitset& operator= (static_bitset&& bs);
 
 		/// Returns the value of the i-th bit.
 		bool operator[] (size_t i) const;
@@ -315,6 +329,46 @@ class static_bitset {
 		 */
 		static_bitset& operator+= (char k);
 
+		/**
+		 * @brief Stores in this bitset the bit-wise @e and of two bitsets.
+		 *
+		 * Memory is only reallocated if this bitset's size differs
+		 * from @e a's.
+		 * @pre Both @e a and @e b have the same size.
+		 * @returns Modifies this bitset so that:
+		 *
+		 *		this = a & b
+		 */
+		void assign_and(const static_bitset& a, const static_bitset& b);
+		/**
+		 * @brief Stores in this bitset the bit-wise @e or of two bitsets.
+		 *
+		 * See @ref assign_and for details.
+		 * @returns Modifies this bitset so that:
+		 *
+		 *		this = a | b
+		 */
+		void assign_or(const static_bitset& a, const static_bitset& b);
+		/**
+		 * @brief Stores in this bitset the bit-wise @e exclusive-or of
+		 * two bitsets.
+		 *
+		 * See @ref assign_and for details.
+		 * @returns Modifies this bitset so that:
+		 *
+		 *		this = a ^ b
+		 */
+		void assign_xor(const static_bitset& a, const static_bitset& b);
+		/**
+		 * @brief Stores in this bitset the difference of two bitsets.
+		 *
+		 * See @ref assign_and for details.
+		 * @returns Modifies this bitset so that:
+		 *
+		 *		this = a - b
+		 */
+		void assign_difference(const static_bitset& a, const static_bitset& b);
+
 		/// Outputs this bitset formatted in a string.
 		inline friend
 		std::ostream& operator<< (std::ostream& os, const static_bitset& bitset) {
@@ -345,7 +399,9 @@ class static_bitset {
 
 		/**
 		 * @brief Swaps the contents of this bitset and @e bs's.
-		 * @pre Both bitsets must have been initialised.
+		 *
+		 * Only the pointers to the memory are swapped, so the bitsets
+		 * may have different sizes.
 		 */
 		void swap(static_bitset& bs);
 
@@ -402,6 +458,37 @@ class static_bitset {
 		/// Returns the number of bits set to 1.
 		size_t count() const;
 
+		/**
+		 * @brief Returns the number of bits set to 1 in both bitsets.
+		 *
+		 * Equivalent to, but faster than, (*this & bs).count().
+		 * @pre Both bitsets have the same size.
+		 */
+		size_t count_and(const static_bitset& bs) const;
+
+		/**
+		 * @brief Returns true if both bitsets have a bit set to 1 in
+		 * common.
+		 *
+		 * Equivalent to, but faster than, (*this & bs).any().
+		 * @pre Both bitsets have the same size.
+		 */
+		bool intersects(const static_bitset& bs) const;
+
+		/**
+		 * @brief Returns the index of the first bit set to 1.
+		 * @return Returns the smallest index @e i such that the @e i-th
+		 * bit is 1, or @ref size() if there is no such bit.
+		 */
+		size_t find_first() const;
+		/**
+		 * @brief Returns the index of the next bit set to 1.
+		 * @param i Index of a bit.
+		 * @return Returns the smallest index @e j > @e i such that the
+		 * @e j-th bit is 1, or @ref size() if there is no such bit.
+		 */
+		size_t find_next(size_t i) const;
+
 		/**
 		 * @brief Returns this bitset as a string.
 		 * @param[out] s This bitset as a string of zeros and ones.
@@ -431,12 +518,10 @@ class static_bitset {
 		 * @brief Append the contents of this bitset to the end
 		 * of a string.
 		 *
-		 * The last byte may contain rubbish. The number of valid bits
-		 * in the last byte is equal to the remainder of the division
-		 * of the number of bytes by 8.
+		 * The bits of the last byte beyond @ref size() are 0.
 		 *
 		 * @param[out] s Let @e k be a string such that
-		 * k[0..7] = @ref bytes[0], k[8..15] = @ref bytes[1], ...
+		 * k[0..7] are the bits 0..7, k[8..15] are the bits 8..15, ...
 		 * The string k is appended at the end of @e s.
 		 */
 		void append_bytes(std::string& s) const;
@@ -444,12 +529,10 @@ class static_bitset {
 		 * @brief Returns a string whose characters are the bytes of
 		 * this bitset.
 		 *
-		 * The last byte may contain rubbish. The number of valid bits
-		 * in the last byte is equal to the remainder of the division
-		 * of the number of bytes by 8.
+		 * The bits of the last byte beyond @ref size() are 0.
 		 *
 		 * @param[out] s A string 's' such that
-		 * s[0..7] = @ref bytes[0], s[8..15] = @ref bytes[1], ...
+		 * s[0..7] are the bits 0..7, s[8..15] are the bits 8..15, ...
 		 */
 		void get_bytes(std::string& s) const;
 
@@ -457,12 +540,10 @@ class static_bitset {
 		 * @brief Returns a string whose characters are the bytes of
 		 * this bitset.
 		 *
-		 * The last byte may contain rubbish. The number of valid bits
-		 * in the last byte is equal to the remainder of the division
-		 * of the number of bytes by 8.
+		 * The bits of the last byte beyond @ref size() are 0.
 		 *
 		 * @returns Returns a string 's' such that
-		 * s[0..7] = @ref bytes[0], s[8..15] = @ref bytes[1], ...
+		 * s[0..7] are the bits 0..7, s[8..15] are the bits 8..15, ...
 		 */
 		std::string get_bytes() const;
 
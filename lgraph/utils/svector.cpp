@@ -144,6 +144,20 @@ void svector<T, Alloc>::add(const T& v) {
 	}
 }
 
+template<class T, class Alloc>
+void svector<T, Alloc>::insert(size_t i, const T& v) {
+	assert(i <= idx);
+
+	// make room for one more element at the end,
+	// then shift [i, idx - 1) one position to the right
+	add(v);
+	std::copy_backward(
+		elems.begin() + i, elems.begin() + idx - 1,
+		elems.begin() + idx
+	);
+	elems[i] = v;
+}
+
 template<class T, class Alloc>
 void svector<T, Alloc>::remove(size_t i) {
 	only_remove(i);
@@ -248,6 +262,27 @@ size_t svector<T, Alloc>::position(const T& v) const {
 	return idx;
 }
 
+template<class T, class Alloc>
+size_t svector<T, Alloc>::lower_bound(const T& v) const {
+	return static_cast<size_t>(
+		std::lower_bound(elems.begin(), elems.begin() + idx, v) - elems.begin()
+	);
+}
+
+template<class T, class Alloc>
+bool svector<T, Alloc>::contains_s(const T& v) const {
+	return position_s(v) != idx;
+}
+
+template<class T, class Alloc>
+size_t svector<T, Alloc>::position_s(const T& v) const {
+	size_t p = lower_bound(v);
+	if (p < idx and not (v < elems[p])) {
+		return p;
+	}
+	return idx;
+}
+
 template<class T, class Alloc>
 void svector<T,Alloc>::as_vector(std::vector<T,Alloc>& v) const {
 	v = std::vector<T,Alloc>(elems.begin(), elems.begin() + size() );
@@ -202,6 +202,20 @@ class svector {
 		 */
 		void add(const T& v);
 
+		/**
+		 * @brief Inserts an element in the i-th position of this container
+		 *
+		 * The elements in the positions [@e i, @ref idx) are moved one
+		 * position to the right and @e v is copied to the @e i-th position.
+		 * Therefore, the relative order of the elements is preserved.
+		 * When @e i = @ref idx this is equivalent to @ref add(const T&).
+		 *
+		 * @param i The position of the new element.
+		 * @param v Value to be inserted.
+		 * @pre @e i <= @ref idx
+		 */
+		void insert(size_t i, const T& v);
+
 		/**
 		 * @brief Removes the element in the i-th position of this container
 		 *
@@ -322,6 +336,41 @@ class svector {
 		 */
 		size_t position(const T& v) const;
 
+		/**
+		 * @brief Position of the first element not smaller than @e v.
+		 *
+		 * Performs a binary search on the contents of the container.
+		 * @param v The element to be searched.
+		 * @return Returns the first position @e p such that the element at
+		 * @e p is not smaller than @e v, or @ref idx if there is no such
+		 * element.
+		 * @pre The container is increasingly sorted.
+		 */
+		size_t lower_bound(const T& v) const;
+
+		/**
+		 * @brief Looks for an element equal to @e v in a sorted container.
+		 *
+		 * Same as @ref contains but performs a binary search.
+		 *
+		 * @param v The element to be searched
+		 * @return Returns true if there is an element equal to @e v in the container.
+		 * @pre The container is increasingly sorted.
+		 */
+		bool contains_s(const T& v) const;
+
+		/**
+		 * @brief Looks for an element @e v in a sorted container.
+		 *
+		 * Same as @ref position but performs a binary search.
+		 *
+		 * @param v The element to be searched
+		 * @return Returns a value smaller than @ref idx if v is in the
+		 * container. Returns a value equal to @ref idx if otherwise.
+		 * @pre The container is increasingly sorted.
+		 */
+		size_t position_s(const T& v) const;
+
 		/**
 		 * @brief Converts this shortened container into a regular C++'s vector.
 		 *
@@ -2,6 +2,7 @@ TEMPLATE = app
 
 CONFIG += console
 CONFIG += c++11
+CONFIG += thread
 CONFIG -= app_bundle
 CONFIG -= qt
 
@@ -38,13 +39,39 @@ SOURCES += \
     wx_metric/wx_metric_centrality.cpp \
     wx_metric/wx_metric_distance.cpp \
     xu_metric/xu_metric_clustering.cpp \
-    xx_metric/xx_metric_centrality.cpp
+    xx_metric/xx_metric_centrality.cpp \
+    ux_csr/ux_csr.cpp \
+    wx_csr/wx_csr.cpp \
+    ux_check/ux_check.cpp \
+    ux_check/ux_check_bfs.cpp \
+    ux_check/ux_check_centrality.cpp \
+    ux_check/ux_check_distance.cpp \
+    ux_check/ux_check_paths.cpp \
+    wx_check/wx_check.cpp \
+    wx_check/wx_check_dijkstra.cpp \
+    wx_check/wx_check_centrality.cpp \
+    wx_check/wx_check_contraction.cpp \
+    wx_check/wx_check_delta.cpp \
+    wx_check/wx_check_distance.cpp \
+    wx_check/wx_check_landmarks.cpp \
+    wx_check/wx_check_paths.cpp \
+    wx_check/wx_check_weights.cpp \
+    xx_structure/xx_structure.cpp \
+    xx_structure/xx_structure_io.cpp \
+    xx_structure/xx_structure_bitset.cpp \
+    xx_structure/xx_structure_workspace.cpp \
+    xx_structure/xx_structure_hyperloglog.cpp \
+    xx_structure/xx_structure_distance_matrix.cpp \
+    xx_structure/xx_structure_queues.cpp
 
 HEADERS += \
     definitions.hpp \
     parse_keywords.hpp \
     exe_tests.hpp \
     io_wrapper.hpp \
-    test_utils.hpp
+    test_utils.hpp \
+    ux_check/ux_check.hpp \
+    wx_check/wx_check.hpp \
+    xx_structure/xx_structure.hpp
 
 DISTFILES += \
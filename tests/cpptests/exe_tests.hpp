@@ -25,6 +25,9 @@ err_type xu_metric_clustering
 err_type xx_metric_centrality
 (const string& c, const string& many, ifstream& fin);
 
+err_type xx_structure
+(const string& name, ifstream& fin);
+
 err_type ux_path_node_node
 (const string& graph_type, const string& many, ifstream& fin);
 err_type ux_path_node_all
@@ -46,6 +49,12 @@ err_type ux_metric_clustering
 err_type ux_metric_distance
 (const string& graph_type, const string& d, ifstream& fin);
 
+err_type ux_csr
+(const string& graph_type, const string& task, ifstream& fin, bool from_snapshot = false);
+
+err_type ux_check
+(const string& graph_type, const string& task, ifstream& fin);
+
 err_type wx_path_node_node
 (const string& graph_type, const string& many, ifstream& fin);
 err_type wx_path_node_all
@@ -67,5 +76,11 @@ err_type wx_metric_clustering
 err_type wx_metric_distance
 (const string& graph_type, const string& d, ifstream& fin);
 
+err_type wx_csr
+(const string& graph_type, const string& task, ifstream& fin, bool from_snapshot = false);
+
+err_type wx_check
+(const string& graph_type, const string& weight_type, const string& task, ifstream& fin);
+
 } // -- namespace exe_tests
 
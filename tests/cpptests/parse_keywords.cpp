@@ -86,6 +86,9 @@ err_type call_xx
 	if (key == "metric") {
 		return call_xx_metric(keywords, i + 1, fin);
 	}
+	if (key == "structure") {
+		return xx_structure(keywords[i + 1], fin);
+	}
 
 	cerr << ERROR("parse_keywords.cpp", "call_xx") << endl;
 	cerr << "    Unhandled keyword at " << i << ": '" << key << "'." << endl;
@@ -168,6 +171,16 @@ err_type call_ux
 	if (task == "metric") {
 		return call_ux_metric(keywords, i + 2, graph_type, fin);
 	}
+	if (task == "csr") {
+		// compressed graph mapped from a binary snapshot
+		if (keywords[i + 2] == "snapshot" and i + 3 < keywords.size()) {
+			return ux_csr(graph_type, keywords[i + 3], fin, true);
+		}
+		return ux_csr(graph_type, keywords[i + 2], fin);
+	}
+	if (task == "check") {
+		return ux_check(graph_type, keywords[i + 2], fin);
+	}
 
 	cerr << ERROR("parse_keywords.cpp", "call_ux") << endl;
 	cerr << "    Unhandled keyword at " << i + 2 << ": '" << task << "'." << endl;
@@ -282,6 +295,20 @@ err_type call_wx
 	if (task == "metric") {
 		return call_wx_metric(keywords, i + 2, graph_type, fin);
 	}
+	if (task == "csr") {
+		// compressed graph mapped from a binary snapshot
+		if (keywords[i + 2] == "snapshot" and i + 3 < keywords.size()) {
+			return wx_csr(graph_type, keywords[i + 3], fin, true);
+		}
+		return wx_csr(graph_type, keywords[i + 2], fin);
+	}
+	if (task == "check") {
+		// the weights are floats unless their type is given
+		if (i + 3 < keywords.size()) {
+			return wx_check(graph_type, keywords[i + 2], keywords[i + 3], fin);
+		}
+		return wx_check(graph_type, "float", keywords[i + 2], fin);
+	}
 
 	cerr << ERROR("parse_keywords.cpp", "call_wx") << endl;
 	cerr << "    Unhandled keyword at " << i + 2 << ": '" << task << "'." << endl;
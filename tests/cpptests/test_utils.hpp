@@ -1,12 +1,16 @@
 #pragma once
 
 // C++ includes
+#include <algorithm>
 #include <sstream>
 #include <string>
 #include <limits>
+#include <vector>
 
 // lgraph includes
 #include <lgraph/data_structures/node_path.hpp>
+#include <lgraph/data_structures/shortest_path_dag.hpp>
+#include <lgraph/data_structures/wxgraph.hpp>
 
 // custom includes
 #include "definitions.hpp"
@@ -19,6 +23,84 @@ bool comp_ux_paths
 bool comp_wx_paths
 (const lgraph::node_path<float>& p, const lgraph::node_path<float>& q);
 
+/* Two distances are the same if they are equal up to a small tolerance.
+ * The tolerance is zero for integral types. */
+template<typename T>
+bool same_distance(T a, T b) {
+	if (a == b) {
+		return true;
+	}
+	if (a == std::numeric_limits<T>::max() or b == std::numeric_limits<T>::max()) {
+		return false;
+	}
+	return (a < b ? b - a : a - b) <= static_cast<T>(1.0e-4);
+}
+
+/* A path of a weighted graph is a shortest path if it goes from 's' to
+ * 't' through edges of the graph without repeating nodes, and both its
+ * length and the sum of the weights of its edges are the distance 'd'.
+ * It is empty if 'd' is infinite. */
+template<typename T>
+bool is_shortest_path(
+	const lgraph::wxgraph<T> *G, const lgraph::node_path<T>& p,
+	lgraph::node s, lgraph::node t, T d
+)
+{
+	if (d == std::numeric_limits<T>::max()) {
+		return p.size() == 0;
+	}
+	if (p.size() == 0 or p[0] != s or p.last_node() != t or
+		not same_distance(p.get_length(), d))
+	{
+		return false;
+	}
+	T length = 0;
+	for (size_t i = 1; i < p.size(); ++i) {
+		if (not G->has_edge(p[i - 1], p[i])) {
+			return false;
+		}
+		length += G->edge_weight(p[i - 1], p[i]);
+	}
+	std::vector<lgraph::node> nodes = p.get_nodes();
+	std::sort(nodes.begin(), nodes.end());
+	return same_distance(length, d) and
+		std::adjacent_find(nodes.begin(), nodes.end()) == nodes.end();
+}
+
+/* Two sets of paths are the same if they have the same sequences of
+ * nodes, in any order. Neither of them may have repeated paths. */
+template<typename T>
+bool same_paths(const lgraph::node_path_set<T>& ps, const lgraph::node_path_set<T>& qs) {
+	std::vector<std::vector<lgraph::node> > P, Q;
+	for (const lgraph::node_path<T>& p : ps) {
+		P.push_back(p.get_nodes());
+	}
+	for (const lgraph::node_path<T>& q : qs) {
+		Q.push_back(q.get_nodes());
+	}
+	std::sort(P.begin(), P.end());
+	std::sort(Q.begin(), Q.end());
+	return P == Q and std::adjacent_find(P.begin(), P.end()) == P.end();
+}
+
+/* The shortest paths from the source of 'dag' to 't', enumerated one
+ * at a time and all at once, are the paths in 'ps', and have the length
+ * of the distance to 't'. */
+template<typename T>
+bool same_dag_paths
+(const lgraph::shortest_path_dag<T>& dag, lgraph::node t, const lgraph::node_path_set<T>& ps)
+{
+	lgraph::node_path_set<T> one, all;
+	for (auto it = dag.paths(t); not it.end(); it.next()) {
+		one.push_back(it.get_path());
+		if (not same_distance(it.get_path().get_length(), dag.distance(t))) {
+			return false;
+		}
+	}
+	dag.get_paths(t, all);
+	return dag.n_paths(t) == ps.size() and same_paths(one, ps) and same_paths(all, ps);
+}
+
 template<typename T>
 std::string floatpointout_dist(T d) {
 	if (d == std::numeric_limits<T>::max()) {
@@ -0,0 +1,123 @@
+// C++ inlcudes
+#include <iostream>
+using namespace std;
+
+// lgraph includes
+#include <lgraph/data_structures/uugraph.hpp>
+#include <lgraph/data_structures/udgraph.hpp>
+using namespace lgraph;
+
+// custom includes
+#include "definitions.hpp"
+#include "io_wrapper.hpp"
+#include "ux_check/ux_check.hpp"
+
+namespace exe_tests {
+
+err_type ux_check(const string& graph_type, const string& task, ifstream& fin) {
+	string input_graph, format;
+	size_t n;
+
+	// parse input field
+	string field;
+	fin >> field;
+	if (field != "INPUT") {
+		cerr << ERROR("ux_check.cpp", "ux_check") << endl;
+		cerr << "    Expected field 'INPUT'." << endl;
+		cerr << "    Instead, '" << field << "' was found." << endl;
+		return err_type::test_format_error;
+	}
+	fin >> n;
+	if (n != 1) {
+		cerr << ERROR("ux_check.cpp", "ux_check") << endl;
+		cerr << "    Only one input file is allowed in this test." << endl;
+		cerr << "    Instead, " << n << " were specified." << endl;
+		return err_type::test_format_error;
+	}
+	fin >> input_graph >> format;
+
+	// parse body field
+	fin >> field;
+	if (field != "BODY") {
+		cerr << ERROR("ux_check.cpp", "ux_check") << endl;
+		cerr << "    Expected field 'BODY'." << endl;
+		cerr << "    Instead, '" << field << "' was found." << endl;
+		return err_type::test_format_error;
+	}
+
+	uxgraph *G = nullptr;
+	if (graph_type == "directed") {
+		G = new udgraph();
+	}
+	else if (graph_type == "undirected") {
+		G = new uugraph();
+	}
+	else {
+		cerr << ERROR("ux_check.cpp", "ux_check") << endl;
+		cerr << "    Wrong value for parameter 'graph_type'." << endl;
+		cerr << "    Received '" << graph_type << "'." << endl;
+		return err_type::invalid_param;
+	}
+
+	err_type r = io_wrapper::read_graph(input_graph, format, G);
+	if (r != err_type::no_error) {
+		if (r == err_type::io_error) {
+			cerr << ERROR("ux_check.cpp", "ux_check") << endl;
+			cerr << "    Could not open file '" << input_graph << "'" << endl;
+		}
+		else if (r == err_type::graph_format_error) {
+			cerr << ERROR("ux_check.cpp", "ux_check") << endl;
+			cerr << "    Input file format '" << format << "' not supported." << endl;
+		}
+		delete G;
+		return r;
+	}
+
+	if (task == "visitor") {
+		r = ux_check_visitor(G, fin);
+	}
+	else if (task == "workspace") {
+		r = ux_check_workspace(G, fin);
+	}
+	else if (task == "direction") {
+		r = ux_check_direction(G, fin);
+	}
+	else if (task == "sources") {
+		r = ux_check_sources(G, fin);
+	}
+	else if (task == "bidirectional") {
+		r = ux_check_bidirectional(G, fin);
+	}
+	else if (task == "dag") {
+		r = ux_check_dag(G, fin);
+	}
+	else if (task == "parents") {
+		r = ux_check_parents(G, fin);
+	}
+	else if (task == "sampling") {
+		r = ux_check_sampling(G, fin);
+	}
+	else if (task == "pivots") {
+		r = ux_check_pivots(G, fin);
+	}
+	else if (task == "hyperanf") {
+		r = ux_check_hyperanf(G, fin);
+	}
+	else if (task == "eccentricity") {
+		r = ux_check_eccentricity(G, fin);
+	}
+	else if (task == "matrix") {
+		r = ux_check_matrix(G, fin);
+	}
+	else {
+		cerr << ERROR("ux_check.cpp", "ux_check") << endl;
+		cerr << "    Value of parameter 'task' is not valid." << endl;
+		cerr << "    Received: '" << task << "'." << endl;
+		r = err_type::invalid_param;
+	}
+
+	delete G;
+	return r;
+}
+
+} // -- namespace exe_tests
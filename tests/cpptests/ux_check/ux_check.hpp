@@ -0,0 +1,34 @@
+#pragma once
+
+/* Tests that check an algorithm of the library against a simpler (and
+ * already tested) one. Every function prints the results of the algorithm
+ * being tested, and reports in the error output any difference with the
+ * reference algorithm.
+ */
+
+// C++ includes
+#include <fstream>
+using namespace std;
+
+// lgraph includes
+#include <lgraph/data_structures/uxgraph.hpp>
+
+// custom includes
+#include "definitions.hpp"
+
+namespace exe_tests {
+
+err_type ux_check_visitor(const lgraph::uxgraph *G, ifstream& fin);
+err_type ux_check_workspace(const lgraph::uxgraph *G, ifstream& fin);
+err_type ux_check_direction(const lgraph::uxgraph *G, ifstream& fin);
+err_type ux_check_sources(const lgraph::uxgraph *G, ifstream& fin);
+err_type ux_check_bidirectional(const lgraph::uxgraph *G, ifstream& fin);
+err_type ux_check_dag(const lgraph::uxgraph *G, ifstream& fin);
+err_type ux_check_parents(const lgraph::uxgraph *G, ifstream& fin);
+err_type ux_check_sampling(const lgraph::uxgraph *G, ifstream& fin);
+err_type ux_check_pivots(const lgraph::uxgraph *G, ifstream& fin);
+err_type ux_check_hyperanf(const lgraph::uxgraph *G, ifstream& fin);
+err_type ux_check_eccentricity(const lgraph::uxgraph *G, ifstream& fin);
+err_type ux_check_matrix(const lgraph::uxgraph *G, ifstream& fin);
+
+} // -- namespace exe_tests
@@ -0,0 +1,545 @@
+// C++ inlcudes
+#include <algorithm>
+#include <iostream>
+#include <vector>
+using namespace std;
+
+// lgraph includes
+#include <lgraph/data_structures/csr_uxgraph.hpp>
+#include <lgraph/data_structures/node_path.hpp>
+#include <lgraph/graph_traversal/bfs.hpp>
+#include <lgraph/graph_traversal/traversal_ux.hpp>
+#include <lgraph/graph_traversal/workspace.hpp>
+using namespace lgraph;
+using namespace traversal;
+
+// custom includes
+#include "definitions.hpp"
+#include "test_utils.hpp"
+#include "ux_check/ux_check.hpp"
+using namespace test_utils;
+
+namespace exe_tests {
+
+// counts the nodes and the edges visited by a BFS
+struct bfs_counter {
+	size_t *n_visited;
+	size_t *n_edges;
+
+	template<class G_t>
+	void operator() (const G_t *, node, const vector<bool>&) const {
+		++(*n_visited);
+	}
+	template<class G_t>
+	void operator() (const G_t *, node, node, const vector<bool>&) const {
+		++(*n_edges);
+	}
+};
+
+// distances from 's' with a plain (top-down only) BFS
+void plain_BFS(const uxgraph *G, node s, vector<_new_>& dist) {
+	dist.assign(G->n_nodes(), inf_t<_new_>());
+	dist[s] = 0;
+	bfs::BFS(
+		G, s, bfs::bfs_no_op(), bfs::bfs_no_op(),
+		[&](const uxgraph *, node u, node v, const vector<bool>& vis) -> void {
+			if (not vis[v]) {
+				dist[v] = dist[u] + 1;
+			}
+		}
+	);
+}
+
+err_type ux_check_visitor(const uxgraph *G, ifstream& fin) {
+	const size_t N = G->n_nodes();
+	const csr_uxgraph C(G);
+
+	node s, t;
+	// read pairs of nodes
+	while (fin >> s >> t) {
+		// visitor-based BFS from 's' that stops at 't'
+		vector<node> order;
+		vector<_new_> dist(N, inf_t<_new_>());
+		dist[s] = 0;
+		bfs::BFS(
+			G, s,
+			[&](const uxgraph *, node u, const vector<bool>&) -> bool {
+				return u == t;
+			},
+			[&](const uxgraph *, node u, const vector<bool>&) -> void {
+				order.push_back(u);
+			},
+			[&](const uxgraph *, node u, node v, const vector<bool>& vis) -> void {
+				if (not vis[v]) {
+					dist[v] = dist[u] + 1;
+				}
+			}
+		);
+
+		cout << s << " " << t << ": " << floatpointout_dist(dist[t]) << " |";
+		for (node u : order) {
+			cout << " " << u;
+		}
+		cout << endl;
+
+		const _new_ d = uxdistance(G, s, t);
+		if (dist[t] != d) {
+			cerr << ERROR("ux_check_bfs.cpp", "ux_check_visitor") << endl;
+			cerr << "    Distance from " << s << " to " << t << " is wrong." << endl;
+			cerr << "    Visitor-based BFS: " << floatpointout_dist(dist[t]) << endl;
+			cerr << "    uxdistance: " << floatpointout_dist(d) << endl;
+			return err_type::test_error;
+		}
+
+		// the same traversal with std::function objects, and on the
+		// compressed graph, visits the nodes in the same order
+		vector<node> order_func;
+		bfs::BFS(
+			G, s,
+			bfs::bfs_terminate(
+			[&](const uxgraph *, node u, const vector<bool>&) -> bool {
+				return u == t;
+			}),
+			bfs::bfs_process_current(
+			[&](const uxgraph *, node u, const vector<bool>&) -> void {
+				order_func.push_back(u);
+			})
+		);
+		vector<node> order_csr;
+		bfs::BFS(
+			&C, s,
+			[&](const csr_uxgraph *, node u, const vector<bool>&) -> bool {
+				return u == t;
+			},
+			[&](const csr_uxgraph *, node u, const vector<bool>&) -> void {
+				order_csr.push_back(u);
+			}
+		);
+		if (order_func != order or order_csr != order) {
+			cerr << ERROR("ux_check_bfs.cpp", "ux_check_visitor") << endl;
+			cerr << "    Different order of the nodes visited from " << s << "." << endl;
+			return err_type::test_error;
+		}
+
+		// a functor visiting the whole component of 's'
+		size_t n_visited = 0;
+		size_t n_edges = 0;
+		const bfs_counter count{&n_visited, &n_edges};
+		bfs::BFS(G, s, bfs::bfs_no_op(), count, count);
+
+		vector<_new_> ds;
+		uxdistance(G, s, ds);
+		size_t n_reached = 0;
+		size_t n_reached_edges = 0;
+		for (node u = 0; u < N; ++u) {
+			if (ds[u] != inf_t<_new_>()) {
+				++n_reached;
+				n_reached_edges += G->get_neighbours(u).size();
+			}
+		}
+		if (n_visited != n_reached or n_edges != n_reached_edges) {
+			cerr << ERROR("ux_check_bfs.cpp", "ux_check_visitor") << endl;
+			cerr << "    Wrong number of nodes or edges visited from " << s << "." << endl;
+			cerr << "    Visitor-based BFS: " << n_visited << " nodes, "
+				 << n_edges << " edges." << endl;
+			cerr << "    uxdistance: " << n_reached << " nodes, "
+				 << n_reached_edges << " edges." << endl;
+			return err_type::test_error;
+		}
+	}
+	return err_type::no_error;
+}
+
+// compares the distances left in a workspace with the expected ones,
+// up to distance 'max_d'
+bool same_distances(const workspace<>& ws, const vector<_new_>& dist, _new_ max_d) {
+	// the nodes are visited in non-decreasing order of distance
+	_new_ prev = 0;
+	for (node v : ws.visited_nodes()) {
+		if (ws.distance(v) < prev) {
+			return false;
+		}
+		prev = ws.distance(v);
+	}
+	for (node v = 0; v < dist.size(); ++v) {
+		const _new_ expected = (dist[v] <= max_d ? dist[v] : inf_t<_new_>());
+		if (ws.distance(v) != expected or ws.is_visited(v) != (expected != inf_t<_new_>())) {
+			return false;
+		}
+	}
+	return true;
+}
+
+err_type ux_check_direction(const uxgraph *G, ifstream& fin) {
+	const size_t N = G->n_nodes();
+	const size_t M = (G->is_directed() ? 1 : 2)*G->n_edges();
+	const csr_uxgraph C(G);
+	csr_uxgraph R;
+	R.init_reverse(G);
+
+	workspace<> ws;
+	node s;
+	// read list of sources
+	while (fin >> s) {
+		vector<_new_> dist;
+		plain_BFS(G, s, dist);
+
+		// the nodes of every level
+		vector<vector<node> > levels;
+		for (node v = 0; v < N; ++v) {
+			if (dist[v] != inf_t<_new_>()) {
+				if (dist[v] >= levels.size()) {
+					levels.resize(dist[v] + 1);
+				}
+				levels[dist[v]].push_back(v);
+			}
+		}
+
+		// the direction in which every level is expanded, following
+		// the heuristic of the direction-optimizing BFS
+		string dirs;
+		bool bottom_up = false;
+		size_t edges_unvisited = M - G->degree(s);
+		for (size_t l = 0; l + 1 < levels.size(); ++l) {
+			size_t edges_frontier = 0;
+			for (node u : levels[l]) {
+				edges_frontier += G->degree(u);
+			}
+			if (not bottom_up) {
+				bottom_up = edges_frontier > edges_unvisited/14;
+			}
+			else {
+				bottom_up =
+					levels[l].size() >= levels[l - 1].size() or
+					levels[l].size() >= N/24;
+			}
+			dirs += (bottom_up ? 'B' : 'T');
+
+			size_t edges_next = 0;
+			for (node u : levels[l + 1]) {
+				edges_next += G->degree(u);
+			}
+			edges_unvisited -= min(edges_unvisited, edges_next);
+		}
+
+		cout << s << ": " << levels.size() << " levels |";
+		for (const vector<node>& level : levels) {
+			cout << " " << level.size();
+		}
+		cout << " | " << dirs << endl;
+
+		// on the graph and on the compressed graph, in both
+		// directions and only top-down, to all nodes and up to
+		// a node in the middle level
+		const node target = levels[levels.size()/2][0];
+		const _new_ max_d = levels.size()/2;
+		for (size_t k = 0; k < 6; ++k) {
+			const node t = (k%2 == 0 ? inf_t<node>() : target);
+			if (k < 2) {
+				bfs::direction_optimizing_BFS(G, &R, s, ws, t);
+			}
+			else if (k < 4) {
+				bfs::direction_optimizing_BFS(&C, &R, s, ws, t);
+			}
+			else {
+				bfs::direction_optimizing_BFS(G, static_cast<const csr_uxgraph *>(nullptr), s, ws, t);
+			}
+
+			if (not same_distances(ws, dist, (k%2 == 0 ? inf_t<_new_>() : max_d))) {
+				cerr << ERROR("ux_check_bfs.cpp", "ux_check_direction") << endl;
+				cerr << "    Wrong distances from " << s;
+				if (k%2 == 1) {
+					cerr << " up to node " << target;
+				}
+				cerr << " (case " << k << ")." << endl;
+				return err_type::test_error;
+			}
+		}
+	}
+	return err_type::no_error;
+}
+
+// compares the distances from every source with a plain BFS from it:
+// every pair must have been reported once, in non-decreasing order of
+// distance for every source
+err_type compare_sources
+(
+	const uxgraph *G, const vector<node>& sources,
+	const vector<vector<_new_> >& dist, const vector<vector<size_t> >& n_calls,
+	const vector<char>& in_order, const string& func
+)
+{
+	for (size_t i = 0; i < sources.size(); ++i) {
+		vector<_new_> expected;
+		plain_BFS(G, sources[i], expected);
+		for (node v = 0; v < G->n_nodes(); ++v) {
+			const size_t calls = (expected[v] == inf_t<_new_>() ? 0 : 1);
+			if (dist[i][v] != expected[v] or n_calls[i][v] != calls) {
+				cerr << ERROR("ux_check_bfs.cpp", "compare_sources") << endl;
+				cerr << "    Wrong distance from " << sources[i] << " to " << v
+					 << " in " << func << "." << endl;
+				cerr << "    Found: " << floatpointout_dist(dist[i][v])
+					 << " (" << n_calls[i][v] << " calls)" << endl;
+				cerr << "    Expected: " << floatpointout_dist(expected[v]) << endl;
+				return err_type::test_error;
+			}
+		}
+		if (not in_order[i]) {
+			cerr << ERROR("ux_check_bfs.cpp", "compare_sources") << endl;
+			cerr << "    The distances from " << sources[i]
+				 << " are not in non-decreasing order in " << func << "." << endl;
+			return err_type::test_error;
+		}
+	}
+	return err_type::no_error;
+}
+
+err_type ux_check_sources(const uxgraph *G, ifstream& fin) {
+	const size_t N = G->n_nodes();
+	const csr_uxgraph C(G);
+
+	vector<node> all(N);
+	for (node u = 0; u < N; ++u) {
+		all[u] = u;
+	}
+	// not all nodes, in a different order, and
+	// as many as not to fill the last block
+	vector<node> some;
+	for (size_t i = 0; i < N; ++i) {
+		const node u = (i*37 + 5)%N;
+		if (u%8 != 3) {
+			some.push_back(u);
+		}
+	}
+
+	size_t n_threads;
+	// read numbers of threads
+	while (fin >> n_threads) {
+		vector<vector<_new_> > dist(N, vector<_new_>(N, inf_t<_new_>()));
+		vector<vector<size_t> > n_calls(N, vector<size_t>(N, 0));
+		vector<_new_> last(N, 0);
+		// (not a vector<bool>: the threads write different sources)
+		vector<char> in_order(N, 1);
+		auto proc =
+		[&](node s, node v, _new_ d) -> void {
+			dist[s][v] = d;
+			++n_calls[s][v];
+			in_order[s] = in_order[s] and last[s] <= d;
+			last[s] = d;
+		};
+
+		bfs::all_sources_BFS(G, proc, n_threads);
+		err_type r = compare_sources(G, all, dist, n_calls, in_order, "all_sources_BFS");
+		if (r != err_type::no_error) {
+			return r;
+		}
+
+		size_t n_pairs = 0;
+		_new_ sum = 0;
+		for (node s = 0; s < N; ++s) {
+			for (node v = 0; v < N; ++v) {
+				if (dist[s][v] != inf_t<_new_>()) {
+					++n_pairs;
+					sum += dist[s][v];
+				}
+			}
+		}
+
+		// the same on the compressed graph
+		for (node s = 0; s < N; ++s) {
+			dist[s].assign(N, inf_t<_new_>());
+			n_calls[s].assign(N, 0);
+		}
+		last.assign(N, 0);
+		in_order.assign(N, 1);
+		bfs::all_sources_BFS(&C, proc, n_threads);
+		r = compare_sources(G, all, dist, n_calls, in_order, "all_sources_BFS (csr)");
+		if (r != err_type::no_error) {
+			return r;
+		}
+
+		// only some of the nodes
+		const size_t S = some.size();
+		vector<vector<_new_> > dist_some(S, vector<_new_>(N, inf_t<_new_>()));
+		vector<vector<size_t> > n_calls_some(S, vector<size_t>(N, 0));
+		vector<_new_> last_some(S, 0);
+		vector<char> in_order_some(S, 1);
+		vector<char> good_tid(S, 1);
+		bfs::sources_BFS(
+			G, some,
+			[&](size_t tid, size_t i, node v, _new_ d) -> void {
+				dist_some[i][v] = d;
+				++n_calls_some[i][v];
+				in_order_some[i] = in_order_some[i] and last_some[i] <= d;
+				last_some[i] = d;
+				good_tid[i] = good_tid[i] and tid < max(n_threads, size_t(1));
+			},
+			n_threads
+		);
+		r = compare_sources(G, some, dist_some, n_calls_some, in_order_some, "sources_BFS");
+		if (r != err_type::no_error) {
+			return r;
+		}
+		if (find(good_tid.begin(), good_tid.end(), 0) != good_tid.end()) {
+			cerr << ERROR("ux_check_bfs.cpp", "ux_check_sources") << endl;
+			cerr << "    Wrong thread identifier in sources_BFS." << endl;
+			return err_type::test_error;
+		}
+
+		cout << n_threads << " threads: " << n_pairs << " pairs reachable, "
+			 << "sum of distances " << sum << endl;
+	}
+	return err_type::no_error;
+}
+
+// is 'p' a shortest path from 's' to 't', at distance 'd'?
+bool is_shortest_path(const uxgraph *G, const node_path<_new_>& p, node s, node t, _new_ d) {
+	if (d == inf_t<_new_>()) {
+		return p.size() == 0;
+	}
+	if (p.size() != d + 1 or p.get_length() != d or p[0] != s or p.last_node() != t) {
+		return false;
+	}
+	for (size_t i = 1; i < p.size(); ++i) {
+		if (not G->has_edge(p[i - 1], p[i])) {
+			return false;
+		}
+	}
+	return true;
+}
+
+err_type ux_check_bidirectional(const uxgraph *G, ifstream& fin) {
+	const size_t N = G->n_nodes();
+	const csr_uxgraph C(G);
+	csr_uxgraph R;
+	R.init_reverse(G);
+	// undirected graphs are their own reverse
+	const csr_uxgraph *Rp = (G->is_directed() ? &R : nullptr);
+
+	workspace<> wf, wb;
+	size_t n_reachable = 0;
+	for (node s = 0; s < N; ++s) {
+		vector<_new_> dist;
+		plain_BFS(G, s, dist);
+
+		for (node t = 0; t < N; ++t) {
+			const _new_ d = dist[t];
+			n_reachable += (d != inf_t<_new_>());
+
+			const _new_ d_graph = uxdistance_bidirectional(G, Rp, s, t, &wf, &wb);
+			const _new_ d_csr = uxdistance_bidirectional(&C, Rp, s, t, &wf, &wb);
+			node_path<_new_> p_graph, p_csr;
+			uxpath_bidirectional(G, Rp, s, t, p_graph, &wf, &wb);
+			uxpath_bidirectional(&C, Rp, s, t, p_csr, &wf, &wb);
+
+			// the nodes where the two traversals meet
+			node u, v;
+			const _new_ d_bfs = bfs::bidirectional_BFS(G, &R, s, t, wf, wb, u, v);
+			bool meet = true;
+			if (d != inf_t<_new_>()) {
+				meet =
+					(s == t ? u == s and v == s : G->has_edge(u, v)) and
+					wf.distance(u) + (s == t ? 0 : 1) + wb.distance(v) == d;
+			}
+
+			if (d_graph != d or d_csr != d or d_bfs != d or not meet or
+				not is_shortest_path(G, p_graph, s, t, d) or
+				not is_shortest_path(G, p_csr, s, t, d))
+			{
+				cerr << ERROR("ux_check_bfs.cpp", "ux_check_bidirectional") << endl;
+				cerr << "    Wrong distance or path from " << s << " to " << t << "." << endl;
+				cerr << "    Expected: " << floatpointout_dist(d) << endl;
+				cerr << "    Graph: " << floatpointout_dist(d_graph)
+					 << ", path: " << p_graph << endl;
+				cerr << "    Compressed graph: " << floatpointout_dist(d_csr)
+					 << ", path: " << p_csr << endl;
+				cerr << "    bidirectional_BFS: " << floatpointout_dist(d_bfs)
+					 << ", meeting at (" << u << "," << v << ")" << endl;
+				return err_type::test_error;
+			}
+		}
+	}
+	cout << N*N << " pairs, " << n_reachable << " reachable" << endl;
+
+	node s, t;
+	// read pairs of nodes whose path is shown
+	while (fin >> s >> t) {
+		node_path<_new_> p;
+		uxpath_bidirectional(G, Rp, s, t, p, &wf, &wb);
+		cout << s << " " << t << ": "
+			 << floatpointout_dist(uxdistance_bidirectional(G, Rp, s, t));
+		if (p.size() > 0) {
+			cout << " | " << p;
+		}
+		cout << endl;
+	}
+	return err_type::no_error;
+}
+
+err_type ux_check_workspace(const uxgraph *G, ifstream& fin) {
+	const size_t N = G->n_nodes();
+
+	// number of rounds of queries from every node
+	size_t n_rounds;
+	fin >> n_rounds;
+
+	// the same workspace for all queries
+	workspace<> ws;
+	for (size_t r = 0; r < n_rounds; ++r) {
+		_new_ sum = 0;
+		size_t n_reached = 0;
+		for (size_t i = 0; i < N; ++i) {
+			// the sources in a different order in every round
+			const node s = (i*7 + r*3)%N;
+			vector<_new_> ds;
+			uxdistance(G, s, ds);
+
+			// a query that stops at a target ...
+			const node t = (s*31 + r)%N;
+			const _new_ d = uxdistance(G, s, t, &ws);
+			if (d != ds[t]) {
+				cerr << ERROR("ux_check_bfs.cpp", "ux_check_workspace") << endl;
+				cerr << "    Wrong distance from " << s << " to " << t
+					 << " in round " << r << "." << endl;
+				cerr << "    Reusing the workspace: " << floatpointout_dist(d) << endl;
+				cerr << "    Fresh memory: " << floatpointout_dist(ds[t]) << endl;
+				return err_type::test_error;
+			}
+
+			// ... followed by one to all nodes, that
+			// must not see anything of the previous ones
+			uxdistance(G, s, ws);
+			size_t n_finite = 0;
+			for (node v = 0; v < N; ++v) {
+				if (ws.distance(v) != ds[v] or
+					ws.is_visited(v) != (ds[v] != inf_t<_new_>()))
+				{
+					cerr << ERROR("ux_check_bfs.cpp", "ux_check_workspace") << endl;
+					cerr << "    Wrong distance from " << s << " to " << v
+						 << " in round " << r << "." << endl;
+					cerr << "    Reusing the workspace: "
+						 << floatpointout_dist(ws.distance(v))
+						 << (ws.is_visited(v) ? " (visited)" : "") << endl;
+					cerr << "    Fresh memory: " << floatpointout_dist(ds[v]) << endl;
+					return err_type::test_error;
+				}
+				if (ds[v] != inf_t<_new_>()) {
+					sum += ds[v];
+					++n_finite;
+				}
+			}
+			if (ws.visited_nodes().size() != n_finite) {
+				cerr << ERROR("ux_check_bfs.cpp", "ux_check_workspace") << endl;
+				cerr << "    Wrong number of visited nodes from " << s
+					 << " in round " << r << "." << endl;
+				return err_type::test_error;
+			}
+			n_reached += n_finite;
+		}
+		cout << "round " << r << ": " << n_reached << " nodes reached, "
+			 << "sum of distances " << sum << endl;
+	}
+	return err_type::no_error;
+}
+
+} // -- namespace exe_tests
@@ -0,0 +1,294 @@
+// C++ inlcudes
+#include <algorithm>
+#include <iostream>
+#include <vector>
+#include <cmath>
+using namespace std;
+
+// lgraph includes
+#include <lgraph/data_structures/csr_uxgraph.hpp>
+#include <lgraph/graph_traversal/traversal_ux.hpp>
+#include <lgraph/metrics/centralities_ux.hpp>
+#include <lgraph/metrics/distance_ux.hpp>
+#include <lgraph/utils/random_generator.hpp>
+using namespace lgraph;
+using namespace traversal;
+using namespace networks::metrics;
+
+// custom includes
+#include "definitions.hpp"
+#include "test_utils.hpp"
+#include "ux_check/ux_check.hpp"
+using namespace test_utils;
+
+namespace exe_tests {
+
+err_type ux_check_hyperanf(const uxgraph *G, ifstream& fin) {
+	const size_t N = G->n_nodes();
+	const csr_uxgraph C(G);
+
+	// the exact neighbourhood function and harmonic centrality
+	vector<double> nf(1, 0.0);
+	vector<double> hc(N, 0.0);
+	_new_ diameter = 0;
+	for (node s = 0; s < N; ++s) {
+		vector<_new_> ds;
+		uxdistance(G, s, ds);
+		for (node t = 0; t < N; ++t) {
+			if (ds[t] == inf_t<_new_>()) {
+				continue;
+			}
+			if (ds[t] >= nf.size()) {
+				nf.resize(ds[t] + 1, 0.0);
+			}
+			nf[ds[t]] += 1.0;
+			hc[s] += (t != s ? 1.0/ds[t] : 0.0);
+			diameter = max(diameter, ds[t]);
+		}
+		hc[s] /= (N - 1);
+	}
+	for (size_t t = 1; t < nf.size(); ++t) {
+		nf[t] += nf[t - 1];
+	}
+
+	// the statistics of the exact function are exact
+	const double md = distance::mean_distance(G);
+	if (abs(distance::mean_distance(nf) - md) > 1.0e-9*max(1.0, md) or
+		abs(distance::effective_diameter(nf, 1.0) - diameter) > 1.0e-9)
+	{
+		cerr << ERROR("ux_check_distance.cpp", "ux_check_hyperanf") << endl;
+		cerr << "    Wrong statistics of the exact neighbourhood function." << endl;
+		cerr << "    Mean distance: " << floatpointout_metric(distance::mean_distance(nf))
+			 << ", expected " << floatpointout_metric(md) << endl;
+		cerr << "    Effective diameter: "
+			 << floatpointout_metric(distance::effective_diameter(nf, 1.0))
+			 << ", expected " << diameter << endl;
+		return err_type::test_error;
+	}
+
+	size_t seed, log2m;
+	// read the seed of the generator and the base 2
+	// logarithm of the number of registers of the counters
+	while (fin >> seed >> log2m) {
+		vector<vector<double> > nf_estimates, hc_estimates;
+		for (size_t n_threads : {1, 3}) {
+			for (bool csr : {false, true}) {
+				utils::drandom_generator<> rg;
+				rg.seed_random_engine(seed);
+				vector<double> nf_est, hc_est;
+				csr ? distance::neighbourhood_function(&C, nf_est, hc_est, rg, log2m, n_threads)
+					: distance::neighbourhood_function(G, nf_est, hc_est, rg, log2m, n_threads);
+				nf_estimates.push_back(nf_est);
+				hc_estimates.push_back(hc_est);
+
+				// without the harmonic centrality
+				rg.seed_random_engine(seed);
+				csr ? distance::neighbourhood_function(&C, nf_est, rg, log2m, n_threads)
+					: distance::neighbourhood_function(G, nf_est, rg, log2m, n_threads);
+				nf_estimates.push_back(nf_est);
+			}
+		}
+		for (size_t i = 1; i < nf_estimates.size(); ++i) {
+			if (nf_estimates[i] != nf_estimates[0] or
+				hc_estimates[i/2] != hc_estimates[0])
+			{
+				cerr << ERROR("ux_check_distance.cpp", "ux_check_hyperanf") << endl;
+				cerr << "    The estimates with seed " << seed << " depend on the "
+					 << "number of threads or on the graph's layout." << endl;
+				return err_type::test_error;
+			}
+		}
+
+		// relative error of the estimates, with a generous
+		// bound of 5 times the standard error of a counter
+		const vector<double>& nf_est = nf_estimates[0];
+		const vector<double>& hc_est = hc_estimates[0];
+		const double bound = 5*1.04/sqrt(static_cast<double>(1 << log2m));
+		double nf_error = 0;
+		for (size_t t = 0; t < max(nf.size(), nf_est.size()); ++t) {
+			const double e = nf_est[min(t, nf_est.size() - 1)];
+			const double x = nf[min(t, nf.size() - 1)];
+			nf_error = max(nf_error, abs(e - x)/x);
+		}
+		double hc_error = 0;
+		for (node u = 0; u < N; ++u) {
+			hc_error = max(hc_error, abs(hc_est[u] - hc[u]));
+		}
+		if (nf_est.size() > diameter + 1 or nf_error > bound or hc_error > bound) {
+			cerr << ERROR("ux_check_distance.cpp", "ux_check_hyperanf") << endl;
+			cerr << "    Wrong estimates with seed " << seed << " and "
+				 << (1 << log2m) << " registers." << endl;
+			cerr << "    Rounds: " << nf_est.size() << ", diameter " << diameter << endl;
+			cerr << "    Relative error of the neighbourhood function: "
+				 << floatpointout_metric(nf_error) << endl;
+			cerr << "    Error of the harmonic centrality: "
+				 << floatpointout_metric(hc_error) << endl;
+			return err_type::test_error;
+		}
+
+		cout << "seed " << seed << ", " << (1 << log2m) << " registers: "
+			 << nf_est.size() << " rounds, relative error "
+			 << floatpointout_metric(nf_error) << ", harmonic centrality error "
+			 << floatpointout_metric(hc_error) << endl;
+		cout << "    mean distance " << floatpointout_metric(distance::mean_distance(nf_est))
+			 << " (exact " << floatpointout_metric(md) << "), effective diameter "
+			 << floatpointout_metric(distance::effective_diameter(nf_est))
+			 << " (exact " << floatpointout_metric(distance::effective_diameter(nf)) << ")"
+			 << endl;
+	}
+	return err_type::no_error;
+}
+
+err_type ux_check_eccentricity(const uxgraph *G, ifstream&) {
+	const size_t N = G->n_nodes();
+	const csr_uxgraph C(G);
+	if (G->is_directed()) {
+		cerr << ERROR("ux_check_distance.cpp", "ux_check_eccentricity") << endl;
+		cerr << "    The graph must be undirected." << endl;
+		return err_type::test_format_error;
+	}
+
+	// the eccentricity of every node: the largest
+	// distance to the nodes reachable from it
+	vector<_new_> ecc(N, 0);
+	for (node s = 0; s < N; ++s) {
+		vector<_new_> ds;
+		uxdistance(G, s, ds);
+		for (node t = 0; t < N; ++t) {
+			if (ds[t] != inf_t<_new_>()) {
+				ecc[s] = max(ecc[s], ds[t]);
+			}
+		}
+	}
+	const _new_ D = (N == 0 ? 0 : *max_element(ecc.begin(), ecc.end()));
+	const _new_ R = (N == 0 ? 0 : *min_element(ecc.begin(), ecc.end()));
+
+	for (bool csr : {false, true}) {
+		_new_ Dg = 0, Rg = 0;
+		vector<_new_> lo, hi;
+		csr ? distance::diameter_radius(&C, Dg, Rg, &lo, &hi)
+			: distance::diameter_radius(G, Dg, Rg, &lo, &hi);
+		const _new_ max_dist = (csr ? distance::max_distance(&C) : distance::max_distance(G));
+
+		bool bounds_ok = (lo.size() == N and hi.size() == N);
+		for (node u = 0; bounds_ok and u < N; ++u) {
+			bounds_ok = lo[u] <= ecc[u] and ecc[u] <= hi[u];
+		}
+		if (Dg != D or Rg != R or max_dist != D or not bounds_ok) {
+			cerr << ERROR("ux_check_distance.cpp", "ux_check_eccentricity") << endl;
+			cerr << "    Wrong diameter or radius" << (csr ? " of the compressed graph." : ".") << endl;
+			cerr << "    Diameter: " << Dg << ", expected " << D << endl;
+			cerr << "    Radius: " << Rg << ", expected " << R << endl;
+			cerr << "    Maximum distance: " << max_dist << endl;
+			for (node u = 0; u < min(N, min(lo.size(), hi.size())); ++u) {
+				cerr << "    " << u << ": " << lo[u] << " <= " << ecc[u] << " <= " << hi[u] << endl;
+			}
+			return err_type::test_error;
+		}
+
+		// without the bounds
+		csr ? distance::diameter_radius(&C, Dg, Rg) : distance::diameter_radius(G, Dg, Rg);
+		if (Dg != D or Rg != R) {
+			cerr << ERROR("ux_check_distance.cpp", "ux_check_eccentricity") << endl;
+			cerr << "    Wrong diameter or radius without the bounds." << endl;
+			return err_type::test_error;
+		}
+	}
+
+	cout << "diameter " << D << ", radius " << R << endl;
+	for (node u = 0; u < N; ++u) {
+		cout << u << ": " << ecc[u] << endl;
+	}
+	return err_type::no_error;
+}
+
+/* The compact matrix of distances has the same distances as the matrix
+ * of vectors, whatever the number of threads, and the metrics computed
+ * from both agree.
+ */
+
+err_type ux_check_matrix(const uxgraph *G, ifstream&) {
+	const size_t N = G->n_nodes();
+	const csr_uxgraph C(G);
+
+	vector<vector<_new_> > ds;
+	uxdistances(G, ds);
+	_new_ D = 0;
+	for (node s = 0; s < N; ++s) {
+		for (node t = 0; t < N; ++t) {
+			if (ds[s][t] != inf_t<_new_>()) {
+				D = max(D, ds[s][t]);
+			}
+		}
+	}
+	const double md = distance::mean_distance(G, ds);
+	vector<double> cc;
+	centralities::closeness(G, ds, cc);
+
+	if (distance::max_distance(G, ds) != D or distance::max_distance(G) != D) {
+		cerr << ERROR("ux_check_distance.cpp", "ux_check_matrix") << endl;
+		cerr << "    Wrong maximum distance." << endl;
+		cerr << "    From the graph: " << distance::max_distance(G) << endl;
+		cerr << "    From the distances: " << distance::max_distance(G, ds) << endl;
+		cerr << "    Expected: " << D << endl;
+		return err_type::test_error;
+	}
+
+	size_t width = 0;
+	for (size_t n_threads : {1, 3}) {
+		for (bool csr : {false, true}) {
+			distance_matrix M;
+			csr ? uxdistances(&C, M, n_threads) : uxdistances(G, M, n_threads);
+			width = M.bytes_per_distance();
+
+			if (M.size() != N or M.is_symmetric() == G->is_directed() or M.capacity() < D) {
+				cerr << ERROR("ux_check_distance.cpp", "ux_check_matrix") << endl;
+				cerr << "    Wrong layout of the matrix with " << n_threads << " threads"
+					 << (csr ? " of the compressed graph." : ".") << endl;
+				cerr << "    Bytes per distance: " << M.bytes_per_distance()
+					 << ", largest distance " << D << endl;
+				return err_type::test_error;
+			}
+			for (node s = 0; s < N; ++s) {
+				for (node t = 0; t < N; ++t) {
+					if (M.get(s, t) != ds[s][t]) {
+						cerr << ERROR("ux_check_distance.cpp", "ux_check_matrix") << endl;
+						cerr << "    Wrong distance with " << n_threads << " threads"
+							 << (csr ? " of the compressed graph." : ".") << endl;
+						cerr << "    Distance from " << s << " to " << t << ": "
+							 << M.get(s, t) << ", expected " << ds[s][t] << endl;
+						return err_type::test_error;
+					}
+				}
+			}
+
+			const _new_ M_D = (csr ? distance::max_distance(&C, M) : distance::max_distance(G, M));
+			const double M_md = (csr ? distance::mean_distance(&C, M) : distance::mean_distance(G, M));
+			vector<double> M_cc;
+			csr ? centralities::closeness(&C, M, M_cc) : centralities::closeness(G, M, M_cc);
+			bool same_cc = (M_cc.size() == N);
+			for (node u = 0; same_cc and u < N; ++u) {
+				// the closeness of an isolated node is infinite
+				same_cc = M_cc[u] == cc[u] or abs(M_cc[u] - cc[u]) <= 1.0e-9*max(1.0, cc[u]);
+			}
+			if (M_D != D or abs(M_md - md) > 1.0e-9*max(1.0, md) or not same_cc) {
+				cerr << ERROR("ux_check_distance.cpp", "ux_check_matrix") << endl;
+				cerr << "    Wrong metrics of the matrix with " << n_threads << " threads"
+					 << (csr ? " of the compressed graph." : ".") << endl;
+				cerr << "    Maximum distance: " << M_D << ", expected " << D << endl;
+				cerr << "    Mean distance: " << floatpointout_metric(M_md)
+					 << ", expected " << floatpointout_metric(md) << endl;
+				return err_type::test_error;
+			}
+		}
+	}
+
+	cout << "max distance " << D << ", " << width << " bytes per distance" << endl;
+	cout << "mean distance " << floatpointout_metric(md) << endl;
+	for (node u = 0; u < N; ++u) {
+		cout << u << ": closeness " << floatpointout_metric(cc[u]) << endl;
+	}
+	return err_type::no_error;
+}
+
+} // -- namespace exe_tests
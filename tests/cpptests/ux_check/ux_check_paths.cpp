@@ -0,0 +1,192 @@
+// C++ inlcudes
+#include <iostream>
+#include <vector>
+#include <cmath>
+using namespace std;
+
+// lgraph includes
+#include <lgraph/data_structures/boolean_path.hpp>
+#include <lgraph/data_structures/csr_uxgraph.hpp>
+#include <lgraph/data_structures/node_path.hpp>
+#include <lgraph/data_structures/shortest_path_dag.hpp>
+#include <lgraph/graph_traversal/traversal_ux.hpp>
+#include <lgraph/graph_traversal/workspace.hpp>
+#include <lgraph/metrics/centralities_ux.hpp>
+#include <lgraph/metrics/centralities_xx.hpp>
+using namespace lgraph;
+using namespace traversal;
+using namespace networks::metrics;
+
+// custom includes
+#include "definitions.hpp"
+#include "test_utils.hpp"
+#include "ux_check/ux_check.hpp"
+using namespace test_utils;
+
+namespace exe_tests {
+
+err_type ux_check_dag(const uxgraph *G, ifstream& fin) {
+	const size_t N = G->n_nodes();
+	const csr_uxgraph C(G);
+
+	// the paths from all nodes, computed in parallel
+	vector<shortest_path_dag<_new_> > dags, dags_csr;
+	uxpaths(G, dags, 1);
+	uxpaths(&C, dags_csr, 3);
+
+	for (node s = 0; s < N; ++s) {
+		shortest_path_dag<_new_> dag, dag_csr;
+		uxpaths(G, s, dag);
+		uxpaths(&C, s, dag_csr);
+		vector<_new_> ds;
+		uxdistance(G, s, ds);
+
+		size_t n_reached = 0;
+		double n_paths = 0;
+		for (node t = 0; t < N; ++t) {
+			node_path_set<_new_> ps;
+			uxpaths(G, s, t, ps);
+
+			for (const shortest_path_dag<_new_> *D :
+				{&dag, &dag_csr, &dags[s], &dags_csr[s]})
+			{
+				const bool reachable = ds[t] != inf_t<_new_>();
+				if (D->get_source() != s or D->is_reachable(t) != reachable or
+					(reachable and D->distance(t) != ds[t]) or
+					not same_dag_paths(*D, t, ps))
+				{
+					cerr << ERROR("ux_check_paths.cpp", "ux_check_dag") << endl;
+					cerr << "    Wrong shortest paths from " << s << " to " << t << "." << endl;
+					cerr << "    Distance: " << floatpointout_dist(D->distance(t))
+						 << ", expected " << floatpointout_dist(ds[t]) << endl;
+					cerr << "    Number of paths: " << D->n_paths(t)
+						 << ", expected " << ps.size() << endl;
+					return err_type::test_error;
+				}
+			}
+			n_reached += dag.is_reachable(t);
+			n_paths += dag.n_paths(t);
+		}
+		cout << s << ": " << n_reached << " nodes reached, " << n_paths << " paths" << endl;
+	}
+
+	// the betweenness from the stored paths is that of Brandes' algorithm
+	vector<double> bc, bc_dags;
+	centralities::betweenness(G, bc);
+	centralities::betweenness(dags, bc_dags);
+	for (node u = 0; u < N; ++u) {
+		const double bu = centralities::betweenness(dags, u);
+		const double bu_G = centralities::betweenness(G, u);
+		if (abs(bc_dags[u] - bc[u]) > 1.0e-9 or abs(bu - bu_G) > 1.0e-9) {
+			cerr << ERROR("ux_check_paths.cpp", "ux_check_dag") << endl;
+			cerr << "    Wrong betweenness of node " << u << "." << endl;
+			cerr << "    From the stored paths: " << floatpointout_metric(bc_dags[u])
+				 << " (all nodes), " << floatpointout_metric(bu) << " (one node)" << endl;
+			cerr << "    Brandes' algorithm: " << floatpointout_metric(bc[u])
+				 << " (all nodes), " << floatpointout_metric(bu_G) << " (one node)" << endl;
+			return err_type::test_error;
+		}
+	}
+
+	node s, t;
+	// read pairs of nodes whose paths are shown one at a time
+	while (fin >> s >> t) {
+		cout << s << " " << t << ":";
+		for (auto it = dags[s].paths(t); not it.end(); it.next()) {
+			cout << " | " << it.get_path().to_string();
+		}
+		cout << endl;
+	}
+	return err_type::no_error;
+}
+
+// 'p' is one of the shortest paths 'ps' from 's' to 't', or it is empty
+// if there are none, and 'bp' has the same nodes and length
+bool is_one_of(
+	const node_path<_new_>& p, const boolean_path<_new_>& bp,
+	const node_path_set<_new_>& ps, _new_ d
+)
+{
+	if (ps.size() == 0) {
+		return p.size() == 0 and bp.size() == 0;
+	}
+
+	bool found = false;
+	for (const node_path<_new_>& q : ps) {
+		found = found or q.get_nodes() == p.get_nodes();
+	}
+	bool same_nodes = (bp.size() == p.size());
+	for (size_t i = 0; i < p.size(); ++i) {
+		same_nodes = same_nodes and bp[p[i]];
+	}
+	return found and p.get_length() == d and bp.get_length() == d and same_nodes;
+}
+
+err_type ux_check_parents(const uxgraph *G, ifstream& fin) {
+	const size_t N = G->n_nodes();
+
+	// the paths between all pairs, in parallel
+	vector<vector<node_path<_new_> > > all_paths;
+	vector<vector<boolean_path<_new_> > > all_bpaths;
+	uxpath(G, all_paths, 3);
+	uxpath(G, all_bpaths, 2);
+
+	// the same workspace for all node-node queries
+	workspace<> ws;
+	size_t n_reachable = 0;
+	size_t n_multiple = 0;
+	for (node s = 0; s < N; ++s) {
+		vector<node_path<_new_> > paths;
+		vector<boolean_path<_new_> > bpaths;
+		uxpath(G, s, paths);
+		uxpath(G, s, bpaths);
+		vector<_new_> ds;
+		uxdistance(G, s, ds);
+
+		for (node t = 0; t < N; ++t) {
+			node_path_set<_new_> ps;
+			uxpaths(G, s, t, ps);
+			node_path<_new_> p, p_ws;
+			boolean_path<_new_> bp, bp_ws;
+			uxpath(G, s, t, p);
+			uxpath(G, s, t, p_ws, &ws);
+			uxpath(G, s, t, bp);
+			uxpath(G, s, t, bp_ws, &ws);
+
+			if (not is_one_of(p, bp, ps, ds[t]) or
+				not is_one_of(p_ws, bp_ws, ps, ds[t]) or
+				not is_one_of(paths[t], bpaths[t], ps, ds[t]) or
+				not is_one_of(all_paths[s][t], all_bpaths[s][t], ps, ds[t]))
+			{
+				cerr << ERROR("ux_check_paths.cpp", "ux_check_parents") << endl;
+				cerr << "    Wrong path from " << s << " to " << t << "." << endl;
+				cerr << "    Distance: " << floatpointout_dist(ds[t])
+					 << ", " << ps.size() << " shortest paths." << endl;
+				cerr << "    Node-node: " << p << " | " << bp << endl;
+				cerr << "    Node-node (workspace): " << p_ws << " | " << bp_ws << endl;
+				cerr << "    Node-all: " << paths[t] << " | " << bpaths[t] << endl;
+				cerr << "    All-all: " << all_paths[s][t] << " | " << all_bpaths[s][t] << endl;
+				return err_type::test_error;
+			}
+			n_reachable += (ps.size() > 0);
+			n_multiple += (ps.size() > 1);
+		}
+	}
+	cout << N*N << " pairs, " << n_reachable << " reachable, "
+		 << n_multiple << " with several shortest paths" << endl;
+
+	node s, t;
+	// read pairs of nodes whose path is shown
+	while (fin >> s >> t) {
+		node_path<_new_> p;
+		uxpath(G, s, t, p, &ws);
+		cout << s << " " << t << ": " << floatpointout_dist(uxdistance(G, s, t));
+		if (p.size() > 0) {
+			cout << " | " << p.to_string();
+		}
+		cout << endl;
+	}
+	return err_type::no_error;
+}
+
+} // -- namespace exe_tests
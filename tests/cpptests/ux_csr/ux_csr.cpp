@@ -0,0 +1,170 @@
+// C++ inlcudes
+#include <cstdio>
+#include <iostream>
+#include <vector>
+using namespace std;
+
+// lgraph includes
+#include <lgraph/data_structures/uugraph.hpp>
+#include <lgraph/data_structures/udgraph.hpp>
+#include <lgraph/data_structures/csr_uxgraph.hpp>
+#include <lgraph/graph_traversal/traversal_ux.hpp>
+#include <lgraph/metrics/centralities_ux.hpp>
+#include <lgraph/metrics/distance_ux.hpp>
+#include <lgraph/io/io.hpp>
+using namespace lgraph;
+
+// custom includes
+#include "definitions.hpp"
+#include "io_wrapper.hpp"
+#include "test_utils.hpp"
+using namespace test_utils;
+
+namespace exe_tests {
+
+void ux_csr_distance(const csr_uxgraph *G, ifstream& fin) {
+	node u;
+	// read list of nodes
+	while (fin >> u) {
+		vector<_new_> dists;
+		vector<size_t> n_paths;
+		traversal::uxdistance(G, u, dists, n_paths);
+
+		for (node v = 0; v < G->n_nodes(); ++v) {
+			cout << v << ": " << floatpointout_dist(dists[v])
+				 << " (" << n_paths[v] << ")" << endl;
+		}
+	}
+}
+
+void ux_csr_metric(const csr_uxgraph *G) {
+	vector<double> cc;
+	networks::metrics::centralities::closeness(G, cc);
+	for (node u = 0; u < G->n_nodes(); ++u) {
+		cout << u << ": " << floatpointout_metric(cc[u]) << endl;
+	}
+
+	double m = networks::metrics::centralities::mcc(G);
+	cout << floatpointout_metric(m) << endl;
+
+	_new_ D = networks::metrics::distance::max_distance(G);
+	cout << D << endl;
+
+	double md = networks::metrics::distance::mean_distance(G);
+	cout << floatpointout_metric(md) << endl;
+}
+
+void ux_csr_betweenness(const csr_uxgraph *G, ifstream& fin) {
+	// number of threads (optional)
+	size_t n_threads;
+	if (not (fin >> n_threads)) {
+		n_threads = 1;
+	}
+
+	vector<double> bc;
+	networks::metrics::centralities::betweenness(G, bc, n_threads);
+	for (node u = 0; u < G->n_nodes(); ++u) {
+		cout << u << ": " << floatpointout_metric(bc[u]) << endl;
+	}
+}
+
+err_type ux_csr
+(const string& graph_type, const string& task, ifstream& fin, bool from_snapshot)
+{
+	string input_graph, format;
+	size_t n;
+
+	// parse input field
+	string field;
+	fin >> field;
+	if (field != "INPUT") {
+		cerr << ERROR("ux_csr.cpp", "ux_csr") << endl;
+		cerr << "    Expected field 'INPUT'." << endl;
+		cerr << "    Instead, '" << field << "' was found." << endl;
+		return err_type::test_format_error;
+	}
+	fin >> n;
+	if (n != 1) {
+		cerr << ERROR("ux_csr.cpp", "ux_csr") << endl;
+		cerr << "    Only one input file is allowed in this test." << endl;
+		cerr << "    Instead, " << n << " were specified." << endl;
+		return err_type::test_format_error;
+	}
+	fin >> input_graph >> format;
+
+	// parse body field
+	fin >> field;
+	if (field != "BODY") {
+		cerr << ERROR("ux_csr.cpp", "ux_csr") << endl;
+		cerr << "    Expected field 'BODY'." << endl;
+		cerr << "    Instead, '" << field << "' was found." << endl;
+		return err_type::test_format_error;
+	}
+
+	uxgraph *G = nullptr;
+	if (graph_type == "directed") {
+		G = new udgraph();
+	}
+	else if (graph_type == "undirected") {
+		G = new uugraph();
+	}
+	else {
+		cerr << ERROR("ux_csr.cpp", "ux_csr") << endl;
+		cerr << "    Wrong value for parameter 'graph_type'." << endl;
+		cerr << "    Received '" << graph_type << "'." << endl;
+		return err_type::invalid_param;
+	}
+
+	err_type r = io_wrapper::read_graph(input_graph, format, G);
+	if (r != err_type::no_error) {
+		if (r == err_type::io_error) {
+			cerr << ERROR("ux_csr.cpp", "ux_csr") << endl;
+			cerr << "    Could not open file '" << input_graph << "'" << endl;
+		}
+		else if (r == err_type::graph_format_error) {
+			cerr << ERROR("ux_csr.cpp", "ux_csr") << endl;
+			cerr << "    Input file format '" << format << "' not supported." << endl;
+		}
+		return r;
+	}
+
+	csr_uxgraph C;
+	if (from_snapshot) {
+		// store the graph in a snapshot and map it back
+		const string snapshot_file = ".tmp.csr-snapshot";
+		if (not io::snapshot::write(snapshot_file, G) or
+			not io::snapshot::map(snapshot_file, &C))
+		{
+			cerr << ERROR("ux_csr.cpp", "ux_csr") << endl;
+			cerr << "    Could not write or map the snapshot '" << snapshot_file << "'." << endl;
+			return err_type::io_error;
+		}
+		// the file stays mapped after removing it
+		remove(snapshot_file.c_str());
+	}
+	else {
+		C.init(G);
+	}
+	delete G;
+	G = nullptr;
+
+	if (task == "distance") {
+		ux_csr_distance(&C, fin);
+	}
+	else if (task == "metric") {
+		ux_csr_metric(&C);
+	}
+	else if (task == "betweenness") {
+		ux_csr_betweenness(&C, fin);
+	}
+	else {
+		cerr << ERROR("ux_csr.cpp", "ux_csr") << endl;
+		cerr << "    Value of parameter 'task' is not valid." << endl;
+		cerr << "    Received: '" << task << "'." << endl;
+		return err_type::invalid_param;
+	}
+
+	return err_type::no_error;
+}
+
+} // -- namespace exe_tests
@@ -0,0 +1,140 @@
+// C++ inlcudes
+#include <iostream>
+using namespace std;
+
+// lgraph includes
+#include <lgraph/data_structures/wugraph.hpp>
+#include <lgraph/data_structures/wdgraph.hpp>
+using namespace lgraph;
+
+// custom includes
+#include "definitions.hpp"
+#include "io_wrapper.hpp"
+#include "wx_check/wx_check.hpp"
+
+namespace exe_tests {
+
+template<typename T>
+err_type wx_check(const string& graph_type, const string& task, ifstream& fin) {
+	string input_graph, format;
+	size_t n;
+
+	// parse input field
+	string field;
+	fin >> field;
+	if (field != "INPUT") {
+		cerr << ERROR("wx_check.cpp", "wx_check") << endl;
+		cerr << "    Expected field 'INPUT'." << endl;
+		cerr << "    Instead, '" << field << "' was found." << endl;
+		return err_type::test_format_error;
+	}
+	fin >> n;
+	if (n != 1) {
+		cerr << ERROR("wx_check.cpp", "wx_check") << endl;
+		cerr << "    Only one input file is allowed in this test." << endl;
+		cerr << "    Instead, " << n << " were specified." << endl;
+		return err_type::test_format_error;
+	}
+	fin >> input_graph >> format;
+
+	// parse body field
+	fin >> field;
+	if (field != "BODY") {
+		cerr << ERROR("wx_check.cpp", "wx_check") << endl;
+		cerr << "    Expected field 'BODY'." << endl;
+		cerr << "    Instead, '" << field << "' was found." << endl;
+		return err_type::test_format_error;
+	}
+
+	wxgraph<T> *G = nullptr;
+	if (graph_type == "directed") {
+		G = new wdgraph<T>();
+	}
+	else if (graph_type == "undirected") {
+		G = new wugraph<T>();
+	}
+	else {
+		cerr << ERROR("wx_check.cpp", "wx_check") << endl;
+		cerr << "    Wrong value for parameter 'graph_type'." << endl;
+		cerr << "    Received '" << graph_type << "'." << endl;
+		return err_type::invalid_param;
+	}
+
+	err_type r = io_wrapper::read_graph(input_graph, format, G);
+	if (r != err_type::no_error) {
+		if (r == err_type::io_error) {
+			cerr << ERROR("wx_check.cpp", "wx_check") << endl;
+			cerr << "    Could not open file '" << input_graph << "'" << endl;
+		}
+		else if (r == err_type::graph_format_error) {
+			cerr << ERROR("wx_check.cpp", "wx_check") << endl;
+			cerr << "    Input file format '" << format << "' not supported." << endl;
+		}
+		delete G;
+		return r;
+	}
+
+	if (task == "visitor") {
+		r = wx_check_visitor(G, fin);
+	}
+	else if (task == "workspace") {
+		r = wx_check_workspace(G, fin);
+	}
+	else if (task == "bidirectional") {
+		r = wx_check_bidirectional(G, fin);
+	}
+	else if (task == "queues") {
+		r = wx_check_queues(G, fin);
+	}
+	else if (task == "dag") {
+		r = wx_check_dag(G, fin);
+	}
+	else if (task == "delta") {
+		r = wx_check_delta_stepping(G, fin);
+	}
+	else if (task == "weights") {
+		r = wx_check_weights(G, fin);
+	}
+	else if (task == "landmarks") {
+		r = wx_check_landmarks(G, fin);
+	}
+	else if (task == "contraction") {
+		r = wx_check_contraction(G, fin);
+	}
+	else if (task == "sampling") {
+		r = wx_check_sampling(G, fin);
+	}
+	else if (task == "pivots") {
+		r = wx_check_pivots(G, fin);
+	}
+	else if (task == "eccentricity") {
+		r = wx_check_eccentricity(G, fin);
+	}
+	else {
+		cerr << ERROR("wx_check.cpp", "wx_check") << endl;
+		cerr << "    Value of parameter 'task' is not valid." << endl;
+		cerr << "    Received: '" << task << "'." << endl;
+		r = err_type::invalid_param;
+	}
+
+	delete G;
+	return r;
+}
+
+err_type wx_check
+(const string& graph_type, const string& weight_type, const string& task, ifstream& fin)
+{
+	if (weight_type == "float") {
+		return wx_check<float>(graph_type, task, fin);
+	}
+	if (weight_type == "uint32") {
+		return wx_check<uint32_t>(graph_type, task, fin);
+	}
+
+	cerr << ERROR("wx_check.cpp", "wx_check") << endl;
+	cerr << "    Value of parameter 'weight_type' is not valid." << endl;
+	cerr << "    Received: '" << weight_type << "'." << endl;
+	return err_type::invalid_param;
+}
+
+} // -- namespace exe_tests
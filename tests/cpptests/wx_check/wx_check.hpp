@@ -0,0 +1,48 @@
+#pragma once
+
+/* Tests that check an algorithm of the library against a simpler (and
+ * already tested) one. Every function prints the results of the algorithm
+ * being tested, and reports in the error output any difference with the
+ * reference algorithm.
+ *
+ * The functions are instantiated for the weight types used in the tests.
+ */
+
+// C++ includes
+#include <fstream>
+using namespace std;
+
+// lgraph includes
+#include <lgraph/data_structures/wxgraph.hpp>
+
+// custom includes
+#include "definitions.hpp"
+
+namespace exe_tests {
+
+template<typename T>
+err_type wx_check_visitor(const lgraph::wxgraph<T> *G, ifstream& fin);
+template<typename T>
+err_type wx_check_workspace(const lgraph::wxgraph<T> *G, ifstream& fin);
+template<typename T>
+err_type wx_check_bidirectional(const lgraph::wxgraph<T> *G, ifstream& fin);
+template<typename T>
+err_type wx_check_queues(const lgraph::wxgraph<T> *G, ifstream& fin);
+template<typename T>
+err_type wx_check_dag(const lgraph::wxgraph<T> *G, ifstream& fin);
+template<typename T>
+err_type wx_check_delta_stepping(const lgraph::wxgraph<T> *G, ifstream& fin);
+template<typename T>
+err_type wx_check_weights(const lgraph::wxgraph<T> *G, ifstream& fin);
+template<typename T>
+err_type wx_check_landmarks(const lgraph::wxgraph<T> *G, ifstream& fin);
+template<typename T>
+err_type wx_check_contraction(const lgraph::wxgraph<T> *G, ifstream& fin);
+template<typename T>
+err_type wx_check_sampling(const lgraph::wxgraph<T> *G, ifstream& fin);
+template<typename T>
+err_type wx_check_pivots(const lgraph::wxgraph<T> *G, ifstream& fin);
+template<typename T>
+err_type wx_check_eccentricity(const lgraph::wxgraph<T> *G, ifstream& fin);
+
+} // -- namespace exe_tests
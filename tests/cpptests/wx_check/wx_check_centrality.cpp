@@ -0,0 +1,211 @@
+// C++ inlcudes
+#include <algorithm>
+#include <functional>
+#include <iostream>
+#include <vector>
+#include <cmath>
+using namespace std;
+
+// lgraph includes
+#include <lgraph/data_structures/csr_wxgraph.hpp>
+#include <lgraph/metrics/centralities_wx.hpp>
+#include <lgraph/utils/random_generator.hpp>
+using namespace lgraph;
+using namespace networks::metrics;
+
+// custom includes
+#include "definitions.hpp"
+#include "test_utils.hpp"
+#include "wx_check/wx_check.hpp"
+using namespace test_utils;
+
+namespace exe_tests {
+
+/* The estimates of a generator with a fixed seed do not depend on the
+ * number of threads, nor on the layout of the graph.
+ */
+
+template<typename T>
+err_type wx_check_sampling(const wxgraph<T> *G, ifstream& fin) {
+	const size_t N = G->n_nodes();
+	const csr_wxgraph<T> C(G);
+
+	vector<double> bc;
+	centralities::betweenness(G, bc);
+
+	string kind;
+	size_t seed;
+	// read the kind of estimate and the seed of the generator: either
+	// "samples" and a number of samples, or "accuracy" and epsilon and delta
+	while (fin >> kind >> seed) {
+		size_t n_samples = 0;
+		double epsilon = 0, delta = 0;
+		if (kind == "samples") {
+			fin >> n_samples;
+		}
+		else if (kind == "accuracy") {
+			fin >> epsilon >> delta;
+		}
+		else {
+			cerr << ERROR("wx_check_centrality.cpp", "wx_check_sampling") << endl;
+			cerr << "    Kind of estimate '" << kind << "' is not valid." << endl;
+			return err_type::test_format_error;
+		}
+
+		vector<vector<double> > estimates;
+		for (size_t n_threads : {1, 2, 4}) {
+			for (bool csr : {false, true}) {
+				utils::drandom_generator<> rg;
+				rg.seed_random_engine(seed);
+				vector<double> est;
+				if (kind == "samples") {
+					csr ? centralities::betweenness(&C, est, n_samples, rg, n_threads)
+						: centralities::betweenness(G, est, n_samples, rg, n_threads);
+				}
+				else {
+					csr ? centralities::betweenness(&C, est, epsilon, delta, rg, n_threads)
+						: centralities::betweenness(G, est, epsilon, delta, rg, n_threads);
+				}
+				estimates.push_back(est);
+			}
+		}
+		for (size_t i = 1; i < estimates.size(); ++i) {
+			if (estimates[i] != estimates[0]) {
+				cerr << ERROR("wx_check_centrality.cpp", "wx_check_sampling") << endl;
+				cerr << "    The estimates with seed " << seed << " depend on the "
+					 << "number of threads or on the graph's layout." << endl;
+				return err_type::test_error;
+			}
+		}
+
+		double max_error = 0;
+		for (node u = 0; u < N; ++u) {
+			max_error = max(max_error, abs(estimates[0][u] - bc[u]));
+		}
+		if (kind == "accuracy" and max_error > epsilon) {
+			cerr << ERROR("wx_check_centrality.cpp", "wx_check_sampling") << endl;
+			cerr << "    An estimate with seed " << seed << " has an error larger than "
+				 << floatpointout_metric(epsilon) << "." << endl;
+			cerr << "    Error: " << floatpointout_metric(max_error) << endl;
+			return err_type::test_error;
+		}
+
+		cout << kind << " " << seed << ": maximum error "
+			 << floatpointout_metric(max_error) << endl;
+	}
+	return err_type::no_error;
+}
+
+// the closeness of a node, and the mean closeness, are estimated
+// within their confidence intervals
+inline bool in_interval(double lo, double x, double hi) {
+	return lo - 1.0e-9 <= x and x <= hi + 1.0e-9;
+}
+
+template<typename T>
+err_type wx_check_pivots(const wxgraph<T> *G, ifstream& fin) {
+	const size_t N = G->n_nodes();
+	const csr_wxgraph<T> C(G);
+
+	vector<double> cc;
+	centralities::closeness(G, cc);
+	const double mcc = centralities::mcc(G, cc);
+
+	size_t seed, n_pivots, top_k;
+	// read the seed of the generator, the number of pivots and
+	// the number of most central nodes whose closeness is refined
+	while (fin >> seed >> n_pivots >> top_k) {
+		vector<vector<double> > estimates;
+		vector<double> mcc_estimates;
+		vector<double> lo, hi;
+		double mcc_lo = 0, mcc_hi = 0;
+		for (size_t n_threads : {1, 3}) {
+			for (bool csr : {false, true}) {
+				utils::drandom_generator<> rg;
+				rg.seed_random_engine(seed);
+				vector<double> est;
+				csr ? centralities::closeness(&C, est, lo, hi, n_pivots, rg, 0.95, top_k, n_threads)
+					: centralities::closeness(G, est, lo, hi, n_pivots, rg, 0.95, top_k, n_threads);
+				estimates.push_back(est);
+
+				rg.seed_random_engine(seed);
+				mcc_estimates.push_back(
+					csr ? centralities::mcc(&C, n_pivots, rg, mcc_lo, mcc_hi, 0.95, n_threads)
+						: centralities::mcc(G, n_pivots, rg, mcc_lo, mcc_hi, 0.95, n_threads)
+				);
+			}
+		}
+		for (size_t i = 1; i < estimates.size(); ++i) {
+			if (estimates[i] != estimates[0] or mcc_estimates[i] != mcc_estimates[0]) {
+				cerr << ERROR("wx_check_centrality.cpp", "wx_check_pivots") << endl;
+				cerr << "    The estimates with seed " << seed << " depend on the "
+					 << "number of threads or on the graph's layout." << endl;
+				return err_type::test_error;
+			}
+		}
+
+		// with all nodes as pivots the estimates are exact
+		const bool all_pivots = (n_pivots >= N);
+		size_t n_contained = 0;
+		size_t n_exact = 0;
+		for (node u = 0; u < N; ++u) {
+			const double e = estimates[0][u];
+			if (not in_interval(lo[u], e, hi[u]) or
+				(all_pivots and abs(e - cc[u]) > 1.0e-9*max(1.0, cc[u])))
+			{
+				cerr << ERROR("wx_check_centrality.cpp", "wx_check_pivots") << endl;
+				cerr << "    Wrong closeness of node " << u << " with seed " << seed
+					 << " and " << n_pivots << " pivots." << endl;
+				cerr << "    Estimate: " << floatpointout_metric(e) << " in ["
+					 << floatpointout_metric(lo[u]) << ", "
+					 << floatpointout_metric(hi[u]) << "]" << endl;
+				cerr << "    Closeness: " << floatpointout_metric(cc[u]) << endl;
+				return err_type::test_error;
+			}
+			n_contained += in_interval(lo[u], cc[u], hi[u]);
+			n_exact += (lo[u] == hi[u]);
+		}
+
+		// if all intervals are correct, the nodes more central than
+		// the 'top_k'-th most central one have their exact closeness
+		if (top_k > 0 and top_k <= N and n_contained == N) {
+			vector<double> sorted_cc = cc;
+			sort(sorted_cc.begin(), sorted_cc.end(), greater<double>());
+			for (node u = 0; u < N; ++u) {
+				if (cc[u] > sorted_cc[top_k - 1] and lo[u] != hi[u]) {
+					cerr << ERROR("wx_check_centrality.cpp", "wx_check_pivots") << endl;
+					cerr << "    The closeness of node " << u << ", among the "
+						 << top_k << " most central, is not exact." << endl;
+					return err_type::test_error;
+				}
+			}
+		}
+		if (not in_interval(mcc_lo, mcc_estimates[0], mcc_hi) or
+			(all_pivots and abs(mcc_estimates[0] - mcc) > 1.0e-9*max(1.0, mcc)))
+		{
+			cerr << ERROR("wx_check_centrality.cpp", "wx_check_pivots") << endl;
+			cerr << "    Wrong mean closeness with seed " << seed
+				 << " and " << n_pivots << " pivots." << endl;
+			cerr << "    Estimate: " << floatpointout_metric(mcc_estimates[0]) << " in ["
+				 << floatpointout_metric(mcc_lo) << ", "
+				 << floatpointout_metric(mcc_hi) << "]" << endl;
+			cerr << "    Mean closeness: " << floatpointout_metric(mcc) << endl;
+			return err_type::test_error;
+		}
+
+		cout << "seed " << seed << ", " << n_pivots << " pivots, top " << top_k << ": "
+			 << n_contained << " intervals contain the closeness, "
+			 << n_exact << " exact" << endl;
+		cout << "    mean closeness " << floatpointout_metric(mcc_estimates[0]) << " in ["
+			 << floatpointout_metric(mcc_lo) << ", " << floatpointout_metric(mcc_hi)
+			 << "], exact " << floatpointout_metric(mcc) << endl;
+	}
+	return err_type::no_error;
+}
+
+template err_type wx_check_sampling(const wxgraph<float> *G, ifstream& fin);
+template err_type wx_check_sampling(const wxgraph<uint32_t> *G, ifstream& fin);
+template err_type wx_check_pivots(const wxgraph<float> *G, ifstream& fin);
+template err_type wx_check_pivots(const wxgraph<uint32_t> *G, ifstream& fin);
+
+} // -- namespace exe_tests
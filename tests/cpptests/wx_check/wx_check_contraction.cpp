@@ -0,0 +1,102 @@
+// C++ inlcudes
+#include <iostream>
+#include <vector>
+using namespace std;
+
+// lgraph includes
+#include <lgraph/data_structures/contraction_hierarchy.hpp>
+#include <lgraph/data_structures/csr_wxgraph.hpp>
+#include <lgraph/data_structures/node_path.hpp>
+#include <lgraph/graph_traversal/traversal_wx.hpp>
+using namespace lgraph;
+using namespace traversal;
+
+// custom includes
+#include "definitions.hpp"
+#include "test_utils.hpp"
+#include "wx_check/wx_check.hpp"
+using namespace test_utils;
+
+namespace exe_tests {
+
+template<typename T>
+err_type wx_check_contraction(const wxgraph<T> *G, ifstream& fin) {
+	const size_t N = G->n_nodes();
+	const csr_wxgraph<T> C(G);
+
+	contraction_hierarchy<T> ch, ch_csr;
+	wxcontract(G, ch);
+	wxcontract(&C, ch_csr);
+
+	// the ranks are a permutation of the nodes, and
+	// the hierarchy does not depend on the graph's layout
+	vector<bool> rank_used(N, false);
+	for (node u = 0; u < N; ++u) {
+		const size_t r = ch.rank(u);
+		if (ch.n_nodes() != N or ch.is_directed() != G->is_directed() or
+			r >= N or rank_used[r] or r != ch_csr.rank(u) or
+			ch.n_edges() != ch_csr.n_edges() or ch.n_shortcuts() != ch_csr.n_shortcuts())
+		{
+			cerr << ERROR("wx_check_contraction.cpp", "wx_check_contraction") << endl;
+			cerr << "    Wrong contraction hierarchy." << endl;
+			cerr << "    Rank of node " << u << ": " << r
+				 << " (compressed graph: " << ch_csr.rank(u) << ")" << endl;
+			cerr << "    Edges: " << ch.n_edges()
+				 << " (compressed graph: " << ch_csr.n_edges() << ")" << endl;
+			cerr << "    Shortcuts: " << ch.n_shortcuts()
+				 << " (compressed graph: " << ch_csr.n_shortcuts() << ")" << endl;
+			return err_type::test_error;
+		}
+		rank_used[r] = true;
+	}
+
+	// the same workspaces for all queries
+	workspace<T> wf, wb;
+	size_t n_reachable = 0;
+	for (node s = 0; s < N; ++s) {
+		vector<T> ds;
+		wxdistance(G, s, ds);
+
+		for (node t = 0; t < N; ++t) {
+			const T d = wxdistance_contracted(ch, s, t);
+			const T d_ws = wxdistance_contracted(ch_csr, s, t, &wf, &wb);
+			node_path<T> p, p_ws;
+			wxpath_contracted(ch, s, t, p);
+			wxpath_contracted(ch_csr, s, t, p_ws, &wf, &wb);
+
+			if (not same_distance(d, ds[t]) or not same_distance(d_ws, ds[t]) or
+				not is_shortest_path(G, p, s, t, ds[t]) or
+				not is_shortest_path(G, p_ws, s, t, ds[t]))
+			{
+				cerr << ERROR("wx_check_contraction.cpp", "wx_check_contraction") << endl;
+				cerr << "    Wrong distance from " << s << " to " << t << "." << endl;
+				cerr << "    Hierarchy: " << floatpointout_dist(d) << ", path " << p << endl;
+				cerr << "    Hierarchy (workspaces): " << floatpointout_dist(d_ws)
+					 << ", path " << p_ws << endl;
+				cerr << "    wxdistance: " << floatpointout_dist(ds[t]) << endl;
+				return err_type::test_error;
+			}
+			n_reachable += (ds[t] != inf_t<T>());
+		}
+	}
+	cout << N*N << " pairs, " << n_reachable << " reachable" << endl;
+	cout << ch.n_edges() << " edges, " << ch.n_shortcuts() << " shortcuts" << endl;
+
+	node s, t;
+	// read pairs of nodes whose path is shown
+	while (fin >> s >> t) {
+		node_path<T> p;
+		wxpath_contracted(ch, s, t, p, &wf, &wb);
+		cout << s << " " << t << ": " << floatpointout_dist(wxdistance_contracted(ch, s, t));
+		if (p.size() > 0) {
+			cout << " | " << p.to_string();
+		}
+		cout << endl;
+	}
+	return err_type::no_error;
+}
+
+template err_type wx_check_contraction(const wxgraph<float> *G, ifstream& fin);
+template err_type wx_check_contraction(const wxgraph<uint32_t> *G, ifstream& fin);
+
+} // -- namespace exe_tests
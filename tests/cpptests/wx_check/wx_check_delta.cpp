@@ -0,0 +1,70 @@
+// C++ inlcudes
+#include <iostream>
+#include <vector>
+using namespace std;
+
+// lgraph includes
+#include <lgraph/data_structures/csr_wxgraph.hpp>
+#include <lgraph/graph_traversal/delta_stepping.hpp>
+#include <lgraph/graph_traversal/traversal_wx.hpp>
+using namespace lgraph;
+using namespace traversal;
+
+// custom includes
+#include "definitions.hpp"
+#include "test_utils.hpp"
+#include "wx_check/wx_check.hpp"
+using namespace test_utils;
+
+namespace exe_tests {
+
+template<typename T>
+err_type wx_check_delta_stepping(const wxgraph<T> *G, ifstream& fin) {
+	const size_t N = G->n_nodes();
+	const csr_wxgraph<T> C(G);
+
+	// distances from every node with Dijkstra's algorithm
+	vector<vector<T> > ds(N);
+	for (node s = 0; s < N; ++s) {
+		wxdistance(G, s, ds[s]);
+	}
+
+	cout << "default width " << floatpointout_dist(delta_stepping_width<T>(G)) << endl;
+
+	T delta;
+	size_t n_threads;
+	// read the width of the buckets (0 for the default
+	// one) and the number of threads
+	while (fin >> delta >> n_threads) {
+		size_t n_reached = 0;
+		for (node s = 0; s < N; ++s) {
+			vector<T> dg, dc;
+			wxdistance_delta_stepping(G, s, dg, delta, n_threads);
+			wxdistance_delta_stepping(&C, s, dc, delta, n_threads);
+
+			for (node t = 0; t < N; ++t) {
+				if (not same_distance(dg[t], ds[s][t]) or
+					not same_distance(dc[t], ds[s][t]))
+				{
+					cerr << ERROR("wx_check_delta.cpp", "wx_check_delta_stepping") << endl;
+					cerr << "    Wrong distance from " << s << " to " << t
+						 << " with delta " << floatpointout_dist(delta)
+						 << " and " << n_threads << " threads." << endl;
+					cerr << "    Graph: " << floatpointout_dist(dg[t]) << endl;
+					cerr << "    Compressed graph: " << floatpointout_dist(dc[t]) << endl;
+					cerr << "    wxdistance: " << floatpointout_dist(ds[s][t]) << endl;
+					return err_type::test_error;
+				}
+				n_reached += (ds[s][t] != inf_t<T>());
+			}
+		}
+		cout << "delta " << floatpointout_dist(delta) << ", " << n_threads
+			 << " threads: " << n_reached << " pairs reachable" << endl;
+	}
+	return err_type::no_error;
+}
+
+template err_type wx_check_delta_stepping(const wxgraph<float> *G, ifstream& fin);
+template err_type wx_check_delta_stepping(const wxgraph<uint32_t> *G, ifstream& fin);
+
+} // -- namespace exe_tests
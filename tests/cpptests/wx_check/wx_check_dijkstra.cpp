@@ -0,0 +1,369 @@
+// C++ inlcudes
+#include <iostream>
+#include <type_traits>
+#include <vector>
+using namespace std;
+
+// lgraph includes
+#include <lgraph/data_structures/csr_wxgraph.hpp>
+#include <lgraph/data_structures/node_path.hpp>
+#include <lgraph/graph_traversal/dijkstra.hpp>
+#include <lgraph/graph_traversal/traversal_wx.hpp>
+#include <lgraph/graph_traversal/workspace.hpp>
+using namespace lgraph;
+using namespace traversal;
+using namespace dijkstra;
+
+// custom includes
+#include "definitions.hpp"
+#include "test_utils.hpp"
+#include "wx_check/wx_check.hpp"
+using namespace test_utils;
+
+namespace exe_tests {
+
+// counts the nodes visited by a Dijkstra and the neighbours pushed
+struct djka_counter {
+	size_t *n_visited;
+	size_t *n_pushed;
+
+	template<class G_t, typename T>
+	void operator() (const G_t *, const djka_node<T>&, const vector<bool>&) const {
+		++(*n_visited);
+	}
+	template<class G_t, typename T>
+	bool operator() (const G_t *, node, node, const T&, const vector<bool>&) const {
+		++(*n_pushed);
+		return true;
+	}
+};
+
+template<typename T>
+err_type wx_check_visitor(const wxgraph<T> *G, ifstream& fin) {
+	const size_t N = G->n_nodes();
+	const csr_wxgraph<T> C(G);
+
+	node s, t;
+	// read pairs of nodes
+	while (fin >> s >> t) {
+		// visitor-based Dijkstra from 's' that stops at 't'
+		vector<djka_node<T> > order;
+		T dist_t = inf_t<T>();
+		Dijkstra<T, indexed_heap<T> >(
+			G, s,
+			[&](const wxgraph<T> *, const djka_node<T>& u, const vector<bool>&) -> bool {
+				return u.second == t;
+			},
+			[&](const wxgraph<T> *, const djka_node<T>& u, const vector<bool>&) -> void {
+				order.push_back(u);
+				if (u.second == t) {
+					dist_t = u.first;
+				}
+			}
+		);
+
+		cout << s << " " << t << ": " << floatpointout_dist(dist_t) << " |";
+		for (const djka_node<T>& u : order) {
+			cout << " " << u.second;
+		}
+		cout << endl;
+
+		const T d = wxdistance(G, s, t);
+		if (not same_distance(dist_t, d)) {
+			cerr << ERROR("wx_check_dijkstra.cpp", "wx_check_visitor") << endl;
+			cerr << "    Distance from " << s << " to " << t << " is wrong." << endl;
+			cerr << "    Visitor-based Dijkstra: " << floatpointout_dist(dist_t) << endl;
+			cerr << "    wxdistance: " << floatpointout_dist(d) << endl;
+			return err_type::test_error;
+		}
+
+		// the nodes are settled in the same order with a lazy heap,
+		// and on the compressed graph
+		vector<djka_node<T> > order_lazy;
+		Dijkstra<T, lazy_heap<T> >(
+			G, s,
+			[&](const wxgraph<T> *, const djka_node<T>& u, const vector<bool>&) -> bool {
+				return u.second == t;
+			},
+			[&](const wxgraph<T> *, const djka_node<T>& u, const vector<bool>&) -> void {
+				order_lazy.push_back(u);
+			}
+		);
+		vector<djka_node<T> > order_csr;
+		Dijkstra<T, indexed_heap<T> >(
+			&C, s,
+			[&](const csr_wxgraph<T> *, const djka_node<T>& u, const vector<bool>&) -> bool {
+				return u.second == t;
+			},
+			[&](const csr_wxgraph<T> *, const djka_node<T>& u, const vector<bool>&) -> void {
+				order_csr.push_back(u);
+			}
+		);
+		if (order_lazy != order or order_csr != order) {
+			cerr << ERROR("wx_check_dijkstra.cpp", "wx_check_visitor") << endl;
+			cerr << "    Different order of the nodes visited from " << s << "." << endl;
+			return err_type::test_error;
+		}
+
+		// a functor visiting the whole component of 's'
+		size_t n_visited = 0;
+		size_t n_pushed = 0;
+		const djka_counter count{&n_visited, &n_pushed};
+		Dijkstra<T>(G, s, djka_no_op(), count, count);
+
+		vector<T> ds;
+		wxdistance(G, s, ds);
+		size_t n_reached = 0;
+		size_t n_reached_edges = 0;
+		for (node u = 0; u < N; ++u) {
+			if (ds[u] != inf_t<T>()) {
+				++n_reached;
+				n_reached_edges += G->get_neighbours(u).size();
+			}
+		}
+		if (n_visited != n_reached or n_pushed != n_reached_edges) {
+			cerr << ERROR("wx_check_dijkstra.cpp", "wx_check_visitor") << endl;
+			cerr << "    Wrong number of nodes or edges visited from " << s << "." << endl;
+			cerr << "    Visitor-based Dijkstra: " << n_visited << " nodes, "
+				 << n_pushed << " edges." << endl;
+			cerr << "    wxdistance: " << n_reached << " nodes, "
+				 << n_reached_edges << " edges." << endl;
+			return err_type::test_error;
+		}
+	}
+	return err_type::no_error;
+}
+
+template<typename T>
+err_type wx_check_workspace(const wxgraph<T> *G, ifstream& fin) {
+	const size_t N = G->n_nodes();
+
+	// number of rounds of queries from every node
+	size_t n_rounds;
+	fin >> n_rounds;
+
+	// the same workspace for all queries
+	workspace<T> ws;
+	for (size_t r = 0; r < n_rounds; ++r) {
+		double sum = 0;
+		size_t n_reached = 0;
+		for (size_t i = 0; i < N; ++i) {
+			// the sources in a different order in every round
+			const node s = (i*7 + r*3)%N;
+			vector<T> ds;
+			wxdistance(G, s, ds);
+
+			// a query that stops at a target ...
+			const node t = (s*31 + r)%N;
+			const T d = wxdistance(G, s, t, &ws);
+			if (not same_distance(d, ds[t])) {
+				cerr << ERROR("wx_check_dijkstra.cpp", "wx_check_workspace") << endl;
+				cerr << "    Wrong distance from " << s << " to " << t
+					 << " in round " << r << "." << endl;
+				cerr << "    Reusing the workspace: " << floatpointout_dist(d) << endl;
+				cerr << "    Fresh memory: " << floatpointout_dist(ds[t]) << endl;
+				return err_type::test_error;
+			}
+
+			// ... followed by one to all nodes, that
+			// must not see anything of the previous ones
+			wxdistance(G, s, ws);
+			size_t n_finite = 0;
+			for (node v = 0; v < N; ++v) {
+				if (not same_distance(ws.distance(v), ds[v]) or
+					ws.is_visited(v) != (ds[v] != inf_t<T>()))
+				{
+					cerr << ERROR("wx_check_dijkstra.cpp", "wx_check_workspace") << endl;
+					cerr << "    Wrong distance from " << s << " to " << v
+						 << " in round " << r << "." << endl;
+					cerr << "    Reusing the workspace: "
+						 << floatpointout_dist(ws.distance(v))
+						 << (ws.is_visited(v) ? " (visited)" : "") << endl;
+					cerr << "    Fresh memory: " << floatpointout_dist(ds[v]) << endl;
+					return err_type::test_error;
+				}
+				if (ds[v] != inf_t<T>()) {
+					sum += static_cast<double>(ds[v]);
+					++n_finite;
+				}
+			}
+			if (ws.visited_nodes().size() != n_finite) {
+				cerr << ERROR("wx_check_dijkstra.cpp", "wx_check_workspace") << endl;
+				cerr << "    Wrong number of visited nodes from " << s
+					 << " in round " << r << "." << endl;
+				return err_type::test_error;
+			}
+			n_reached += n_finite;
+		}
+		cout << "round " << r << ": " << n_reached << " nodes reached, "
+			 << "sum of distances " << floatpointout_dist(sum) << endl;
+	}
+	return err_type::no_error;
+}
+
+template<typename T>
+err_type wx_check_bidirectional(const wxgraph<T> *G, ifstream& fin) {
+	const size_t N = G->n_nodes();
+	const csr_wxgraph<T> C(G);
+	csr_wxgraph<T> R;
+	R.init_reverse(G);
+	// undirected graphs are their own reverse
+	const csr_wxgraph<T> *Rp = (G->is_directed() ? &R : nullptr);
+
+	workspace<T> wf, wb;
+	size_t n_reachable = 0;
+	for (node s = 0; s < N; ++s) {
+		vector<T> dist;
+		wxdistance(G, s, dist);
+
+		for (node t = 0; t < N; ++t) {
+			const T d = dist[t];
+			n_reachable += (d != inf_t<T>());
+
+			const T d_graph = wxdistance_bidirectional(G, Rp, s, t, &wf, &wb);
+			const T d_csr = wxdistance_bidirectional(&C, Rp, s, t, &wf, &wb);
+			node_path<T> p_graph, p_csr;
+			wxpath_bidirectional(G, Rp, s, t, p_graph, &wf, &wb);
+			wxpath_bidirectional(&C, Rp, s, t, p_csr, &wf, &wb);
+
+			// the nodes where the two traversals meet
+			node u, v;
+			const T d_djka = bidirectional_Dijkstra<T>(G, &R, s, t, wf, wb, u, v);
+			bool meet = true;
+			if (d != inf_t<T>()) {
+				meet =
+					(s == t ? u == s and v == s : G->has_edge(u, v)) and
+					same_distance<T>(
+						wf.distance(u) + (s == t ? 0 : G->edge_weight(u, v)) + wb.distance(v), d
+					);
+			}
+
+			if (not same_distance(d_graph, d) or not same_distance(d_csr, d) or
+				not same_distance(d_djka, d) or not meet or
+				not is_shortest_path(G, p_graph, s, t, d) or
+				not is_shortest_path(G, p_csr, s, t, d))
+			{
+				cerr << ERROR("wx_check_dijkstra.cpp", "wx_check_bidirectional") << endl;
+				cerr << "    Wrong distance or path from " << s << " to " << t << "." << endl;
+				cerr << "    Expected: " << floatpointout_dist(d) << endl;
+				cerr << "    Graph: " << floatpointout_dist(d_graph)
+					 << ", path: " << p_graph << endl;
+				cerr << "    Compressed graph: " << floatpointout_dist(d_csr)
+					 << ", path: " << p_csr << endl;
+				cerr << "    bidirectional_Dijkstra: " << floatpointout_dist(d_djka)
+					 << ", meeting at (" << u << "," << v << ")" << endl;
+				return err_type::test_error;
+			}
+		}
+	}
+	cout << N*N << " pairs, " << n_reachable << " reachable" << endl;
+
+	node s, t;
+	// read pairs of nodes whose path is shown
+	while (fin >> s >> t) {
+		node_path<T> p;
+		wxpath_bidirectional(G, Rp, s, t, p, &wf, &wb);
+		cout << s << " " << t << ": "
+			 << floatpointout_dist(wxdistance_bidirectional(G, Rp, s, t));
+		if (p.size() > 0) {
+			cout << " | " << p.to_string();
+		}
+		cout << endl;
+	}
+	return err_type::no_error;
+}
+
+// Dijkstra from 's' with the queue 'queue_t' reaches the nodes at the
+// distances in 'ds', and visits every node once
+template<typename T, class queue_t>
+bool same_distances_queue
+(const wxgraph<T> *G, node s, const vector<T>& ds, workspace<T>& ws, const string& name)
+{
+	const size_t N = G->n_nodes();
+	vector<T> dq(N, inf_t<T>());
+	bool twice = false;
+	Dijkstra<T, queue_t>(
+		G, s, djka_no_op(),
+		[&](const wxgraph<T> *, const djka_node<T>& u, const vector<bool>&) -> void {
+			twice = twice or dq[u.second] != inf_t<T>();
+			dq[u.second] = u.first;
+		},
+		djka_always_add(), &ws
+	);
+
+	for (node u = 0; u < N; ++u) {
+		if (twice or not same_distance(dq[u], ds[u])) {
+			cerr << ERROR("wx_check_dijkstra.cpp", "same_distances_queue") << endl;
+			cerr << "    Wrong distance from " << s << " to " << u
+				 << " with the " << name << "." << endl;
+			cerr << "    Distance: " << floatpointout_dist(dq[u]) << endl;
+			cerr << "    wxdistance: " << floatpointout_dist(ds[u]) << endl;
+			if (twice) {
+				cerr << "    Some node was visited twice." << endl;
+			}
+			return false;
+		}
+	}
+	return true;
+}
+
+// the radix heap only takes integral distances
+template<typename T>
+bool same_distances_radix
+(const wxgraph<T> *G, node s, const vector<T>& ds, workspace<T>& ws, true_type)
+{
+	return same_distances_queue<T, radix_heap<T> >(G, s, ds, ws, "radix heap");
+}
+template<typename T>
+bool same_distances_radix
+(const wxgraph<T> *, node, const vector<T>&, workspace<T>&, false_type)
+{
+	return true;
+}
+
+template<typename T>
+err_type wx_check_queues(const wxgraph<T> *G, ifstream& fin) {
+	const size_t N = G->n_nodes();
+
+	// the same workspace for all queues
+	workspace<T> ws;
+	node s;
+	// read the sources
+	while (fin >> s) {
+		vector<T> ds;
+		wxdistance(G, s, ds);
+
+		if (not same_distances_queue<T, indexed_heap<T,2> >(G, s, ds, ws, "binary heap") or
+			not same_distances_queue<T, indexed_heap<T,4> >(G, s, ds, ws, "4-ary heap") or
+			not same_distances_queue<T, indexed_heap<T,8> >(G, s, ds, ws, "8-ary heap") or
+			not same_distances_queue<T, lazy_heap<T> >(G, s, ds, ws, "lazy heap") or
+			not same_distances_radix(G, s, ds, ws, is_integral<T>()))
+		{
+			return err_type::test_error;
+		}
+
+		size_t n_reached = 0;
+		double sum = 0;
+		for (node u = 0; u < N; ++u) {
+			if (ds[u] != inf_t<T>()) {
+				++n_reached;
+				sum += static_cast<double>(ds[u]);
+			}
+		}
+		cout << s << ": " << n_reached << " nodes reached, "
+			 << "sum of distances " << floatpointout_dist(sum) << endl;
+	}
+	return err_type::no_error;
+}
+
+template err_type wx_check_visitor(const wxgraph<float> *G, ifstream& fin);
+template err_type wx_check_workspace(const wxgraph<float> *G, ifstream& fin);
+template err_type wx_check_bidirectional(const wxgraph<float> *G, ifstream& fin);
+template err_type wx_check_queues(const wxgraph<float> *G, ifstream& fin);
+
+template err_type wx_check_visitor(const wxgraph<uint32_t> *G, ifstream& fin);
+template err_type wx_check_workspace(const wxgraph<uint32_t> *G, ifstream& fin);
+template err_type wx_check_bidirectional(const wxgraph<uint32_t> *G, ifstream& fin);
+template err_type wx_check_queues(const wxgraph<uint32_t> *G, ifstream& fin);
+
+} // -- namespace exe_tests
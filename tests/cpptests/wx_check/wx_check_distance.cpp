@@ -0,0 +1,98 @@
+// C++ inlcudes
+#include <algorithm>
+#include <iostream>
+#include <vector>
+using namespace std;
+
+// lgraph includes
+#include <lgraph/data_structures/csr_wxgraph.hpp>
+#include <lgraph/graph_traversal/traversal_wx.hpp>
+#include <lgraph/metrics/distance_wx.hpp>
+using namespace lgraph;
+using namespace traversal;
+using namespace networks::metrics;
+
+// custom includes
+#include "definitions.hpp"
+#include "test_utils.hpp"
+#include "wx_check/wx_check.hpp"
+using namespace test_utils;
+
+namespace exe_tests {
+
+template<typename T>
+err_type wx_check_eccentricity(const wxgraph<T> *G, ifstream&) {
+	const size_t N = G->n_nodes();
+	const csr_wxgraph<T> C(G);
+	if (G->is_directed()) {
+		cerr << ERROR("wx_check_distance.cpp", "wx_check_eccentricity") << endl;
+		cerr << "    The graph must be undirected." << endl;
+		return err_type::test_format_error;
+	}
+
+	// the eccentricity of every node: the largest
+	// distance to the nodes reachable from it
+	vector<T> ecc(N, 0);
+	for (node s = 0; s < N; ++s) {
+		vector<T> ds;
+		wxdistance(G, s, ds);
+		for (node t = 0; t < N; ++t) {
+			if (ds[t] != inf_t<T>()) {
+				ecc[s] = max(ecc[s], ds[t]);
+			}
+		}
+	}
+	const T D = (N == 0 ? 0 : *max_element(ecc.begin(), ecc.end()));
+	const T R = (N == 0 ? 0 : *min_element(ecc.begin(), ecc.end()));
+
+	for (bool csr : {false, true}) {
+		T Dg = 0, Rg = 0;
+		vector<T> lo, hi;
+		csr ? distance::diameter_radius(&C, Dg, Rg, &lo, &hi)
+			: distance::diameter_radius(G, Dg, Rg, &lo, &hi);
+		const T max_dist = (csr ? distance::max_distance(&C) : distance::max_distance(G));
+
+		bool bounds_ok = (lo.size() == N and hi.size() == N);
+		for (node u = 0; bounds_ok and u < N; ++u) {
+			bounds_ok =
+				(lo[u] <= ecc[u] or same_distance(lo[u], ecc[u])) and
+				(ecc[u] <= hi[u] or same_distance(ecc[u], hi[u]));
+		}
+		if (not same_distance(Dg, D) or not same_distance(Rg, R) or
+			not same_distance(max_dist, D) or not bounds_ok)
+		{
+			cerr << ERROR("wx_check_distance.cpp", "wx_check_eccentricity") << endl;
+			cerr << "    Wrong diameter or radius" << (csr ? " of the compressed graph." : ".") << endl;
+			cerr << "    Diameter: " << floatpointout_dist(Dg)
+				 << ", expected " << floatpointout_dist(D) << endl;
+			cerr << "    Radius: " << floatpointout_dist(Rg)
+				 << ", expected " << floatpointout_dist(R) << endl;
+			cerr << "    Maximum distance: " << floatpointout_dist(max_dist) << endl;
+			for (node u = 0; u < min(N, min(lo.size(), hi.size())); ++u) {
+				cerr << "    " << u << ": " << floatpointout_dist(lo[u])
+					 << " <= " << floatpointout_dist(ecc[u])
+					 << " <= " << floatpointout_dist(hi[u]) << endl;
+			}
+			return err_type::test_error;
+		}
+
+		// without the bounds
+		csr ? distance::diameter_radius(&C, Dg, Rg) : distance::diameter_radius(G, Dg, Rg);
+		if (not same_distance(Dg, D) or not same_distance(Rg, R)) {
+			cerr << ERROR("wx_check_distance.cpp", "wx_check_eccentricity") << endl;
+			cerr << "    Wrong diameter or radius without the bounds." << endl;
+			return err_type::test_error;
+		}
+	}
+
+	cout << "diameter " << floatpointout_dist(D) << ", radius " << floatpointout_dist(R) << endl;
+	for (node u = 0; u < N; ++u) {
+		cout << u << ": " << floatpointout_dist(ecc[u]) << endl;
+	}
+	return err_type::no_error;
+}
+
+template err_type wx_check_eccentricity(const wxgraph<float> *G, ifstream& fin);
+template err_type wx_check_eccentricity(const wxgraph<uint32_t> *G, ifstream& fin);
+
+} // -- namespace exe_tests
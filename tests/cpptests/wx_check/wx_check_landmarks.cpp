@@ -0,0 +1,183 @@
+// C includes
+#include <stdio.h>
+
+// C++ inlcudes
+#include <fstream>
+#include <iostream>
+#include <type_traits>
+#include <vector>
+using namespace std;
+
+// lgraph includes
+#include <lgraph/data_structures/csr_wxgraph.hpp>
+#include <lgraph/data_structures/landmark_index.hpp>
+#include <lgraph/data_structures/node_path.hpp>
+#include <lgraph/graph_traversal/traversal_wx.hpp>
+#include <lgraph/io/snapshot_landmarks.hpp>
+using namespace lgraph;
+using namespace traversal;
+
+// custom includes
+#include "definitions.hpp"
+#include "test_utils.hpp"
+#include "wx_check/wx_check.hpp"
+using namespace test_utils;
+
+namespace exe_tests {
+
+// the two indices hold the same landmarks and distances
+template<typename T>
+bool same_index(const landmark_index<T>& a, const landmark_index<T>& b) {
+	return
+		a.n_nodes() == b.n_nodes() and a.is_directed() == b.is_directed() and
+		a.get_landmarks() == b.get_landmarks() and
+		a.get_from() == b.get_from() and a.get_to() == b.get_to();
+}
+
+// the index survives a round trip through a snapshot, and the
+// snapshot cannot be read as an index of another type, nor when
+// it is truncated
+template<typename T>
+err_type check_snapshot(const landmark_index<T>& idx) {
+	typedef typename conditional<is_integral<T>::value, float, uint32_t>::type other_t;
+
+	const string snapshot_file = ".tmp.landmarks-snapshot";
+	landmark_index<T> read_idx;
+	landmark_index<other_t> other_idx;
+	if (not io::snapshot::write(snapshot_file, idx) or
+		not io::snapshot::read(snapshot_file, read_idx))
+	{
+		cerr << ERROR("wx_check_landmarks.cpp", "check_snapshot") << endl;
+		cerr << "    Could not write or read the snapshot '" << snapshot_file << "'." << endl;
+		return err_type::io_error;
+	}
+	if (not same_index(idx, read_idx)) {
+		cerr << ERROR("wx_check_landmarks.cpp", "check_snapshot") << endl;
+		cerr << "    The index read from the snapshot is not the one written." << endl;
+		return err_type::test_error;
+	}
+	if (io::snapshot::read(snapshot_file, other_idx)) {
+		cerr << ERROR("wx_check_landmarks.cpp", "check_snapshot") << endl;
+		cerr << "    The snapshot was read as an index of another type." << endl;
+		return err_type::test_error;
+	}
+
+	// drop the last distance
+	ifstream fsnap(snapshot_file, ios::binary);
+	const string bytes((istreambuf_iterator<char>(fsnap)), istreambuf_iterator<char>());
+	fsnap.close();
+	ofstream ftrunc(snapshot_file, ios::binary);
+	ftrunc.write(bytes.data(), bytes.size() - sizeof(T));
+	ftrunc.close();
+	const bool read_truncated = io::snapshot::read(snapshot_file, read_idx);
+	remove(snapshot_file.c_str());
+	if (read_truncated) {
+		cerr << ERROR("wx_check_landmarks.cpp", "check_snapshot") << endl;
+		cerr << "    A truncated snapshot was read." << endl;
+		return err_type::test_error;
+	}
+	return err_type::no_error;
+}
+
+template<typename T>
+err_type wx_check_landmarks(const wxgraph<T> *G, ifstream& fin) {
+	const size_t N = G->n_nodes();
+	const csr_wxgraph<T> C(G);
+	csr_wxgraph<T> R;
+	R.init_reverse(G);
+	// undirected graphs are their own reverse
+	const csr_wxgraph<T> *Rp = (G->is_directed() ? &R : nullptr);
+
+	// distances from every node with Dijkstra's algorithm
+	vector<vector<T> > ds(N);
+	for (node s = 0; s < N; ++s) {
+		wxdistance(G, s, ds[s]);
+	}
+
+	size_t K, n_threads;
+	// read the number of landmarks, and the number of threads
+	// used to build the index of the same landmarks
+	while (fin >> K >> n_threads) {
+		landmark_index<T> idx, idx_csr, idx_list;
+		wxlandmarks(G, Rp, K, idx);
+		wxlandmarks(&C, Rp, K, idx_csr);
+		wxlandmarks(G, Rp, idx.get_landmarks(), idx_list, n_threads);
+		if (not same_index(idx, idx_csr) or not same_index(idx, idx_list)) {
+			cerr << ERROR("wx_check_landmarks.cpp", "wx_check_landmarks") << endl;
+			cerr << "    The indices of " << K << " landmarks are not equal." << endl;
+			return err_type::test_error;
+		}
+
+		// the index holds the distances from and to the landmarks
+		for (size_t i = 0; i < idx.n_landmarks(); ++i) {
+			const node l = idx.get_landmarks()[i];
+			for (node u = 0; u < N; ++u) {
+				if (not same_distance(idx.from_landmark(i, u), ds[l][u]) or
+					(G->is_directed() and not same_distance(idx.to_landmark(i, u), ds[u][l])))
+				{
+					cerr << ERROR("wx_check_landmarks.cpp", "wx_check_landmarks") << endl;
+					cerr << "    Wrong distance between landmark " << l
+						 << " and node " << u << "." << endl;
+					return err_type::test_error;
+				}
+			}
+		}
+
+		workspace<T> ws;
+		size_t n_exact = 0;
+		size_t n_reachable = 0;
+		for (node s = 0; s < N; ++s) {
+			for (node t = 0; t < N; ++t) {
+				const T d = ds[s][t];
+				const T lb = idx.lower_bound(s, t);
+				const T ub = idx.upper_bound(s, t);
+				const T dg = wxdistance_landmarks(G, idx, s, t, &ws);
+				const T dc = wxdistance_landmarks(&C, idx, s, t);
+				node_path<T> pg, pc;
+				wxpath_landmarks(G, idx, s, t, pg);
+				wxpath_landmarks(&C, idx, s, t, pc, &ws);
+
+				// an infinite lower bound proves that there is no path
+				const bool bounds_ok =
+					(lb == inf_t<T>() ? d == inf_t<T>() : lb <= d or same_distance(lb, d)) and
+					(d == inf_t<T>() ? ub == inf_t<T>() : d <= ub or same_distance(d, ub));
+				if (not bounds_ok or
+					not same_distance(dg, d) or not same_distance(dc, d) or
+					not is_shortest_path(G, pg, s, t, d) or
+					not is_shortest_path(G, pc, s, t, d))
+				{
+					cerr << ERROR("wx_check_landmarks.cpp", "wx_check_landmarks") << endl;
+					cerr << "    Wrong distance from " << s << " to " << t
+						 << " with " << K << " landmarks." << endl;
+					cerr << "    Bounds: " << floatpointout_dist(lb)
+						 << " <= " << floatpointout_dist(ub) << endl;
+					cerr << "    Graph: " << floatpointout_dist(dg) << ", path " << pg << endl;
+					cerr << "    Compressed graph: " << floatpointout_dist(dc) << ", path " << pc << endl;
+					cerr << "    wxdistance: " << floatpointout_dist(d) << endl;
+					return err_type::test_error;
+				}
+				n_exact += (d != inf_t<T>() and same_distance(lb, d));
+				n_reachable += (d != inf_t<T>());
+			}
+		}
+
+		const err_type r = check_snapshot(idx);
+		if (r != err_type::no_error) {
+			return r;
+		}
+
+		cout << idx.n_landmarks() << " landmarks:";
+		for (node l : idx.get_landmarks()) {
+			cout << " " << l;
+		}
+		cout << endl;
+		cout << "    " << n_reachable << " pairs reachable, "
+			 << n_exact << " exact lower bounds" << endl;
+	}
+	return err_type::no_error;
+}
+
+template err_type wx_check_landmarks(const wxgraph<float> *G, ifstream& fin);
+template err_type wx_check_landmarks(const wxgraph<uint32_t> *G, ifstream& fin);
+
+} // -- namespace exe_tests
@@ -0,0 +1,105 @@
+// C++ inlcudes
+#include <iostream>
+#include <vector>
+#include <cmath>
+using namespace std;
+
+// lgraph includes
+#include <lgraph/data_structures/csr_wxgraph.hpp>
+#include <lgraph/data_structures/node_path.hpp>
+#include <lgraph/data_structures/shortest_path_dag.hpp>
+#include <lgraph/graph_traversal/traversal_wx.hpp>
+#include <lgraph/metrics/centralities_wx.hpp>
+#include <lgraph/metrics/centralities_xx.hpp>
+using namespace lgraph;
+using namespace traversal;
+using namespace networks::metrics;
+
+// custom includes
+#include "definitions.hpp"
+#include "test_utils.hpp"
+#include "wx_check/wx_check.hpp"
+using namespace test_utils;
+
+namespace exe_tests {
+
+template<typename T>
+err_type wx_check_dag(const wxgraph<T> *G, ifstream& fin) {
+	const size_t N = G->n_nodes();
+	const csr_wxgraph<T> C(G);
+
+	// the paths from all nodes, computed in parallel
+	vector<shortest_path_dag<T> > dags, dags_csr;
+	wxpaths(G, dags, 1);
+	wxpaths(&C, dags_csr, 3);
+
+	for (node s = 0; s < N; ++s) {
+		shortest_path_dag<T> dag, dag_csr;
+		wxpaths(G, s, dag);
+		wxpaths(&C, s, dag_csr);
+		vector<T> ds;
+		wxdistance(G, s, ds);
+
+		size_t n_reached = 0;
+		double n_paths = 0;
+		for (node t = 0; t < N; ++t) {
+			node_path_set<T> ps;
+			wxpaths(G, s, t, ps);
+
+			for (const shortest_path_dag<T> *D :
+				{&dag, &dag_csr, &dags[s], &dags_csr[s]})
+			{
+				const bool reachable = ds[t] != inf_t<T>();
+				if (D->get_source() != s or D->is_reachable(t) != reachable or
+					(reachable and not same_distance(D->distance(t), ds[t])) or
+					not same_dag_paths(*D, t, ps))
+				{
+					cerr << ERROR("wx_check_paths.cpp", "wx_check_dag") << endl;
+					cerr << "    Wrong shortest paths from " << s << " to " << t << "." << endl;
+					cerr << "    Distance: " << floatpointout_dist(D->distance(t))
+						 << ", expected " << floatpointout_dist(ds[t]) << endl;
+					cerr << "    Number of paths: " << D->n_paths(t)
+						 << ", expected " << ps.size() << endl;
+					return err_type::test_error;
+				}
+			}
+			n_reached += dag.is_reachable(t);
+			n_paths += dag.n_paths(t);
+		}
+		cout << s << ": " << n_reached << " nodes reached, " << n_paths << " paths" << endl;
+	}
+
+	// the betweenness from the stored paths is that of Brandes' algorithm
+	vector<double> bc, bc_dags;
+	centralities::betweenness(G, bc);
+	centralities::betweenness(dags, bc_dags);
+	for (node u = 0; u < N; ++u) {
+		const double bu = centralities::betweenness(dags, u);
+		const double bu_G = centralities::betweenness(G, u);
+		if (abs(bc_dags[u] - bc[u]) > 1.0e-9 or abs(bu - bu_G) > 1.0e-9) {
+			cerr << ERROR("wx_check_paths.cpp", "wx_check_dag") << endl;
+			cerr << "    Wrong betweenness of node " << u << "." << endl;
+			cerr << "    From the stored paths: " << floatpointout_metric(bc_dags[u])
+				 << " (all nodes), " << floatpointout_metric(bu) << " (one node)" << endl;
+			cerr << "    Brandes' algorithm: " << floatpointout_metric(bc[u])
+				 << " (all nodes), " << floatpointout_metric(bu_G) << " (one node)" << endl;
+			return err_type::test_error;
+		}
+	}
+
+	node s, t;
+	// read pairs of nodes whose paths are shown one at a time
+	while (fin >> s >> t) {
+		cout << s << " " << t << ":";
+		for (auto it = dags[s].paths(t); not it.end(); it.next()) {
+			cout << " | " << it.get_path().to_string();
+		}
+		cout << endl;
+	}
+	return err_type::no_error;
+}
+
+template err_type wx_check_dag(const wxgraph<float> *G, ifstream& fin);
+template err_type wx_check_dag(const wxgraph<uint32_t> *G, ifstream& fin);
+
+} // -- namespace exe_tests
@@ -0,0 +1,257 @@
+// C++ inlcudes
+#include <algorithm>
+#include <iostream>
+#include <limits>
+#include <vector>
+#include <cmath>
+using namespace std;
+
+// lgraph includes
+#include <lgraph/data_structures/node_path.hpp>
+#include <lgraph/graph_traversal/traversal_wx.hpp>
+#include <lgraph/metrics/centralities_wx.hpp>
+#include <lgraph/metrics/distance_wx.hpp>
+using namespace lgraph;
+using namespace traversal;
+using namespace networks::metrics;
+
+// custom includes
+#include "definitions.hpp"
+#include "test_utils.hpp"
+#include "wx_check/wx_check.hpp"
+using namespace test_utils;
+
+namespace exe_tests {
+
+/* The algorithms are compared against the Floyd-Warshall algorithm run
+ * with distances of type double, which represent the integral distances
+ * of the tests exactly (up to 2^53), so that they also check that the
+ * algorithms compare the distances of any type correctly. The edges must
+ * have positive integral weights, also when their type is float, since
+ * the closeness adds up the distances as integers.
+ */
+
+// distance from every node to every other node
+// (infinite if there is no path), and the number of
+// shortest paths between them
+void reference_distances(
+	const size_t N,
+	const vector<vector<node> >& adj, const vector<vector<double> >& wl,
+	vector<vector<double> >& dist, vector<vector<double> >& sigma
+)
+{
+	const double inf = numeric_limits<double>::infinity();
+	dist.assign(N, vector<double>(N, inf));
+	for (node u = 0; u < N; ++u) {
+		dist[u][u] = 0;
+		for (size_t i = 0; i < adj[u].size(); ++i) {
+			dist[u][adj[u][i]] = min(dist[u][adj[u][i]], wl[u][i]);
+		}
+	}
+	for (node w = 0; w < N; ++w) {
+		for (node u = 0; u < N; ++u) {
+			for (node v = 0; v < N; ++v) {
+				dist[u][v] = min(dist[u][v], dist[u][w] + dist[w][v]);
+			}
+		}
+	}
+
+	// the paths to a node only go through closer nodes
+	sigma.assign(N, vector<double>(N, 0.0));
+	vector<node> order(N);
+	for (node s = 0; s < N; ++s) {
+		for (node u = 0; u < N; ++u) {
+			order[u] = u;
+		}
+		sort(order.begin(), order.end(),
+			[&](node a, node b) -> bool { return dist[s][a] < dist[s][b]; }
+		);
+
+		sigma[s][s] = 1;
+		for (node u : order) {
+			if (dist[s][u] == inf) {
+				break;
+			}
+			for (size_t i = 0; i < adj[u].size(); ++i) {
+				const node v = adj[u][i];
+				if (dist[s][u] + wl[u][i] == dist[s][v]) {
+					sigma[s][v] += sigma[s][u];
+				}
+			}
+		}
+	}
+}
+
+// the reference distance as a distance of type T
+template<typename T>
+inline T as_distance(double d) {
+	return (d == numeric_limits<double>::infinity() ? inf_t<T>() : static_cast<T>(d));
+}
+
+// the centralities of floating-point distances have rounding errors
+inline bool same_metric(double a, double b) {
+	return a == b or abs(a - b) <= 1.0e-6*max(1.0, abs(b));
+}
+
+template<typename T>
+err_type wx_check_weights(const wxgraph<T> *G, ifstream&) {
+	const size_t N = G->n_nodes();
+
+	vector<vector<node> > adj(N);
+	vector<vector<double> > wl(N);
+	for (node u = 0; u < N; ++u) {
+		for (size_t i = 0; i < G->get_neighbours(u).size(); ++i) {
+			adj[u].push_back(G->get_neighbours(u)[i]);
+			wl[u].push_back(static_cast<double>(G->get_weights(u)[i]));
+			if (G->get_weights(u)[i] == 0) {
+				cerr << ERROR("wx_check_weights.cpp", "wx_check_weights") << endl;
+				cerr << "    The weights of the edges must be positive." << endl;
+				return err_type::test_format_error;
+			}
+		}
+	}
+	vector<vector<double> > dist, sigma;
+	reference_distances(N, adj, wl, dist, sigma);
+
+	// distances, number of shortest paths, and the paths themselves
+	vector<vector<node_path_set<T> > > all_paths;
+	wxpaths(G, all_paths);
+	vector<vector<T> > ds(N);
+	for (node s = 0; s < N; ++s) {
+		vector<size_t> n_paths;
+		wxdistance(G, s, ds[s], n_paths);
+
+		for (node t = 0; t < N; ++t) {
+			const T d = as_distance<T>(dist[s][t]);
+			const double np = (s == t ? 1.0 : sigma[s][t]);
+
+			node_path<T> p;
+			wxpath(G, s, t, p);
+			node_path_set<T> ps;
+			wxpaths(G, s, t, ps);
+
+			bool paths_ok = true;
+			if (d != inf_t<T>()) {
+				paths_ok = is_shortest_path(G, p, s, t, d) and
+					ps.size() == np and all_paths[s][t].size() == np;
+				for (const node_path<T>& q : ps) {
+					paths_ok = paths_ok and is_shortest_path(G, q, s, t, d);
+				}
+				for (const node_path<T>& q : all_paths[s][t]) {
+					paths_ok = paths_ok and is_shortest_path(G, q, s, t, d);
+				}
+			}
+
+			if (not same_distance(ds[s][t], d) or not paths_ok or
+				(d != inf_t<T>() and n_paths[t] != np))
+			{
+				cerr << ERROR("wx_check_weights.cpp", "wx_check_weights") << endl;
+				cerr << "    Wrong distance or paths from " << s << " to " << t << "." << endl;
+				cerr << "    Distance: " << floatpointout_dist(ds[s][t])
+					 << ", expected " << floatpointout_dist(d) << endl;
+				cerr << "    Number of paths: " << n_paths[t]
+					 << ", expected " << np << endl;
+				cerr << "    Path: " << p << endl;
+				cerr << "    Paths (single pair): " << ps.size() << endl;
+				cerr << "    Paths (all pairs): " << all_paths[s][t].size() << endl;
+				return err_type::test_error;
+			}
+		}
+	}
+
+	// closeness of every node, and the mean of them
+	vector<double> cc;
+	centralities::closeness(G, cc);
+	double sum_cc = 0;
+	for (node s = 0; s < N; ++s) {
+		double sum = 0;
+		for (node t = 0; t < N; ++t) {
+			sum += (dist[s][t] == numeric_limits<double>::infinity() ? 0 : dist[s][t]);
+		}
+		const double c = 1.0/(sum/(N - 1));
+		sum_cc += c;
+		if (not same_metric(cc[s], c) or not same_metric(centralities::closeness(G, s), c)) {
+			cerr << ERROR("wx_check_weights.cpp", "wx_check_weights") << endl;
+			cerr << "    Wrong closeness of node " << s << "." << endl;
+			cerr << "    Closeness: " << floatpointout_metric(cc[s])
+				 << ", expected " << floatpointout_metric(c) << endl;
+			return err_type::test_error;
+		}
+	}
+	const double mcc = centralities::mcc(G);
+	if (not same_metric(mcc, sum_cc/N)) {
+		cerr << ERROR("wx_check_weights.cpp", "wx_check_weights") << endl;
+		cerr << "    Wrong mean closeness." << endl;
+		cerr << "    Mean closeness: " << floatpointout_metric(mcc)
+			 << ", expected " << floatpointout_metric(sum_cc/N) << endl;
+		return err_type::test_error;
+	}
+
+	// betweenness: the pairs (s,t) with s < t connected by a path
+	// through 'u', or that start or end at 'u'
+	vector<double> bc_ref(N, 0.0);
+	for (node s = 0; s < N; ++s) {
+		for (node t = s + 1; t < N; ++t) {
+			if (dist[s][t] == numeric_limits<double>::infinity()) {
+				continue;
+			}
+			bc_ref[s] += 1.0;
+			bc_ref[t] += 1.0;
+			for (node u = 0; u < N; ++u) {
+				if (u != s and u != t and dist[s][u] + dist[u][t] == dist[s][t]) {
+					bc_ref[u] += sigma[s][u]*sigma[u][t]/sigma[s][t];
+				}
+			}
+		}
+	}
+	for (double& b : bc_ref) {
+		b /= ((N - 1)*(N - 2))/2;
+	}
+	for (size_t n_threads : {1, 3}) {
+		vector<double> bc;
+		centralities::betweenness(G, bc, n_threads);
+		for (node u = 0; u < N; ++u) {
+			if (not same_metric(bc[u], bc_ref[u])) {
+				cerr << ERROR("wx_check_weights.cpp", "wx_check_weights") << endl;
+				cerr << "    Wrong betweenness of node " << u << " with "
+					 << n_threads << " threads." << endl;
+				cerr << "    Betweenness: " << floatpointout_metric(bc[u])
+					 << ", expected " << floatpointout_metric(bc_ref[u]) << endl;
+				return err_type::test_error;
+			}
+		}
+	}
+
+	// largest finite distance between two nodes, in either direction
+	T D = 0;
+	for (node s = 0; s < N; ++s) {
+		for (node t = 0; t < N; ++t) {
+			if (dist[s][t] != numeric_limits<double>::infinity()) {
+				D = max(D, as_distance<T>(dist[s][t]));
+			}
+		}
+	}
+	const T D_graph = distance::max_distance(G);
+	const T D_ds = distance::max_distance(G, ds);
+	if (D_graph != D or D_ds != D) {
+		cerr << ERROR("wx_check_weights.cpp", "wx_check_weights") << endl;
+		cerr << "    Wrong maximum distance." << endl;
+		cerr << "    From the graph: " << floatpointout_dist(D_graph) << endl;
+		cerr << "    From the distances: " << floatpointout_dist(D_ds) << endl;
+		cerr << "    Expected: " << floatpointout_dist(D) << endl;
+		return err_type::test_error;
+	}
+
+	cout << "max distance " << floatpointout_dist(D) << endl;
+	cout << "mean closeness " << floatpointout_metric(mcc) << endl;
+	for (node u = 0; u < N; ++u) {
+		cout << u << ": closeness " << floatpointout_metric(cc[u])
+			 << ", betweenness " << floatpointout_metric(bc_ref[u]) << endl;
+	}
+	return err_type::no_error;
+}
+
+template err_type wx_check_weights(const wxgraph<float> *G, ifstream& fin);
+template err_type wx_check_weights(const wxgraph<uint32_t> *G, ifstream& fin);
+
+} // -- namespace exe_tests
@@ -0,0 +1,170 @@
+// C++ inlcudes
+#include <cstdio>
+#include <iostream>
+#include <vector>
+using namespace std;
+
+// lgraph includes
+#include <lgraph/data_structures/wugraph.hpp>
+#include <lgraph/data_structures/wdgraph.hpp>
+#include <lgraph/data_structures/csr_wxgraph.hpp>
+#include <lgraph/graph_traversal/traversal_wx.hpp>
+#include <lgraph/metrics/centralities_wx.hpp>
+#include <lgraph/metrics/distance_wx.hpp>
+#include <lgraph/io/io.hpp>
+using namespace lgraph;
+
+// custom includes
+#include "definitions.hpp"
+#include "io_wrapper.hpp"
+#include "test_utils.hpp"
+using namespace test_utils;
+
+namespace exe_tests {
+
+void wx_csr_distance(const csr_wxgraph<float> *G, ifstream& fin) {
+	node u;
+	// read list of nodes
+	while (fin >> u) {
+		vector<float> dists;
+		vector<size_t> n_paths;
+		traversal::wxdistance(G, u, dists, n_paths);
+
+		for (node v = 0; v < G->n_nodes(); ++v) {
+			cout << v << ": " << floatpointout_dist(dists[v])
+				 << " (" << n_paths[v] << ")" << endl;
+		}
+	}
+}
+
+void wx_csr_metric(const csr_wxgraph<float> *G) {
+	vector<double> cc;
+	networks::metrics::centralities::closeness(G, cc);
+	for (node u = 0; u < G->n_nodes(); ++u) {
+		cout << u << ": " << floatpointout_metric(cc[u]) << endl;
+	}
+
+	double m = networks::metrics::centralities::mcc(G);
+	cout << floatpointout_metric(m) << endl;
+
+	float D = networks::metrics::distance::max_distance(G);
+	cout << D << endl;
+
+	double md = networks::metrics::distance::mean_distance(G);
+	cout << floatpointout_metric(md) << endl;
+}
+
+void wx_csr_betweenness(const csr_wxgraph<float> *G, ifstream& fin) {
+	// number of threads (optional)
+	size_t n_threads;
+	if (not (fin >> n_threads)) {
+		n_threads = 1;
+	}
+
+	vector<double> bc;
+	networks::metrics::centralities::betweenness(G, bc, n_threads);
+	for (node u = 0; u < G->n_nodes(); ++u) {
+		cout << u << ": " << floatpointout_metric(bc[u]) << endl;
+	}
+}
+
+err_type wx_csr
+(const string& graph_type, const string& task, ifstream& fin, bool from_snapshot)
+{
+	string input_graph, format;
+	size_t n;
+
+	// parse input field
+	string field;
+	fin >> field;
+	if (field != "INPUT") {
+		cerr << ERROR("wx_csr.cpp", "wx_csr") << endl;
+		cerr << "    Expected field 'INPUT'." << endl;
+		cerr << "    Instead, '" << field << "' was found." << endl;
+		return err_type::test_format_error;
+	}
+	fin >> n;
+	if (n != 1) {
+		cerr << ERROR("wx_csr.cpp", "wx_csr") << endl;
+		cerr << "    Only one input file is allowed in this test." << endl;
+		cerr << "    Instead, " << n << " were specified." << endl;
+		return err_type::test_format_error;
+	}
+	fin >> input_graph >> format;
+
+	// parse body field
+	fin >> field;
+	if (field != "BODY") {
+		cerr << ERROR("wx_csr.cpp", "wx_csr") << endl;
+		cerr << "    Expected field 'BODY'." << endl;
+		cerr << "    Instead, '" << field << "' was found." << endl;
+		return err_type::test_format_error;
+	}
+
+	wxgraph<float> *G = nullptr;
+	if (graph_type == "directed") {
+		G = new wdgraph<float>();
+	}
+	else if (graph_type == "undirected") {
+		G = new wugraph<float>();
+	}
+	else {
+		cerr << ERROR("wx_csr.cpp", "wx_csr") << endl;
+		cerr << "    Wrong value for parameter 'graph_type'." << endl;
+		cerr << "    Received '" << graph_type << "'." << endl;
+		return err_type::invalid_param;
+	}
+
+	err_type r = io_wrapper::read_graph(input_graph, format, G);
+	if (r != err_type::no_error) {
+		if (r == err_type::io_error) {
+			cerr << ERROR("wx_csr.cpp", "wx_csr") << endl;
+			cerr << "    Could not open file '" << input_graph << "'" << endl;
+		}
+		else if (r == err_type::graph_format_error) {
+			cerr << ERROR("wx_csr.cpp", "wx_csr") << endl;
+			cerr << "    Input file format '" << format << "' not supported." << endl;
+		}
+		return r;
+	}
+
+	csr_wxgraph<float> C;
+	if (from_snapshot) {
+		// store the graph in a snapshot and map it back
+		const string snapshot_file = ".tmp.csr-snapshot";
+		if (not io::snapshot::write(snapshot_file, G) or
+			not io::snapshot::map(snapshot_file, &C))
+		{
+			cerr << ERROR("wx_csr.cpp", "wx_csr") << endl;
+			cerr << "    Could not write or map the snapshot '" << snapshot_file << "'." << endl;
+			return err_type::io_error;
+		}
+		// the file stays mapped after removing it
+		remove(snapshot_file.c_str());
+	}
+	else {
+		C.init(G);
+	}
+	delete G;
+	G = nullptr;
+
+	if (task == "distance") {
+		wx_csr_distance(&C, fin);
+	}
+	else if (task == "metric") {
+		wx_csr_metric(&C);
+	}
+	else if (task == "betweenness") {
+		wx_csr_betweenness(&C, fin);
+	}
+	else {
+		cerr << ERROR("wx_csr.cpp", "wx_csr") << endl;
+		cerr << "    Value of parameter 'task' is not valid." << endl;
+		cerr << "    Received: '" << task << "'." << endl;
+		return err_type::invalid_param;
+	}
+
+	return err_type::no_error;
+}
+
+} // -- namespace exe_tests
@@ -106,6 +106,20 @@ err_type xu_metric_clustering(const string& c, ifstream& fin)
 		return r;
 	}
 
+	// optionally, keep the neighbourhoods sorted
+	string adjacency;
+	if (fin >> adjacency) {
+		if (adjacency == "sorted") {
+			G->sort_adjacency_list();
+		}
+		else {
+			cerr << ERROR("xu_metric_clustering.cpp", "xu_metric_clustering") << endl;
+			cerr << "    Wrong value for parameter 'adjacency'." << endl;
+			cerr << "    Received '" << adjacency << "'." << endl;
+			return err_type::invalid_param;
+		}
+	}
+
 	if (c == "gcc") {
 		xu_metric_clustering_gcc(G);
 	}
@@ -0,0 +1,50 @@
+// C++ inlcudes
+#include <iostream>
+using namespace std;
+
+// custom includes
+#include "definitions.hpp"
+#include "xx_structure/xx_structure.hpp"
+
+namespace exe_tests {
+
+err_type xx_structure(const string& name, ifstream& fin) {
+	// parse body field
+	string field;
+	fin >> field;
+	if (field != "BODY") {
+		cerr << ERROR("xx_structure.cpp", "xx_structure") << endl;
+		cerr << "    Expected field 'BODY'." << endl;
+		cerr << "    Instead, '" << field << "' was found." << endl;
+		return err_type::test_format_error;
+	}
+
+	if (name == "edgelist") {
+		return xx_structure_edge_list(fin);
+	}
+	if (name == "snapshot") {
+		return xx_structure_snapshot(fin);
+	}
+	if (name == "bitset") {
+		return xx_structure_bitset(fin);
+	}
+	if (name == "workspace") {
+		return xx_structure_workspace(fin);
+	}
+	if (name == "queues") {
+		return xx_structure_queues(fin);
+	}
+	if (name == "hyperloglog") {
+		return xx_structure_hyperloglog(fin);
+	}
+	if (name == "distance_matrix") {
+		return xx_structure_distance_matrix(fin);
+	}
+
+	cerr << ERROR("xx_structure.cpp", "xx_structure") << endl;
+	cerr << "    Value of parameter 'name' is not valid." << endl;
+	cerr << "    Received: '" << name << "'." << endl;
+	return err_type::invalid_param;
+}
+
+} // -- namespace exe_tests
@@ -0,0 +1,26 @@
+#pragma once
+
+/* Tests of the data structures of the library that do not need an input
+ * graph. Every function prints the state of the data structure after
+ * the operations read from the input, and reports in the error output
+ * any difference with a simpler implementation of the same operations.
+ */
+
+// C++ includes
+#include <fstream>
+using namespace std;
+
+// custom includes
+#include "definitions.hpp"
+
+namespace exe_tests {
+
+err_type xx_structure_edge_list(ifstream& fin);
+err_type xx_structure_snapshot(ifstream& fin);
+err_type xx_structure_bitset(ifstream& fin);
+err_type xx_structure_workspace(ifstream& fin);
+err_type xx_structure_queues(ifstream& fin);
+err_type xx_structure_hyperloglog(ifstream& fin);
+err_type xx_structure_distance_matrix(ifstream& fin);
+
+} // -- namespace exe_tests
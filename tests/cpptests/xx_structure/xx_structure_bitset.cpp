@@ -0,0 +1,141 @@
+// C++ inlcudes
+#include <iostream>
+#include <string>
+#include <vector>
+using namespace std;
+
+// lgraph includes
+#include <lgraph/utils/static_bitset.hpp>
+using namespace lgraph;
+using namespace utils;
+
+// custom includes
+#include "definitions.hpp"
+#include "xx_structure/xx_structure.hpp"
+
+namespace exe_tests {
+
+// the bytes of a sequence of bits, first bit in the most
+// significant position and the bits after the last one 0
+string bytes_of(const vector<bool>& bits) {
+	string s((bits.size() + 7)/8, '\0');
+	for (size_t i = 0; i < bits.size(); ++i) {
+		if (bits[i]) {
+			s[i/8] = static_cast<char>(s[i/8] | (0x80 >> (i%8)));
+		}
+	}
+	return s;
+}
+
+// compares the bitset with the expected bits. All the functions
+// that look at whole words see the padding bits after the last one
+bool same_bits(const static_bitset& bs, const vector<bool>& bits) {
+	vector<size_t> expected;
+	for (size_t i = 0; i < bits.size(); ++i) {
+		if (bits[i]) {
+			expected.push_back(i);
+		}
+	}
+
+	vector<size_t> which;
+	bs.which(which);
+	vector<size_t> found;
+	for (size_t i = bs.find_first(); i < bs.size(); i = bs.find_next(i)) {
+		found.push_back(i);
+	}
+
+	vector<bool> all_bits;
+	bs.get_01(all_bits);
+
+	return
+		bs.size() == bits.size() and all_bits == bits and
+		bs.count() == expected.size() and which == expected and found == expected and
+		bs.all() == (expected.size() == bits.size()) and
+		bs.any() == (expected.size() > 0) and
+		bs.get_bytes() == bytes_of(bits);
+}
+
+err_type xx_structure_bitset(ifstream& fin) {
+	size_t n;
+	// read sizes of the bitsets
+	while (fin >> n) {
+		// some bits set, the last one included
+		vector<bool> bits(n);
+		for (size_t i = 0; i < n; ++i) {
+			bits[i] = (i%5 == 0 or i + 1 == n);
+		}
+		vector<bool> flipped(bits);
+		flipped.flip();
+		const vector<bool> ones(n, true);
+		const vector<bool> zeros(n, false);
+
+		static_bitset bs(bits);
+		static_bitset all_set;
+		all_set.init_set(n);
+		static_bitset all_unset;
+		all_unset.init_unset(n);
+
+		vector<pair<string, bool> > checks;
+		checks.push_back(make_pair("init", same_bits(bs, bits)));
+		checks.push_back(make_pair("set", same_bits(all_set, ones)));
+		checks.push_back(make_pair("unset", same_bits(all_unset, zeros)));
+		checks.push_back(make_pair("~", same_bits(~bs, flipped)));
+		checks.push_back(make_pair("==", same_bits(bs == bs, ones)));
+		checks.push_back(make_pair("<=", same_bits(all_unset <= bs, ones)));
+		checks.push_back(make_pair("^", same_bits(bs ^ all_set, flipped)));
+		checks.push_back(make_pair("-", same_bits(all_set - bs, flipped)));
+
+		static_bitset c(bs);
+		c.flip();
+		checks.push_back(make_pair("flip", same_bits(c, flipped)));
+		c.flip();
+		checks.push_back(make_pair("flip-flip", same_bits(c, bits)));
+
+		// the bits at the boundary
+		if (n > 0) {
+			c.unset_bit(n - 1);
+			vector<bool> b(bits);
+			b[n - 1] = false;
+			checks.push_back(make_pair("unset-last", same_bits(c, b)));
+			c.set_bit(n - 1);
+			checks.push_back(make_pair("set-last", same_bits(c, bits)));
+		}
+
+		// adding to the bytes does not carry into the padding
+		static_bitset d;
+		d.init_set(n);
+		d += 1;
+		// (full bytes wrap around to 0, the last one only
+		// changes in its padding)
+		vector<bool> e(n, false);
+		for (size_t i = n/8*8; i < n; ++i) {
+			e[i] = true;
+		}
+		checks.push_back(make_pair("+=", same_bits(d, e)));
+
+		// shrinking a bitset within the same words clears the padding
+		static_bitset f;
+		f.init_set(n + 63 - (n + 63)%64);
+		f.init(n);
+		checks.push_back(make_pair("shrink", same_bits(f, ones)));
+
+		cout << n << ":";
+		bool ok = true;
+		for (const pair<string, bool>& p : checks) {
+			cout << " " << p.first;
+			if (not p.second) {
+				cerr << ERROR("xx_structure_bitset.cpp", "xx_structure_bitset") << endl;
+				cerr << "    Wrong bits after '" << p.first << "' on a bitset of "
+					 << n << " bits." << endl;
+				ok = false;
+			}
+		}
+		cout << " (" << bs.count() << " set)" << endl;
+		if (not ok) {
+			return err_type::test_error;
+		}
+	}
+	return err_type::no_error;
+}
+
+} // -- namespace exe_tests
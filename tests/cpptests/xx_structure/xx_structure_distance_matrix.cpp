@@ -0,0 +1,186 @@
+// C++ inlcudes
+#include <algorithm>
+#include <iostream>
+#include <random>
+#include <vector>
+#include <cmath>
+using namespace std;
+
+// lgraph includes
+#include <lgraph/data_structures/distance_matrix.hpp>
+using namespace lgraph;
+
+// custom includes
+#include "definitions.hpp"
+#include "test_utils.hpp"
+#include "xx_structure/xx_structure.hpp"
+using namespace test_utils;
+
+namespace exe_tests {
+
+/* The distances of random pairs of nodes are set in a compact matrix and
+ * in a full matrix: both must give the same distances, sums of rows and
+ * largest distance, before and after widening the compact matrix.
+ */
+
+// number of bytes of the narrowest type that represents 'max_distance'
+inline size_t expected_width(_new_ max_distance) {
+	if (max_distance < 0xff) {
+		return 1;
+	}
+	if (max_distance < 0xffff) {
+		return 2;
+	}
+	if (max_distance < 0xffffffff) {
+		return 4;
+	}
+	return 8;
+}
+
+inline size_t expected_bytes(size_t n, bool symmetric, size_t width) {
+	return (symmetric ? n*(n - 1)/2 : n*n)*width;
+}
+
+err_type same_matrices
+(const distance_matrix& M, const vector<vector<_new_> >& ref, const string& when)
+{
+	const size_t n = ref.size();
+	for (node u = 0; u < n; ++u) {
+		for (node v = 0; v < n; ++v) {
+			if (M.get(u, v) != ref[u][v]) {
+				cerr << ERROR("xx_structure_distance_matrix.cpp", "same_matrices") << endl;
+				cerr << "    Wrong distance " << when << "." << endl;
+				cerr << "    Distance from " << u << " to " << v << ": "
+					 << M.get(u, v) << ", expected " << ref[u][v] << endl;
+				return err_type::test_error;
+			}
+		}
+	}
+
+	vector<double> sums;
+	M.row_sums(sums);
+	_new_ D = 0;
+	for (node u = 0; u < n; ++u) {
+		double sum = 0;
+		for (node v = 0; v < n; ++v) {
+			if (ref[u][v] != inf_t<_new_>()) {
+				sum += ref[u][v];
+				D = max(D, ref[u][v]);
+			}
+		}
+		if (sums.size() != n or sums[u] != sum) {
+			cerr << ERROR("xx_structure_distance_matrix.cpp", "same_matrices") << endl;
+			cerr << "    Wrong sum of the distances from node " << u << " " << when << "." << endl;
+			cerr << "    Sum: " << (u < sums.size() ? sums[u] : 0.0)
+				 << ", expected " << sum << endl;
+			return err_type::test_error;
+		}
+	}
+	if (M.max_distance() != D) {
+		cerr << ERROR("xx_structure_distance_matrix.cpp", "same_matrices") << endl;
+		cerr << "    Wrong largest distance " << when << "." << endl;
+		cerr << "    Largest distance: " << M.max_distance() << ", expected " << D << endl;
+		return err_type::test_error;
+	}
+	return err_type::no_error;
+}
+
+err_type check_distance_matrix
+(size_t n, bool symmetric, _new_ max_distance, _new_ widened, size_t seed)
+{
+	distance_matrix M;
+	M.init(n, symmetric, max_distance);
+	const size_t width = expected_width(max_distance);
+	if (M.size() != n or M.is_symmetric() != symmetric or
+		M.bytes_per_distance() != width or
+		M.bytes() != expected_bytes(n, symmetric, width) or
+		M.capacity() < max_distance or M.capacity() == inf_t<_new_>())
+	{
+		cerr << ERROR("xx_structure_distance_matrix.cpp", "check_distance_matrix") << endl;
+		cerr << "    Wrong layout of a matrix of " << n << " nodes and largest distance "
+			 << max_distance << "." << endl;
+		cerr << "    Bytes per distance: " << M.bytes_per_distance()
+			 << ", expected " << width << endl;
+		cerr << "    Bytes: " << M.bytes() << ", expected "
+			 << expected_bytes(n, symmetric, width) << endl;
+		cerr << "    Capacity: " << M.capacity() << endl;
+		return err_type::test_error;
+	}
+
+	// the distances set in random pairs of different nodes, and
+	// in the opposite direction in symmetric matrices
+	vector<vector<_new_> > ref(n, vector<_new_>(n, inf_t<_new_>()));
+	for (node u = 0; u < n; ++u) {
+		ref[u][u] = 0;
+	}
+	mt19937_64 gen(seed);
+	for (size_t i = 0; n > 1 and i < n*n; ++i) {
+		const node u = gen()%n;
+		const node v = gen()%n;
+		if (u == v) {
+			continue;
+		}
+		// some pairs are disconnected again
+		const _new_ d = (gen()%8 == 0 ? inf_t<_new_>() : gen()%(max_distance + 1));
+		M.set(u, v, d);
+		ref[u][v] = d;
+		if (symmetric) {
+			ref[v][u] = d;
+		}
+	}
+	err_type r = same_matrices(M, ref, "after setting them");
+	if (r != err_type::no_error) {
+		return r;
+	}
+
+	// widening keeps the distances stored, and makes room for larger ones
+	M.widen(widened);
+	const size_t new_width = max(width, expected_width(widened));
+	if (M.bytes_per_distance() != new_width or
+		M.bytes() != expected_bytes(n, symmetric, new_width) or
+		M.capacity() < widened)
+	{
+		cerr << ERROR("xx_structure_distance_matrix.cpp", "check_distance_matrix") << endl;
+		cerr << "    Wrong layout after widening to " << widened << "." << endl;
+		cerr << "    Bytes per distance: " << M.bytes_per_distance()
+			 << ", expected " << new_width << endl;
+		return err_type::test_error;
+	}
+	r = same_matrices(M, ref, "after widening");
+	if (r != err_type::no_error) {
+		return r;
+	}
+	if (n > 1) {
+		M.set(n - 1, 0, widened);
+		ref[n - 1][0] = widened;
+		if (symmetric) {
+			ref[0][n - 1] = widened;
+		}
+		r = same_matrices(M, ref, "after setting the largest distance");
+		if (r != err_type::no_error) {
+			return r;
+		}
+	}
+
+	cout << n << " nodes, " << (symmetric ? "symmetric" : "non-symmetric")
+		 << ": " << width << " -> " << new_width << " bytes per distance, "
+		 << M.bytes() << " bytes" << endl;
+	return err_type::no_error;
+}
+
+err_type xx_structure_distance_matrix(ifstream& fin) {
+	size_t n, symmetric, seed;
+	_new_ max_distance, widened;
+	// read the number of nodes, whether the matrix is symmetric, the
+	// largest distance, the largest distance after widening and the seed
+	while (fin >> n >> symmetric >> max_distance >> widened >> seed) {
+		const err_type r =
+			check_distance_matrix(n, symmetric != 0, max_distance, widened, seed);
+		if (r != err_type::no_error) {
+			return r;
+		}
+	}
+	return err_type::no_error;
+}
+
+} // -- namespace exe_tests
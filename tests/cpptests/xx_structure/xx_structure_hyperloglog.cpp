@@ -0,0 +1,132 @@
+// C includes
+#include <string.h>
+
+// C++ inlcudes
+#include <algorithm>
+#include <iostream>
+#include <random>
+#include <vector>
+#include <cmath>
+#include <set>
+using namespace std;
+
+// lgraph includes
+#include <lgraph/data_structures/hyperloglog.hpp>
+using namespace lgraph;
+
+// custom includes
+#include "definitions.hpp"
+#include "test_utils.hpp"
+#include "xx_structure/xx_structure.hpp"
+using namespace test_utils;
+
+namespace exe_tests {
+
+/* Several counters of random sets of elements are merged in different
+ * orders: the unions must have the same registers as the counter of all
+ * the elements, whatever the order.
+ */
+
+err_type check_hyperloglog(size_t log2m, size_t n_sets, size_t n_elements, size_t seed) {
+	// the sets, and the unions: all the elements added to one
+	// counter, and the sets merged in order, in reverse order
+	// and in random order
+	const size_t all = n_sets;
+	const size_t forward = n_sets + 1;
+	const size_t backward = n_sets + 2;
+	const size_t shuffled = n_sets + 3;
+	hyperloglog_counters H;
+	H.init(n_sets + 4, log2m, seed);
+	const size_t m = H.n_registers();
+
+	mt19937_64 gen(seed);
+	vector<set<uint64_t> > sets(n_sets);
+	set<uint64_t> all_elements;
+	for (size_t i = 0; i < n_sets; ++i) {
+		for (size_t j = 0; j < n_elements; ++j) {
+			// elements repeated within and across the sets
+			const uint64_t x = gen()%(2*n_sets*n_elements);
+			H.add(i, x);
+			H.add(all, x);
+			sets[i].insert(x);
+			all_elements.insert(x);
+		}
+	}
+
+	vector<size_t> order(n_sets);
+	for (size_t i = 0; i < n_sets; ++i) {
+		order[i] = i;
+	}
+	vector<uint8_t> before(m);
+	for (size_t i : order) {
+		// a merge changes the counter if it reports so
+		memcpy(&before[0], H.registers(forward), m);
+		const bool changed = H.merge(forward, H.registers(i));
+		if (changed != (memcmp(&before[0], H.registers(forward), m) != 0)) {
+			cerr << ERROR("xx_structure_hyperloglog.cpp", "check_hyperloglog") << endl;
+			cerr << "    Merging set " << i << " reported " << (changed ? "a" : "no")
+				 << " change wrongly." << endl;
+			return err_type::test_error;
+		}
+	}
+	reverse(order.begin(), order.end());
+	for (size_t i : order) {
+		H.merge(backward, H.registers(i));
+	}
+	shuffle(order.begin(), order.end(), gen);
+	for (size_t i : order) {
+		H.merge(shuffled, H.registers(i));
+	}
+
+	for (size_t c : {forward, backward, shuffled}) {
+		if (memcmp(H.registers(all), H.registers(c), m) != 0) {
+			cerr << ERROR("xx_structure_hyperloglog.cpp", "check_hyperloglog") << endl;
+			cerr << "    The union depends on the order of the merges." << endl;
+			return err_type::test_error;
+		}
+	}
+	// the union does not change by merging any set again
+	for (size_t i = 0; i < n_sets; ++i) {
+		if (H.merge(shuffled, H.registers(i))) {
+			cerr << ERROR("xx_structure_hyperloglog.cpp", "check_hyperloglog") << endl;
+			cerr << "    Merging set " << i << " into the union changed it." << endl;
+			return err_type::test_error;
+		}
+	}
+
+	// relative error of the estimates, with a generous bound
+	// of 5 times the standard error
+	const double bound = 5*1.04/sqrt(static_cast<double>(m));
+	double max_error = 0;
+	for (size_t i = 0; i <= n_sets; ++i) {
+		const double n = static_cast<double>(i < n_sets ? sets[i].size() : all_elements.size());
+		max_error = max(max_error, abs(H.estimate(i) - n)/n);
+	}
+	if (max_error > bound) {
+		cerr << ERROR("xx_structure_hyperloglog.cpp", "check_hyperloglog") << endl;
+		cerr << "    Relative error " << floatpointout_metric(max_error)
+			 << " larger than " << floatpointout_metric(bound) << "." << endl;
+		return err_type::test_error;
+	}
+
+	cout << m << " registers, " << n_sets << " sets of " << n_elements << " elements: "
+		 << all_elements.size() << " distinct, estimated "
+		 << floatpointout_metric(H.estimate(all)) << ", maximum relative error "
+		 << floatpointout_metric(max_error) << endl;
+	return err_type::no_error;
+}
+
+err_type xx_structure_hyperloglog(ifstream& fin) {
+	size_t log2m, n_sets, n_elements, seed;
+	// read the base 2 logarithm of the number of registers, the
+	// number of sets, of elements added to every set and the seed
+	while (fin >> log2m >> n_sets >> n_elements >> seed) {
+		const err_type r = check_hyperloglog(log2m, n_sets, n_elements, seed);
+		if (r != err_type::no_error) {
+			return r;
+		}
+	}
+	return err_type::no_error;
+}
+
+} // -- namespace exe_tests
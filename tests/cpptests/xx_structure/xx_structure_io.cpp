@@ -0,0 +1,329 @@
+// C++ inlcudes
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <fstream>
+#include <iterator>
+#include <limits>
+#include <vector>
+using namespace std;
+
+// lgraph includes
+#include <lgraph/data_structures/uugraph.hpp>
+#include <lgraph/data_structures/udgraph.hpp>
+#include <lgraph/data_structures/wugraph.hpp>
+#include <lgraph/data_structures/wdgraph.hpp>
+#include <lgraph/io/io.hpp>
+#include <lgraph/io/mapped_file.hpp>
+#include <lgraph/io/snapshot_format.hpp>
+using namespace lgraph;
+using namespace io;
+
+// custom includes
+#include "definitions.hpp"
+#include "xx_structure/xx_structure.hpp"
+
+namespace exe_tests {
+
+// the lines of an edge list, read with an input stream
+struct edge_line {
+	node u, v;
+	float w;
+};
+
+// the neighbours of 'u', in the order of the adjacency list
+vector<pair<node, float> > neighbours(const uxgraph& G, node u) {
+	vector<pair<node, float> > nu;
+	for (node v : G.get_neighbours(u)) {
+		nu.push_back(make_pair(v, 0.0f));
+	}
+	return nu;
+}
+// the neighbours of 'u' and the weights of the edges
+vector<pair<node, float> > neighbours(const wxgraph<float>& G, node u) {
+	vector<pair<node, float> > nu;
+	const neighbourhood& Nu = G.get_neighbours(u);
+	const weight_list<float>& Wu = G.get_weights(u);
+	for (size_t i = 0; i < Nu.size(); ++i) {
+		nu.push_back(make_pair(Nu[i], Wu[i]));
+	}
+	return nu;
+}
+template<class G_t>
+vector<pair<node, float> > sorted_neighbours(const G_t& G, node u) {
+	vector<pair<node, float> > nu = neighbours(G, u);
+	sort(nu.begin(), nu.end());
+	return nu;
+}
+
+void add_line(uxgraph& G, const edge_line& e) {
+	G.add_edge(e.u, e.v);
+}
+void add_line(wxgraph<float>& G, const edge_line& e) {
+	G.add_edge(e.u, e.v, e.w);
+}
+
+err_type check_mapped_file(const string& file) {
+	mapped_file mf;
+	ifstream fin(file, ios::binary);
+	if (mf.open(file.c_str()) != fin.is_open()) {
+		cerr << ERROR("xx_structure_io.cpp", "check_mapped_file") << endl;
+		cerr << "    The file '" << file << "' is ";
+		cerr << (fin.is_open() ? "" : "not ") << "readable, but mapped_file ";
+		cerr << (mf.is_open() ? "opened" : "did not open") << " it." << endl;
+		return err_type::test_error;
+	}
+	if (not fin.is_open()) {
+		return err_type::no_error;
+	}
+
+	const string contents(
+		(istreambuf_iterator<char>(fin)), istreambuf_iterator<char>()
+	);
+	if (mf.size() != contents.size() or
+		(mf.size() == 0) != (mf.data() == nullptr) or
+		not equal(contents.begin(), contents.end(), mf.data()))
+	{
+		cerr << ERROR("xx_structure_io.cpp", "check_mapped_file") << endl;
+		cerr << "    Wrong contents of the mapped file '" << file << "'." << endl;
+		cerr << "    Mapped " << mf.size() << " bytes, expected "
+			 << contents.size() << "." << endl;
+		return err_type::test_error;
+	}
+
+	mf.close();
+	if (mf.is_open() or mf.size() != 0 or mf.data() != nullptr) {
+		cerr << ERROR("xx_structure_io.cpp", "check_mapped_file") << endl;
+		cerr << "    The file '" << file << "' is still mapped after closing it." << endl;
+		return err_type::test_error;
+	}
+	return err_type::no_error;
+}
+
+template<class G_t>
+err_type check_edge_list(const string& file, bool directed, bool weighted) {
+	// read the file with an input stream
+	vector<edge_line> lines;
+	size_t N = 1;
+	{
+	ifstream fin(file);
+	edge_line e;
+	e.w = 0.0f;
+	while (fin >> e.u >> e.v and (not weighted or fin >> e.w)) {
+		lines.push_back(e);
+		N = max(N, max(e.u, e.v) + 1);
+	}
+	}
+
+	// every line is an edge, in the order of the file
+	G_t K;
+	edge_list::read(file, &K, edge_list::duplicates::keep);
+	// only the first occurrence of an edge is added
+	G_t G;
+	edge_list::read(file, &G, edge_list::duplicates::remove);
+
+	cout << file << ": " << G.n_nodes() << " nodes, "
+		 << K.n_edges() << " lines, " << G.n_edges() << " edges" << endl;
+	for (node u = 0; u < G.n_nodes(); ++u) {
+		cout << "    " << u << ":";
+		for (const pair<node, float>& p : sorted_neighbours(G, u)) {
+			cout << " " << p.first;
+			if (weighted) {
+				cout << "(" << p.second << ")";
+			}
+		}
+		cout << endl;
+	}
+
+	// the expected graph when keeping every line
+	vector<vector<pair<node, float> > > adj(N);
+	for (const edge_line& e : lines) {
+		adj[e.u].push_back(make_pair(e.v, e.w));
+		if (not directed) {
+			adj[e.v].push_back(make_pair(e.u, e.w));
+		}
+	}
+	// the expected graph when removing the repeated edges,
+	// built adding the edges one at a time
+	G_t R;
+	R.init(N);
+	for (const edge_line& e : lines) {
+		if (not R.has_edge(e.u, e.v)) {
+			add_line(R, e);
+		}
+	}
+
+	if (K.n_nodes() != N or G.n_nodes() != N or
+		K.n_edges() != lines.size() or G.n_edges() != R.n_edges())
+	{
+		cerr << ERROR("xx_structure_io.cpp", "check_edge_list") << endl;
+		cerr << "    Wrong number of nodes or edges read from '" << file << "'." << endl;
+		cerr << "    Expected " << N << " nodes, " << lines.size()
+			 << " lines and " << R.n_edges() << " edges." << endl;
+		return err_type::test_error;
+	}
+	for (node u = 0; u < N; ++u) {
+		if (neighbours(K, u) != adj[u]) {
+			cerr << ERROR("xx_structure_io.cpp", "check_edge_list") << endl;
+			cerr << "    Wrong neighbours of node " << u
+				 << " keeping every line of '" << file << "'." << endl;
+			return err_type::test_error;
+		}
+		if (sorted_neighbours(G, u) != sorted_neighbours(R, u)) {
+			cerr << ERROR("xx_structure_io.cpp", "check_edge_list") << endl;
+			cerr << "    Wrong neighbours of node " << u
+				 << " removing the repeated edges of '" << file << "'." << endl;
+			return err_type::test_error;
+		}
+	}
+	return err_type::no_error;
+}
+
+err_type xx_structure_edge_list(ifstream& fin) {
+	string file, graph_type, weights;
+	// read files, and how to read them
+	while (fin >> file >> graph_type >> weights) {
+		err_type r = check_mapped_file(file);
+		if (r != err_type::no_error) {
+			return r;
+		}
+
+		uugraph U;
+		if (not edge_list::read(file, &U)) {
+			cout << file << ": could not be opened" << endl;
+			continue;
+		}
+
+		const bool directed = graph_type == "directed";
+		if (weights == "weighted") {
+			r = (directed ?
+				check_edge_list<wdgraph<float> >(file, true, true) :
+				check_edge_list<wugraph<float> >(file, false, true));
+		}
+		else {
+			r = (directed ?
+				check_edge_list<udgraph>(file, true, false) :
+				check_edge_list<uugraph>(file, false, false));
+		}
+		if (r != err_type::no_error) {
+			return r;
+		}
+	}
+	return err_type::no_error;
+}
+
+// Writes 'bytes' to 'file' and tries to map it into 'C' and to read it
+// into 'R'. Only the snapshot written by the library, 'intact', must
+// be accepted.
+template<class G_t, class C_t>
+err_type check_snapshot_bytes(
+	const string& file, const string& bytes,
+	const string& what, const string& input
+)
+{
+	{
+	ofstream fout(file, ios::binary);
+	fout.write(bytes.data(), bytes.size());
+	}
+
+	C_t C;
+	G_t R;
+	const bool mapped = snapshot::map(file, &C);
+	const bool read = snapshot::read(file, &R);
+	cout << "    " << what << ": "
+		 << (mapped ? "mapped" : "not mapped") << ", "
+		 << (read ? "read" : "not read") << endl;
+
+	const bool expected = what == "intact";
+	if (mapped != expected or read != expected) {
+		cerr << ERROR("xx_structure_io.cpp", "check_snapshot_bytes") << endl;
+		cerr << "    The snapshot of '" << input << "' (" << what << ") was "
+			 << (expected ? "rejected." : "accepted.") << endl;
+		return err_type::test_error;
+	}
+	return err_type::no_error;
+}
+
+// Writes the snapshot of the graph in 'input' and checks that it is
+// rejected after truncating it or after setting counts in its header
+// whose sizes in bytes overflow a 64-bit integer.
+template<class G_t, class C_t>
+err_type check_snapshot(const string& input) {
+	const string file = ".tmp.structure-snapshot";
+
+	G_t G;
+	edge_list::read(input, &G);
+	if (not snapshot::write(file, &G)) {
+		cerr << ERROR("xx_structure_io.cpp", "check_snapshot") << endl;
+		cerr << "    Could not write the snapshot '" << file << "'." << endl;
+		return err_type::io_error;
+	}
+
+	string bytes;
+	{
+	ifstream fin(file, ios::binary);
+	bytes.assign((istreambuf_iterator<char>(fin)), istreambuf_iterator<char>());
+	}
+	snapshot::snapshot_header h;
+	memcpy(&h, bytes.data(), sizeof(h));
+
+	cout << input << ": " << bytes.size() << " bytes" << endl;
+
+	vector<pair<string, string> > tests;
+	tests.push_back(make_pair("intact", bytes));
+	tests.push_back(make_pair("truncated header", bytes.substr(0, sizeof(h) - 1)));
+	tests.push_back(make_pair("truncated arrays", bytes.substr(0, bytes.size() - 1)));
+
+	// the size of the offsets is 0 modulo 2^64
+	snapshot::snapshot_header hn = h;
+	hn.n_nodes = numeric_limits<uint64_t>::max()/sizeof(uint64_t);
+	string nodes = bytes;
+	memcpy(&nodes[0], &hn, sizeof(hn));
+	tests.push_back(make_pair("nodes overflow", nodes));
+
+	// the size of the neighbourhoods and the weights is smaller than
+	// the size of one edge modulo 2^64, and the last offset agrees
+	snapshot::snapshot_header hm = h;
+	hm.n_neighbours =
+		numeric_limits<uint64_t>::max()/(sizeof(uint64_t) + h.weight_size) + 1;
+	string neighbours = bytes;
+	memcpy(&neighbours[0], &hm, sizeof(hm));
+	memcpy(
+		&neighbours[sizeof(hm) + h.n_nodes*sizeof(uint64_t)],
+		&hm.n_neighbours, sizeof(uint64_t)
+	);
+	tests.push_back(make_pair("neighbours overflow", neighbours));
+
+	err_type r = err_type::no_error;
+	for (size_t i = 0; i < tests.size() and r == err_type::no_error; ++i) {
+		r = check_snapshot_bytes<G_t, C_t>(file, tests[i].second, tests[i].first, input);
+	}
+	remove(file.c_str());
+	return r;
+}
+
+err_type xx_structure_snapshot(ifstream& fin) {
+	string file, graph_type, weights;
+	// read files, and how to read them
+	while (fin >> file >> graph_type >> weights) {
+		const bool directed = graph_type == "directed";
+		err_type r;
+		if (weights == "weighted") {
+			r = (directed ?
+				check_snapshot<wdgraph<float>, csr_wxgraph<float> >(file) :
+				check_snapshot<wugraph<float>, csr_wxgraph<float> >(file));
+		}
+		else {
+			r = (directed ?
+				check_snapshot<udgraph, csr_uxgraph>(file) :
+				check_snapshot<uugraph, csr_uxgraph>(file));
+		}
+		if (r != err_type::no_error) {
+			return r;
+		}
+	}
+	return err_type::no_error;
+}
+
+} // -- namespace exe_tests
@@ -0,0 +1,275 @@
+// C++ inlcudes
+#include <iostream>
+#include <random>
+#include <vector>
+#include <set>
+using namespace std;
+
+// lgraph includes
+#include <lgraph/graph_traversal/dijkstra_queues.hpp>
+#include <lgraph/graph_traversal/workspace.hpp>
+using namespace lgraph;
+using namespace traversal;
+using namespace dijkstra;
+
+// custom includes
+#include "definitions.hpp"
+#include "test_utils.hpp"
+#include "xx_structure/xx_structure.hpp"
+using namespace test_utils;
+
+namespace exe_tests {
+
+/* The queues are compared against a set of (distance, node) pairs after
+ * every operation. Ties between equal distances are frequent: the keys
+ * are drawn from a small range.
+ */
+
+// the element at the top has the smallest distance, and it is in the set
+template<typename T, class set_t>
+bool check_top(const djka_node<T>& top, const set_t& ref) {
+	return top.first == ref.begin()->first and ref.find(top) != ref.end();
+}
+
+template<typename T, size_t d>
+err_type check_indexed_heap(size_t n, size_t n_ops, size_t seed) {
+	workspace<T> ws(n);
+	indexed_heap<T,d> Q(ws);
+
+	mt19937 gen(seed);
+	// distance of every node in the queue
+	vector<T> key(n, inf_t<T>());
+	set<djka_node<T> > ref;
+
+	size_t n_pushes = 0;
+	size_t n_decreases = 0;
+	size_t n_pops = 0;
+	for (size_t i = 0; i < n_ops; ++i) {
+		if (gen()%3 != 0 or ref.empty()) {
+			const node u = gen()%n;
+			const T k = static_cast<T>(gen()%16);
+			Q.push(k, u);
+			if (key[u] == inf_t<T>()) {
+				++n_pushes;
+				key[u] = k;
+				ref.insert(djka_node<T>(k, u));
+			}
+			else if (k < key[u]) {
+				++n_decreases;
+				ref.erase(djka_node<T>(key[u], u));
+				key[u] = k;
+				ref.insert(djka_node<T>(k, u));
+			}
+		}
+		else {
+			const djka_node<T> top = Q.top();
+			if (not check_top(top, ref)) {
+				cerr << ERROR("xx_structure_queues.cpp", "check_indexed_heap") << endl;
+				cerr << "    Wrong top in operation " << i << " of the "
+					 << d << "-ary heap." << endl;
+				cerr << "    Top: (" << top.first << ", " << top.second << ")" << endl;
+				cerr << "    Expected distance " << ref.begin()->first << endl;
+				return err_type::test_error;
+			}
+			Q.pop();
+			ref.erase(top);
+			key[top.second] = inf_t<T>();
+			++n_pops;
+		}
+
+		// decreasing a key does not add elements
+		if (Q.size() != ref.size()) {
+			cerr << ERROR("xx_structure_queues.cpp", "check_indexed_heap") << endl;
+			cerr << "    Wrong size in operation " << i << " of the "
+				 << d << "-ary heap." << endl;
+			cerr << "    Size: " << Q.size() << ", expected " << ref.size() << endl;
+			return err_type::test_error;
+		}
+	}
+
+	// the rest of the elements come out sorted
+	while (not ref.empty()) {
+		if (not check_top(Q.top(), ref)) {
+			cerr << ERROR("xx_structure_queues.cpp", "check_indexed_heap") << endl;
+			cerr << "    Wrong top when emptying the " << d << "-ary heap." << endl;
+			return err_type::test_error;
+		}
+		ref.erase(Q.top());
+		Q.pop();
+	}
+	if (not Q.empty()) {
+		cerr << ERROR("xx_structure_queues.cpp", "check_indexed_heap") << endl;
+		cerr << "    The " << d << "-ary heap is not empty." << endl;
+		return err_type::test_error;
+	}
+
+	cout << d << "-ary heap, " << n << " nodes, " << n_ops << " operations: "
+		 << n_pushes << " pushes, " << n_decreases << " decreases, "
+		 << n_pops << " pops" << endl;
+	return err_type::no_error;
+}
+
+template<typename T>
+err_type check_lazy_heap(size_t n, size_t n_ops, size_t seed) {
+	workspace<T> ws(n);
+	lazy_heap<T> Q(ws);
+
+	mt19937 gen(seed);
+	multiset<djka_node<T> > ref;
+
+	size_t n_pushes = 0;
+	size_t n_pops = 0;
+	for (size_t i = 0; i < n_ops; ++i) {
+		if (gen()%3 != 0 or ref.empty()) {
+			const node u = gen()%n;
+			const T k = static_cast<T>(gen()%16);
+			Q.push(k, u);
+			ref.insert(djka_node<T>(k, u));
+			++n_pushes;
+		}
+		else {
+			// ties are broken by node index
+			if (Q.top() != *ref.begin()) {
+				cerr << ERROR("xx_structure_queues.cpp", "check_lazy_heap") << endl;
+				cerr << "    Wrong top in operation " << i << " of the lazy heap." << endl;
+				cerr << "    Top: (" << Q.top().first << ", " << Q.top().second << ")" << endl;
+				cerr << "    Expected: (" << ref.begin()->first << ", "
+					 << ref.begin()->second << ")" << endl;
+				return err_type::test_error;
+			}
+			Q.pop();
+			ref.erase(ref.begin());
+			++n_pops;
+		}
+
+		if (Q.size() != ref.size()) {
+			cerr << ERROR("xx_structure_queues.cpp", "check_lazy_heap") << endl;
+			cerr << "    Wrong size in operation " << i << " of the lazy heap." << endl;
+			cerr << "    Size: " << Q.size() << ", expected " << ref.size() << endl;
+			return err_type::test_error;
+		}
+	}
+
+	cout << "lazy heap, " << n << " nodes, " << n_ops << " operations: "
+		 << n_pushes << " pushes, " << n_pops << " pops" << endl;
+	return err_type::no_error;
+}
+
+// The distances pushed into a radix heap cannot be smaller than the
+// last one popped. They start at 'base', and grow in small steps, so
+// that there are ties, and now and then in steps of any number of bits,
+// so that the elements are spread over all the buckets. They never reach
+// the largest value.
+template<typename T>
+err_type check_radix_heap(size_t n, size_t n_ops, size_t seed, T base) {
+	workspace<T> ws(n);
+	radix_heap<T> Q(ws);
+
+	mt19937_64 gen(seed);
+	multiset<djka_node<T> > ref;
+	T last = base;
+	const T max_key = inf_t<T>() - 1;
+
+	size_t n_pushes = 0;
+	size_t n_pops = 0;
+	for (size_t i = 0; i < n_ops; ++i) {
+		if (gen()%3 != 0 or ref.empty()) {
+			const node u = gen()%n;
+			const size_t step = gen()%16;
+			const size_t bits = 8*sizeof(T);
+			const T delta = static_cast<T>(
+				step < 8 ? gen()%16 :
+				step < 15 ? gen()%(1 << 20) : gen() >> (64 - bits + gen()%bits)
+			);
+			const T k = (delta <= max_key - last ? last + delta : max_key);
+			Q.push(k, u);
+			ref.insert(djka_node<T>(k, u));
+			++n_pushes;
+		}
+		else {
+			const djka_node<T> top = Q.top();
+			if (not check_top(top, ref)) {
+				cerr << ERROR("xx_structure_queues.cpp", "check_radix_heap") << endl;
+				cerr << "    Wrong top in operation " << i << " of the radix heap." << endl;
+				cerr << "    Top: (" << top.first << ", " << top.second << ")" << endl;
+				cerr << "    Expected distance " << ref.begin()->first << endl;
+				return err_type::test_error;
+			}
+			Q.pop();
+			ref.erase(ref.find(top));
+			last = top.first;
+			++n_pops;
+		}
+
+		if (Q.size() != ref.size()) {
+			cerr << ERROR("xx_structure_queues.cpp", "check_radix_heap") << endl;
+			cerr << "    Wrong size in operation " << i << " of the radix heap." << endl;
+			cerr << "    Size: " << Q.size() << ", expected " << ref.size() << endl;
+			return err_type::test_error;
+		}
+	}
+
+	// the rest of the elements come out sorted
+	while (not ref.empty()) {
+		const djka_node<T> top = Q.top();
+		if (not check_top(top, ref)) {
+			cerr << ERROR("xx_structure_queues.cpp", "check_radix_heap") << endl;
+			cerr << "    Wrong top when emptying the radix heap." << endl;
+			return err_type::test_error;
+		}
+		Q.pop();
+		ref.erase(ref.find(top));
+	}
+	if (not Q.empty()) {
+		cerr << ERROR("xx_structure_queues.cpp", "check_radix_heap") << endl;
+		cerr << "    The radix heap is not empty." << endl;
+		return err_type::test_error;
+	}
+
+	cout << 8*sizeof(T) << "-bit radix heap, " << n << " nodes, " << n_ops
+		 << " operations from " << base << ": " << n_pushes << " pushes, "
+		 << n_pops << " pops, last distance " << last << endl;
+	return err_type::no_error;
+}
+
+err_type xx_structure_queues(ifstream& fin) {
+	string queue;
+	size_t n, n_ops, seed;
+	// read the queue, the number of nodes, of operations and the seed
+	while (fin >> queue >> n >> n_ops >> seed) {
+		err_type r = err_type::invalid_param;
+		if (queue == "indexed-2") {
+			r = check_indexed_heap<float, 2>(n, n_ops, seed);
+		}
+		else if (queue == "indexed-4") {
+			r = check_indexed_heap<float, 4>(n, n_ops, seed);
+		}
+		else if (queue == "indexed-8") {
+			r = check_indexed_heap<size_t, 8>(n, n_ops, seed);
+		}
+		else if (queue == "lazy") {
+			r = check_lazy_heap<float>(n, n_ops, seed);
+		}
+		else if (queue == "radix-32" or queue == "radix-64") {
+			// the smallest distance
+			uint64_t base;
+			fin >> base;
+			if (queue == "radix-32") {
+				r = check_radix_heap<uint32_t>(n, n_ops, seed, static_cast<uint32_t>(base));
+			}
+			else {
+				r = check_radix_heap<uint64_t>(n, n_ops, seed, base);
+			}
+		}
+		else {
+			cerr << ERROR("xx_structure_queues.cpp", "xx_structure_queues") << endl;
+			cerr << "    Queue '" << queue << "' is not supported." << endl;
+		}
+		if (r != err_type::no_error) {
+			return r;
+		}
+	}
+	return err_type::no_error;
+}
+
+} // -- namespace exe_tests
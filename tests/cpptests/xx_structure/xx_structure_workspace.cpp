@@ -0,0 +1,118 @@
+// C++ inlcudes
+#include <iostream>
+#include <vector>
+using namespace std;
+
+// lgraph includes
+#include <lgraph/graph_traversal/workspace.hpp>
+using namespace lgraph;
+using namespace traversal;
+
+// custom includes
+#include "definitions.hpp"
+#include "test_utils.hpp"
+#include "xx_structure/xx_structure.hpp"
+using namespace test_utils;
+
+namespace exe_tests {
+
+// does node 'u' get a value in round 'r'?
+inline bool chosen(size_t r, node u, size_t k) {
+	return ((r*131 + u*31) ^ (r >> 2))%k == 0;
+}
+
+template<class stamp_t>
+err_type check_workspace(size_t n, size_t n_rounds) {
+	// few bits for the generations: they wrap around
+	// every 2^8 - 1 (or 2^16 - 1) rounds
+	workspace<_new_, stamp_t> ws(n, true);
+
+	size_t n_set = 0;
+	for (size_t r = 0; r < n_rounds; ++r) {
+		vector<_new_> ds(n, inf_t<_new_>());
+		vector<size_t> ps(n, 0);
+		vector<node> parents(n, n);
+		vector<bool> vis(n, false);
+		size_t n_vis = 0;
+
+		// node 0 only gets a value in the first round: it is
+		// the oldest stamp when the generations wrap around
+		for (node u = 0; u < n; ++u) {
+			if ((u == 0 and r == 0) or (u > 0 and chosen(r, u, 3))) {
+				ds[u] = r*n + u;
+				ps[u] = r + u;
+				parents[u] = (u + r)%n;
+				ws.set_distance(u, ds[u]);
+				ws.set_n_paths(u, ps[u]);
+				ws.set_parent(u, parents[u]);
+				++n_set;
+			}
+			if (chosen(r, u, 4)) {
+				vis[u] = true;
+				ws.visit(u);
+				++n_vis;
+			}
+		}
+
+		for (node u = 0; u < n; ++u) {
+			if (ws.distance(u) != ds[u] or ws.n_paths(u) != ps[u] or
+				ws.parent(u) != parents[u] or ws.is_visited(u) != vis[u])
+			{
+				cerr << ERROR("xx_structure_workspace.cpp", "check_workspace") << endl;
+				cerr << "    Stale value of node " << u << " in round " << r
+					 << " with " << 8*sizeof(stamp_t) << "-bit generations." << endl;
+				cerr << "    Distance: " << floatpointout_dist(ws.distance(u))
+					 << ", expected " << floatpointout_dist(ds[u]) << endl;
+				cerr << "    Paths: " << ws.n_paths(u)
+					 << ", expected " << ps[u] << endl;
+				cerr << "    Parent: " << ws.parent(u)
+					 << ", expected " << parents[u] << endl;
+				return err_type::test_error;
+			}
+		}
+		if (ws.visited_nodes().size() != n_vis) {
+			cerr << ERROR("xx_structure_workspace.cpp", "check_workspace") << endl;
+			cerr << "    Wrong number of visited nodes in round " << r << "." << endl;
+			return err_type::test_error;
+		}
+
+		// initialising with the same size only resets
+		if (r%1000 == 999) {
+			ws.init(n, true);
+		}
+		else {
+			ws.reset();
+		}
+	}
+
+	cout << 8*sizeof(stamp_t) << "-bit generations, " << n << " nodes, "
+		 << n_rounds << " rounds: " << n_set << " values set" << endl;
+	return err_type::no_error;
+}
+
+err_type xx_structure_workspace(ifstream& fin) {
+	size_t bits, n, n_rounds;
+	// read the size of the stamps, of the workspace, and the rounds
+	while (fin >> bits >> n >> n_rounds) {
+		err_type r = err_type::invalid_param;
+		if (bits == 8) {
+			r = check_workspace<uint8_t>(n, n_rounds);
+		}
+		else if (bits == 16) {
+			r = check_workspace<uint16_t>(n, n_rounds);
+		}
+		else if (bits == 32) {
+			r = check_workspace<uint32_t>(n, n_rounds);
+		}
+		else {
+			cerr << ERROR("xx_structure_workspace.cpp", "xx_structure_workspace") << endl;
+			cerr << "    Stamps of " << bits << " bits are not supported." << endl;
+		}
+		if (r != err_type::no_error) {
+			return r;
+		}
+	}
+	return err_type::no_error;
+}
+
+} // -- namespace exe_tests
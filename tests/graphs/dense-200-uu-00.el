@@ -0,0 +1,2877 @@
+0 5
+0 10
+0 18
+0 21
+0 32
+0 33
+0 37
+0 38
+0 39
+0 47
+0 50
+0 54
+0 55
+0 57
+0 59
+0 62
+0 66
+0 74
+0 82
+0 90
+0 104
+0 111
+0 130
+0 136
+0 140
+0 148
+0 149
+0 164
+0 166
+0 170
+0 175
+0 187
+0 189
+0 196
+1 3
+1 7
+1 11
+1 14
+1 17
+1 21
+1 24
+1 32
+1 35
+1 37
+1 54
+1 67
+1 70
+1 72
+1 75
+1 93
+1 110
+1 111
+1 115
+1 117
+1 137
+1 142
+1 155
+1 159
+1 162
+1 172
+1 175
+1 190
+2 26
+2 30
+2 32
+2 59
+2 60
+2 62
+2 65
+2 75
+2 80
+2 90
+2 91
+2 93
+2 109
+2 110
+2 124
+2 140
+2 144
+2 151
+2 163
+2 167
+2 169
+2 171
+2 193
+3 19
+3 27
+3 34
+3 39
+3 47
+3 65
+3 67
+3 70
+3 82
+3 83
+3 88
+3 102
+3 110
+3 112
+3 113
+3 114
+3 117
+3 132
+3 137
+3 141
+3 152
+3 156
+3 162
+3 172
+3 173
+3 175
+3 176
+3 185
+3 186
+3 191
+3 195
+4 33
+4 40
+4 45
+4 46
+4 49
+4 51
+4 56
+4 58
+4 64
+4 67
+4 71
+4 75
+4 91
+4 95
+4 101
+4 107
+4 108
+4 117
+4 125
+4 133
+4 147
+4 155
+4 175
+4 177
+4 192
+4 199
+5 18
+5 25
+5 26
+5 33
+5 42
+5 49
+5 54
+5 60
+5 62
+5 64
+5 74
+5 81
+5 93
+5 99
+5 110
+5 118
+5 122
+5 126
+5 134
+5 139
+5 140
+5 144
+5 161
+5 166
+5 179
+5 184
+5 196
+5 197
+6 11
+6 25
+6 29
+6 31
+6 36
+6 40
+6 44
+6 57
+6 64
+6 84
+6 87
+6 89
+6 105
+6 108
+6 113
+6 127
+6 137
+6 163
+6 165
+6 178
+6 182
+6 187
+6 188
+6 194
+7 10
+7 19
+7 21
+7 23
+7 35
+7 48
+7 51
+7 54
+7 56
+7 60
+7 74
+7 84
+7 95
+7 98
+7 101
+7 119
+7 127
+7 133
+7 134
+7 138
+7 154
+7 155
+7 158
+7 161
+7 168
+7 180
+7 183
+7 185
+7 195
+8 9
+8 11
+8 15
+8 23
+8 42
+8 46
+8 49
+8 75
+8 79
+8 87
+8 91
+8 121
+8 142
+8 145
+8 148
+8 149
+8 151
+8 167
+8 173
+8 175
+8 179
+8 181
+8 184
+8 186
+8 188
+9 11
+9 13
+9 17
+9 23
+9 28
+9 42
+9 46
+9 48
+9 56
+9 57
+9 62
+9 77
+9 82
+9 83
+9 87
+9 91
+9 96
+9 109
+9 112
+9 121
+9 139
+9 142
+9 144
+9 152
+9 158
+9 164
+9 165
+9 174
+9 175
+9 177
+9 188
+9 199
+10 19
+10 20
+10 31
+10 32
+10 44
+10 48
+10 68
+10 77
+10 79
+10 84
+10 85
+10 93
+10 98
+10 104
+10 120
+10 133
+10 134
+10 138
+10 144
+10 151
+10 152
+10 172
+10 178
+10 195
+11 13
+11 16
+11 38
+11 39
+11 43
+11 44
+11 53
+11 57
+11 60
+11 73
+11 75
+11 81
+11 85
+11 86
+11 89
+11 93
+11 97
+11 102
+11 107
+11 112
+11 121
+11 123
+11 127
+11 132
+11 136
+11 143
+11 171
+11 182
+11 195
+12 16
+12 17
+12 34
+12 37
+12 40
+12 43
+12 55
+12 60
+12 61
+12 62
+12 63
+12 66
+12 80
+12 91
+12 96
+12 102
+12 103
+12 104
+12 108
+12 112
+12 115
+12 118
+12 128
+12 141
+12 150
+12 152
+12 160
+12 172
+12 175
+12 181
+12 182
+12 186
+12 189
+12 197
+13 15
+13 17
+13 18
+13 19
+13 22
+13 25
+13 27
+13 35
+13 52
+13 73
+13 76
+13 81
+13 89
+13 91
+13 101
+13 106
+13 107
+13 108
+13 109
+13 117
+13 118
+13 124
+13 125
+13 129
+13 136
+13 140
+13 141
+13 150
+13 151
+13 152
+13 164
+13 184
+13 191
+13 192
+13 194
+14 15
+14 24
+14 29
+14 34
+14 41
+14 45
+14 48
+14 51
+14 64
+14 74
+14 78
+14 85
+14 86
+14 92
+14 99
+14 111
+14 115
+14 123
+14 135
+14 141
+14 153
+14 166
+14 167
+14 184
+14 187
+14 193
+14 198
+15 28
+15 32
+15 35
+15 37
+15 40
+15 47
+15 55
+15 74
+15 77
+15 78
+15 88
+15 94
+15 99
+15 101
+15 128
+15 139
+15 150
+15 151
+15 154
+15 162
+15 197
+15 198
+16 25
+16 33
+16 42
+16 50
+16 51
+16 65
+16 66
+16 69
+16 75
+16 77
+16 82
+16 88
+16 89
+16 92
+16 102
+16 111
+16 113
+16 118
+16 125
+16 136
+16 137
+16 139
+16 149
+16 155
+16 156
+16 185
+17 18
+17 22
+17 30
+17 32
+17 33
+17 38
+17 49
+17 50
+17 54
+17 63
+17 67
+17 69
+17 75
+17 88
+17 95
+17 114
+17 122
+17 153
+17 154
+17 155
+17 170
+17 174
+17 183
+17 189
+18 29
+18 35
+18 49
+18 56
+18 60
+18 61
+18 72
+18 77
+18 81
+18 86
+18 100
+18 112
+18 122
+18 123
+18 129
+18 133
+18 140
+18 142
+18 146
+18 157
+18 158
+18 170
+18 179
+18 195
+19 22
+19 31
+19 38
+19 42
+19 53
+19 56
+19 59
+19 60
+19 66
+19 68
+19 76
+19 81
+19 85
+19 94
+19 95
+19 101
+19 104
+19 110
+19 136
+19 139
+19 147
+19 186
+19 187
+19 194
+19 198
+20 23
+20 24
+20 27
+20 32
+20 34
+20 41
+20 42
+20 47
+20 58
+20 68
+20 69
+20 74
+20 76
+20 81
+20 85
+20 108
+20 114
+20 128
+20 132
+20 134
+20 140
+20 145
+20 146
+20 159
+20 160
+20 163
+20 172
+20 179
+20 183
+20 186
+20 195
+20 198
+21 24
+21 28
+21 37
+21 38
+21 57
+21 58
+21 66
+21 68
+21 77
+21 78
+21 79
+21 86
+21 99
+21 103
+21 109
+21 115
+21 118
+21 120
+21 134
+21 136
+21 157
+21 169
+21 177
+21 181
+22 33
+22 39
+22 40
+22 47
+22 57
+22 63
+22 66
+22 70
+22 73
+22 74
+22 84
+22 95
+22 98
+22 104
+22 106
+22 118
+22 121
+22 123
+22 137
+22 148
+22 162
+22 163
+22 195
+23 26
+23 28
+23 32
+23 35
+23 45
+23 48
+23 49
+23 67
+23 96
+23 97
+23 102
+23 104
+23 115
+23 118
+23 121
+23 123
+23 128
+23 135
+23 146
+23 163
+23 182
+23 183
+23 196
+24 26
+24 34
+24 36
+24 54
+24 64
+24 78
+24 97
+24 105
+24 116
+24 127
+24 130
+24 133
+24 146
+24 150
+24 159
+24 166
+24 176
+24 177
+24 180
+24 185
+24 187
+24 190
+24 191
+25 27
+25 36
+25 37
+25 39
+25 56
+25 74
+25 76
+25 83
+25 87
+25 101
+25 109
+25 124
+25 128
+25 129
+25 136
+25 142
+25 143
+25 149
+25 153
+25 155
+25 158
+25 166
+25 170
+25 174
+25 180
+25 187
+25 192
+25 196
+25 198
+26 29
+26 37
+26 38
+26 43
+26 57
+26 60
+26 62
+26 65
+26 67
+26 71
+26 80
+26 84
+26 87
+26 89
+26 115
+26 123
+26 124
+26 129
+26 135
+26 137
+26 146
+26 147
+26 154
+26 155
+26 164
+26 171
+26 194
+27 37
+27 40
+27 54
+27 56
+27 60
+27 70
+27 75
+27 76
+27 82
+27 94
+27 104
+27 106
+27 109
+27 119
+27 124
+27 130
+27 134
+27 137
+27 155
+27 167
+27 170
+27 179
+27 189
+28 32
+28 33
+28 34
+28 35
+28 45
+28 56
+28 58
+28 65
+28 72
+28 77
+28 88
+28 90
+28 92
+28 95
+28 100
+28 110
+28 111
+28 121
+28 132
+28 145
+28 146
+28 150
+28 151
+28 170
+28 174
+28 178
+28 182
+28 184
+28 185
+28 192
+28 195
+29 36
+29 48
+29 50
+29 67
+29 91
+29 92
+29 97
+29 101
+29 102
+29 106
+29 109
+29 118
+29 120
+29 130
+29 137
+29 139
+29 140
+29 147
+29 152
+29 156
+29 164
+29 188
+29 196
+29 198
+30 31
+30 37
+30 52
+30 59
+30 71
+30 76
+30 83
+30 86
+30 97
+30 105
+30 113
+30 127
+30 131
+30 134
+30 146
+30 154
+30 164
+30 172
+30 175
+30 182
+30 197
+31 38
+31 41
+31 61
+31 66
+31 68
+31 71
+31 76
+31 96
+31 98
+31 99
+31 105
+31 106
+31 109
+31 111
+31 114
+31 122
+31 123
+31 144
+31 148
+31 156
+31 161
+31 176
+31 182
+31 191
+31 194
+31 196
+31 197
+32 33
+32 37
+32 53
+32 55
+32 64
+32 75
+32 76
+32 82
+32 83
+32 87
+32 92
+32 95
+32 99
+32 105
+32 108
+32 110
+32 116
+32 133
+32 135
+32 136
+32 142
+32 143
+32 146
+32 151
+32 174
+32 179
+32 180
+33 40
+33 46
+33 52
+33 54
+33 80
+33 85
+33 98
+33 104
+33 141
+33 155
+33 160
+33 161
+33 167
+33 170
+33 180
+33 191
+34 40
+34 45
+34 47
+34 59
+34 62
+34 104
+34 111
+34 133
+34 135
+34 140
+34 144
+34 166
+34 168
+34 173
+34 178
+34 179
+34 181
+34 188
+34 191
+34 197
+35 38
+35 39
+35 40
+35 44
+35 52
+35 56
+35 65
+35 89
+35 110
+35 118
+35 120
+35 124
+35 127
+35 128
+35 131
+35 132
+35 133
+35 144
+35 158
+35 159
+35 160
+35 180
+35 185
+35 191
+35 198
+35 199
+36 43
+36 52
+36 54
+36 62
+36 67
+36 71
+36 72
+36 76
+36 78
+36 84
+36 89
+36 102
+36 106
+36 107
+36 109
+36 114
+36 141
+36 147
+36 148
+36 183
+36 190
+37 38
+37 40
+37 41
+37 49
+37 56
+37 65
+37 69
+37 73
+37 78
+37 89
+37 109
+37 111
+37 113
+37 126
+37 135
+37 137
+37 159
+37 166
+37 174
+37 182
+37 192
+38 40
+38 49
+38 59
+38 84
+38 89
+38 93
+38 105
+38 107
+38 108
+38 122
+38 135
+38 139
+38 143
+38 147
+38 153
+38 162
+38 163
+38 166
+38 169
+38 174
+38 180
+38 181
+38 198
+39 42
+39 49
+39 59
+39 63
+39 68
+39 79
+39 91
+39 107
+39 112
+39 114
+39 115
+39 118
+39 125
+39 126
+39 130
+39 133
+39 137
+39 147
+39 149
+39 151
+39 152
+39 157
+39 161
+39 164
+39 169
+39 171
+39 178
+39 180
+39 182
+39 196
+39 199
+40 41
+40 45
+40 49
+40 62
+40 70
+40 84
+40 89
+40 91
+40 92
+40 109
+40 110
+40 111
+40 120
+40 133
+40 135
+40 151
+40 157
+40 162
+40 173
+40 176
+40 191
+40 192
+41 43
+41 53
+41 84
+41 103
+41 105
+41 109
+41 110
+41 118
+41 122
+41 125
+41 141
+41 144
+41 153
+41 156
+41 161
+41 164
+41 175
+41 189
+41 197
+41 199
+42 43
+42 62
+42 63
+42 73
+42 87
+42 96
+42 100
+42 101
+42 102
+42 109
+42 142
+42 144
+42 152
+42 153
+42 158
+42 186
+42 190
+42 194
+43 49
+43 53
+43 64
+43 67
+43 78
+43 88
+43 111
+43 112
+43 115
+43 118
+43 119
+43 131
+43 137
+43 138
+43 142
+43 144
+43 155
+43 157
+43 161
+43 179
+43 184
+43 185
+43 190
+43 192
+43 196
+43 199
+44 48
+44 52
+44 61
+44 69
+44 75
+44 88
+44 89
+44 92
+44 102
+44 108
+44 111
+44 112
+44 114
+44 117
+44 127
+44 140
+44 157
+44 169
+44 175
+44 178
+44 189
+44 198
+45 48
+45 49
+45 51
+45 52
+45 56
+45 57
+45 69
+45 74
+45 75
+45 85
+45 96
+45 99
+45 100
+45 103
+45 110
+45 112
+45 117
+45 126
+45 142
+45 143
+45 144
+45 145
+45 152
+45 154
+45 163
+45 167
+45 169
+45 186
+45 188
+45 193
+45 197
+46 52
+46 72
+46 73
+46 82
+46 100
+46 102
+46 108
+46 114
+46 116
+46 129
+46 134
+46 156
+46 160
+46 175
+46 178
+46 185
+46 194
+47 54
+47 75
+47 83
+47 84
+47 114
+47 122
+47 125
+47 126
+47 130
+47 131
+47 132
+47 136
+47 139
+47 150
+47 153
+47 160
+47 163
+47 173
+47 176
+47 181
+47 187
+48 51
+48 52
+48 61
+48 65
+48 67
+48 72
+48 106
+48 107
+48 119
+48 122
+48 131
+48 143
+48 151
+48 153
+48 179
+48 180
+48 185
+49 50
+49 51
+49 60
+49 70
+49 75
+49 96
+49 119
+49 127
+49 134
+49 141
+49 144
+49 145
+49 147
+49 178
+49 183
+49 184
+49 187
+50 59
+50 60
+50 63
+50 78
+50 108
+50 119
+50 121
+50 126
+50 152
+50 154
+50 158
+50 161
+50 164
+50 170
+50 183
+50 184
+50 199
+51 52
+51 86
+51 97
+51 99
+51 100
+51 115
+51 134
+51 144
+51 159
+51 164
+51 172
+51 178
+51 184
+51 187
+52 61
+52 64
+52 67
+52 71
+52 75
+52 77
+52 80
+52 84
+52 94
+52 111
+52 114
+52 121
+52 133
+52 146
+52 148
+52 149
+52 151
+52 153
+52 160
+52 162
+52 173
+52 179
+52 182
+52 188
+52 196
+52 199
+53 58
+53 61
+53 62
+53 73
+53 79
+53 81
+53 82
+53 85
+53 90
+53 101
+53 102
+53 104
+53 105
+53 108
+53 109
+53 118
+53 128
+53 130
+53 131
+53 134
+53 137
+53 146
+53 156
+53 158
+53 169
+53 170
+53 171
+53 178
+53 180
+53 184
+53 187
+53 189
+53 191
+53 193
+53 196
+53 199
+54 60
+54 67
+54 70
+54 93
+54 99
+54 113
+54 115
+54 117
+54 122
+54 127
+54 132
+54 148
+54 156
+54 171
+54 177
+54 178
+54 179
+54 181
+54 182
+54 184
+54 192
+54 195
+54 197
+54 198
+54 199
+55 67
+55 70
+55 84
+55 88
+55 98
+55 103
+55 108
+55 111
+55 118
+55 126
+55 137
+55 143
+55 148
+55 154
+55 155
+55 157
+55 166
+55 169
+55 180
+55 188
+55 197
+56 61
+56 64
+56 69
+56 84
+56 93
+56 102
+56 104
+56 112
+56 113
+56 121
+56 126
+56 132
+56 134
+56 151
+56 153
+56 165
+56 170
+56 177
+56 195
+56 197
+57 85
+57 91
+57 93
+57 119
+57 121
+57 124
+57 129
+57 130
+57 141
+57 143
+57 145
+57 146
+57 147
+57 151
+57 158
+57 166
+57 170
+57 176
+57 182
+57 183
+57 191
+57 195
+57 196
+57 197
+58 66
+58 85
+58 86
+58 88
+58 96
+58 104
+58 108
+58 113
+58 119
+58 130
+58 133
+58 141
+58 152
+58 158
+58 176
+58 177
+58 183
+58 188
+58 195
+59 73
+59 74
+59 83
+59 87
+59 97
+59 99
+59 106
+59 107
+59 126
+59 146
+59 149
+59 151
+59 171
+59 175
+59 187
+59 190
+59 198
+59 199
+60 75
+60 77
+60 78
+60 95
+60 98
+60 112
+60 115
+60 120
+60 127
+60 130
+60 137
+60 145
+60 147
+60 174
+60 182
+60 183
+60 184
+60 189
+61 65
+61 75
+61 78
+61 81
+61 82
+61 89
+61 94
+61 101
+61 109
+61 117
+61 121
+61 125
+61 133
+61 135
+61 154
+61 155
+61 156
+61 157
+61 164
+61 172
+61 176
+61 186
+62 66
+62 74
+62 77
+62 84
+62 107
+62 108
+62 110
+62 120
+62 134
+62 136
+62 142
+62 158
+62 165
+62 166
+62 186
+62 190
+62 191
+62 198
+62 199
+63 64
+63 67
+63 76
+63 93
+63 94
+63 98
+63 101
+63 102
+63 108
+63 111
+63 112
+63 131
+63 152
+63 155
+63 172
+63 174
+63 176
+63 185
+63 192
+63 197
+64 72
+64 80
+64 87
+64 88
+64 91
+64 100
+64 102
+64 104
+64 107
+64 113
+64 122
+64 130
+64 132
+64 152
+64 161
+64 178
+65 66
+65 73
+65 77
+65 86
+65 100
+65 106
+65 122
+65 140
+65 149
+65 156
+65 187
+65 188
+65 191
+65 193
+66 69
+66 72
+66 73
+66 75
+66 78
+66 80
+66 92
+66 100
+66 108
+66 110
+66 111
+66 112
+66 113
+66 123
+66 139
+66 143
+66 153
+66 156
+66 162
+66 165
+66 166
+66 177
+66 181
+66 193
+67 73
+67 85
+67 88
+67 96
+67 102
+67 114
+67 151
+67 167
+67 173
+68 78
+68 81
+68 83
+68 87
+68 93
+68 99
+68 102
+68 105
+68 107
+68 114
+68 119
+68 126
+68 127
+68 128
+68 131
+68 132
+68 145
+68 174
+68 176
+68 185
+69 72
+69 75
+69 84
+69 90
+69 95
+69 96
+69 99
+69 105
+69 106
+69 122
+69 128
+69 130
+69 136
+69 139
+69 146
+69 147
+69 159
+69 167
+69 172
+69 175
+69 176
+69 180
+69 199
+70 72
+70 83
+70 85
+70 91
+70 98
+70 99
+70 106
+70 109
+70 112
+70 118
+70 132
+70 134
+70 136
+70 148
+70 157
+70 160
+70 165
+70 167
+70 182
+70 190
+70 194
+71 80
+71 84
+71 94
+71 101
+71 103
+71 104
+71 107
+71 109
+71 125
+71 128
+71 133
+71 134
+71 136
+71 138
+71 155
+71 161
+71 165
+71 171
+71 172
+71 180
+71 183
+71 184
+71 186
+72 85
+72 93
+72 95
+72 102
+72 107
+72 112
+72 114
+72 125
+72 127
+72 129
+72 144
+72 145
+72 160
+72 161
+72 174
+72 178
+72 183
+73 80
+73 86
+73 116
+73 117
+73 124
+73 138
+73 145
+73 148
+73 153
+73 165
+73 166
+73 185
+73 193
+73 194
+73 197
+73 199
+74 75
+74 79
+74 88
+74 89
+74 93
+74 97
+74 106
+74 108
+74 118
+74 122
+74 139
+74 141
+74 143
+74 146
+74 150
+74 155
+74 179
+74 186
+74 193
+75 76
+75 77
+75 82
+75 83
+75 94
+75 106
+75 114
+75 116
+75 131
+75 150
+75 152
+75 163
+75 174
+75 175
+75 182
+75 189
+75 194
+76 82
+76 84
+76 91
+76 102
+76 103
+76 107
+76 108
+76 109
+76 110
+76 114
+76 121
+76 134
+76 137
+76 138
+76 140
+76 145
+76 149
+76 156
+76 165
+76 180
+76 195
+76 197
+77 79
+77 105
+77 110
+77 119
+77 122
+77 145
+77 150
+77 154
+77 160
+77 163
+77 168
+77 173
+77 182
+77 187
+77 188
+78 80
+78 81
+78 93
+78 96
+78 99
+78 106
+78 113
+78 119
+78 123
+78 127
+78 135
+78 150
+78 154
+78 161
+78 187
+78 197
+79 82
+79 88
+79 108
+79 109
+79 115
+79 125
+79 133
+79 137
+79 141
+79 149
+79 157
+79 161
+79 170
+79 194
+80 84
+80 96
+80 99
+80 100
+80 104
+80 116
+80 122
+80 129
+80 139
+80 145
+80 164
+80 166
+80 181
+80 187
+80 191
+80 192
+80 193
+80 194
+81 84
+81 95
+81 108
+81 112
+81 140
+81 141
+81 158
+81 160
+81 171
+81 174
+81 178
+81 183
+81 188
+82 95
+82 118
+82 124
+82 125
+82 127
+82 129
+82 148
+82 162
+82 174
+82 187
+82 191
+82 192
+83 85
+83 88
+83 89
+83 91
+83 99
+83 113
+83 114
+83 122
+83 124
+83 133
+83 136
+83 147
+83 156
+83 157
+83 162
+83 176
+83 184
+84 87
+84 95
+84 101
+84 110
+84 113
+84 121
+84 123
+84 134
+84 139
+84 153
+84 158
+84 160
+84 162
+84 171
+84 179
+84 194
+85 91
+85 97
+85 98
+85 99
+85 102
+85 119
+85 124
+85 126
+85 136
+85 139
+85 143
+85 144
+85 159
+85 162
+85 163
+85 174
+85 179
+85 189
+85 192
+86 89
+86 90
+86 103
+86 119
+86 120
+86 136
+86 158
+86 159
+86 163
+86 171
+86 172
+86 173
+86 177
+87 88
+87 96
+87 98
+87 101
+87 103
+87 105
+87 120
+87 121
+87 125
+87 140
+87 143
+87 150
+87 151
+87 157
+87 161
+87 163
+87 165
+87 173
+87 176
+87 180
+87 187
+87 199
+88 89
+88 98
+88 103
+88 105
+88 107
+88 116
+88 118
+88 126
+88 131
+88 132
+88 136
+88 150
+88 167
+88 172
+88 198
+89 108
+89 109
+89 119
+89 132
+89 134
+89 156
+89 162
+89 164
+89 171
+89 177
+89 178
+89 181
+90 93
+90 103
+90 115
+90 130
+90 131
+90 132
+90 143
+90 144
+90 148
+90 150
+90 152
+90 154
+90 160
+90 181
+90 189
+90 190
+91 95
+91 99
+91 100
+91 105
+91 107
+91 128
+91 131
+91 132
+91 135
+91 143
+91 145
+91 149
+91 154
+91 155
+91 156
+91 157
+91 175
+91 181
+92 101
+92 105
+92 106
+92 108
+92 109
+92 112
+92 115
+92 119
+92 121
+92 132
+92 139
+92 147
+92 155
+92 157
+92 158
+92 172
+92 176
+92 185
+92 195
+92 197
+93 105
+93 111
+93 119
+93 130
+93 131
+93 134
+93 135
+93 146
+93 154
+93 167
+93 175
+93 176
+93 181
+93 182
+93 189
+93 190
+93 199
+94 104
+94 105
+94 113
+94 120
+94 123
+94 125
+94 135
+94 163
+94 169
+94 171
+94 183
+94 185
+94 193
+95 96
+95 115
+95 125
+95 129
+95 130
+95 138
+95 155
+95 165
+95 169
+95 170
+95 178
+95 179
+95 185
+95 191
+95 192
+95 198
+96 98
+96 100
+96 110
+96 115
+96 116
+96 118
+96 119
+96 122
+96 136
+96 166
+96 192
+96 196
+96 197
+97 100
+97 110
+97 116
+97 119
+97 124
+97 125
+97 127
+97 134
+97 141
+97 144
+97 150
+97 152
+97 158
+97 161
+97 178
+97 180
+97 184
+98 109
+98 112
+98 116
+98 117
+98 119
+98 122
+98 127
+98 138
+98 139
+98 142
+98 146
+98 148
+98 160
+98 161
+98 180
+98 194
+99 102
+99 103
+99 111
+99 113
+99 128
+99 139
+99 143
+99 147
+99 150
+99 155
+99 177
+99 178
+99 181
+99 184
+99 186
+99 191
+99 197
+100 114
+100 119
+100 127
+100 128
+100 132
+100 138
+100 143
+100 145
+100 149
+100 158
+100 164
+100 168
+100 171
+100 177
+100 178
+100 190
+101 118
+101 119
+101 120
+101 124
+101 134
+101 136
+101 141
+101 143
+101 148
+101 165
+101 167
+101 172
+101 188
+102 113
+102 136
+102 138
+102 140
+102 149
+102 152
+102 162
+102 170
+102 173
+102 179
+103 106
+103 127
+103 129
+103 131
+103 134
+103 139
+103 141
+103 147
+103 165
+103 178
+103 184
+103 187
+104 114
+104 127
+104 146
+104 148
+104 162
+104 166
+104 170
+104 173
+104 185
+104 196
+105 115
+105 116
+105 121
+105 123
+105 125
+105 128
+105 134
+105 137
+105 143
+105 144
+105 157
+105 158
+105 159
+105 164
+105 165
+105 170
+105 188
+105 190
+105 191
+105 195
+106 109
+106 116
+106 119
+106 124
+106 126
+106 137
+106 140
+106 142
+106 145
+106 147
+106 148
+106 150
+106 153
+106 156
+106 163
+106 169
+106 171
+106 172
+106 191
+106 194
+107 118
+107 123
+107 130
+107 134
+107 153
+107 168
+107 180
+107 186
+107 187
+107 197
+108 117
+108 131
+108 150
+108 151
+108 159
+108 173
+108 179
+109 120
+109 124
+109 125
+109 129
+109 139
+109 150
+109 151
+109 154
+109 157
+109 159
+109 163
+109 174
+109 186
+109 190
+110 121
+110 122
+110 131
+110 139
+110 142
+110 152
+110 154
+110 167
+110 177
+110 180
+110 182
+111 120
+111 122
+111 130
+111 137
+111 139
+111 148
+111 164
+111 182
+111 183
+111 184
+111 190
+112 117
+112 123
+112 126
+112 127
+112 130
+112 136
+112 141
+112 142
+112 159
+112 161
+112 168
+112 174
+112 176
+112 190
+113 115
+113 116
+113 120
+113 123
+113 129
+113 133
+113 135
+113 142
+113 144
+113 150
+113 156
+113 168
+113 172
+113 177
+113 184
+113 185
+113 191
+113 198
+114 123
+114 129
+114 137
+114 140
+114 145
+114 153
+114 155
+114 157
+114 167
+114 169
+114 197
+115 119
+115 121
+115 125
+115 129
+115 131
+115 133
+115 142
+115 146
+115 152
+115 158
+115 188
+115 190
+115 195
+115 198
+116 117
+116 124
+116 129
+116 130
+116 135
+116 143
+116 149
+116 166
+116 174
+116 186
+116 187
+116 189
+116 191
+116 192
+116 193
+117 130
+117 133
+117 145
+117 153
+117 154
+117 155
+117 156
+117 159
+117 160
+117 166
+117 169
+117 172
+117 174
+117 181
+117 182
+117 199
+118 171
+118 173
+118 174
+118 178
+118 179
+118 190
+118 197
+119 126
+119 146
+119 156
+119 157
+119 167
+119 168
+119 188
+119 189
+119 195
+120 135
+120 138
+120 142
+120 150
+120 153
+120 163
+120 164
+120 169
+120 174
+120 176
+120 183
+120 197
+121 128
+121 150
+121 154
+121 157
+121 178
+121 182
+121 186
+121 187
+121 193
+121 197
+122 126
+122 128
+122 138
+122 141
+122 149
+122 153
+122 156
+122 165
+122 166
+122 170
+122 171
+122 172
+122 191
+122 194
+123 128
+123 133
+123 138
+123 148
+123 149
+123 154
+123 172
+123 173
+123 177
+124 128
+124 131
+124 134
+124 148
+124 150
+124 155
+124 165
+124 166
+124 185
+124 188
+124 192
+125 126
+125 128
+125 129
+125 133
+125 147
+125 148
+125 150
+125 159
+125 168
+125 174
+125 184
+125 198
+126 146
+126 150
+126 155
+126 170
+126 174
+126 176
+126 178
+126 191
+127 128
+127 129
+127 134
+127 150
+127 159
+127 166
+127 173
+127 175
+127 178
+127 180
+127 182
+127 191
+128 135
+128 146
+128 150
+128 153
+128 168
+128 179
+128 187
+128 197
+129 131
+129 132
+129 142
+129 164
+129 165
+129 168
+129 178
+129 187
+129 190
+129 194
+129 195
+129 197
+130 131
+130 137
+130 147
+130 154
+130 161
+130 164
+130 171
+130 179
+130 183
+130 185
+130 195
+131 141
+131 144
+131 145
+131 160
+131 166
+131 174
+131 178
+131 182
+131 184
+131 188
+131 197
+131 199
+132 141
+132 143
+132 154
+132 160
+132 162
+132 165
+132 170
+132 173
+132 185
+132 191
+133 140
+133 143
+133 153
+133 159
+133 168
+133 173
+133 180
+133 187
+134 151
+134 160
+134 164
+134 181
+134 188
+134 191
+134 199
+135 136
+135 150
+135 154
+135 166
+135 168
+135 169
+135 170
+135 185
+135 193
+136 139
+136 146
+136 152
+136 161
+136 163
+136 165
+136 167
+136 177
+136 178
+136 190
+137 140
+137 143
+137 145
+137 160
+137 163
+137 166
+137 171
+137 179
+137 183
+137 192
+138 143
+138 164
+138 170
+138 172
+138 187
+138 195
+139 143
+139 151
+139 153
+139 158
+139 159
+139 167
+139 168
+139 169
+139 172
+139 176
+139 180
+139 183
+139 189
+139 192
+139 194
+139 196
+139 198
+140 144
+140 152
+140 160
+140 172
+140 179
+140 180
+140 184
+140 185
+141 148
+141 149
+141 152
+141 160
+141 168
+141 172
+141 173
+141 174
+141 180
+141 186
+141 190
+141 199
+142 152
+142 165
+142 167
+142 176
+142 178
+142 181
+142 185
+142 196
+142 197
+142 199
+143 145
+143 170
+143 177
+143 181
+143 187
+143 192
+144 163
+144 169
+144 180
+144 185
+144 187
+144 195
+145 146
+145 148
+145 149
+145 162
+145 166
+145 174
+145 175
+145 191
+145 193
+146 168
+146 178
+146 184
+146 196
+147 150
+147 159
+147 160
+147 165
+147 167
+147 172
+147 179
+147 190
+147 199
+148 153
+148 169
+148 178
+148 189
+148 190
+148 194
+148 196
+148 198
+149 159
+149 167
+149 170
+149 175
+149 176
+149 184
+149 190
+149 196
+150 164
+150 168
+150 182
+150 188
+150 197
+150 199
+151 159
+151 172
+151 174
+151 188
+151 189
+151 190
+152 158
+152 164
+152 166
+152 168
+152 178
+152 196
+153 163
+153 166
+153 167
+153 171
+153 183
+153 190
+154 157
+154 177
+154 181
+154 189
+154 198
+155 198
+155 199
+156 164
+156 171
+156 173
+156 177
+156 195
+156 199
+157 167
+157 171
+157 174
+157 176
+157 177
+157 181
+157 193
+158 159
+158 169
+158 172
+158 177
+158 189
+158 190
+158 197
+159 174
+159 175
+159 178
+159 185
+159 192
+160 161
+160 165
+160 168
+160 179
+160 191
+161 162
+161 167
+161 168
+161 170
+161 187
+161 189
+161 190
+162 163
+162 171
+162 175
+162 176
+162 177
+162 185
+162 192
+162 193
+162 199
+163 167
+163 170
+163 172
+163 175
+163 179
+163 182
+163 192
+163 197
+163 199
+164 173
+164 174
+164 178
+165 179
+165 192
+165 194
+165 196
+166 176
+166 182
+166 187
+166 189
+167 171
+167 174
+167 185
+167 186
+167 189
+167 193
+167 196
+168 169
+168 173
+168 189
+168 190
+168 193
+169 170
+169 176
+169 178
+169 194
+169 195
+169 197
+170 175
+170 183
+171 179
+171 189
+172 175
+172 181
+172 183
+173 176
+173 182
+173 186
+173 189
+173 192
+174 187
+174 197
+175 177
+175 179
+175 180
+175 192
+175 198
+176 182
+176 193
+176 196
+176 198
+177 183
+177 186
+177 191
+178 183
+179 189
+179 193
+179 195
+180 184
+180 189
+180 190
+181 182
+181 189
+181 195
+182 185
+183 185
+183 190
+183 194
+184 186
+185 186
+185 188
+185 191
+185 198
+186 193
+186 196
+188 199
+189 191
+189 194
+190 196
+192 193
+192 195
+192 199
+193 194
+193 199
+194 197
+194 198
@@ -0,0 +1,11962 @@
+0 2
+0 7
+0 15
+0 18
+0 21
+0 30
+0 32
+0 42
+0 43
+0 46
+0 48
+0 72
+0 80
+0 94
+0 95
+0 97
+0 100
+0 119
+0 123
+0 142
+0 150
+0 155
+0 167
+0 202
+0 208
+0 225
+0 228
+0 231
+0 234
+0 237
+0 238
+0 243
+0 255
+0 260
+0 262
+0 265
+0 270
+0 275
+0 282
+0 286
+1 0
+1 5
+1 7
+1 8
+1 15
+1 26
+1 30
+1 34
+1 35
+1 37
+1 44
+1 51
+1 55
+1 60
+1 68
+1 101
+1 107
+1 109
+1 117
+1 126
+1 130
+1 138
+1 147
+1 148
+1 159
+1 161
+1 170
+1 172
+1 192
+1 197
+1 203
+1 205
+1 209
+1 214
+1 238
+1 240
+1 249
+1 262
+1 288
+1 289
+2 0
+2 4
+2 7
+2 10
+2 21
+2 37
+2 38
+2 46
+2 51
+2 59
+2 67
+2 74
+2 90
+2 95
+2 96
+2 97
+2 106
+2 107
+2 108
+2 109
+2 124
+2 132
+2 138
+2 151
+2 155
+2 168
+2 188
+2 190
+2 196
+2 197
+2 201
+2 202
+2 214
+2 215
+2 226
+2 229
+2 260
+2 286
+2 295
+2 298
+3 8
+3 19
+3 24
+3 35
+3 37
+3 40
+3 53
+3 55
+3 64
+3 65
+3 69
+3 78
+3 81
+3 89
+3 93
+3 97
+3 100
+3 104
+3 108
+3 116
+3 122
+3 127
+3 130
+3 131
+3 143
+3 150
+3 159
+3 197
+3 198
+3 200
+3 215
+3 232
+3 245
+3 247
+3 251
+3 262
+3 266
+3 283
+3 286
+3 294
+4 9
+4 10
+4 17
+4 22
+4 23
+4 30
+4 34
+4 35
+4 37
+4 38
+4 43
+4 47
+4 66
+4 67
+4 69
+4 70
+4 71
+4 90
+4 127
+4 137
+4 144
+4 159
+4 163
+4 169
+4 174
+4 180
+4 183
+4 185
+4 188
+4 210
+4 228
+4 230
+4 231
+4 243
+4 246
+4 267
+4 271
+4 279
+4 292
+4 299
+5 6
+5 7
+5 11
+5 15
+5 36
+5 39
+5 41
+5 42
+5 44
+5 46
+5 57
+5 59
+5 73
+5 103
+5 117
+5 130
+5 131
+5 154
+5 158
+5 169
+5 188
+5 194
+5 195
+5 198
+5 213
+5 225
+5 234
+5 236
+5 242
+5 246
+5 248
+5 254
+5 255
+5 263
+5 265
+5 277
+5 293
+5 297
+5 298
+6 16
+6 20
+6 21
+6 32
+6 38
+6 57
+6 68
+6 69
+6 86
+6 101
+6 102
+6 107
+6 109
+6 112
+6 123
+6 128
+6 140
+6 141
+6 142
+6 161
+6 162
+6 164
+6 167
+6 175
+6 179
+6 195
+6 196
+6 207
+6 211
+6 220
+6 226
+6 230
+6 231
+6 241
+6 252
+6 254
+6 255
+6 265
+6 266
+6 298
+7 5
+7 9
+7 12
+7 18
+7 24
+7 39
+7 44
+7 55
+7 59
+7 69
+7 72
+7 81
+7 91
+7 97
+7 101
+7 102
+7 114
+7 115
+7 121
+7 131
+7 136
+7 139
+7 143
+7 158
+7 177
+7 181
+7 188
+7 201
+7 207
+7 228
+7 232
+7 241
+7 243
+7 256
+7 266
+7 273
+7 274
+7 276
+7 288
+7 292
+8 3
+8 14
+8 17
+8 19
+8 32
+8 42
+8 44
+8 50
+8 63
+8 66
+8 88
+8 100
+8 104
+8 109
+8 111
+8 124
+8 134
+8 140
+8 158
+8 164
+8 167
+8 175
+8 178
+8 192
+8 198
+8 199
+8 210
+8 215
+8 219
+8 225
+8 230
+8 232
+8 237
+8 249
+8 257
+8 258
+8 274
+8 281
+8 291
+9 2
+9 14
+9 44
+9 58
+9 71
+9 72
+9 76
+9 84
+9 102
+9 106
+9 113
+9 131
+9 139
+9 148
+9 155
+9 159
+9 171
+9 193
+9 195
+9 210
+9 224
+9 225
+9 240
+9 252
+9 254
+9 257
+9 263
+9 264
+9 265
+9 267
+9 268
+9 269
+9 272
+9 274
+9 275
+9 278
+9 286
+9 287
+9 293
+9 296
+10 6
+10 11
+10 15
+10 18
+10 22
+10 33
+10 47
+10 55
+10 62
+10 65
+10 66
+10 79
+10 85
+10 98
+10 99
+10 116
+10 125
+10 126
+10 133
+10 137
+10 145
+10 162
+10 164
+10 173
+10 181
+10 205
+10 206
+10 211
+10 214
+10 222
+10 234
+10 242
+10 243
+10 251
+10 252
+10 264
+10 268
+10 275
+10 278
+10 288
+11 9
+11 45
+11 49
+11 53
+11 62
+11 64
+11 67
+11 68
+11 69
+11 81
+11 92
+11 99
+11 101
+11 102
+11 104
+11 110
+11 111
+11 119
+11 122
+11 128
+11 132
+11 161
+11 177
+11 192
+11 198
+11 206
+11 211
+11 215
+11 222
+11 223
+11 255
+11 261
+11 271
+11 273
+11 275
+11 277
+11 278
+11 291
+11 298
+12 6
+12 19
+12 20
+12 31
+12 36
+12 39
+12 48
+12 49
+12 54
+12 58
+12 59
+12 68
+12 75
+12 80
+12 88
+12 94
+12 96
+12 97
+12 104
+12 107
+12 144
+12 167
+12 175
+12 181
+12 183
+12 184
+12 191
+12 200
+12 218
+12 220
+12 236
+12 239
+12 246
+12 257
+12 258
+12 263
+12 282
+12 291
+12 296
+13 5
+13 7
+13 25
+13 36
+13 43
+13 48
+13 51
+13 59
+13 68
+13 81
+13 84
+13 92
+13 94
+13 97
+13 99
+13 102
+13 105
+13 118
+13 132
+13 139
+13 143
+13 153
+13 154
+13 165
+13 168
+13 172
+13 174
+13 182
+13 184
+13 189
+13 207
+13 208
+13 221
+13 232
+13 240
+13 258
+13 262
+13 275
+13 291
+13 299
+14 5
+14 11
+14 23
+14 25
+14 39
+14 50
+14 51
+14 55
+14 58
+14 61
+14 81
+14 93
+14 100
+14 109
+14 110
+14 121
+14 128
+14 131
+14 132
+14 141
+14 174
+14 192
+14 197
+14 199
+14 202
+14 205
+14 207
+14 212
+14 227
+14 254
+14 258
+14 260
+14 263
+14 266
+14 272
+14 276
+14 281
+14 290
+14 291
+14 294
+15 7
+15 13
+15 21
+15 23
+15 25
+15 27
+15 29
+15 37
+15 80
+15 86
+15 114
+15 124
+15 125
+15 128
+15 138
+15 145
+15 146
+15 151
+15 159
+15 161
+15 163
+15 187
+15 197
+15 199
+15 203
+15 204
+15 209
+15 215
+15 219
+15 241
+15 244
+15 247
+15 253
+15 267
+15 269
+15 271
+15 277
+15 287
+15 297
+15 299
+16 20
+16 25
+16 26
+16 31
+16 50
+16 58
+16 60
+16 63
+16 65
+16 70
+16 71
+16 73
+16 79
+16 97
+16 100
+16 104
+16 122
+16 125
+16 127
+16 134
+16 139
+16 140
+16 142
+16 148
+16 158
+16 182
+16 183
+16 186
+16 213
+16 214
+16 226
+16 233
+16 239
+16 246
+16 257
+16 259
+16 270
+16 271
+16 289
+16 298
+17 4
+17 13
+17 19
+17 37
+17 38
+17 44
+17 52
+17 61
+17 68
+17 77
+17 78
+17 82
+17 94
+17 107
+17 109
+17 113
+17 120
+17 132
+17 138
+17 142
+17 148
+17 166
+17 173
+17 175
+17 181
+17 188
+17 189
+17 191
+17 199
+17 217
+17 218
+17 227
+17 229
+17 245
+17 247
+17 253
+17 277
+17 280
+17 281
+17 297
+18 4
+18 38
+18 40
+18 41
+18 42
+18 43
+18 49
+18 60
+18 73
+18 109
+18 112
+18 113
+18 127
+18 142
+18 144
+18 153
+18 155
+18 156
+18 158
+18 162
+18 165
+18 167
+18 183
+18 185
+18 187
+18 204
+18 221
+18 224
+18 225
+18 234
+18 236
+18 237
+18 248
+18 253
+18 264
+18 271
+18 278
+18 288
+18 290
+18 291
+19 11
+19 12
+19 13
+19 29
+19 32
+19 41
+19 43
+19 45
+19 49
+19 53
+19 73
+19 79
+19 81
+19 90
+19 99
+19 112
+19 113
+19 125
+19 140
+19 144
+19 151
+19 156
+19 160
+19 171
+19 186
+19 187
+19 188
+19 198
+19 199
+19 202
+19 216
+19 232
+19 264
+19 276
+19 278
+19 279
+19 288
+19 290
+19 297
+19 299
+20 1
+20 5
+20 12
+20 23
+20 30
+20 37
+20 45
+20 56
+20 69
+20 74
+20 83
+20 85
+20 104
+20 125
+20 140
+20 149
+20 164
+20 170
+20 172
+20 173
+20 178
+20 179
+20 185
+20 192
+20 193
+20 199
+20 201
+20 210
+20 215
+20 217
+20 235
+20 237
+20 249
+20 250
+20 252
+20 267
+20 268
+20 270
+20 275
+20 277
+21 8
+21 18
+21 25
+21 31
+21 47
+21 55
+21 58
+21 68
+21 79
+21 88
+21 91
+21 94
+21 101
+21 111
+21 113
+21 114
+21 120
+21 133
+21 143
+21 155
+21 157
+21 159
+21 160
+21 175
+21 183
+21 197
+21 204
+21 206
+21 226
+21 234
+21 241
+21 245
+21 246
+21 247
+21 248
+21 260
+21 270
+21 280
+21 281
+21 299
+22 0
+22 5
+22 9
+22 27
+22 29
+22 42
+22 49
+22 65
+22 67
+22 74
+22 76
+22 77
+22 80
+22 91
+22 96
+22 98
+22 104
+22 121
+22 126
+22 132
+22 136
+22 138
+22 140
+22 155
+22 164
+22 180
+22 190
+22 212
+22 213
+22 215
+22 230
+22 239
+22 241
+22 245
+22 259
+22 264
+22 270
+22 273
+22 278
+22 292
+23 5
+23 6
+23 19
+23 34
+23 38
+23 46
+23 54
+23 58
+23 62
+23 71
+23 77
+23 80
+23 105
+23 106
+23 121
+23 148
+23 150
+23 152
+23 156
+23 159
+23 161
+23 172
+23 184
+23 192
+23 193
+23 201
+23 207
+23 211
+23 225
+23 227
+23 234
+23 236
+23 239
+23 243
+23 253
+23 269
+23 276
+23 278
+23 284
+23 288
+24 16
+24 18
+24 37
+24 44
+24 46
+24 47
+24 48
+24 51
+24 52
+24 56
+24 63
+24 67
+24 71
+24 72
+24 80
+24 91
+24 92
+24 96
+24 98
+24 102
+24 116
+24 131
+24 140
+24 158
+24 168
+24 169
+24 174
+24 192
+24 195
+24 200
+24 205
+24 208
+24 218
+24 222
+24 228
+24 237
+24 240
+24 261
+24 284
+24 288
+25 7
+25 9
+25 52
+25 54
+25 72
+25 75
+25 81
+25 96
+25 100
+25 101
+25 104
+25 105
+25 119
+25 125
+25 129
+25 133
+25 150
+25 152
+25 157
+25 162
+25 169
+25 170
+25 175
+25 180
+25 193
+25 197
+25 205
+25 211
+25 225
+25 247
+25 256
+25 260
+25 262
+25 264
+25 271
+25 275
+25 280
+25 285
+25 290
+25 293
+26 1
+26 13
+26 16
+26 32
+26 39
+26 42
+26 46
+26 62
+26 63
+26 69
+26 74
+26 84
+26 86
+26 95
+26 101
+26 122
+26 123
+26 125
+26 135
+26 136
+26 147
+26 168
+26 170
+26 171
+26 184
+26 185
+26 186
+26 213
+26 231
+26 232
+26 237
+26 244
+26 278
+26 279
+26 280
+26 286
+26 287
+26 291
+26 293
+26 295
+27 8
+27 16
+27 19
+27 52
+27 58
+27 60
+27 67
+27 70
+27 73
+27 74
+27 81
+27 88
+27 92
+27 102
+27 124
+27 134
+27 144
+27 157
+27 170
+27 172
+27 176
+27 195
+27 197
+27 206
+27 207
+27 208
+27 209
+27 210
+27 222
+27 237
+27 239
+27 240
+27 248
+27 254
+27 266
+27 270
+27 289
+27 290
+27 291
+28 0
+28 12
+28 26
+28 27
+28 35
+28 36
+28 50
+28 53
+28 62
+28 63
+28 66
+28 84
+28 113
+28 120
+28 122
+28 124
+28 125
+28 151
+28 153
+28 156
+28 164
+28 169
+28 188
+28 192
+28 202
+28 203
+28 215
+28 221
+28 228
+28 232
+28 243
+28 257
+28 266
+28 268
+28 269
+28 275
+28 279
+28 288
+28 290
+28 294
+29 8
+29 12
+29 15
+29 23
+29 25
+29 30
+29 32
+29 54
+29 69
+29 72
+29 73
+29 88
+29 98
+29 100
+29 103
+29 105
+29 118
+29 120
+29 140
+29 151
+29 156
+29 157
+29 160
+29 161
+29 166
+29 171
+29 181
+29 182
+29 203
+29 215
+29 225
+29 227
+29 230
+29 232
+29 241
+29 255
+29 271
+29 272
+29 286
+29 299
+30 3
+30 23
+30 37
+30 39
+30 40
+30 44
+30 46
+30 59
+30 61
+30 67
+30 84
+30 86
+30 92
+30 97
+30 100
+30 114
+30 115
+30 117
+30 120
+30 125
+30 128
+30 137
+30 139
+30 141
+30 145
+30 151
+30 154
+30 157
+30 190
+30 212
+30 216
+30 225
+30 236
+30 256
+30 264
+30 268
+30 270
+30 271
+30 275
+30 291
+31 1
+31 14
+31 16
+31 17
+31 18
+31 30
+31 32
+31 57
+31 77
+31 84
+31 89
+31 91
+31 92
+31 95
+31 103
+31 113
+31 120
+31 131
+31 132
+31 133
+31 142
+31 149
+31 164
+31 184
+31 196
+31 223
+31 225
+31 236
+31 247
+31 250
+31 255
+31 258
+31 264
+31 266
+31 272
+31 278
+31 280
+31 284
+31 297
+31 299
+32 9
+32 15
+32 21
+32 26
+32 27
+32 31
+32 37
+32 45
+32 58
+32 74
+32 77
+32 81
+32 87
+32 91
+32 92
+32 121
+32 127
+32 130
+32 134
+32 135
+32 159
+32 160
+32 161
+32 166
+32 193
+32 210
+32 217
+32 222
+32 226
+32 229
+32 232
+32 254
+32 255
+32 257
+32 261
+32 269
+32 278
+32 291
+32 293
+32 296
+33 1
+33 17
+33 20
+33 21
+33 29
+33 39
+33 44
+33 46
+33 60
+33 65
+33 68
+33 72
+33 74
+33 82
+33 110
+33 111
+33 116
+33 117
+33 123
+33 129
+33 151
+33 152
+33 158
+33 172
+33 186
+33 201
+33 206
+33 209
+33 214
+33 217
+33 233
+33 236
+33 239
+33 241
+33 250
+33 267
+33 269
+33 282
+33 284
+33 299
+34 9
+34 24
+34 25
+34 37
+34 83
+34 90
+34 92
+34 93
+34 94
+34 104
+34 109
+34 110
+34 111
+34 126
+34 134
+34 137
+34 140
+34 141
+34 157
+34 175
+34 177
+34 185
+34 193
+34 195
+34 196
+34 201
+34 204
+34 214
+34 228
+34 236
+34 239
+34 241
+34 245
+34 249
+34 250
+34 262
+34 265
+34 276
+34 281
+34 290
+35 10
+35 16
+35 20
+35 28
+35 29
+35 42
+35 52
+35 61
+35 65
+35 69
+35 70
+35 77
+35 78
+35 96
+35 106
+35 122
+35 123
+35 131
+35 133
+35 154
+35 159
+35 160
+35 164
+35 166
+35 184
+35 193
+35 195
+35 196
+35 201
+35 210
+35 217
+35 230
+35 231
+35 245
+35 250
+35 263
+35 264
+35 265
+35 278
+35 280
+36 5
+36 12
+36 20
+36 30
+36 34
+36 46
+36 52
+36 61
+36 62
+36 69
+36 71
+36 75
+36 104
+36 110
+36 115
+36 120
+36 132
+36 143
+36 145
+36 149
+36 152
+36 168
+36 176
+36 180
+36 182
+36 189
+36 191
+36 196
+36 197
+36 200
+36 207
+36 218
+36 230
+36 247
+36 250
+36 252
+36 264
+36 273
+36 285
+36 289
+37 11
+37 12
+37 18
+37 27
+37 32
+37 47
+37 61
+37 77
+37 81
+37 85
+37 103
+37 113
+37 122
+37 129
+37 131
+37 139
+37 143
+37 153
+37 157
+37 165
+37 166
+37 175
+37 177
+37 179
+37 186
+37 193
+37 200
+37 206
+37 207
+37 216
+37 240
+37 243
+37 244
+37 253
+37 254
+37 266
+37 283
+37 298
+37 299
+38 10
+38 15
+38 19
+38 24
+38 32
+38 34
+38 69
+38 76
+38 95
+38 98
+38 110
+38 112
+38 116
+38 120
+38 132
+38 134
+38 138
+38 139
+38 141
+38 152
+38 158
+38 174
+38 184
+38 185
+38 191
+38 195
+38 196
+38 197
+38 210
+38 212
+38 230
+38 237
+38 240
+38 242
+38 253
+38 259
+38 277
+38 289
+38 294
+39 0
+39 1
+39 9
+39 32
+39 35
+39 40
+39 53
+39 64
+39 80
+39 81
+39 82
+39 91
+39 98
+39 106
+39 121
+39 122
+39 127
+39 135
+39 146
+39 150
+39 160
+39 166
+39 170
+39 177
+39 185
+39 187
+39 189
+39 201
+39 202
+39 212
+39 251
+39 252
+39 255
+39 263
+39 266
+39 273
+39 278
+39 280
+39 287
+39 288
+40 7
+40 20
+40 27
+40 52
+40 57
+40 64
+40 66
+40 68
+40 82
+40 83
+40 93
+40 94
+40 102
+40 104
+40 118
+40 128
+40 129
+40 137
+40 138
+40 149
+40 158
+40 167
+40 170
+40 176
+40 188
+40 192
+40 197
+40 200
+40 203
+40 211
+40 214
+40 215
+40 231
+40 241
+40 246
+40 259
+40 262
+40 288
+40 290
+40 299
+41 13
+41 21
+41 24
+41 34
+41 54
+41 60
+41 61
+41 71
+41 72
+41 75
+41 77
+41 80
+41 87
+41 89
+41 99
+41 110
+41 114
+41 128
+41 144
+41 145
+41 146
+41 158
+41 165
+41 168
+41 182
+41 191
+41 199
+41 200
+41 207
+41 208
+41 221
+41 224
+41 226
+41 247
+41 249
+41 275
+41 277
+41 279
+41 284
+41 295
+42 2
+42 3
+42 9
+42 16
+42 26
+42 29
+42 32
+42 40
+42 41
+42 71
+42 73
+42 77
+42 93
+42 96
+42 102
+42 103
+42 110
+42 116
+42 129
+42 132
+42 138
+42 140
+42 141
+42 158
+42 164
+42 172
+42 179
+42 187
+42 202
+42 204
+42 209
+42 212
+42 246
+42 247
+42 281
+42 282
+42 285
+42 286
+42 289
+42 291
+43 4
+43 5
+43 12
+43 13
+43 24
+43 32
+43 38
+43 51
+43 60
+43 72
+43 86
+43 90
+43 107
+43 116
+43 125
+43 127
+43 128
+43 135
+43 138
+43 148
+43 157
+43 158
+43 165
+43 183
+43 186
+43 198
+43 204
+43 205
+43 209
+43 226
+43 238
+43 246
+43 253
+43 263
+43 269
+43 272
+43 275
+43 284
+43 292
+43 295
+44 4
+44 10
+44 11
+44 24
+44 26
+44 34
+44 48
+44 54
+44 66
+44 73
+44 79
+44 89
+44 90
+44 92
+44 93
+44 104
+44 105
+44 108
+44 109
+44 135
+44 141
+44 142
+44 155
+44 159
+44 164
+44 171
+44 177
+44 179
+44 181
+44 186
+44 189
+44 190
+44 204
+44 206
+44 220
+44 230
+44 257
+44 259
+44 275
+44 279
+45 5
+45 21
+45 28
+45 34
+45 35
+45 55
+45 58
+45 62
+45 75
+45 91
+45 93
+45 108
+45 112
+45 117
+45 139
+45 164
+45 176
+45 182
+45 192
+45 193
+45 196
+45 199
+45 209
+45 214
+45 217
+45 220
+45 223
+45 225
+45 232
+45 239
+45 242
+45 255
+45 256
+45 258
+45 263
+45 268
+45 277
+45 290
+45 293
+45 296
+46 7
+46 16
+46 19
+46 23
+46 26
+46 27
+46 33
+46 53
+46 56
+46 58
+46 64
+46 72
+46 77
+46 94
+46 95
+46 96
+46 106
+46 119
+46 128
+46 131
+46 133
+46 145
+46 160
+46 166
+46 168
+46 175
+46 178
+46 205
+46 218
+46 228
+46 231
+46 232
+46 239
+46 240
+46 251
+46 261
+46 265
+46 270
+46 274
+46 282
+47 7
+47 15
+47 18
+47 28
+47 33
+47 36
+47 37
+47 45
+47 51
+47 54
+47 60
+47 77
+47 91
+47 93
+47 100
+47 105
+47 112
+47 122
+47 123
+47 142
+47 143
+47 147
+47 161
+47 170
+47 173
+47 177
+47 187
+47 193
+47 198
+47 213
+47 220
+47 225
+47 238
+47 250
+47 251
+47 254
+47 272
+47 281
+47 284
+47 286
+48 4
+48 21
+48 35
+48 36
+48 59
+48 60
+48 63
+48 65
+48 66
+48 68
+48 74
+48 87
+48 92
+48 100
+48 102
+48 105
+48 106
+48 107
+48 120
+48 132
+48 136
+48 142
+48 157
+48 158
+48 176
+48 177
+48 183
+48 184
+48 191
+48 209
+48 213
+48 217
+48 233
+48 238
+48 252
+48 259
+48 263
+48 296
+48 297
+49 6
+49 7
+49 8
+49 15
+49 32
+49 40
+49 45
+49 50
+49 52
+49 53
+49 63
+49 67
+49 101
+49 107
+49 112
+49 115
+49 125
+49 128
+49 137
+49 142
+49 144
+49 145
+49 146
+49 149
+49 170
+49 174
+49 186
+49 187
+49 191
+49 198
+49 210
+49 211
+49 214
+49 215
+49 225
+49 229
+49 232
+49 244
+49 279
+49 299
+50 1
+50 8
+50 10
+50 11
+50 29
+50 31
+50 34
+50 37
+50 42
+50 49
+50 56
+50 61
+50 73
+50 79
+50 85
+50 87
+50 107
+50 111
+50 113
+50 117
+50 129
+50 161
+50 176
+50 185
+50 189
+50 202
+50 205
+50 221
+50 236
+50 237
+50 239
+50 240
+50 242
+50 245
+50 254
+50 258
+50 263
+50 265
+50 277
+50 299
+51 12
+51 27
+51 34
+51 45
+51 48
+51 53
+51 55
+51 56
+51 63
+51 66
+51 70
+51 73
+51 79
+51 87
+51 111
+51 121
+51 125
+51 126
+51 150
+51 154
+51 157
+51 179
+51 180
+51 187
+51 189
+51 211
+51 231
+51 235
+51 238
+51 257
+51 259
+51 260
+51 262
+51 268
+51 273
+51 274
+51 285
+51 287
+51 288
+51 290
+52 5
+52 14
+52 23
+52 40
+52 43
+52 49
+52 56
+52 57
+52 60
+52 70
+52 78
+52 80
+52 88
+52 104
+52 109
+52 112
+52 117
+52 132
+52 133
+52 136
+52 150
+52 153
+52 168
+52 188
+52 192
+52 199
+52 201
+52 207
+52 208
+52 211
+52 213
+52 214
+52 250
+52 252
+52 256
+52 271
+52 274
+52 278
+52 286
+52 290
+53 3
+53 4
+53 16
+53 25
+53 31
+53 50
+53 59
+53 83
+53 107
+53 114
+53 117
+53 126
+53 154
+53 159
+53 160
+53 165
+53 170
+53 182
+53 183
+53 184
+53 187
+53 188
+53 190
+53 191
+53 195
+53 196
+53 204
+53 208
+53 219
+53 220
+53 230
+53 244
+53 247
+53 249
+53 266
+53 269
+53 270
+53 271
+53 280
+54 11
+54 16
+54 24
+54 27
+54 28
+54 29
+54 42
+54 43
+54 45
+54 47
+54 49
+54 60
+54 70
+54 76
+54 79
+54 94
+54 108
+54 109
+54 115
+54 128
+54 129
+54 138
+54 144
+54 146
+54 161
+54 162
+54 168
+54 174
+54 176
+54 191
+54 202
+54 203
+54 205
+54 217
+54 251
+54 254
+54 264
+54 282
+54 292
+54 296
+55 2
+55 16
+55 36
+55 38
+55 42
+55 49
+55 57
+55 58
+55 59
+55 60
+55 63
+55 71
+55 79
+55 88
+55 102
+55 108
+55 140
+55 158
+55 163
+55 165
+55 171
+55 182
+55 193
+55 203
+55 208
+55 212
+55 214
+55 221
+55 223
+55 225
+55 227
+55 229
+55 241
+55 245
+55 252
+55 253
+55 274
+55 279
+55 280
+55 286
+56 7
+56 23
+56 32
+56 33
+56 46
+56 53
+56 75
+56 83
+56 85
+56 92
+56 103
+56 109
+56 119
+56 124
+56 130
+56 131
+56 133
+56 165
+56 167
+56 177
+56 179
+56 183
+56 193
+56 198
+56 202
+56 210
+56 211
+56 221
+56 223
+56 231
+56 236
+56 246
+56 250
+56 261
+56 266
+56 281
+56 286
+56 294
+56 298
+56 299
+57 17
+57 50
+57 52
+57 55
+57 60
+57 61
+57 76
+57 77
+57 79
+57 81
+57 83
+57 86
+57 95
+57 97
+57 102
+57 111
+57 118
+57 126
+57 135
+57 148
+57 154
+57 156
+57 166
+57 170
+57 176
+57 180
+57 182
+57 186
+57 188
+57 198
+57 228
+57 233
+57 249
+57 250
+57 256
+57 271
+57 273
+57 282
+57 290
+57 298
+58 10
+58 14
+58 27
+58 38
+58 45
+58 56
+58 67
+58 77
+58 81
+58 83
+58 88
+58 110
+58 119
+58 127
+58 129
+58 133
+58 134
+58 138
+58 139
+58 142
+58 145
+58 146
+58 150
+58 156
+58 176
+58 183
+58 185
+58 189
+58 199
+58 218
+58 231
+58 246
+58 248
+58 258
+58 260
+58 273
+58 275
+58 277
+58 278
+58 287
+59 1
+59 15
+59 31
+59 34
+59 36
+59 38
+59 39
+59 40
+59 44
+59 52
+59 56
+59 61
+59 71
+59 72
+59 73
+59 94
+59 98
+59 99
+59 101
+59 118
+59 154
+59 158
+59 178
+59 181
+59 188
+59 211
+59 213
+59 223
+59 248
+59 249
+59 255
+59 266
+59 269
+59 277
+59 281
+59 285
+59 287
+59 289
+59 292
+59 294
+60 0
+60 10
+60 12
+60 16
+60 34
+60 42
+60 44
+60 45
+60 55
+60 57
+60 69
+60 76
+60 77
+60 79
+60 80
+60 86
+60 95
+60 110
+60 112
+60 118
+60 131
+60 139
+60 152
+60 153
+60 154
+60 161
+60 171
+60 177
+60 179
+60 190
+60 202
+60 208
+60 212
+60 218
+60 250
+60 265
+60 266
+60 277
+60 292
+60 296
+61 7
+61 11
+61 17
+61 24
+61 33
+61 76
+61 89
+61 94
+61 102
+61 104
+61 108
+61 113
+61 118
+61 120
+61 121
+61 123
+61 126
+61 129
+61 130
+61 133
+61 134
+61 154
+61 159
+61 168
+61 170
+61 171
+61 180
+61 189
+61 200
+61 212
+61 231
+61 232
+61 245
+61 260
+61 266
+61 267
+61 269
+61 293
+61 294
+61 299
+62 7
+62 16
+62 21
+62 22
+62 26
+62 33
+62 34
+62 35
+62 37
+62 40
+62 47
+62 69
+62 70
+62 72
+62 73
+62 81
+62 105
+62 111
+62 115
+62 119
+62 125
+62 146
+62 163
+62 173
+62 175
+62 182
+62 189
+62 194
+62 198
+62 212
+62 214
+62 217
+62 226
+62 243
+62 252
+62 255
+62 257
+62 276
+62 285
+62 287
+63 8
+63 25
+63 36
+63 39
+63 41
+63 47
+63 53
+63 61
+63 62
+63 69
+63 74
+63 82
+63 93
+63 94
+63 95
+63 98
+63 114
+63 121
+63 134
+63 139
+63 140
+63 150
+63 157
+63 158
+63 164
+63 169
+63 177
+63 188
+63 190
+63 226
+63 232
+63 247
+63 257
+63 267
+63 269
+63 276
+63 290
+63 291
+63 298
+64 7
+64 10
+64 12
+64 19
+64 21
+64 23
+64 26
+64 32
+64 73
+64 75
+64 83
+64 85
+64 88
+64 93
+64 97
+64 108
+64 112
+64 128
+64 133
+64 144
+64 155
+64 162
+64 172
+64 175
+64 179
+64 182
+64 189
+64 205
+64 217
+64 224
+64 235
+64 238
+64 240
+64 242
+64 250
+64 255
+64 278
+64 287
+64 296
+64 299
+65 0
+65 1
+65 28
+65 46
+65 49
+65 57
+65 80
+65 83
+65 87
+65 119
+65 120
+65 131
+65 137
+65 145
+65 147
+65 160
+65 170
+65 173
+65 177
+65 194
+65 205
+65 206
+65 213
+65 219
+65 235
+65 236
+65 239
+65 245
+65 251
+65 254
+65 260
+65 263
+65 276
+65 284
+65 286
+65 287
+65 291
+65 293
+65 297
+65 298
+66 13
+66 21
+66 25
+66 29
+66 31
+66 37
+66 43
+66 52
+66 60
+66 65
+66 73
+66 77
+66 90
+66 99
+66 100
+66 110
+66 120
+66 126
+66 130
+66 140
+66 143
+66 148
+66 152
+66 161
+66 163
+66 175
+66 180
+66 204
+66 218
+66 226
+66 228
+66 243
+66 246
+66 250
+66 254
+66 257
+66 258
+66 275
+66 284
+66 298
+67 1
+67 11
+67 20
+67 22
+67 29
+67 33
+67 56
+67 60
+67 64
+67 78
+67 81
+67 82
+67 95
+67 115
+67 117
+67 118
+67 124
+67 130
+67 132
+67 133
+67 135
+67 147
+67 155
+67 159
+67 175
+67 180
+67 196
+67 199
+67 201
+67 204
+67 208
+67 220
+67 223
+67 241
+67 251
+67 252
+67 255
+67 262
+67 264
+67 291
+68 13
+68 18
+68 25
+68 26
+68 27
+68 29
+68 33
+68 35
+68 49
+68 52
+68 55
+68 95
+68 102
+68 111
+68 123
+68 127
+68 136
+68 139
+68 143
+68 147
+68 148
+68 155
+68 161
+68 167
+68 168
+68 169
+68 170
+68 173
+68 186
+68 203
+68 222
+68 237
+68 238
+68 242
+68 249
+68 267
+68 269
+68 272
+68 274
+68 297
+69 6
+69 21
+69 28
+69 29
+69 31
+69 40
+69 44
+69 54
+69 62
+69 76
+69 93
+69 94
+69 96
+69 99
+69 110
+69 120
+69 128
+69 129
+69 137
+69 139
+69 151
+69 163
+69 181
+69 208
+69 212
+69 214
+69 219
+69 221
+69 233
+69 242
+69 243
+69 256
+69 269
+69 270
+69 272
+69 277
+69 281
+69 282
+69 284
+69 299
+70 1
+70 8
+70 11
+70 17
+70 23
+70 28
+70 36
+70 37
+70 44
+70 54
+70 61
+70 65
+70 98
+70 106
+70 113
+70 122
+70 125
+70 131
+70 137
+70 155
+70 161
+70 171
+70 196
+70 200
+70 204
+70 206
+70 209
+70 210
+70 217
+70 224
+70 237
+70 239
+70 242
+70 249
+70 255
+70 260
+70 288
+70 292
+70 293
+70 295
+71 8
+71 11
+71 38
+71 43
+71 45
+71 46
+71 47
+71 104
+71 106
+71 108
+71 115
+71 116
+71 117
+71 132
+71 137
+71 151
+71 152
+71 155
+71 161
+71 174
+71 176
+71 187
+71 192
+71 194
+71 200
+71 205
+71 210
+71 213
+71 218
+71 222
+71 223
+71 229
+71 231
+71 232
+71 233
+71 242
+71 258
+71 276
+71 281
+71 288
+72 11
+72 12
+72 26
+72 30
+72 34
+72 50
+72 69
+72 74
+72 80
+72 85
+72 100
+72 110
+72 113
+72 128
+72 131
+72 140
+72 148
+72 153
+72 166
+72 167
+72 173
+72 175
+72 186
+72 200
+72 203
+72 208
+72 215
+72 222
+72 244
+72 249
+72 253
+72 255
+72 260
+72 270
+72 278
+72 287
+72 290
+72 296
+72 298
+72 299
+73 4
+73 11
+73 12
+73 13
+73 24
+73 26
+73 38
+73 43
+73 60
+73 74
+73 76
+73 86
+73 91
+73 97
+73 105
+73 110
+73 127
+73 140
+73 148
+73 153
+73 159
+73 180
+73 183
+73 186
+73 191
+73 194
+73 203
+73 207
+73 221
+73 225
+73 235
+73 236
+73 262
+73 271
+73 275
+73 276
+73 279
+73 285
+73 291
+73 296
+74 10
+74 14
+74 24
+74 29
+74 30
+74 76
+74 87
+74 89
+74 93
+74 108
+74 110
+74 111
+74 114
+74 115
+74 117
+74 135
+74 144
+74 149
+74 160
+74 163
+74 164
+74 169
+74 172
+74 174
+74 178
+74 181
+74 183
+74 185
+74 186
+74 220
+74 225
+74 226
+74 242
+74 245
+74 250
+74 252
+74 258
+74 280
+74 291
+74 298
+75 1
+75 7
+75 8
+75 10
+75 12
+75 22
+75 27
+75 32
+75 48
+75 49
+75 52
+75 57
+75 78
+75 83
+75 88
+75 90
+75 113
+75 127
+75 133
+75 137
+75 139
+75 147
+75 149
+75 153
+75 158
+75 165
+75 180
+75 182
+75 184
+75 186
+75 197
+75 213
+75 239
+75 240
+75 251
+75 273
+75 278
+75 283
+75 287
+75 298
+76 11
+76 16
+76 20
+76 38
+76 46
+76 56
+76 97
+76 99
+76 114
+76 116
+76 125
+76 135
+76 145
+76 146
+76 151
+76 154
+76 159
+76 185
+76 188
+76 190
+76 199
+76 200
+76 203
+76 211
+76 227
+76 232
+76 233
+76 236
+76 239
+76 256
+76 258
+76 262
+76 267
+76 270
+76 272
+76 279
+76 283
+76 285
+76 294
+76 297
+77 6
+77 9
+77 19
+77 28
+77 35
+77 37
+77 38
+77 56
+77 57
+77 75
+77 88
+77 109
+77 110
+77 112
+77 124
+77 126
+77 148
+77 158
+77 159
+77 170
+77 171
+77 172
+77 182
+77 199
+77 218
+77 222
+77 228
+77 229
+77 237
+77 255
+77 263
+77 264
+77 272
+77 273
+77 278
+77 279
+77 284
+77 287
+77 295
+77 298
+78 3
+78 15
+78 17
+78 18
+78 22
+78 29
+78 33
+78 42
+78 51
+78 58
+78 71
+78 83
+78 84
+78 90
+78 94
+78 95
+78 96
+78 102
+78 103
+78 114
+78 121
+78 122
+78 128
+78 129
+78 132
+78 134
+78 138
+78 142
+78 155
+78 163
+78 164
+78 176
+78 196
+78 198
+78 212
+78 242
+78 253
+78 267
+78 286
+78 288
+79 3
+79 5
+79 14
+79 17
+79 21
+79 24
+79 30
+79 39
+79 59
+79 61
+79 62
+79 66
+79 75
+79 92
+79 97
+79 104
+79 115
+79 122
+79 129
+79 148
+79 163
+79 168
+79 184
+79 190
+79 195
+79 196
+79 199
+79 210
+79 223
+79 229
+79 239
+79 248
+79 251
+79 252
+79 255
+79 256
+79 271
+79 277
+79 285
+79 289
+80 2
+80 14
+80 19
+80 23
+80 26
+80 34
+80 36
+80 37
+80 44
+80 49
+80 57
+80 71
+80 74
+80 75
+80 76
+80 83
+80 86
+80 92
+80 97
+80 102
+80 117
+80 123
+80 141
+80 146
+80 157
+80 175
+80 179
+80 186
+80 192
+80 193
+80 195
+80 198
+80 209
+80 223
+80 230
+80 242
+80 260
+80 267
+80 274
+80 290
+81 4
+81 14
+81 20
+81 50
+81 55
+81 57
+81 61
+81 67
+81 73
+81 82
+81 95
+81 99
+81 119
+81 125
+81 128
+81 132
+81 135
+81 138
+81 142
+81 145
+81 146
+81 148
+81 149
+81 152
+81 171
+81 174
+81 185
+81 190
+81 196
+81 200
+81 201
+81 206
+81 212
+81 216
+81 247
+81 254
+81 277
+81 285
+81 292
+81 295
+82 0
+82 1
+82 13
+82 15
+82 31
+82 33
+82 46
+82 58
+82 67
+82 91
+82 95
+82 97
+82 98
+82 101
+82 106
+82 119
+82 134
+82 137
+82 140
+82 143
+82 162
+82 165
+82 168
+82 173
+82 187
+82 194
+82 199
+82 215
+82 220
+82 222
+82 229
+82 237
+82 240
+82 242
+82 246
+82 259
+82 277
+82 285
+82 288
+82 296
+83 13
+83 15
+83 18
+83 29
+83 32
+83 47
+83 50
+83 51
+83 57
+83 64
+83 65
+83 71
+83 77
+83 82
+83 93
+83 99
+83 103
+83 117
+83 123
+83 130
+83 131
+83 160
+83 176
+83 178
+83 183
+83 189
+83 190
+83 203
+83 211
+83 215
+83 233
+83 235
+83 237
+83 243
+83 272
+83 275
+83 279
+83 280
+83 287
+83 293
+84 5
+84 27
+84 30
+84 37
+84 49
+84 61
+84 67
+84 80
+84 108
+84 123
+84 134
+84 136
+84 143
+84 146
+84 148
+84 167
+84 182
+84 184
+84 187
+84 190
+84 201
+84 203
+84 215
+84 217
+84 218
+84 225
+84 227
+84 233
+84 239
+84 243
+84 245
+84 246
+84 247
+84 258
+84 260
+84 261
+84 275
+84 276
+84 283
+84 298
+85 1
+85 5
+85 23
+85 24
+85 26
+85 32
+85 40
+85 41
+85 50
+85 58
+85 60
+85 67
+85 69
+85 72
+85 73
+85 75
+85 76
+85 77
+85 79
+85 83
+85 86
+85 93
+85 109
+85 117
+85 144
+85 151
+85 159
+85 170
+85 171
+85 188
+85 196
+85 204
+85 216
+85 217
+85 227
+85 228
+85 247
+85 273
+85 290
+85 291
+86 19
+86 20
+86 23
+86 30
+86 37
+86 38
+86 55
+86 71
+86 80
+86 87
+86 91
+86 92
+86 105
+86 106
+86 114
+86 122
+86 124
+86 127
+86 134
+86 145
+86 154
+86 157
+86 162
+86 164
+86 170
+86 172
+86 205
+86 213
+86 214
+86 215
+86 234
+86 240
+86 253
+86 258
+86 263
+86 264
+86 279
+86 282
+86 283
+87 22
+87 32
+87 39
+87 46
+87 48
+87 60
+87 63
+87 65
+87 78
+87 86
+87 90
+87 101
+87 115
+87 118
+87 121
+87 124
+87 126
+87 128
+87 137
+87 147
+87 161
+87 180
+87 186
+87 187
+87 188
+87 191
+87 196
+87 197
+87 208
+87 210
+87 215
+87 221
+87 237
+87 238
+87 248
+87 254
+87 258
+87 260
+87 265
+87 287
+88 6
+88 7
+88 15
+88 17
+88 34
+88 39
+88 42
+88 48
+88 51
+88 59
+88 61
+88 72
+88 98
+88 103
+88 107
+88 115
+88 123
+88 130
+88 142
+88 148
+88 154
+88 156
+88 163
+88 166
+88 180
+88 193
+88 214
+88 217
+88 232
+88 239
+88 242
+88 245
+88 249
+88 250
+88 254
+88 271
+88 273
+88 283
+88 291
+89 18
+89 24
+89 40
+89 46
+89 47
+89 49
+89 61
+89 63
+89 64
+89 67
+89 68
+89 74
+89 80
+89 90
+89 91
+89 132
+89 150
+89 151
+89 153
+89 160
+89 162
+89 174
+89 181
+89 184
+89 210
+89 211
+89 215
+89 224
+89 227
+89 232
+89 242
+89 257
+89 263
+89 264
+89 265
+89 271
+89 285
+89 291
+89 294
+89 295
+90 0
+90 21
+90 30
+90 35
+90 47
+90 53
+90 54
+90 58
+90 70
+90 71
+90 82
+90 86
+90 93
+90 101
+90 104
+90 108
+90 131
+90 136
+90 143
+90 158
+90 168
+90 169
+90 171
+90 178
+90 193
+90 211
+90 214
+90 219
+90 224
+90 236
+90 238
+90 252
+90 266
+90 272
+90 276
+90 280
+90 288
+90 290
+90 293
+90 297
+91 1
+91 2
+91 13
+91 23
+91 46
+91 61
+91 65
+91 74
+91 78
+91 81
+91 84
+91 106
+91 109
+91 118
+91 123
+91 145
+91 167
+91 178
+91 180
+91 183
+91 187
+91 189
+91 194
+91 198
+91 218
+91 223
+91 225
+91 233
+91 239
+91 242
+91 243
+91 250
+91 253
+91 258
+91 269
+91 275
+91 288
+91 290
+91 299
+92 7
+92 15
+92 16
+92 22
+92 30
+92 40
+92 41
+92 42
+92 45
+92 46
+92 51
+92 53
+92 58
+92 70
+92 90
+92 94
+92 95
+92 96
+92 102
+92 114
+92 118
+92 134
+92 155
+92 159
+92 161
+92 162
+92 172
+92 174
+92 179
+92 181
+92 188
+92 193
+92 195
+92 217
+92 227
+92 231
+92 240
+92 241
+92 250
+92 281
+93 17
+93 25
+93 26
+93 32
+93 36
+93 38
+93 39
+93 44
+93 48
+93 62
+93 87
+93 102
+93 104
+93 114
+93 116
+93 125
+93 138
+93 146
+93 149
+93 151
+93 152
+93 154
+93 157
+93 163
+93 168
+93 174
+93 175
+93 204
+93 206
+93 210
+93 211
+93 212
+93 214
+93 224
+93 226
+93 234
+93 255
+93 261
+93 271
+93 279
+94 3
+94 8
+94 10
+94 12
+94 14
+94 15
+94 23
+94 26
+94 47
+94 49
+94 51
+94 58
+94 80
+94 83
+94 121
+94 138
+94 148
+94 149
+94 151
+94 152
+94 171
+94 176
+94 184
+94 188
+94 193
+94 197
+94 204
+94 205
+94 214
+94 227
+94 233
+94 246
+94 251
+94 252
+94 269
+94 274
+94 275
+94 284
+94 289
+94 297
+95 3
+95 17
+95 25
+95 26
+95 31
+95 39
+95 41
+95 57
+95 67
+95 72
+95 73
+95 84
+95 115
+95 127
+95 138
+95 140
+95 153
+95 157
+95 168
+95 173
+95 192
+95 193
+95 199
+95 209
+95 220
+95 226
+95 236
+95 243
+95 245
+95 250
+95 257
+95 264
+95 268
+95 270
+95 273
+95 274
+95 286
+95 288
+95 296
+95 297
+96 9
+96 21
+96 41
+96 46
+96 51
+96 53
+96 56
+96 60
+96 63
+96 64
+96 66
+96 68
+96 87
+96 93
+96 101
+96 107
+96 116
+96 121
+96 124
+96 125
+96 139
+96 150
+96 159
+96 170
+96 178
+96 195
+96 196
+96 210
+96 222
+96 228
+96 235
+96 236
+96 242
+96 246
+96 256
+96 263
+96 268
+96 271
+96 282
+96 296
+97 19
+97 22
+97 24
+97 30
+97 31
+97 34
+97 38
+97 52
+97 59
+97 65
+97 69
+97 75
+97 89
+97 102
+97 108
+97 115
+97 131
+97 134
+97 138
+97 142
+97 162
+97 166
+97 171
+97 179
+97 188
+97 193
+97 201
+97 209
+97 222
+97 227
+97 228
+97 241
+97 249
+97 260
+97 262
+97 268
+97 280
+97 290
+97 297
+97 299
+98 1
+98 2
+98 7
+98 10
+98 26
+98 27
+98 31
+98 36
+98 37
+98 42
+98 55
+98 68
+98 70
+98 76
+98 80
+98 87
+98 88
+98 89
+98 105
+98 113
+98 116
+98 125
+98 157
+98 165
+98 173
+98 178
+98 181
+98 186
+98 187
+98 203
+98 207
+98 212
+98 226
+98 231
+98 235
+98 236
+98 239
+98 248
+98 280
+98 281
+99 5
+99 7
+99 17
+99 23
+99 31
+99 33
+99 46
+99 49
+99 63
+99 100
+99 101
+99 107
+99 115
+99 136
+99 140
+99 149
+99 154
+99 156
+99 161
+99 166
+99 173
+99 179
+99 182
+99 183
+99 202
+99 203
+99 213
+99 216
+99 236
+99 248
+99 250
+99 251
+99 261
+99 268
+99 271
+99 273
+99 283
+99 291
+99 294
+99 295
+100 11
+100 28
+100 30
+100 33
+100 35
+100 45
+100 48
+100 49
+100 55
+100 66
+100 68
+100 80
+100 87
+100 107
+100 111
+100 126
+100 129
+100 132
+100 137
+100 145
+100 154
+100 159
+100 160
+100 163
+100 177
+100 178
+100 183
+100 193
+100 196
+100 197
+100 208
+100 218
+100 224
+100 225
+100 232
+100 237
+100 261
+100 273
+100 287
+100 290
+101 0
+101 2
+101 14
+101 20
+101 31
+101 38
+101 43
+101 46
+101 50
+101 51
+101 59
+101 64
+101 67
+101 90
+101 97
+101 104
+101 114
+101 137
+101 141
+101 147
+101 150
+101 168
+101 178
+101 187
+101 202
+101 211
+101 212
+101 228
+101 229
+101 239
+101 246
+101 249
+101 253
+101 254
+101 262
+101 263
+101 269
+101 296
+101 297
+101 299
+102 9
+102 14
+102 15
+102 25
+102 31
+102 43
+102 52
+102 54
+102 64
+102 75
+102 79
+102 81
+102 83
+102 96
+102 103
+102 113
+102 119
+102 124
+102 125
+102 139
+102 151
+102 156
+102 160
+102 165
+102 171
+102 182
+102 188
+102 199
+102 211
+102 215
+102 220
+102 237
+102 241
+102 252
+102 254
+102 257
+102 263
+102 272
+102 280
+102 297
+103 1
+103 21
+103 23
+103 26
+103 28
+103 34
+103 42
+103 49
+103 50
+103 63
+103 64
+103 72
+103 87
+103 104
+103 110
+103 115
+103 122
+103 123
+103 124
+103 134
+103 135
+103 151
+103 152
+103 181
+103 182
+103 183
+103 188
+103 192
+103 201
+103 221
+103 225
+103 226
+103 229
+103 252
+103 273
+103 274
+103 277
+103 278
+103 283
+103 295
+104 2
+104 7
+104 12
+104 25
+104 26
+104 32
+104 42
+104 45
+104 58
+104 61
+104 63
+104 64
+104 68
+104 70
+104 87
+104 101
+104 106
+104 114
+104 120
+104 124
+104 130
+104 144
+104 145
+104 155
+104 176
+104 177
+104 199
+104 213
+104 230
+104 231
+104 236
+104 241
+104 243
+104 246
+104 248
+104 260
+104 270
+104 283
+104 287
+104 299
+105 14
+105 28
+105 32
+105 33
+105 41
+105 69
+105 73
+105 74
+105 81
+105 95
+105 98
+105 103
+105 106
+105 110
+105 139
+105 140
+105 148
+105 149
+105 154
+105 162
+105 176
+105 187
+105 204
+105 213
+105 220
+105 224
+105 227
+105 234
+105 236
+105 242
+105 245
+105 250
+105 251
+105 252
+105 258
+105 267
+105 273
+105 282
+105 284
+105 291
+106 11
+106 23
+106 24
+106 28
+106 32
+106 34
+106 37
+106 39
+106 40
+106 43
+106 49
+106 54
+106 55
+106 61
+106 62
+106 69
+106 70
+106 74
+106 81
+106 102
+106 111
+106 132
+106 141
+106 176
+106 177
+106 193
+106 208
+106 217
+106 220
+106 225
+106 227
+106 234
+106 258
+106 260
+106 279
+106 283
+106 286
+106 291
+106 292
+106 299
+107 7
+107 8
+107 13
+107 14
+107 19
+107 20
+107 34
+107 47
+107 51
+107 58
+107 78
+107 86
+107 95
+107 101
+107 102
+107 104
+107 105
+107 108
+107 123
+107 126
+107 131
+107 132
+107 134
+107 143
+107 148
+107 158
+107 175
+107 177
+107 179
+107 205
+107 209
+107 210
+107 240
+107 262
+107 270
+107 281
+107 284
+107 287
+107 295
+107 298
+108 0
+108 14
+108 18
+108 51
+108 60
+108 63
+108 69
+108 72
+108 85
+108 87
+108 88
+108 96
+108 97
+108 115
+108 118
+108 120
+108 124
+108 126
+108 139
+108 145
+108 149
+108 151
+108 159
+108 165
+108 186
+108 187
+108 194
+108 200
+108 222
+108 225
+108 239
+108 265
+108 280
+108 282
+108 283
+108 285
+108 291
+108 294
+108 297
+108 298
+109 3
+109 10
+109 40
+109 43
+109 51
+109 54
+109 72
+109 74
+109 88
+109 91
+109 94
+109 99
+109 103
+109 106
+109 110
+109 116
+109 137
+109 141
+109 142
+109 147
+109 150
+109 151
+109 153
+109 157
+109 182
+109 190
+109 202
+109 221
+109 232
+109 237
+109 241
+109 245
+109 252
+109 259
+109 265
+109 268
+109 269
+109 281
+109 294
+109 299
+110 8
+110 13
+110 25
+110 44
+110 45
+110 46
+110 61
+110 78
+110 80
+110 84
+110 85
+110 87
+110 90
+110 93
+110 113
+110 117
+110 137
+110 149
+110 152
+110 162
+110 173
+110 183
+110 185
+110 196
+110 200
+110 219
+110 223
+110 224
+110 231
+110 245
+110 246
+110 248
+110 253
+110 258
+110 261
+110 264
+110 265
+110 280
+110 286
+110 290
+111 1
+111 3
+111 23
+111 39
+111 58
+111 81
+111 83
+111 90
+111 96
+111 102
+111 106
+111 118
+111 121
+111 138
+111 146
+111 147
+111 165
+111 174
+111 176
+111 179
+111 182
+111 189
+111 216
+111 217
+111 224
+111 225
+111 226
+111 229
+111 235
+111 238
+111 241
+111 242
+111 249
+111 252
+111 263
+111 276
+111 280
+111 281
+111 283
+111 289
+112 6
+112 7
+112 10
+112 15
+112 27
+112 47
+112 53
+112 63
+112 73
+112 77
+112 84
+112 90
+112 99
+112 119
+112 121
+112 130
+112 131
+112 135
+112 141
+112 167
+112 171
+112 182
+112 184
+112 195
+112 200
+112 201
+112 205
+112 216
+112 222
+112 223
+112 224
+112 236
+112 253
+112 254
+112 267
+112 269
+112 279
+112 280
+112 287
+112 295
+113 5
+113 16
+113 17
+113 28
+113 29
+113 46
+113 52
+113 54
+113 56
+113 81
+113 90
+113 95
+113 100
+113 102
+113 114
+113 116
+113 118
+113 122
+113 123
+113 128
+113 134
+113 139
+113 161
+113 169
+113 170
+113 185
+113 190
+113 203
+113 212
+113 218
+113 233
+113 242
+113 243
+113 245
+113 246
+113 247
+113 248
+113 251
+113 258
+113 260
+114 3
+114 5
+114 9
+114 15
+114 17
+114 22
+114 42
+114 43
+114 52
+114 53
+114 56
+114 65
+114 75
+114 94
+114 100
+114 101
+114 118
+114 127
+114 129
+114 132
+114 134
+114 135
+114 145
+114 167
+114 189
+114 204
+114 220
+114 221
+114 227
+114 228
+114 231
+114 236
+114 252
+114 259
+114 270
+114 275
+114 277
+114 283
+114 287
+115 3
+115 9
+115 35
+115 40
+115 53
+115 60
+115 63
+115 75
+115 79
+115 112
+115 113
+115 126
+115 129
+115 152
+115 153
+115 162
+115 163
+115 166
+115 181
+115 182
+115 188
+115 200
+115 202
+115 206
+115 207
+115 208
+115 217
+115 219
+115 220
+115 234
+115 245
+115 246
+115 251
+115 262
+115 266
+115 268
+115 277
+115 282
+115 293
+115 298
+116 6
+116 8
+116 10
+116 12
+116 23
+116 34
+116 42
+116 65
+116 69
+116 87
+116 94
+116 96
+116 102
+116 114
+116 119
+116 147
+116 154
+116 187
+116 188
+116 210
+116 213
+116 230
+116 235
+116 236
+116 238
+116 239
+116 245
+116 253
+116 258
+116 260
+116 267
+116 268
+116 270
+116 272
+116 280
+116 282
+116 285
+116 288
+116 291
+116 296
+117 3
+117 5
+117 10
+117 34
+117 35
+117 52
+117 70
+117 77
+117 88
+117 106
+117 119
+117 122
+117 126
+117 127
+117 137
+117 142
+117 143
+117 145
+117 147
+117 155
+117 160
+117 163
+117 180
+117 186
+117 208
+117 213
+117 219
+117 223
+117 228
+117 229
+117 239
+117 243
+117 259
+117 264
+117 266
+117 281
+117 283
+117 285
+117 294
+117 299
+118 9
+118 23
+118 30
+118 32
+118 35
+118 38
+118 39
+118 48
+118 70
+118 72
+118 79
+118 91
+118 92
+118 105
+118 115
+118 117
+118 131
+118 143
+118 148
+118 149
+118 152
+118 170
+118 175
+118 177
+118 188
+118 193
+118 194
+118 214
+118 231
+118 239
+118 245
+118 253
+118 258
+118 265
+118 267
+118 275
+118 282
+118 291
+118 292
+118 297
+119 13
+119 22
+119 45
+119 56
+119 60
+119 69
+119 71
+119 76
+119 79
+119 91
+119 97
+119 100
+119 123
+119 124
+119 125
+119 129
+119 130
+119 136
+119 146
+119 154
+119 155
+119 167
+119 171
+119 178
+119 180
+119 188
+119 191
+119 193
+119 197
+119 199
+119 205
+119 206
+119 214
+119 221
+119 232
+119 238
+119 240
+119 268
+119 282
+119 297
+120 3
+120 5
+120 14
+120 26
+120 35
+120 38
+120 41
+120 47
+120 53
+120 75
+120 79
+120 80
+120 82
+120 86
+120 90
+120 105
+120 124
+120 135
+120 138
+120 148
+120 163
+120 167
+120 181
+120 184
+120 185
+120 186
+120 196
+120 204
+120 211
+120 216
+120 219
+120 229
+120 231
+120 234
+120 248
+120 250
+120 253
+120 290
+120 295
+121 13
+121 14
+121 17
+121 25
+121 31
+121 40
+121 47
+121 48
+121 58
+121 71
+121 81
+121 90
+121 93
+121 119
+121 124
+121 139
+121 144
+121 146
+121 152
+121 155
+121 158
+121 165
+121 168
+121 170
+121 178
+121 190
+121 191
+121 192
+121 214
+121 223
+121 248
+121 251
+121 253
+121 259
+121 263
+121 267
+121 268
+121 270
+121 272
+121 273
+122 0
+122 3
+122 18
+122 21
+122 30
+122 38
+122 53
+122 54
+122 57
+122 69
+122 75
+122 79
+122 87
+122 98
+122 134
+122 136
+122 146
+122 148
+122 150
+122 161
+122 165
+122 173
+122 187
+122 197
+122 199
+122 200
+122 221
+122 223
+122 226
+122 233
+122 239
+122 244
+122 245
+122 266
+122 270
+122 272
+122 276
+122 278
+122 291
+123 13
+123 23
+123 24
+123 25
+123 28
+123 40
+123 42
+123 49
+123 53
+123 76
+123 85
+123 86
+123 106
+123 119
+123 124
+123 138
+123 147
+123 155
+123 169
+123 175
+123 194
+123 198
+123 202
+123 209
+123 219
+123 223
+123 230
+123 233
+123 239
+123 243
+123 250
+123 251
+123 259
+123 261
+123 263
+123 269
+123 276
+123 278
+123 285
+123 295
+124 19
+124 21
+124 28
+124 30
+124 35
+124 43
+124 55
+124 59
+124 61
+124 73
+124 84
+124 85
+124 88
+124 91
+124 92
+124 93
+124 95
+124 101
+124 107
+124 108
+124 128
+124 136
+124 145
+124 152
+124 157
+124 161
+124 162
+124 199
+124 210
+124 216
+124 233
+124 234
+124 235
+124 238
+124 242
+124 252
+124 255
+124 260
+124 264
+124 277
+125 3
+125 5
+125 17
+125 18
+125 19
+125 38
+125 39
+125 40
+125 41
+125 43
+125 56
+125 62
+125 63
+125 81
+125 82
+125 88
+125 89
+125 92
+125 105
+125 114
+125 117
+125 131
+125 132
+125 137
+125 163
+125 186
+125 192
+125 195
+125 197
+125 199
+125 211
+125 224
+125 228
+125 234
+125 236
+125 239
+125 246
+125 257
+125 289
+125 294
+126 7
+126 12
+126 14
+126 25
+126 28
+126 32
+126 36
+126 42
+126 71
+126 86
+126 91
+126 104
+126 109
+126 110
+126 112
+126 139
+126 140
+126 143
+126 147
+126 152
+126 164
+126 171
+126 177
+126 183
+126 185
+126 210
+126 223
+126 224
+126 228
+126 230
+126 236
+126 244
+126 250
+126 253
+126 269
+126 276
+126 277
+126 282
+126 285
+126 287
+127 2
+127 26
+127 44
+127 48
+127 56
+127 65
+127 70
+127 79
+127 90
+127 98
+127 104
+127 114
+127 124
+127 132
+127 134
+127 136
+127 141
+127 153
+127 155
+127 163
+127 164
+127 174
+127 180
+127 183
+127 187
+127 191
+127 192
+127 198
+127 222
+127 224
+127 245
+127 247
+127 251
+127 258
+127 267
+127 271
+127 272
+127 284
+127 292
+127 299
+128 4
+128 12
+128 24
+128 29
+128 37
+128 40
+128 41
+128 44
+128 46
+128 48
+128 59
+128 62
+128 73
+128 86
+128 87
+128 108
+128 110
+128 145
+128 147
+128 149
+128 152
+128 157
+128 165
+128 173
+128 182
+128 194
+128 200
+128 204
+128 220
+128 221
+128 231
+128 238
+128 242
+128 244
+128 259
+128 271
+128 285
+128 289
+128 295
+128 299
+129 6
+129 7
+129 29
+129 35
+129 36
+129 38
+129 43
+129 52
+129 61
+129 70
+129 71
+129 73
+129 75
+129 100
+129 108
+129 110
+129 112
+129 121
+129 161
+129 179
+129 180
+129 182
+129 190
+129 197
+129 203
+129 204
+129 215
+129 216
+129 225
+129 234
+129 242
+129 245
+129 253
+129 260
+129 263
+129 275
+129 286
+129 294
+129 298
+129 299
+130 0
+130 14
+130 18
+130 26
+130 37
+130 43
+130 48
+130 67
+130 73
+130 88
+130 91
+130 93
+130 95
+130 98
+130 108
+130 112
+130 113
+130 119
+130 122
+130 136
+130 148
+130 154
+130 158
+130 159
+130 201
+130 204
+130 210
+130 220
+130 229
+130 233
+130 246
+130 247
+130 248
+130 259
+130 277
+130 279
+130 283
+130 287
+130 293
+131 2
+131 8
+131 15
+131 29
+131 34
+131 44
+131 58
+131 65
+131 72
+131 74
+131 88
+131 92
+131 102
+131 118
+131 124
+131 128
+131 130
+131 142
+131 145
+131 149
+131 158
+131 163
+131 174
+131 179
+131 180
+131 184
+131 196
+131 214
+131 216
+131 218
+131 229
+131 231
+131 232
+131 239
+131 244
+131 245
+131 246
+131 255
+131 257
+131 297
+132 1
+132 5
+132 21
+132 31
+132 47
+132 57
+132 61
+132 82
+132 90
+132 97
+132 106
+132 113
+132 121
+132 134
+132 153
+132 159
+132 163
+132 168
+132 177
+132 187
+132 190
+132 199
+132 202
+132 222
+132 226
+132 233
+132 240
+132 241
+132 243
+132 253
+132 254
+132 256
+132 258
+132 259
+132 268
+132 270
+132 273
+132 277
+132 281
+132 295
+133 13
+133 19
+133 29
+133 30
+133 34
+133 36
+133 44
+133 46
+133 48
+133 51
+133 66
+133 76
+133 78
+133 83
+133 88
+133 89
+133 108
+133 113
+133 115
+133 118
+133 132
+133 140
+133 143
+133 146
+133 149
+133 150
+133 153
+133 156
+133 165
+133 189
+133 193
+133 197
+133 241
+133 248
+133 249
+133 257
+133 265
+133 267
+133 292
+134 4
+134 12
+134 17
+134 18
+134 26
+134 31
+134 37
+134 40
+134 42
+134 44
+134 46
+134 63
+134 75
+134 76
+134 87
+134 93
+134 96
+134 102
+134 108
+134 122
+134 139
+134 151
+134 160
+134 164
+134 170
+134 175
+134 184
+134 212
+134 235
+134 236
+134 251
+134 259
+134 262
+134 272
+134 273
+134 275
+134 279
+134 288
+134 294
+134 299
+135 3
+135 7
+135 28
+135 29
+135 34
+135 39
+135 43
+135 47
+135 56
+135 58
+135 60
+135 64
+135 65
+135 70
+135 79
+135 96
+135 108
+135 114
+135 116
+135 117
+135 137
+135 144
+135 171
+135 182
+135 186
+135 204
+135 206
+135 214
+135 224
+135 228
+135 230
+135 242
+135 263
+135 266
+135 268
+135 270
+135 271
+135 278
+135 286
+135 294
+136 5
+136 14
+136 18
+136 20
+136 21
+136 43
+136 55
+136 68
+136 79
+136 92
+136 96
+136 98
+136 101
+136 107
+136 108
+136 110
+136 111
+136 113
+136 121
+136 122
+136 129
+136 130
+136 134
+136 148
+136 173
+136 176
+136 178
+136 179
+136 188
+136 196
+136 209
+136 215
+136 224
+136 228
+136 232
+136 241
+136 246
+136 257
+136 295
+136 297
+137 3
+137 7
+137 8
+137 13
+137 24
+137 28
+137 30
+137 34
+137 39
+137 49
+137 57
+137 64
+137 65
+137 89
+137 91
+137 93
+137 107
+137 112
+137 116
+137 126
+137 153
+137 160
+137 161
+137 162
+137 163
+137 164
+137 167
+137 171
+137 172
+137 179
+137 181
+137 194
+137 210
+137 219
+137 225
+137 260
+137 270
+137 290
+137 291
+137 297
+138 1
+138 7
+138 11
+138 19
+138 20
+138 24
+138 31
+138 45
+138 46
+138 48
+138 56
+138 64
+138 67
+138 89
+138 91
+138 106
+138 123
+138 127
+138 134
+138 142
+138 150
+138 152
+138 153
+138 161
+138 164
+138 178
+138 201
+138 205
+138 206
+138 208
+138 218
+138 219
+138 245
+138 249
+138 255
+138 268
+138 269
+138 276
+138 278
+138 296
+139 10
+139 34
+139 40
+139 44
+139 47
+139 61
+139 66
+139 70
+139 79
+139 88
+139 100
+139 111
+139 115
+139 130
+139 134
+139 152
+139 159
+139 160
+139 170
+139 172
+139 182
+139 187
+139 189
+139 193
+139 198
+139 208
+139 223
+139 224
+139 225
+139 228
+139 247
+139 254
+139 257
+139 271
+139 278
+139 284
+139 290
+139 291
+139 293
+139 295
+140 23
+140 25
+140 26
+140 31
+140 39
+140 40
+140 41
+140 46
+140 47
+140 48
+140 53
+140 65
+140 71
+140 73
+140 80
+140 91
+140 99
+140 105
+140 109
+140 124
+140 149
+140 162
+140 165
+140 171
+140 172
+140 182
+140 190
+140 194
+140 204
+140 208
+140 220
+140 226
+140 237
+140 250
+140 253
+140 254
+140 255
+140 274
+140 293
+140 299
+141 19
+141 27
+141 28
+141 38
+141 43
+141 49
+141 51
+141 52
+141 84
+141 106
+141 118
+141 125
+141 126
+141 134
+141 137
+141 139
+141 142
+141 150
+141 151
+141 161
+141 162
+141 169
+141 175
+141 181
+141 195
+141 199
+141 200
+141 210
+141 221
+141 233
+141 237
+141 239
+141 258
+141 259
+141 269
+141 276
+141 283
+141 284
+141 287
+141 297
+142 0
+142 9
+142 14
+142 17
+142 32
+142 40
+142 44
+142 46
+142 51
+142 63
+142 75
+142 80
+142 84
+142 93
+142 105
+142 116
+142 118
+142 121
+142 129
+142 132
+142 140
+142 149
+142 150
+142 168
+142 175
+142 177
+142 181
+142 184
+142 187
+142 189
+142 191
+142 192
+142 199
+142 239
+142 247
+142 267
+142 270
+142 275
+142 285
+143 1
+143 3
+143 7
+143 8
+143 15
+143 16
+143 17
+143 20
+143 21
+143 39
+143 41
+143 59
+143 61
+143 62
+143 69
+143 76
+143 100
+143 103
+143 105
+143 111
+143 115
+143 125
+143 162
+143 169
+143 176
+143 201
+143 207
+143 216
+143 231
+143 233
+143 243
+143 252
+143 254
+143 259
+143 261
+143 266
+143 274
+143 282
+143 286
+143 293
+144 3
+144 6
+144 13
+144 15
+144 19
+144 21
+144 34
+144 39
+144 43
+144 47
+144 51
+144 57
+144 58
+144 64
+144 80
+144 95
+144 97
+144 105
+144 111
+144 114
+144 125
+144 146
+144 150
+144 155
+144 163
+144 174
+144 205
+144 214
+144 215
+144 221
+144 225
+144 226
+144 229
+144 243
+144 247
+144 266
+144 271
+144 275
+144 281
+144 292
+145 9
+145 10
+145 11
+145 14
+145 17
+145 18
+145 29
+145 31
+145 33
+145 34
+145 46
+145 54
+145 61
+145 79
+145 81
+145 82
+145 83
+145 84
+145 110
+145 117
+145 119
+145 148
+145 163
+145 164
+145 174
+145 180
+145 191
+145 204
+145 210
+145 211
+145 218
+145 219
+145 227
+145 236
+145 244
+145 252
+145 253
+145 273
+145 281
+145 285
+146 7
+146 11
+146 30
+146 35
+146 48
+146 58
+146 60
+146 70
+146 81
+146 98
+146 102
+146 113
+146 122
+146 132
+146 139
+146 162
+146 176
+146 182
+146 188
+146 193
+146 197
+146 198
+146 199
+146 205
+146 208
+146 216
+146 220
+146 224
+146 232
+146 235
+146 237
+146 240
+146 241
+146 242
+146 244
+146 256
+146 266
+146 284
+146 288
+146 294
+147 0
+147 14
+147 24
+147 42
+147 46
+147 64
+147 84
+147 91
+147 105
+147 106
+147 120
+147 128
+147 131
+147 133
+147 148
+147 150
+147 172
+147 173
+147 189
+147 190
+147 204
+147 205
+147 209
+147 219
+147 230
+147 232
+147 233
+147 245
+147 250
+147 251
+147 252
+147 256
+147 257
+147 258
+147 264
+147 272
+147 277
+147 288
+147 290
+147 298
+148 0
+148 2
+148 9
+148 11
+148 38
+148 57
+148 64
+148 67
+148 69
+148 100
+148 104
+148 115
+148 128
+148 135
+148 137
+148 144
+148 165
+148 175
+148 179
+148 189
+148 194
+148 211
+148 215
+148 225
+148 234
+148 237
+148 252
+148 253
+148 258
+148 259
+148 272
+148 274
+148 275
+148 279
+148 281
+148 282
+148 283
+148 294
+148 298
+148 299
+149 13
+149 35
+149 38
+149 48
+149 49
+149 51
+149 84
+149 85
+149 91
+149 97
+149 129
+149 131
+149 143
+149 148
+149 152
+149 156
+149 160
+149 167
+149 177
+149 184
+149 198
+149 201
+149 205
+149 211
+149 213
+149 215
+149 226
+149 245
+149 254
+149 258
+149 260
+149 261
+149 272
+149 273
+149 275
+149 278
+149 282
+149 283
+149 285
+149 292
+150 4
+150 19
+150 21
+150 33
+150 37
+150 40
+150 41
+150 44
+150 57
+150 66
+150 75
+150 89
+150 90
+150 91
+150 105
+150 114
+150 129
+150 135
+150 139
+150 143
+150 149
+150 154
+150 177
+150 190
+150 193
+150 200
+150 203
+150 219
+150 224
+150 232
+150 240
+150 242
+150 249
+150 257
+150 261
+150 267
+150 273
+150 274
+150 289
+150 294
+151 15
+151 19
+151 23
+151 26
+151 28
+151 33
+151 42
+151 54
+151 67
+151 78
+151 81
+151 104
+151 112
+151 118
+151 120
+151 125
+151 128
+151 132
+151 138
+151 148
+151 154
+151 166
+151 175
+151 179
+151 180
+151 185
+151 189
+151 199
+151 224
+151 226
+151 231
+151 239
+151 249
+151 251
+151 257
+151 272
+151 280
+151 282
+151 292
+151 296
+152 6
+152 14
+152 25
+152 30
+152 34
+152 54
+152 58
+152 60
+152 63
+152 66
+152 67
+152 73
+152 88
+152 91
+152 93
+152 104
+152 105
+152 107
+152 109
+152 154
+152 155
+152 156
+152 179
+152 185
+152 195
+152 211
+152 213
+152 220
+152 231
+152 234
+152 240
+152 242
+152 247
+152 265
+152 270
+152 277
+152 280
+152 293
+152 295
+152 299
+153 6
+153 16
+153 19
+153 34
+153 52
+153 57
+153 65
+153 77
+153 101
+153 102
+153 106
+153 120
+153 121
+153 123
+153 136
+153 137
+153 141
+153 142
+153 154
+153 167
+153 169
+153 184
+153 191
+153 194
+153 196
+153 199
+153 211
+153 217
+153 222
+153 228
+153 231
+153 236
+153 253
+153 255
+153 258
+153 263
+153 264
+153 277
+153 281
+154 3
+154 8
+154 19
+154 29
+154 35
+154 44
+154 54
+154 60
+154 68
+154 71
+154 83
+154 108
+154 117
+154 123
+154 133
+154 143
+154 151
+154 152
+154 158
+154 159
+154 165
+154 179
+154 180
+154 181
+154 189
+154 196
+154 199
+154 233
+154 240
+154 242
+154 243
+154 251
+154 258
+154 265
+154 272
+154 273
+154 284
+154 288
+154 292
+154 294
+155 2
+155 5
+155 7
+155 9
+155 33
+155 36
+155 51
+155 61
+155 68
+155 70
+155 80
+155 94
+155 109
+155 111
+155 129
+155 130
+155 132
+155 140
+155 145
+155 153
+155 154
+155 157
+155 169
+155 172
+155 173
+155 175
+155 208
+155 218
+155 220
+155 222
+155 238
+155 247
+155 251
+155 259
+155 260
+155 262
+155 266
+155 279
+155 281
+155 290
+156 8
+156 13
+156 16
+156 21
+156 25
+156 28
+156 39
+156 48
+156 61
+156 94
+156 112
+156 119
+156 120
+156 134
+156 138
+156 139
+156 140
+156 147
+156 149
+156 152
+156 155
+156 162
+156 167
+156 184
+156 186
+156 196
+156 222
+156 227
+156 234
+156 246
+156 249
+156 260
+156 262
+156 269
+156 272
+156 273
+156 276
+156 281
+156 284
+156 288
+157 4
+157 5
+157 6
+157 10
+157 15
+157 31
+157 36
+157 43
+157 50
+157 54
+157 55
+157 75
+157 76
+157 92
+157 96
+157 107
+157 109
+157 115
+157 131
+157 134
+157 164
+157 166
+157 193
+157 202
+157 206
+157 207
+157 209
+157 217
+157 220
+157 245
+157 248
+157 265
+157 269
+157 271
+157 274
+157 281
+157 288
+157 290
+157 291
+157 296
+158 1
+158 19
+158 30
+158 49
+158 58
+158 59
+158 60
+158 62
+158 63
+158 66
+158 67
+158 68
+158 78
+158 85
+158 91
+158 100
+158 101
+158 111
+158 125
+158 129
+158 135
+158 160
+158 162
+158 172
+158 175
+158 178
+158 186
+158 192
+158 209
+158 228
+158 236
+158 240
+158 242
+158 245
+158 258
+158 259
+158 274
+158 279
+158 285
+158 286
+159 8
+159 19
+159 21
+159 28
+159 29
+159 42
+159 48
+159 51
+159 66
+159 68
+159 77
+159 78
+159 103
+159 109
+159 125
+159 128
+159 129
+159 136
+159 142
+159 149
+159 155
+159 173
+159 175
+159 182
+159 183
+159 187
+159 194
+159 195
+159 205
+159 210
+159 216
+159 217
+159 220
+159 231
+159 234
+159 261
+159 264
+159 281
+159 283
+159 295
+160 5
+160 6
+160 16
+160 22
+160 46
+160 52
+160 61
+160 66
+160 84
+160 85
+160 103
+160 107
+160 115
+160 134
+160 144
+160 157
+160 165
+160 167
+160 179
+160 185
+160 194
+160 208
+160 209
+160 212
+160 217
+160 219
+160 231
+160 236
+160 242
+160 247
+160 253
+160 256
+160 257
+160 259
+160 267
+160 273
+160 293
+160 294
+160 296
+160 297
+161 9
+161 10
+161 12
+161 14
+161 23
+161 31
+161 33
+161 59
+161 61
+161 74
+161 77
+161 79
+161 82
+161 90
+161 91
+161 96
+161 115
+161 116
+161 121
+161 125
+161 136
+161 147
+161 168
+161 184
+161 186
+161 188
+161 192
+161 194
+161 198
+161 206
+161 207
+161 215
+161 227
+161 229
+161 239
+161 241
+161 256
+161 267
+161 282
+161 297
+162 2
+162 10
+162 18
+162 24
+162 27
+162 31
+162 59
+162 61
+162 68
+162 81
+162 83
+162 84
+162 85
+162 92
+162 96
+162 105
+162 108
+162 109
+162 124
+162 129
+162 130
+162 133
+162 141
+162 144
+162 145
+162 149
+162 158
+162 160
+162 164
+162 182
+162 185
+162 191
+162 219
+162 223
+162 236
+162 255
+162 260
+162 266
+162 275
+162 298
+163 18
+163 21
+163 35
+163 41
+163 42
+163 44
+163 59
+163 67
+163 76
+163 93
+163 97
+163 137
+163 152
+163 162
+163 164
+163 168
+163 170
+163 171
+163 181
+163 187
+163 191
+163 192
+163 199
+163 202
+163 207
+163 211
+163 227
+163 240
+163 259
+163 260
+163 264
+163 268
+163 269
+163 274
+163 276
+163 281
+163 283
+163 286
+163 288
+163 292
+164 3
+164 10
+164 19
+164 20
+164 24
+164 26
+164 30
+164 34
+164 39
+164 43
+164 66
+164 72
+164 75
+164 83
+164 84
+164 90
+164 109
+164 112
+164 116
+164 118
+164 119
+164 125
+164 130
+164 153
+164 173
+164 185
+164 188
+164 194
+164 196
+164 216
+164 222
+164 230
+164 231
+164 248
+164 258
+164 265
+164 267
+164 275
+164 281
+164 287
+165 10
+165 21
+165 36
+165 45
+165 53
+165 65
+165 68
+165 76
+165 79
+165 85
+165 90
+165 92
+165 96
+165 97
+165 99
+165 100
+165 101
+165 112
+165 130
+165 131
+165 139
+165 151
+165 154
+165 155
+165 159
+165 177
+165 184
+165 196
+165 203
+165 223
+165 236
+165 245
+165 248
+165 254
+165 256
+165 257
+165 261
+165 276
+165 280
+165 290
+166 12
+166 16
+166 19
+166 37
+166 54
+166 58
+166 73
+166 76
+166 78
+166 85
+166 89
+166 90
+166 101
+166 103
+166 106
+166 125
+166 134
+166 136
+166 149
+166 152
+166 161
+166 170
+166 173
+166 182
+166 184
+166 186
+166 195
+166 202
+166 211
+166 217
+166 228
+166 238
+166 243
+166 246
+166 248
+166 256
+166 268
+166 287
+166 293
+166 298
+167 2
+167 9
+167 11
+167 14
+167 15
+167 20
+167 30
+167 32
+167 35
+167 50
+167 53
+167 54
+167 66
+167 67
+167 78
+167 89
+167 91
+167 96
+167 101
+167 111
+167 128
+167 130
+167 141
+167 143
+167 177
+167 182
+167 189
+167 196
+167 197
+167 204
+167 207
+167 209
+167 221
+167 269
+167 274
+167 279
+167 280
+167 288
+167 291
+167 294
+168 3
+168 7
+168 17
+168 23
+168 43
+168 44
+168 49
+168 54
+168 66
+168 67
+168 83
+168 88
+168 93
+168 99
+168 102
+168 107
+168 127
+168 132
+168 138
+168 151
+168 157
+168 163
+168 166
+168 180
+168 184
+168 186
+168 204
+168 207
+168 230
+168 235
+168 237
+168 239
+168 253
+168 254
+168 255
+168 263
+168 272
+168 286
+168 287
+168 289
+169 1
+169 8
+169 15
+169 27
+169 29
+169 38
+169 39
+169 45
+169 54
+169 57
+169 65
+169 68
+169 83
+169 85
+169 88
+169 90
+169 105
+169 108
+169 118
+169 125
+169 131
+169 132
+169 137
+169 138
+169 140
+169 142
+169 181
+169 192
+169 195
+169 214
+169 222
+169 223
+169 241
+169 250
+169 260
+169 266
+169 267
+169 268
+169 283
+169 289
+170 12
+170 19
+170 23
+170 35
+170 38
+170 47
+170 48
+170 56
+170 73
+170 82
+170 84
+170 104
+170 105
+170 107
+170 117
+170 118
+170 127
+170 133
+170 136
+170 138
+170 152
+170 153
+170 161
+170 163
+170 165
+170 168
+170 174
+170 180
+170 213
+170 214
+170 219
+170 221
+170 224
+170 225
+170 242
+170 259
+170 269
+170 272
+170 281
+170 288
+171 2
+171 4
+171 6
+171 8
+171 10
+171 15
+171 22
+171 29
+171 32
+171 35
+171 56
+171 59
+171 66
+171 76
+171 87
+171 90
+171 92
+171 95
+171 108
+171 109
+171 120
+171 126
+171 137
+171 147
+171 149
+171 160
+171 165
+171 184
+171 191
+171 200
+171 223
+171 230
+171 231
+171 238
+171 243
+171 269
+171 278
+171 281
+171 282
+171 293
+172 9
+172 13
+172 22
+172 32
+172 33
+172 38
+172 40
+172 44
+172 56
+172 62
+172 69
+172 74
+172 77
+172 82
+172 83
+172 100
+172 104
+172 107
+172 109
+172 112
+172 122
+172 131
+172 137
+172 161
+172 164
+172 169
+172 174
+172 176
+172 178
+172 181
+172 183
+172 185
+172 199
+172 227
+172 233
+172 236
+172 238
+172 256
+172 257
+172 263
+173 3
+173 20
+173 25
+173 39
+173 42
+173 84
+173 90
+173 92
+173 94
+173 98
+173 104
+173 109
+173 112
+173 116
+173 119
+173 129
+173 136
+173 137
+173 139
+173 147
+173 164
+173 171
+173 185
+173 188
+173 194
+173 199
+173 204
+173 208
+173 216
+173 218
+173 224
+173 230
+173 242
+173 251
+173 253
+173 266
+173 267
+173 280
+173 285
+173 297
+174 4
+174 10
+174 12
+174 21
+174 22
+174 35
+174 50
+174 56
+174 67
+174 69
+174 77
+174 81
+174 82
+174 92
+174 95
+174 106
+174 107
+174 119
+174 122
+174 132
+174 134
+174 137
+174 143
+174 169
+174 182
+174 187
+174 200
+174 211
+174 232
+174 235
+174 238
+174 240
+174 245
+174 250
+174 252
+174 269
+174 278
+174 282
+174 283
+174 286
+175 6
+175 22
+175 28
+175 31
+175 34
+175 45
+175 55
+175 58
+175 60
+175 65
+175 66
+175 72
+175 89
+175 101
+175 134
+175 140
+175 143
+175 144
+175 147
+175 148
+175 150
+175 153
+175 158
+175 174
+175 181
+175 199
+175 204
+175 214
+175 219
+175 221
+175 224
+175 231
+175 233
+175 246
+175 248
+175 251
+175 253
+175 276
+175 277
+175 291
+176 5
+176 12
+176 23
+176 31
+176 35
+176 46
+176 54
+176 56
+176 57
+176 59
+176 60
+176 66
+176 67
+176 71
+176 88
+176 95
+176 123
+176 125
+176 135
+176 150
+176 153
+176 156
+176 157
+176 177
+176 181
+176 189
+176 194
+176 198
+176 227
+176 230
+176 244
+176 245
+176 250
+176 260
+176 261
+176 263
+176 269
+176 271
+176 278
+176 288
+177 3
+177 22
+177 27
+177 41
+177 43
+177 54
+177 58
+177 64
+177 81
+177 87
+177 96
+177 100
+177 111
+177 115
+177 121
+177 123
+177 139
+177 156
+177 158
+177 161
+177 162
+177 175
+177 179
+177 188
+177 190
+177 191
+177 197
+177 205
+177 219
+177 227
+177 241
+177 242
+177 243
+177 244
+177 256
+177 259
+177 266
+177 273
+177 275
+177 288
+178 5
+178 7
+178 15
+178 28
+178 32
+178 36
+178 39
+178 40
+178 64
+178 68
+178 75
+178 91
+178 112
+178 116
+178 120
+178 121
+178 139
+178 147
+178 152
+178 155
+178 161
+178 163
+178 179
+178 184
+178 187
+178 204
+178 210
+178 211
+178 214
+178 229
+178 241
+178 255
+178 257
+178 263
+178 265
+178 273
+178 276
+178 280
+178 284
+178 298
+179 0
+179 1
+179 12
+179 17
+179 22
+179 31
+179 38
+179 39
+179 47
+179 50
+179 57
+179 61
+179 65
+179 66
+179 67
+179 78
+179 83
+179 86
+179 103
+179 109
+179 119
+179 125
+179 131
+179 142
+179 152
+179 167
+179 168
+179 181
+179 212
+179 215
+179 235
+179 246
+179 256
+179 268
+179 277
+179 281
+179 282
+179 283
+179 288
+180 11
+180 12
+180 25
+180 32
+180 69
+180 90
+180 97
+180 100
+180 105
+180 111
+180 113
+180 129
+180 142
+180 156
+180 157
+180 162
+180 165
+180 168
+180 179
+180 184
+180 189
+180 194
+180 198
+180 199
+180 202
+180 209
+180 212
+180 217
+180 219
+180 225
+180 241
+180 244
+180 245
+180 255
+180 265
+180 285
+180 286
+180 288
+180 297
+180 299
+181 0
+181 9
+181 17
+181 21
+181 22
+181 35
+181 37
+181 44
+181 76
+181 79
+181 83
+181 98
+181 103
+181 125
+181 134
+181 138
+181 145
+181 146
+181 171
+181 172
+181 199
+181 207
+181 208
+181 212
+181 220
+181 223
+181 225
+181 229
+181 231
+181 233
+181 240
+181 242
+181 247
+181 266
+181 276
+181 277
+181 279
+181 280
+181 285
+181 287
+182 0
+182 8
+182 24
+182 39
+182 43
+182 58
+182 61
+182 63
+182 65
+182 66
+182 75
+182 87
+182 101
+182 111
+182 121
+182 123
+182 125
+182 128
+182 135
+182 136
+182 148
+182 153
+182 154
+182 159
+182 176
+182 184
+182 199
+182 214
+182 217
+182 222
+182 225
+182 234
+182 242
+182 248
+182 250
+182 259
+182 263
+182 269
+182 279
+182 295
+183 1
+183 7
+183 26
+183 27
+183 28
+183 31
+183 43
+183 48
+183 55
+183 62
+183 66
+183 79
+183 85
+183 87
+183 88
+183 89
+183 107
+183 118
+183 121
+183 126
+183 131
+183 154
+183 160
+183 169
+183 170
+183 177
+183 194
+183 204
+183 206
+183 227
+183 242
+183 246
+183 249
+183 263
+183 266
+183 286
+183 290
+183 293
+183 297
+184 6
+184 12
+184 13
+184 17
+184 20
+184 31
+184 34
+184 36
+184 38
+184 52
+184 62
+184 63
+184 97
+184 99
+184 101
+184 111
+184 121
+184 124
+184 125
+184 129
+184 132
+184 137
+184 139
+184 143
+184 148
+184 151
+184 174
+184 175
+184 196
+184 225
+184 232
+184 250
+184 251
+184 262
+184 266
+184 270
+184 275
+184 280
+184 283
+184 289
+185 4
+185 15
+185 16
+185 19
+185 20
+185 29
+185 39
+185 49
+185 61
+185 70
+185 76
+185 86
+185 89
+185 101
+185 104
+185 113
+185 120
+185 132
+185 138
+185 144
+185 146
+185 148
+185 193
+185 212
+185 213
+185 220
+185 227
+185 234
+185 241
+185 248
+185 255
+185 256
+185 257
+185 270
+185 280
+185 282
+185 283
+185 285
+185 287
+185 296
+186 10
+186 13
+186 14
+186 15
+186 24
+186 34
+186 36
+186 47
+186 54
+186 80
+186 82
+186 85
+186 86
+186 88
+186 102
+186 104
+186 109
+186 112
+186 130
+186 138
+186 139
+186 144
+186 152
+186 157
+186 177
+186 178
+186 179
+186 180
+186 187
+186 188
+186 196
+186 203
+186 204
+186 211
+186 227
+186 245
+186 273
+186 285
+186 286
+186 298
+187 4
+187 7
+187 25
+187 26
+187 37
+187 46
+187 48
+187 58
+187 66
+187 82
+187 95
+187 105
+187 113
+187 117
+187 121
+187 122
+187 129
+187 139
+187 142
+187 153
+187 156
+187 166
+187 198
+187 210
+187 211
+187 212
+187 213
+187 218
+187 239
+187 242
+187 251
+187 259
+187 269
+187 272
+187 275
+187 286
+187 288
+187 293
+187 295
+187 298
+188 5
+188 15
+188 24
+188 31
+188 36
+188 45
+188 55
+188 56
+188 62
+188 68
+188 71
+188 79
+188 86
+188 89
+188 95
+188 100
+188 101
+188 114
+188 142
+188 152
+188 172
+188 173
+188 193
+188 196
+188 197
+188 217
+188 224
+188 227
+188 238
+188 242
+188 248
+188 249
+188 253
+188 254
+188 256
+188 257
+188 262
+188 272
+188 277
+188 298
+189 10
+189 14
+189 32
+189 40
+189 41
+189 56
+189 57
+189 76
+189 78
+189 90
+189 122
+189 130
+189 137
+189 146
+189 158
+189 165
+189 178
+189 179
+189 186
+189 190
+189 195
+189 197
+189 198
+189 202
+189 205
+189 216
+189 230
+189 239
+189 241
+189 247
+189 249
+189 253
+189 254
+189 261
+189 264
+189 276
+189 277
+189 285
+189 290
+189 296
+190 2
+190 12
+190 16
+190 20
+190 23
+190 31
+190 41
+190 49
+190 58
+190 73
+190 75
+190 94
+190 96
+190 104
+190 106
+190 126
+190 134
+190 137
+190 142
+190 155
+190 158
+190 164
+190 176
+190 178
+190 180
+190 193
+190 208
+190 217
+190 222
+190 229
+190 232
+190 236
+190 237
+190 238
+190 245
+190 256
+190 277
+190 281
+190 288
+190 290
+191 8
+191 32
+191 35
+191 37
+191 39
+191 45
+191 50
+191 58
+191 61
+191 68
+191 81
+191 96
+191 112
+191 114
+191 124
+191 126
+191 128
+191 130
+191 132
+191 138
+191 146
+191 158
+191 169
+191 188
+191 189
+191 193
+191 205
+191 207
+191 208
+191 213
+191 229
+191 238
+191 244
+191 247
+191 251
+191 262
+191 277
+191 278
+191 290
+191 297
+192 2
+192 15
+192 19
+192 25
+192 27
+192 28
+192 30
+192 73
+192 78
+192 87
+192 89
+192 96
+192 97
+192 98
+192 103
+192 116
+192 130
+192 139
+192 143
+192 149
+192 159
+192 162
+192 166
+192 189
+192 206
+192 218
+192 235
+192 238
+192 242
+192 259
+192 263
+192 272
+192 274
+192 277
+192 278
+192 279
+192 281
+192 289
+192 291
+192 296
+193 7
+193 8
+193 11
+193 13
+193 28
+193 30
+193 31
+193 42
+193 46
+193 53
+193 65
+193 91
+193 95
+193 100
+193 107
+193 108
+193 114
+193 116
+193 121
+193 134
+193 136
+193 139
+193 145
+193 148
+193 152
+193 159
+193 163
+193 173
+193 219
+193 225
+193 226
+193 239
+193 252
+193 271
+193 289
+193 290
+193 293
+193 296
+193 298
+194 1
+194 21
+194 31
+194 41
+194 42
+194 43
+194 44
+194 46
+194 67
+194 71
+194 75
+194 98
+194 108
+194 113
+194 118
+194 122
+194 143
+194 144
+194 148
+194 154
+194 167
+194 174
+194 183
+194 196
+194 199
+194 202
+194 215
+194 217
+194 223
+194 236
+194 237
+194 239
+194 242
+194 253
+194 262
+194 264
+194 276
+194 279
+194 294
+194 298
+195 20
+195 21
+195 38
+195 40
+195 48
+195 54
+195 58
+195 74
+195 78
+195 84
+195 93
+195 98
+195 117
+195 119
+195 120
+195 123
+195 131
+195 134
+195 145
+195 161
+195 169
+195 170
+195 174
+195 180
+195 181
+195 185
+195 187
+195 192
+195 210
+195 215
+195 235
+195 238
+195 241
+195 246
+195 248
+195 255
+195 268
+195 276
+195 296
+195 297
+196 0
+196 4
+196 6
+196 9
+196 14
+196 22
+196 45
+196 59
+196 61
+196 68
+196 76
+196 77
+196 82
+196 108
+196 111
+196 113
+196 114
+196 127
+196 128
+196 139
+196 140
+196 148
+196 158
+196 171
+196 185
+196 200
+196 204
+196 223
+196 228
+196 241
+196 250
+196 253
+196 263
+196 264
+196 270
+196 274
+196 275
+196 277
+196 281
+196 288
+197 0
+197 5
+197 13
+197 21
+197 39
+197 45
+197 47
+197 52
+197 69
+197 77
+197 91
+197 92
+197 103
+197 107
+197 108
+197 128
+197 136
+197 139
+197 143
+197 149
+197 155
+197 163
+197 182
+197 188
+197 191
+197 192
+197 194
+197 203
+197 210
+197 220
+197 222
+197 228
+197 239
+197 253
+197 263
+197 269
+197 273
+197 276
+197 283
+197 287
+198 1
+198 5
+198 10
+198 16
+198 60
+198 61
+198 63
+198 66
+198 79
+198 80
+198 81
+198 102
+198 119
+198 130
+198 131
+198 137
+198 138
+198 139
+198 140
+198 149
+198 150
+198 169
+198 172
+198 179
+198 181
+198 183
+198 188
+198 195
+198 207
+198 212
+198 222
+198 240
+198 244
+198 250
+198 257
+198 261
+198 262
+198 277
+198 281
+198 288
+199 4
+199 19
+199 24
+199 30
+199 33
+199 37
+199 40
+199 64
+199 65
+199 68
+199 70
+199 81
+199 84
+199 85
+199 111
+199 121
+199 123
+199 131
+199 134
+199 157
+199 163
+199 165
+199 174
+199 178
+199 179
+199 193
+199 196
+199 197
+199 216
+199 225
+199 229
+199 247
+199 267
+199 271
+199 274
+199 275
+199 282
+199 283
+199 285
+199 290
+200 1
+200 18
+200 30
+200 34
+200 61
+200 66
+200 73
+200 75
+200 76
+200 80
+200 93
+200 99
+200 104
+200 108
+200 110
+200 124
+200 126
+200 129
+200 136
+200 137
+200 141
+200 148
+200 154
+200 167
+200 171
+200 181
+200 187
+200 190
+200 210
+200 212
+200 221
+200 227
+200 230
+200 235
+200 240
+200 242
+200 256
+200 257
+200 278
+200 294
+201 1
+201 5
+201 8
+201 19
+201 22
+201 30
+201 45
+201 60
+201 65
+201 67
+201 73
+201 74
+201 79
+201 80
+201 86
+201 90
+201 92
+201 96
+201 99
+201 100
+201 102
+201 110
+201 139
+201 144
+201 149
+201 156
+201 165
+201 168
+201 173
+201 174
+201 198
+201 203
+201 211
+201 214
+201 257
+201 276
+201 280
+201 282
+201 297
+201 299
+202 19
+202 29
+202 44
+202 48
+202 67
+202 79
+202 81
+202 96
+202 97
+202 99
+202 104
+202 107
+202 108
+202 128
+202 134
+202 136
+202 141
+202 153
+202 155
+202 160
+202 162
+202 165
+202 173
+202 180
+202 181
+202 203
+202 210
+202 219
+202 222
+202 226
+202 241
+202 256
+202 268
+202 280
+202 283
+202 290
+202 294
+202 296
+202 298
+203 23
+203 40
+203 52
+203 64
+203 73
+203 75
+203 79
+203 80
+203 84
+203 98
+203 103
+203 105
+203 108
+203 118
+203 123
+203 144
+203 151
+203 155
+203 156
+203 160
+203 168
+203 171
+203 172
+203 177
+203 178
+203 185
+203 189
+203 191
+203 204
+203 228
+203 229
+203 230
+203 241
+203 253
+203 258
+203 263
+203 265
+203 284
+203 289
+203 296
+204 0
+204 4
+204 8
+204 10
+204 15
+204 34
+204 38
+204 40
+204 48
+204 49
+204 59
+204 74
+204 76
+204 90
+204 98
+204 107
+204 136
+204 142
+204 143
+204 153
+204 154
+204 159
+204 162
+204 173
+204 176
+204 177
+204 184
+204 185
+204 187
+204 196
+204 199
+204 225
+204 231
+204 240
+204 241
+204 257
+204 259
+204 273
+204 289
+204 298
+205 7
+205 26
+205 36
+205 62
+205 66
+205 67
+205 70
+205 74
+205 76
+205 86
+205 91
+205 93
+205 105
+205 106
+205 109
+205 125
+205 151
+205 157
+205 163
+205 170
+205 171
+205 177
+205 184
+205 185
+205 197
+205 209
+205 219
+205 232
+205 241
+205 242
+205 248
+205 258
+205 265
+205 268
+205 271
+205 280
+205 281
+205 291
+205 295
+206 6
+206 14
+206 17
+206 52
+206 71
+206 75
+206 77
+206 80
+206 87
+206 88
+206 89
+206 96
+206 100
+206 104
+206 105
+206 108
+206 134
+206 140
+206 154
+206 160
+206 165
+206 171
+206 173
+206 177
+206 179
+206 199
+206 211
+206 228
+206 245
+206 248
+206 252
+206 258
+206 264
+206 275
+206 282
+206 285
+206 286
+206 288
+206 290
+206 295
+207 9
+207 22
+207 24
+207 28
+207 36
+207 42
+207 43
+207 62
+207 67
+207 69
+207 71
+207 84
+207 91
+207 99
+207 104
+207 105
+207 118
+207 138
+207 151
+207 175
+207 180
+207 205
+207 206
+207 213
+207 215
+207 216
+207 217
+207 219
+207 221
+207 222
+207 224
+207 234
+207 240
+207 247
+207 252
+207 254
+207 261
+207 267
+207 276
+207 283
+208 19
+208 26
+208 31
+208 37
+208 39
+208 44
+208 52
+208 56
+208 60
+208 68
+208 82
+208 83
+208 87
+208 90
+208 92
+208 104
+208 116
+208 117
+208 131
+208 138
+208 142
+208 148
+208 160
+208 165
+208 169
+208 184
+208 191
+208 192
+208 197
+208 214
+208 215
+208 223
+208 228
+208 233
+208 251
+208 279
+208 280
+208 281
+208 286
+208 299
+209 0
+209 4
+209 12
+209 13
+209 27
+209 30
+209 45
+209 47
+209 53
+209 61
+209 68
+209 69
+209 71
+209 78
+209 96
+209 97
+209 106
+209 107
+209 114
+209 120
+209 123
+209 127
+209 142
+209 145
+209 158
+209 170
+209 210
+209 221
+209 230
+209 231
+209 241
+209 242
+209 264
+209 270
+209 271
+209 272
+209 277
+209 287
+209 290
+209 297
+210 3
+210 4
+210 6
+210 19
+210 26
+210 31
+210 35
+210 44
+210 54
+210 64
+210 66
+210 67
+210 73
+210 80
+210 82
+210 90
+210 105
+210 107
+210 137
+210 140
+210 149
+210 167
+210 178
+210 187
+210 194
+210 198
+210 220
+210 225
+210 226
+210 228
+210 235
+210 241
+210 247
+210 249
+210 259
+210 260
+210 265
+210 276
+210 280
+210 288
+211 2
+211 10
+211 33
+211 42
+211 48
+211 53
+211 54
+211 56
+211 70
+211 72
+211 73
+211 82
+211 91
+211 93
+211 95
+211 101
+211 104
+211 105
+211 134
+211 136
+211 140
+211 154
+211 164
+211 165
+211 174
+211 184
+211 186
+211 197
+211 202
+211 208
+211 215
+211 223
+211 253
+211 255
+211 280
+211 282
+211 284
+211 291
+211 292
+211 294
+212 11
+212 13
+212 16
+212 18
+212 30
+212 38
+212 41
+212 54
+212 70
+212 78
+212 83
+212 97
+212 106
+212 108
+212 112
+212 117
+212 125
+212 129
+212 143
+212 145
+212 150
+212 153
+212 156
+212 174
+212 188
+212 190
+212 196
+212 199
+212 210
+212 215
+212 216
+212 230
+212 242
+212 251
+212 259
+212 271
+212 274
+212 275
+212 286
+212 293
+213 9
+213 17
+213 26
+213 27
+213 42
+213 43
+213 59
+213 71
+213 80
+213 82
+213 85
+213 92
+213 99
+213 105
+213 119
+213 125
+213 126
+213 132
+213 134
+213 138
+213 144
+213 145
+213 151
+213 153
+213 178
+213 179
+213 185
+213 190
+213 195
+213 207
+213 210
+213 221
+213 232
+213 253
+213 280
+213 286
+213 287
+213 291
+213 294
+213 299
+214 3
+214 15
+214 25
+214 46
+214 47
+214 52
+214 54
+214 59
+214 63
+214 65
+214 68
+214 88
+214 98
+214 102
+214 114
+214 115
+214 123
+214 127
+214 138
+214 140
+214 158
+214 161
+214 163
+214 172
+214 178
+214 216
+214 228
+214 232
+214 239
+214 244
+214 246
+214 247
+214 248
+214 249
+214 262
+214 265
+214 266
+214 269
+214 285
+214 292
+215 16
+215 28
+215 29
+215 33
+215 36
+215 50
+215 54
+215 55
+215 66
+215 73
+215 75
+215 96
+215 104
+215 120
+215 125
+215 133
+215 135
+215 140
+215 162
+215 175
+215 177
+215 179
+215 183
+215 184
+215 185
+215 198
+215 199
+215 201
+215 208
+215 216
+215 220
+215 225
+215 227
+215 230
+215 235
+215 252
+215 255
+215 272
+215 284
+215 291
+216 0
+216 13
+216 32
+216 36
+216 40
+216 54
+216 61
+216 66
+216 69
+216 76
+216 87
+216 94
+216 97
+216 98
+216 107
+216 110
+216 116
+216 122
+216 125
+216 152
+216 186
+216 188
+216 190
+216 192
+216 198
+216 199
+216 205
+216 208
+216 209
+216 215
+216 218
+216 226
+216 227
+216 230
+216 236
+216 245
+216 254
+216 256
+216 268
+216 293
+217 1
+217 9
+217 26
+217 32
+217 52
+217 55
+217 60
+217 62
+217 74
+217 75
+217 105
+217 111
+217 116
+217 121
+217 137
+217 155
+217 173
+217 176
+217 178
+217 182
+217 184
+217 185
+217 186
+217 196
+217 202
+217 205
+217 215
+217 216
+217 218
+217 221
+217 231
+217 237
+217 247
+217 250
+217 257
+217 260
+217 280
+217 283
+217 287
+217 298
+218 1
+218 18
+218 38
+218 39
+218 41
+218 46
+218 47
+218 56
+218 57
+218 61
+218 64
+218 71
+218 84
+218 88
+218 93
+218 101
+218 115
+218 132
+218 136
+218 159
+218 163
+218 164
+218 172
+218 179
+218 181
+218 200
+218 209
+218 211
+218 223
+218 233
+218 234
+218 236
+218 244
+218 246
+218 247
+218 263
+218 270
+218 273
+218 291
+218 294
+219 7
+219 26
+219 44
+219 56
+219 60
+219 62
+219 66
+219 75
+219 81
+219 112
+219 120
+219 124
+219 125
+219 129
+219 134
+219 143
+219 145
+219 150
+219 151
+219 158
+219 160
+219 165
+219 170
+219 172
+219 179
+219 182
+219 183
+219 197
+219 199
+219 215
+219 218
+219 220
+219 221
+219 245
+219 254
+219 267
+219 272
+219 283
+219 291
+219 296
+220 8
+220 25
+220 27
+220 39
+220 42
+220 59
+220 61
+220 74
+220 79
+220 81
+220 87
+220 100
+220 102
+220 110
+220 113
+220 116
+220 127
+220 134
+220 141
+220 143
+220 156
+220 158
+220 174
+220 178
+220 195
+220 205
+220 207
+220 213
+220 219
+220 225
+220 233
+220 236
+220 252
+220 256
+220 260
+220 266
+220 290
+220 293
+220 294
+220 297
+221 22
+221 26
+221 32
+221 34
+221 58
+221 60
+221 69
+221 96
+221 98
+221 100
+221 106
+221 113
+221 114
+221 115
+221 120
+221 125
+221 127
+221 132
+221 142
+221 148
+221 179
+221 181
+221 184
+221 186
+221 196
+221 197
+221 201
+221 204
+221 214
+221 240
+221 245
+221 256
+221 261
+221 264
+221 269
+221 276
+221 280
+221 281
+221 285
+221 288
+222 18
+222 28
+222 29
+222 37
+222 44
+222 51
+222 52
+222 63
+222 64
+222 67
+222 76
+222 83
+222 90
+222 104
+222 108
+222 117
+222 119
+222 123
+222 126
+222 135
+222 136
+222 161
+222 162
+222 167
+222 177
+222 208
+222 224
+222 229
+222 232
+222 242
+222 248
+222 250
+222 262
+222 281
+222 283
+222 284
+222 287
+222 289
+222 290
+223 11
+223 34
+223 36
+223 53
+223 60
+223 73
+223 97
+223 100
+223 106
+223 107
+223 108
+223 111
+223 119
+223 121
+223 129
+223 133
+223 153
+223 162
+223 163
+223 166
+223 167
+223 177
+223 180
+223 188
+223 193
+223 195
+223 199
+223 201
+223 207
+223 209
+223 227
+223 234
+223 252
+223 256
+223 262
+223 264
+223 265
+223 271
+223 278
+223 280
+224 6
+224 15
+224 20
+224 27
+224 29
+224 36
+224 57
+224 69
+224 74
+224 83
+224 85
+224 87
+224 89
+224 110
+224 114
+224 115
+224 117
+224 142
+224 151
+224 153
+224 154
+224 155
+224 193
+224 194
+224 203
+224 206
+224 214
+224 215
+224 217
+224 225
+224 237
+224 260
+224 265
+224 269
+224 270
+224 274
+224 282
+224 283
+224 290
+224 297
+225 11
+225 16
+225 21
+225 29
+225 35
+225 37
+225 43
+225 51
+225 54
+225 58
+225 62
+225 75
+225 78
+225 83
+225 94
+225 96
+225 108
+225 125
+225 126
+225 127
+225 135
+225 137
+225 140
+225 144
+225 147
+225 162
+225 174
+225 182
+225 185
+225 206
+225 213
+225 229
+225 230
+225 237
+225 245
+225 252
+225 258
+225 294
+225 299
+226 8
+226 14
+226 35
+226 44
+226 49
+226 52
+226 55
+226 67
+226 73
+226 75
+226 76
+226 87
+226 97
+226 103
+226 109
+226 115
+226 121
+226 128
+226 133
+226 147
+226 150
+226 154
+226 160
+226 166
+226 175
+226 176
+226 177
+226 201
+226 208
+226 212
+226 217
+226 229
+226 231
+226 234
+226 249
+226 254
+226 256
+226 260
+226 268
+226 281
+227 3
+227 6
+227 10
+227 16
+227 35
+227 47
+227 57
+227 61
+227 64
+227 69
+227 82
+227 86
+227 97
+227 103
+227 108
+227 111
+227 119
+227 123
+227 131
+227 132
+227 148
+227 183
+227 184
+227 199
+227 218
+227 221
+227 236
+227 238
+227 246
+227 250
+227 254
+227 261
+227 262
+227 265
+227 267
+227 286
+227 292
+227 294
+227 297
+227 298
+228 0
+228 5
+228 6
+228 16
+228 22
+228 26
+228 41
+228 44
+228 49
+228 58
+228 67
+228 84
+228 97
+228 100
+228 104
+228 105
+228 124
+228 134
+228 137
+228 138
+228 139
+228 142
+228 151
+228 163
+228 181
+228 182
+228 184
+228 197
+228 200
+228 202
+228 212
+228 219
+228 226
+228 238
+228 257
+228 262
+228 290
+228 293
+228 295
+228 296
+229 13
+229 14
+229 15
+229 24
+229 31
+229 32
+229 36
+229 56
+229 61
+229 67
+229 69
+229 76
+229 78
+229 80
+229 91
+229 92
+229 96
+229 110
+229 114
+229 124
+229 128
+229 138
+229 143
+229 153
+229 164
+229 173
+229 186
+229 191
+229 193
+229 207
+229 209
+229 217
+229 228
+229 252
+229 253
+229 254
+229 256
+229 272
+229 285
+229 292
+230 3
+230 7
+230 8
+230 25
+230 28
+230 30
+230 52
+230 61
+230 64
+230 79
+230 84
+230 88
+230 97
+230 104
+230 106
+230 109
+230 110
+230 115
+230 126
+230 138
+230 143
+230 148
+230 153
+230 155
+230 165
+230 184
+230 185
+230 196
+230 203
+230 207
+230 210
+230 223
+230 231
+230 238
+230 262
+230 268
+230 275
+230 288
+230 294
+230 299
+231 0
+231 5
+231 13
+231 25
+231 27
+231 38
+231 48
+231 51
+231 56
+231 66
+231 75
+231 91
+231 99
+231 106
+231 119
+231 120
+231 134
+231 137
+231 151
+231 156
+231 159
+231 168
+231 180
+231 185
+231 190
+231 191
+231 192
+231 196
+231 202
+231 208
+231 218
+231 221
+231 227
+231 261
+231 262
+231 265
+231 267
+231 276
+231 296
+231 298
+232 1
+232 4
+232 7
+232 8
+232 34
+232 43
+232 51
+232 64
+232 83
+232 85
+232 92
+232 93
+232 94
+232 95
+232 105
+232 120
+232 122
+232 123
+232 135
+232 155
+232 169
+232 170
+232 174
+232 187
+232 191
+232 194
+232 200
+232 204
+232 226
+232 234
+232 236
+232 248
+232 249
+232 255
+232 263
+232 279
+232 280
+232 291
+232 295
+233 0
+233 1
+233 3
+233 6
+233 32
+233 52
+233 57
+233 58
+233 70
+233 77
+233 90
+233 113
+233 118
+233 124
+233 142
+233 145
+233 146
+233 157
+233 160
+233 164
+233 167
+233 171
+233 173
+233 184
+233 187
+233 206
+233 209
+233 216
+233 221
+233 231
+233 238
+233 249
+233 251
+233 253
+233 262
+233 264
+233 274
+233 278
+233 288
+234 12
+234 17
+234 19
+234 23
+234 24
+234 31
+234 32
+234 34
+234 37
+234 43
+234 50
+234 56
+234 60
+234 62
+234 72
+234 76
+234 85
+234 86
+234 88
+234 90
+234 91
+234 95
+234 107
+234 110
+234 111
+234 115
+234 126
+234 153
+234 155
+234 157
+234 158
+234 173
+234 180
+234 182
+234 197
+234 217
+234 251
+234 254
+234 261
+234 267
+235 19
+235 21
+235 25
+235 37
+235 55
+235 74
+235 75
+235 85
+235 86
+235 100
+235 104
+235 111
+235 116
+235 119
+235 125
+235 135
+235 150
+235 153
+235 159
+235 173
+235 177
+235 178
+235 183
+235 184
+235 187
+235 205
+235 211
+235 218
+235 233
+235 238
+235 243
+235 245
+235 250
+235 252
+235 253
+235 255
+235 266
+235 275
+235 289
+235 290
+236 3
+236 16
+236 24
+236 25
+236 26
+236 34
+236 35
+236 36
+236 41
+236 43
+236 47
+236 53
+236 57
+236 69
+236 73
+236 100
+236 111
+236 123
+236 125
+236 130
+236 145
+236 153
+236 156
+236 157
+236 163
+236 170
+236 186
+236 190
+236 191
+236 200
+236 215
+236 226
+236 230
+236 238
+236 256
+236 257
+236 273
+236 278
+236 292
+236 294
+237 3
+237 11
+237 15
+237 16
+237 17
+237 19
+237 28
+237 49
+237 79
+237 82
+237 83
+237 120
+237 122
+237 130
+237 133
+237 137
+237 144
+237 152
+237 162
+237 166
+237 169
+237 191
+237 197
+237 206
+237 209
+237 213
+237 229
+237 233
+237 234
+237 235
+237 239
+237 242
+237 248
+237 261
+237 264
+237 267
+237 271
+237 273
+237 284
+238 0
+238 6
+238 8
+238 13
+238 19
+238 20
+238 23
+238 27
+238 39
+238 45
+238 52
+238 55
+238 73
+238 76
+238 85
+238 107
+238 110
+238 128
+238 136
+238 141
+238 144
+238 145
+238 158
+238 159
+238 168
+238 171
+238 174
+238 190
+238 196
+238 200
+238 209
+238 210
+238 217
+238 227
+238 230
+238 234
+238 239
+238 247
+238 285
+238 291
+239 4
+239 15
+239 27
+239 36
+239 40
+239 41
+239 45
+239 60
+239 69
+239 76
+239 96
+239 98
+239 108
+239 124
+239 137
+239 150
+239 159
+239 162
+239 173
+239 180
+239 182
+239 185
+239 189
+239 193
+239 197
+239 204
+239 208
+239 209
+239 213
+239 216
+239 220
+239 231
+239 233
+239 236
+239 250
+239 264
+239 272
+239 274
+239 276
+239 292
+240 3
+240 13
+240 25
+240 34
+240 38
+240 40
+240 52
+240 57
+240 81
+240 83
+240 91
+240 94
+240 95
+240 100
+240 103
+240 118
+240 125
+240 126
+240 133
+240 138
+240 145
+240 170
+240 172
+240 174
+240 181
+240 205
+240 209
+240 213
+240 217
+240 231
+240 233
+240 246
+240 253
+240 256
+240 259
+240 261
+240 262
+240 270
+240 272
+240 284
+241 11
+241 18
+241 23
+241 25
+241 28
+241 39
+241 41
+241 46
+241 55
+241 62
+241 71
+241 83
+241 94
+241 95
+241 108
+241 120
+241 125
+241 129
+241 132
+241 136
+241 141
+241 155
+241 167
+241 173
+241 177
+241 202
+241 212
+241 216
+241 226
+241 227
+241 230
+241 235
+241 262
+241 264
+241 268
+241 277
+241 278
+241 279
+241 282
+241 288
+242 13
+242 19
+242 25
+242 32
+242 41
+242 58
+242 61
+242 63
+242 64
+242 71
+242 77
+242 88
+242 96
+242 105
+242 106
+242 108
+242 118
+242 128
+242 131
+242 132
+242 134
+242 146
+242 149
+242 150
+242 171
+242 188
+242 193
+242 195
+242 197
+242 207
+242 215
+242 223
+242 224
+242 231
+242 251
+242 256
+242 257
+242 288
+242 295
+242 297
+243 3
+243 7
+243 15
+243 29
+243 50
+243 53
+243 54
+243 63
+243 66
+243 75
+243 84
+243 95
+243 104
+243 109
+243 111
+243 117
+243 125
+243 138
+243 150
+243 151
+243 177
+243 180
+243 190
+243 209
+243 219
+243 221
+243 222
+243 228
+243 234
+243 239
+243 240
+243 244
+243 247
+243 248
+243 251
+243 254
+243 256
+243 257
+243 266
+243 274
+244 2
+244 5
+244 12
+244 17
+244 20
+244 28
+244 35
+244 37
+244 40
+244 50
+244 62
+244 66
+244 75
+244 100
+244 119
+244 120
+244 135
+244 145
+244 157
+244 165
+244 168
+244 173
+244 175
+244 181
+244 185
+244 188
+244 193
+244 194
+244 217
+244 219
+244 221
+244 232
+244 233
+244 242
+244 243
+244 254
+244 280
+244 290
+244 292
+245 5
+245 21
+245 23
+245 26
+245 45
+245 49
+245 51
+245 60
+245 71
+245 100
+245 103
+245 107
+245 116
+245 117
+245 119
+245 139
+245 150
+245 164
+245 170
+245 171
+245 174
+245 176
+245 181
+245 200
+245 203
+245 216
+245 222
+245 223
+245 233
+245 235
+245 250
+245 252
+245 262
+245 263
+245 269
+245 271
+245 272
+245 273
+245 279
+245 282
+246 5
+246 12
+246 17
+246 37
+246 38
+246 40
+246 53
+246 54
+246 55
+246 66
+246 69
+246 80
+246 84
+246 91
+246 92
+246 104
+246 157
+246 162
+246 164
+246 172
+246 175
+246 182
+246 188
+246 190
+246 198
+246 201
+246 207
+246 216
+246 235
+246 237
+246 240
+246 241
+246 243
+246 248
+246 257
+246 269
+246 271
+246 281
+246 290
+247 2
+247 22
+247 37
+247 38
+247 43
+247 47
+247 55
+247 56
+247 65
+247 84
+247 87
+247 96
+247 99
+247 102
+247 109
+247 114
+247 127
+247 129
+247 140
+247 148
+247 163
+247 197
+247 198
+247 201
+247 210
+247 217
+247 225
+247 227
+247 237
+247 242
+247 255
+247 257
+247 259
+247 260
+247 262
+247 268
+247 271
+247 276
+247 278
+247 291
+248 12
+248 30
+248 32
+248 35
+248 42
+248 50
+248 52
+248 68
+248 78
+248 90
+248 100
+248 112
+248 115
+248 119
+248 123
+248 126
+248 127
+248 129
+248 138
+248 142
+248 145
+248 147
+248 153
+248 165
+248 175
+248 184
+248 193
+248 210
+248 216
+248 234
+248 235
+248 252
+248 258
+248 259
+248 265
+248 277
+248 279
+248 284
+248 285
+249 0
+249 5
+249 7
+249 8
+249 9
+249 10
+249 22
+249 26
+249 44
+249 45
+249 60
+249 68
+249 70
+249 84
+249 102
+249 108
+249 112
+249 119
+249 120
+249 128
+249 130
+249 145
+249 147
+249 160
+249 161
+249 175
+249 176
+249 186
+249 193
+249 205
+249 211
+249 215
+249 218
+249 226
+249 227
+249 235
+249 257
+249 262
+249 281
+249 293
+250 2
+250 8
+250 22
+250 28
+250 29
+250 31
+250 32
+250 35
+250 43
+250 44
+250 69
+250 73
+250 88
+250 92
+250 94
+250 99
+250 104
+250 109
+250 114
+250 116
+250 120
+250 122
+250 128
+250 132
+250 158
+250 166
+250 175
+250 176
+250 195
+250 212
+250 217
+250 222
+250 226
+250 229
+250 233
+250 247
+250 258
+250 261
+250 272
+250 297
+251 5
+251 8
+251 13
+251 22
+251 24
+251 30
+251 53
+251 60
+251 61
+251 71
+251 77
+251 93
+251 95
+251 99
+251 110
+251 112
+251 125
+251 126
+251 128
+251 133
+251 141
+251 149
+251 158
+251 159
+251 165
+251 169
+251 170
+251 179
+251 185
+251 207
+251 219
+251 225
+251 240
+251 249
+251 250
+251 264
+251 267
+251 284
+251 293
+251 298
+252 6
+252 10
+252 11
+252 20
+252 24
+252 40
+252 46
+252 55
+252 75
+252 85
+252 88
+252 94
+252 101
+252 104
+252 109
+252 114
+252 115
+252 121
+252 132
+252 143
+252 145
+252 154
+252 158
+252 164
+252 173
+252 176
+252 188
+252 189
+252 192
+252 196
+252 234
+252 238
+252 240
+252 251
+252 259
+252 264
+252 273
+252 284
+252 291
+252 294
+253 0
+253 4
+253 10
+253 34
+253 37
+253 39
+253 41
+253 48
+253 52
+253 60
+253 65
+253 69
+253 87
+253 120
+253 127
+253 146
+253 147
+253 152
+253 153
+253 158
+253 164
+253 169
+253 174
+253 177
+253 182
+253 185
+253 190
+253 191
+253 206
+253 219
+253 230
+253 235
+253 243
+253 248
+253 256
+253 265
+253 266
+253 268
+253 279
+253 297
+254 12
+254 14
+254 23
+254 36
+254 38
+254 48
+254 53
+254 58
+254 65
+254 77
+254 79
+254 88
+254 90
+254 109
+254 114
+254 139
+254 154
+254 156
+254 157
+254 160
+254 166
+254 173
+254 176
+254 190
+254 193
+254 195
+254 201
+254 204
+254 210
+254 215
+254 225
+254 229
+254 232
+254 259
+254 278
+254 286
+254 287
+254 292
+254 297
+254 298
+255 8
+255 15
+255 17
+255 27
+255 38
+255 48
+255 52
+255 54
+255 58
+255 66
+255 70
+255 71
+255 72
+255 80
+255 93
+255 100
+255 103
+255 105
+255 111
+255 118
+255 124
+255 141
+255 144
+255 148
+255 154
+255 157
+255 182
+255 189
+255 192
+255 194
+255 210
+255 219
+255 226
+255 239
+255 248
+255 251
+255 262
+255 283
+255 290
+255 297
+256 1
+256 17
+256 19
+256 28
+256 40
+256 41
+256 46
+256 49
+256 51
+256 52
+256 60
+256 63
+256 85
+256 86
+256 103
+256 110
+256 116
+256 129
+256 132
+256 135
+256 158
+256 167
+256 171
+256 172
+256 183
+256 191
+256 192
+256 195
+256 210
+256 221
+256 226
+256 227
+256 241
+256 243
+256 254
+256 260
+256 263
+256 279
+256 282
+256 297
+257 11
+257 18
+257 19
+257 22
+257 37
+257 44
+257 48
+257 51
+257 64
+257 70
+257 77
+257 90
+257 100
+257 105
+257 111
+257 117
+257 125
+257 138
+257 151
+257 156
+257 157
+257 158
+257 159
+257 165
+257 169
+257 171
+257 179
+257 191
+257 230
+257 233
+257 234
+257 239
+257 242
+257 261
+257 262
+257 273
+257 285
+257 292
+257 294
+257 299
+258 2
+258 16
+258 36
+258 38
+258 44
+258 45
+258 62
+258 66
+258 68
+258 73
+258 90
+258 100
+258 105
+258 107
+258 110
+258 115
+258 119
+258 125
+258 127
+258 136
+258 137
+258 154
+258 157
+258 180
+258 181
+258 195
+258 197
+258 207
+258 215
+258 232
+258 252
+258 257
+258 259
+258 264
+258 267
+258 268
+258 270
+258 279
+258 286
+258 294
+259 4
+259 5
+259 11
+259 18
+259 20
+259 27
+259 29
+259 36
+259 51
+259 55
+259 66
+259 67
+259 73
+259 76
+259 78
+259 79
+259 93
+259 94
+259 103
+259 114
+259 118
+259 121
+259 136
+259 159
+259 161
+259 170
+259 171
+259 188
+259 198
+259 210
+259 230
+259 248
+259 256
+259 258
+259 262
+259 266
+259 267
+259 274
+259 276
+259 280
+260 1
+260 4
+260 6
+260 10
+260 24
+260 26
+260 43
+260 65
+260 67
+260 73
+260 75
+260 84
+260 85
+260 88
+260 101
+260 113
+260 114
+260 129
+260 133
+260 138
+260 154
+260 160
+260 161
+260 171
+260 177
+260 181
+260 183
+260 201
+260 212
+260 220
+260 225
+260 233
+260 235
+260 243
+260 261
+260 266
+260 277
+260 289
+260 290
+260 294
+261 2
+261 7
+261 17
+261 18
+261 20
+261 22
+261 28
+261 45
+261 47
+261 65
+261 83
+261 86
+261 87
+261 88
+261 91
+261 93
+261 96
+261 101
+261 126
+261 148
+261 155
+261 156
+261 161
+261 169
+261 185
+261 189
+261 196
+261 205
+261 219
+261 221
+261 222
+261 228
+261 230
+261 234
+261 241
+261 242
+261 256
+261 260
+261 292
+261 297
+262 45
+262 50
+262 57
+262 64
+262 66
+262 77
+262 82
+262 90
+262 94
+262 103
+262 105
+262 114
+262 124
+262 128
+262 133
+262 142
+262 149
+262 156
+262 161
+262 168
+262 169
+262 175
+262 177
+262 194
+262 207
+262 211
+262 213
+262 216
+262 224
+262 232
+262 255
+262 257
+262 270
+262 274
+262 276
+262 281
+262 282
+262 287
+262 293
+262 297
+263 25
+263 43
+263 56
+263 62
+263 64
+263 65
+263 66
+263 67
+263 72
+263 83
+263 89
+263 92
+263 93
+263 96
+263 98
+263 101
+263 111
+263 121
+263 133
+263 134
+263 140
+263 147
+263 151
+263 153
+263 157
+263 170
+263 190
+263 201
+263 213
+263 228
+263 231
+263 233
+263 237
+263 240
+263 253
+263 261
+263 266
+263 274
+263 277
+263 293
+264 2
+264 5
+264 6
+264 10
+264 26
+264 38
+264 43
+264 48
+264 58
+264 74
+264 79
+264 90
+264 101
+264 109
+264 120
+264 130
+264 131
+264 133
+264 141
+264 156
+264 168
+264 173
+264 186
+264 200
+264 201
+264 214
+264 216
+264 218
+264 219
+264 232
+264 237
+264 242
+264 261
+264 263
+264 268
+264 278
+264 283
+264 286
+264 291
+264 296
+265 1
+265 3
+265 13
+265 15
+265 25
+265 28
+265 38
+265 53
+265 60
+265 61
+265 70
+265 92
+265 100
+265 108
+265 115
+265 122
+265 125
+265 128
+265 141
+265 147
+265 158
+265 159
+265 164
+265 174
+265 181
+265 187
+265 202
+265 211
+265 217
+265 218
+265 220
+265 222
+265 226
+265 237
+265 247
+265 254
+265 269
+265 279
+265 281
+265 297
+266 7
+266 8
+266 10
+266 14
+266 16
+266 17
+266 24
+266 26
+266 42
+266 55
+266 56
+266 65
+266 78
+266 87
+266 88
+266 95
+266 99
+266 112
+266 138
+266 142
+266 144
+266 153
+266 154
+266 173
+266 178
+266 182
+266 191
+266 199
+266 214
+266 222
+266 228
+266 233
+266 238
+266 239
+266 245
+266 261
+266 275
+266 283
+266 290
+266 291
+267 13
+267 14
+267 21
+267 22
+267 23
+267 24
+267 29
+267 30
+267 34
+267 42
+267 43
+267 44
+267 46
+267 49
+267 53
+267 54
+267 57
+267 59
+267 72
+267 82
+267 94
+267 105
+267 136
+267 138
+267 156
+267 158
+267 180
+267 193
+267 204
+267 213
+267 215
+267 217
+267 229
+267 238
+267 239
+267 241
+267 271
+267 277
+267 294
+267 296
+268 2
+268 12
+268 24
+268 31
+268 35
+268 39
+268 46
+268 51
+268 59
+268 60
+268 64
+268 72
+268 73
+268 74
+268 77
+268 83
+268 84
+268 85
+268 98
+268 100
+268 114
+268 132
+268 137
+268 154
+268 159
+268 167
+268 177
+268 181
+268 190
+268 193
+268 204
+268 213
+268 223
+268 229
+268 232
+268 258
+268 280
+268 287
+268 289
+268 297
+269 8
+269 16
+269 24
+269 36
+269 37
+269 39
+269 41
+269 44
+269 56
+269 57
+269 72
+269 100
+269 106
+269 108
+269 110
+269 111
+269 113
+269 116
+269 126
+269 134
+269 142
+269 157
+269 166
+269 174
+269 182
+269 186
+269 192
+269 200
+269 207
+269 210
+269 213
+269 222
+269 223
+269 224
+269 225
+269 235
+269 244
+269 255
+269 272
+269 291
+270 0
+270 1
+270 2
+270 3
+270 11
+270 13
+270 21
+270 24
+270 36
+270 55
+270 56
+270 69
+270 73
+270 80
+270 93
+270 102
+270 105
+270 108
+270 112
+270 115
+270 124
+270 135
+270 159
+270 167
+270 182
+270 186
+270 192
+270 198
+270 214
+270 216
+270 225
+270 231
+270 232
+270 242
+270 246
+270 247
+270 249
+270 269
+270 275
+270 285
+271 1
+271 12
+271 13
+271 16
+271 22
+271 30
+271 46
+271 51
+271 57
+271 72
+271 91
+271 101
+271 108
+271 122
+271 123
+271 127
+271 140
+271 149
+271 151
+271 156
+271 169
+271 189
+271 196
+271 202
+271 207
+271 210
+271 214
+271 217
+271 233
+271 234
+271 239
+271 251
+271 253
+271 262
+271 265
+271 270
+271 281
+271 286
+271 289
+271 298
+272 0
+272 9
+272 19
+272 30
+272 35
+272 40
+272 44
+272 46
+272 52
+272 53
+272 56
+272 58
+272 66
+272 68
+272 69
+272 76
+272 78
+272 103
+272 116
+272 121
+272 125
+272 135
+272 144
+272 160
+272 177
+272 185
+272 190
+272 193
+272 195
+272 209
+272 211
+272 220
+272 224
+272 227
+272 251
+272 254
+272 261
+272 280
+272 285
+272 289
+273 21
+273 23
+273 27
+273 34
+273 37
+273 44
+273 45
+273 52
+273 59
+273 74
+273 78
+273 81
+273 87
+273 89
+273 91
+273 93
+273 101
+273 108
+273 109
+273 115
+273 120
+273 124
+273 125
+273 139
+273 145
+273 147
+273 156
+273 162
+273 166
+273 169
+273 197
+273 207
+273 211
+273 221
+273 242
+273 244
+273 269
+273 270
+273 293
+274 5
+274 8
+274 12
+274 34
+274 45
+274 48
+274 55
+274 67
+274 73
+274 77
+274 82
+274 85
+274 103
+274 117
+274 118
+274 133
+274 137
+274 150
+274 152
+274 153
+274 172
+274 174
+274 187
+274 195
+274 204
+274 213
+274 215
+274 219
+274 226
+274 237
+274 248
+274 249
+274 253
+274 255
+274 261
+274 282
+274 287
+274 288
+274 291
+275 10
+275 13
+275 20
+275 22
+275 25
+275 30
+275 37
+275 55
+275 58
+275 59
+275 68
+275 73
+275 89
+275 109
+275 112
+275 113
+275 118
+275 120
+275 123
+275 124
+275 129
+275 134
+275 136
+275 137
+275 144
+275 175
+275 178
+275 183
+275 185
+275 187
+275 193
+275 213
+275 239
+275 240
+275 254
+275 261
+275 262
+275 268
+275 279
+275 283
+276 6
+276 10
+276 18
+276 24
+276 38
+276 58
+276 59
+276 60
+276 63
+276 64
+276 65
+276 71
+276 72
+276 73
+276 76
+276 88
+276 92
+276 101
+276 106
+276 116
+276 129
+276 145
+276 149
+276 158
+276 166
+276 167
+276 178
+276 196
+276 201
+276 208
+276 223
+276 224
+276 231
+276 237
+276 245
+276 249
+276 274
+276 278
+276 296
+276 298
+277 15
+277 16
+277 25
+277 31
+277 37
+277 44
+277 45
+277 54
+277 55
+277 63
+277 64
+277 66
+277 70
+277 75
+277 80
+277 97
+277 100
+277 113
+277 124
+277 125
+277 146
+277 156
+277 170
+277 174
+277 176
+277 186
+277 193
+277 198
+277 210
+277 211
+277 213
+277 215
+277 230
+277 238
+277 249
+277 262
+277 278
+277 280
+277 283
+277 294
+278 8
+278 18
+278 21
+278 24
+278 29
+278 35
+278 50
+278 53
+278 57
+278 71
+278 73
+278 77
+278 79
+278 99
+278 100
+278 101
+278 111
+278 119
+278 120
+278 121
+278 148
+278 150
+278 153
+278 162
+278 172
+278 178
+278 182
+278 185
+278 188
+278 189
+278 212
+278 220
+278 223
+278 232
+278 236
+278 237
+278 242
+278 250
+278 275
+278 286
+279 1
+279 4
+279 14
+279 16
+279 18
+279 21
+279 28
+279 33
+279 36
+279 38
+279 47
+279 54
+279 70
+279 72
+279 82
+279 112
+279 118
+279 133
+279 144
+279 145
+279 149
+279 158
+279 159
+279 168
+279 182
+279 184
+279 186
+279 206
+279 213
+279 222
+279 229
+279 233
+279 240
+279 243
+279 255
+279 256
+279 261
+279 275
+279 287
+279 291
+280 25
+280 29
+280 32
+280 35
+280 57
+280 58
+280 68
+280 70
+280 71
+280 75
+280 84
+280 88
+280 101
+280 111
+280 115
+280 131
+280 135
+280 145
+280 147
+280 152
+280 186
+280 192
+280 194
+280 197
+280 199
+280 202
+280 209
+280 216
+280 217
+280 222
+280 235
+280 238
+280 244
+280 247
+280 262
+280 264
+280 265
+280 293
+280 295
+280 298
+281 0
+281 3
+281 7
+281 9
+281 14
+281 18
+281 30
+281 54
+281 57
+281 60
+281 63
+281 66
+281 72
+281 89
+281 90
+281 92
+281 97
+281 103
+281 104
+281 110
+281 118
+281 120
+281 130
+281 155
+281 172
+281 173
+281 183
+281 189
+281 198
+281 217
+281 235
+281 241
+281 242
+281 257
+281 263
+281 268
+281 274
+281 275
+281 284
+281 291
+282 7
+282 16
+282 17
+282 28
+282 39
+282 48
+282 59
+282 61
+282 74
+282 82
+282 89
+282 98
+282 102
+282 133
+282 135
+282 137
+282 141
+282 160
+282 168
+282 172
+282 178
+282 191
+282 194
+282 197
+282 202
+282 203
+282 206
+282 214
+282 219
+282 230
+282 237
+282 244
+282 264
+282 271
+282 280
+282 293
+282 296
+282 297
+282 298
+282 299
+283 7
+283 36
+283 43
+283 55
+283 64
+283 71
+283 87
+283 92
+283 93
+283 96
+283 97
+283 100
+283 101
+283 114
+283 115
+283 125
+283 126
+283 127
+283 130
+283 137
+283 139
+283 140
+283 146
+283 154
+283 173
+283 174
+283 181
+283 184
+283 201
+283 221
+283 236
+283 248
+283 255
+283 258
+283 269
+283 282
+283 289
+283 290
+283 292
+284 8
+284 10
+284 13
+284 19
+284 23
+284 46
+284 57
+284 58
+284 72
+284 77
+284 79
+284 86
+284 94
+284 97
+284 127
+284 144
+284 146
+284 148
+284 149
+284 157
+284 167
+284 190
+284 192
+284 195
+284 200
+284 206
+284 209
+284 211
+284 212
+284 215
+284 216
+284 224
+284 227
+284 228
+284 245
+284 246
+284 252
+284 255
+284 269
+284 279
+285 0
+285 2
+285 5
+285 9
+285 15
+285 26
+285 29
+285 41
+285 44
+285 51
+285 61
+285 67
+285 68
+285 71
+285 88
+285 98
+285 117
+285 134
+285 136
+285 141
+285 146
+285 152
+285 164
+285 176
+285 180
+285 197
+285 206
+285 212
+285 217
+285 223
+285 240
+285 261
+285 264
+285 268
+285 287
+285 294
+285 295
+285 297
+285 298
+285 299
+286 3
+286 21
+286 28
+286 31
+286 43
+286 45
+286 56
+286 57
+286 72
+286 73
+286 74
+286 77
+286 89
+286 106
+286 112
+286 118
+286 122
+286 131
+286 137
+286 139
+286 157
+286 162
+286 166
+286 175
+286 176
+286 185
+286 187
+286 192
+286 201
+286 219
+286 220
+286 235
+286 248
+286 249
+286 253
+286 263
+286 268
+286 288
+286 293
+286 294
+287 10
+287 11
+287 12
+287 13
+287 34
+287 49
+287 52
+287 59
+287 72
+287 79
+287 84
+287 86
+287 92
+287 93
+287 102
+287 120
+287 124
+287 141
+287 149
+287 150
+287 151
+287 161
+287 162
+287 175
+287 176
+287 177
+287 179
+287 180
+287 192
+287 200
+287 202
+287 212
+287 230
+287 247
+287 254
+287 263
+287 265
+287 277
+287 278
+287 296
+288 1
+288 4
+288 13
+288 16
+288 22
+288 27
+288 30
+288 38
+288 42
+288 43
+288 46
+288 62
+288 64
+288 73
+288 88
+288 89
+288 114
+288 118
+288 134
+288 137
+288 145
+288 146
+288 156
+288 171
+288 177
+288 181
+288 198
+288 199
+288 202
+288 204
+288 207
+288 215
+288 220
+288 224
+288 230
+288 250
+288 260
+288 264
+288 278
+288 282
+289 1
+289 3
+289 8
+289 13
+289 15
+289 51
+289 52
+289 53
+289 61
+289 62
+289 70
+289 73
+289 78
+289 82
+289 98
+289 105
+289 107
+289 109
+289 110
+289 122
+289 123
+289 129
+289 130
+289 143
+289 152
+289 160
+289 184
+289 191
+289 201
+289 210
+289 220
+289 232
+289 245
+289 247
+289 256
+289 257
+289 264
+289 265
+289 290
+289 297
+290 13
+290 17
+290 22
+290 24
+290 32
+290 34
+290 37
+290 53
+290 72
+290 88
+290 89
+290 112
+290 118
+290 121
+290 123
+290 124
+290 139
+290 145
+290 161
+290 168
+290 173
+290 181
+290 182
+290 184
+290 185
+290 186
+290 196
+290 199
+290 212
+290 215
+290 221
+290 232
+290 238
+290 247
+290 254
+290 259
+290 267
+290 287
+290 288
+290 293
+291 2
+291 3
+291 4
+291 17
+291 25
+291 29
+291 38
+291 54
+291 62
+291 64
+291 72
+291 80
+291 81
+291 93
+291 98
+291 105
+291 108
+291 111
+291 118
+291 123
+291 125
+291 138
+291 149
+291 154
+291 170
+291 204
+291 207
+291 214
+291 222
+291 226
+291 227
+291 231
+291 247
+291 252
+291 259
+291 260
+291 283
+291 288
+291 299
+292 28
+292 34
+292 63
+292 64
+292 71
+292 74
+292 83
+292 97
+292 101
+292 107
+292 112
+292 119
+292 126
+292 130
+292 131
+292 133
+292 149
+292 157
+292 161
+292 166
+292 169
+292 170
+292 176
+292 180
+292 183
+292 194
+292 198
+292 214
+292 221
+292 227
+292 228
+292 253
+292 255
+292 256
+292 265
+292 267
+292 274
+292 283
+292 284
+293 5
+293 13
+293 18
+293 22
+293 26
+293 35
+293 47
+293 53
+293 65
+293 70
+293 71
+293 83
+293 111
+293 113
+293 125
+293 136
+293 141
+293 163
+293 167
+293 171
+293 188
+293 189
+293 195
+293 210
+293 219
+293 226
+293 227
+293 235
+293 242
+293 249
+293 252
+293 253
+293 254
+293 265
+293 272
+293 273
+293 278
+293 281
+293 288
+293 291
+294 5
+294 10
+294 12
+294 18
+294 38
+294 47
+294 58
+294 60
+294 72
+294 77
+294 82
+294 85
+294 86
+294 88
+294 95
+294 102
+294 109
+294 121
+294 127
+294 130
+294 150
+294 163
+294 178
+294 196
+294 218
+294 221
+294 223
+294 230
+294 237
+294 259
+294 266
+294 270
+294 272
+294 278
+294 280
+294 287
+294 292
+294 295
+294 298
+294 299
+295 5
+295 12
+295 16
+295 22
+295 23
+295 25
+295 27
+295 29
+295 36
+295 44
+295 50
+295 52
+295 61
+295 64
+295 69
+295 71
+295 81
+295 85
+295 91
+295 105
+295 110
+295 113
+295 120
+295 122
+295 135
+295 148
+295 151
+295 172
+295 181
+295 187
+295 190
+295 207
+295 223
+295 230
+295 244
+295 256
+295 266
+295 278
+295 285
+295 294
+296 1
+296 3
+296 10
+296 19
+296 54
+296 55
+296 56
+296 81
+296 99
+296 111
+296 116
+296 142
+296 143
+296 152
+296 153
+296 158
+296 162
+296 164
+296 167
+296 172
+296 176
+296 177
+296 180
+296 182
+296 196
+296 202
+296 206
+296 208
+296 213
+296 220
+296 250
+296 251
+296 255
+296 262
+296 267
+296 271
+296 278
+296 284
+296 285
+296 298
+297 12
+297 17
+297 19
+297 22
+297 61
+297 63
+297 69
+297 70
+297 82
+297 84
+297 94
+297 99
+297 108
+297 129
+297 140
+297 141
+297 144
+297 148
+297 149
+297 159
+297 162
+297 171
+297 172
+297 191
+297 196
+297 198
+297 200
+297 204
+297 205
+297 207
+297 208
+297 210
+297 218
+297 233
+297 248
+297 263
+297 267
+297 277
+297 286
+297 293
+298 7
+298 9
+298 16
+298 26
+298 30
+298 46
+298 57
+298 67
+298 71
+298 73
+298 86
+298 100
+298 104
+298 117
+298 147
+298 154
+298 155
+298 162
+298 171
+298 177
+298 202
+298 203
+298 206
+298 207
+298 218
+298 236
+298 241
+298 243
+298 256
+298 258
+298 260
+298 263
+298 271
+298 273
+298 280
+298 289
+298 294
+298 295
+298 296
+298 299
+299 0
+299 8
+299 12
+299 19
+299 31
+299 35
+299 37
+299 43
+299 47
+299 52
+299 57
+299 74
+299 83
+299 101
+299 121
+299 126
+299 134
+299 140
+299 149
+299 161
+299 189
+299 198
+299 200
+299 207
+299 213
+299 214
+299 216
+299 219
+299 232
+299 244
+299 257
+299 260
+299 262
+299 266
+299 272
+299 275
+299 278
+299 280
+299 287
+299 293
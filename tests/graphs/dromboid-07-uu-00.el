@@ -0,0 +1,8 @@
+0 1
+0 2
+1 3
+2 3
+3 4
+3 5
+4 6
+5 6
@@ -0,0 +1,10 @@
+0 1
+1 2
+0 1
+2 2
+3 0
+1 0
+2 4
+4 4
+2 4
+5 3
\ No newline at end of file
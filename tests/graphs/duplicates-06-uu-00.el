@@ -0,0 +1,11 @@
+0 1
+1 2
+1 0
+2 2
+3 0
+0 1
+2 4
+4 4
+4 2
+5 3
+2 2
\ No newline at end of file
@@ -0,0 +1,10 @@
+0 1 1.5
+1 2 2
+0 1 7
+2 2 0.5
+3 0 3
+1 0 4
+2 4 1
+4 4 2
+2 4 9
+5 3 0.25
\ No newline at end of file
@@ -0,0 +1,11 @@
+0 1 1.5
+1 2 2
+1 0 7
+2 2 0.5
+3 0 3
+0 1 4
+2 4 1
+4 4 2
+4 2 9
+5 3 0.25
+2 2 6
\ No newline at end of file
@@ -0,0 +1,20 @@
+0 1
+0 2
+1 3
+2 4
+2 5
+4 6
+5 7
+4 8
+10 11
+10 12
+12 13
+13 14
+11 15
+16 17
+17 18
+17 19
+17 20
+20 21
+17 22
+19 23
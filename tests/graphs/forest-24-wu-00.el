@@ -0,0 +1,20 @@
+0 1 9
+0 2 5
+1 3 9
+2 4 4
+2 5 9
+4 6 4
+5 7 2
+4 8 3
+10 11 5
+10 12 6
+12 13 9
+13 14 4
+11 15 7
+16 17 4
+17 18 5
+17 19 7
+17 20 2
+20 21 8
+17 22 6
+19 23 6
@@ -0,0 +1,64 @@
+0 1 4294967000
+0 4 4294967002
+0 7 4294967001
+0 9 4294967000
+0 13 4294967003
+1 7 2
+1 9 1
+2 5 3
+2 6 1
+2 11 4
+3 8 3
+4 5 4
+5 0 2
+5 4 1
+5 9 2
+5 11 1
+6 7 3
+6 8 1
+6 16 4
+6 18 3
+7 1 1
+8 4 3
+8 7 3
+8 19 4
+9 3 1
+10 3 1
+10 6 3
+10 15 3
+10 17 4
+11 0 1
+11 8 3
+12 8 3
+13 1 3
+13 2 1
+13 3 4
+13 9 3
+13 16 3
+13 17 2
+13 19 1
+14 12 1
+15 2 3
+15 3 3
+15 12 3
+15 18 3
+16 2 1
+16 3 4
+16 5 1
+16 11 1
+16 13 4
+16 17 3
+17 14 2
+18 1 4
+18 6 1
+18 16 1
+19 11 4
+19 12 4
+19 13 3
+19 15 4
+20 22 3
+21 20 4
+21 22 3
+22 23 2
+24 21 1
+24 23 2
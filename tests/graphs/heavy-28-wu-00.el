@@ -0,0 +1,35 @@
+0 4 1
+0 7 3
+0 9 3
+0 12 1
+0 20 536870913
+2 0 3
+3 1 4
+3 22 536870913
+4 8 2
+5 15 1
+5 18 1
+7 9 3
+7 15 2
+7 16 2
+8 7 2
+8 13 1
+9 13 2
+10 3 1
+10 4 3
+11 15 4
+12 11 1
+14 0 4
+14 15 1
+15 3 4
+16 2 2
+16 5 3
+17 1 4
+17 3 2
+18 1 3
+19 2 4
+19 10 4
+20 21 536870913
+21 23 536870912
+22 23 536870913
+26 27 2
@@ -0,0 +1,299 @@
+0 68
+1 48
+1 78
+1 100
+2 3
+2 28
+2 41
+2 50
+3 39
+3 50
+3 60
+3 67
+3 106
+4 48
+4 75
+4 107
+5 3
+5 39
+6 39
+9 39
+9 109
+10 2
+10 17
+10 34
+10 104
+11 52
+11 83
+12 23
+12 26
+12 62
+13 32
+13 55
+13 85
+14 37
+14 57
+14 58
+14 78
+14 105
+16 1
+16 27
+16 43
+17 72
+18 4
+18 106
+20 25
+20 53
+21 20
+21 64
+21 84
+21 87
+21 105
+23 11
+23 44
+24 30
+24 33
+24 63
+25 44
+25 64
+26 77
+27 34
+28 72
+28 97
+29 1
+29 51
+30 8
+30 20
+30 77
+31 46
+32 15
+32 27
+32 47
+32 67
+32 91
+33 23
+34 14
+34 82
+34 84
+34 92
+34 97
+35 11
+35 13
+35 31
+36 2
+37 2
+37 8
+37 15
+37 70
+37 92
+38 36
+38 95
+39 25
+40 3
+40 51
+40 76
+41 5
+41 63
+42 58
+42 76
+43 54
+44 29
+45 58
+46 37
+46 70
+47 11
+48 9
+48 100
+48 103
+49 37
+49 43
+49 55
+49 100
+50 47
+50 75
+51 53
+52 9
+52 62
+53 20
+53 44
+53 101
+53 107
+54 7
+54 69
+54 92
+55 75
+55 104
+56 63
+56 84
+57 1
+57 28
+57 50
+57 60
+57 90
+58 14
+58 89
+60 14
+61 31
+61 40
+61 46
+62 17
+62 93
+63 97
+64 54
+64 63
+64 86
+64 106
+64 107
+65 13
+65 44
+66 99
+66 107
+67 83
+68 27
+68 62
+69 26
+69 70
+69 79
+69 104
+70 29
+70 44
+70 74
+70 77
+71 26
+71 82
+71 108
+72 32
+72 58
+72 68
+72 70
+73 70
+73 86
+74 50
+74 70
+75 13
+75 63
+75 100
+76 3
+76 40
+77 97
+78 51
+78 75
+79 65
+80 92
+80 102
+81 22
+82 21
+83 40
+83 48
+83 69
+84 45
+84 80
+85 1
+85 22
+85 24
+86 9
+86 12
+86 28
+86 73
+86 94
+87 27
+88 60
+88 66
+89 57
+89 99
+90 108
+91 37
+92 5
+92 20
+92 91
+93 0
+93 65
+94 38
+94 65
+95 42
+95 102
+95 108
+96 57
+97 8
+97 58
+98 0
+98 13
+98 25
+98 68
+99 20
+99 69
+99 90
+99 91
+100 5
+100 17
+100 26
+100 75
+100 78
+100 79
+101 5
+102 29
+102 41
+102 70
+102 79
+102 108
+103 16
+103 72
+104 27
+104 32
+104 45
+105 37
+106 28
+107 48
+107 87
+108 64
+108 73
+108 102
+109 4
+109 41
+109 105
+110 111
+110 119
+112 110
+112 117
+112 118
+112 124
+113 126
+114 120
+114 128
+115 111
+115 114
+115 118
+115 119
+116 114
+117 110
+117 118
+117 122
+118 127
+119 111
+119 113
+119 114
+119 117
+120 112
+120 113
+120 115
+120 128
+120 129
+121 125
+121 128
+122 115
+122 120
+122 128
+123 127
+123 128
+124 110
+124 127
+125 110
+125 114
+126 115
+126 129
+127 111
+127 112
+127 116
+127 129
+128 120
+128 129
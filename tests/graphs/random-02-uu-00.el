@@ -0,0 +1,260 @@
+0 4
+0 19
+0 36
+0 88
+1 92
+2 12
+2 39
+2 65
+2 66
+2 83
+2 93
+2 103
+3 5
+3 10
+3 13
+3 22
+3 27
+3 46
+3 47
+3 62
+3 79
+4 16
+4 31
+4 34
+4 49
+4 74
+4 97
+5 33
+5 99
+5 101
+6 53
+6 83
+7 26
+7 32
+7 46
+7 57
+7 73
+7 108
+8 14
+9 28
+9 45
+9 56
+9 78
+9 100
+10 11
+10 15
+10 32
+10 74
+11 28
+11 92
+12 13
+12 23
+12 58
+12 73
+13 29
+13 30
+13 88
+13 95
+13 96
+14 24
+14 65
+14 95
+15 32
+15 50
+15 78
+16 66
+16 104
+17 59
+17 65
+17 66
+17 85
+18 43
+18 102
+18 103
+19 31
+19 60
+20 21
+20 29
+20 52
+20 57
+20 87
+20 94
+21 67
+21 78
+21 94
+22 41
+22 46
+22 69
+22 71
+23 66
+23 71
+23 96
+24 104
+25 39
+26 62
+26 75
+26 97
+27 50
+27 77
+27 87
+28 84
+29 30
+29 75
+29 81
+29 87
+29 91
+31 67
+31 86
+31 105
+32 47
+32 77
+32 87
+33 70
+34 47
+34 75
+34 98
+34 109
+35 54
+35 62
+36 43
+37 46
+37 50
+37 63
+38 102
+39 57
+39 61
+39 68
+39 92
+39 93
+39 109
+40 59
+40 107
+41 65
+41 104
+42 82
+43 105
+44 59
+44 78
+44 96
+45 58
+45 75
+45 101
+46 61
+46 65
+46 90
+46 101
+46 106
+46 109
+47 69
+47 73
+47 88
+48 54
+48 82
+49 75
+50 62
+50 91
+50 102
+51 96
+52 75
+52 81
+52 87
+53 62
+53 77
+53 94
+54 55
+54 89
+54 91
+55 81
+56 64
+57 100
+57 101
+58 59
+58 62
+58 84
+59 62
+59 83
+60 84
+61 67
+61 92
+62 76
+62 96
+63 64
+64 66
+64 71
+65 86
+65 90
+65 92
+65 106
+66 85
+67 74
+67 96
+67 97
+70 98
+71 89
+71 92
+72 92
+74 75
+74 99
+77 94
+78 83
+78 108
+79 87
+79 90
+79 101
+79 102
+80 95
+84 87
+84 102
+85 103
+86 89
+86 105
+87 107
+89 106
+90 92
+90 106
+91 94
+93 102
+93 103
+93 104
+99 107
+110 113
+110 114
+110 120
+110 124
+111 112
+111 126
+112 116
+112 120
+112 123
+113 119
+113 122
+113 123
+114 119
+114 124
+114 127
+115 118
+115 122
+115 124
+115 126
+116 122
+116 127
+116 128
+116 129
+117 122
+117 126
+117 127
+118 122
+118 125
+118 128
+120 124
+120 126
+121 127
+121 128
+122 129
+123 125
+123 129
+124 126
+125 129
+126 128
+128 129
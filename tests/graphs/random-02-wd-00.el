@@ -0,0 +1,299 @@
+0 61 9
+0 109 5
+2 37 3
+2 48 5
+2 67 7
+3 41 2
+4 25 6
+4 52 7
+4 67 9
+4 109 3
+5 4 7
+5 38 9
+5 43 8
+5 48 0
+5 77 7
+6 1 1
+6 47 6
+6 78 0
+6 96 7
+7 45 3
+7 81 3
+7 99 1
+8 20 3
+8 61 4
+9 13 3
+9 44 3
+9 102 4
+10 72 2
+10 103 2
+11 44 9
+12 4 0
+13 76 4
+13 79 2
+13 93 0
+13 98 5
+14 43 2
+15 6 6
+15 8 1
+15 16 1
+15 21 1
+15 59 1
+15 68 4
+16 5 4
+16 32 0
+17 46 5
+17 48 7
+17 63 9
+19 25 5
+19 29 0
+19 88 0
+20 40 5
+21 10 5
+21 30 6
+22 5 6
+22 46 7
+23 35 1
+23 40 3
+23 86 9
+24 40 7
+27 33 6
+27 81 2
+28 4 8
+28 25 5
+28 56 1
+28 83 4
+29 8 1
+29 24 6
+29 43 1
+30 4 7
+30 41 8
+30 75 4
+30 84 1
+31 27 8
+33 24 5
+33 38 5
+33 66 7
+33 70 4
+34 28 4
+34 31 1
+34 36 5
+34 55 9
+34 79 8
+35 64 8
+35 94 1
+36 15 7
+37 53 8
+38 46 5
+38 55 0
+38 70 4
+38 75 9
+39 0 2
+39 64 2
+40 46 2
+40 53 5
+41 42 7
+42 54 1
+42 70 1
+43 1 8
+43 94 2
+43 103 5
+47 32 9
+47 58 6
+47 71 8
+47 77 4
+48 58 2
+48 81 7
+48 85 7
+48 101 4
+49 75 2
+49 82 1
+50 81 1
+52 19 2
+52 37 8
+52 74 8
+53 15 9
+53 37 6
+53 64 5
+54 6 1
+54 16 4
+54 28 4
+54 50 6
+54 98 0
+55 73 2
+55 83 0
+58 2 7
+59 44 8
+59 45 4
+60 41 3
+60 76 8
+60 80 5
+61 95 5
+61 109 6
+62 2 7
+62 40 8
+62 80 1
+64 38 5
+65 25 7
+65 55 1
+65 64 2
+66 36 4
+66 49 9
+66 101 1
+67 66 1
+67 101 9
+68 34 1
+68 52 2
+68 74 3
+69 16 9
+69 43 6
+69 61 6
+69 73 2
+69 107 9
+70 60 9
+71 0 2
+71 91 6
+72 13 3
+72 52 8
+72 57 8
+72 87 2
+73 44 9
+73 51 2
+73 56 3
+74 8 4
+74 40 5
+75 7 4
+75 16 0
+76 40 7
+76 68 6
+77 1 6
+77 83 5
+77 85 8
+77 90 9
+78 33 4
+78 75 7
+78 97 8
+79 44 4
+79 55 7
+80 17 0
+80 42 9
+80 58 3
+80 63 0
+81 19 1
+81 53 3
+81 61 7
+81 92 2
+82 76 8
+83 27 7
+84 95 3
+84 108 3
+85 99 8
+86 2 3
+86 45 0
+86 55 8
+86 106 7
+87 3 1
+87 71 9
+88 15 4
+88 53 2
+88 75 2
+89 12 7
+89 20 1
+89 41 9
+91 11 0
+91 30 0
+91 60 5
+91 75 9
+91 83 3
+91 92 8
+91 100 1
+92 49 7
+93 102 8
+94 1 0
+94 16 5
+95 58 5
+97 47 5
+97 75 5
+97 89 2
+99 3 1
+99 80 9
+99 104 0
+100 15 1
+100 48 5
+100 53 3
+100 69 1
+101 33 3
+101 35 6
+102 5 3
+102 8 7
+102 34 5
+102 88 1
+103 16 0
+103 31 6
+103 64 1
+103 100 3
+103 107 2
+103 109 6
+104 3 7
+104 15 7
+104 93 1
+105 0 8
+105 34 6
+105 82 3
+106 49 7
+106 73 4
+106 79 0
+107 60 7
+107 73 7
+107 96 6
+108 34 7
+108 76 2
+109 35 7
+109 38 0
+109 75 4
+110 113 5
+110 118 5
+111 126 7
+111 127 8
+112 111 5
+112 128 9
+113 122 6
+113 125 3
+113 127 0
+114 115 3
+114 122 4
+114 128 5
+115 110 2
+115 112 7
+115 114 8
+115 123 3
+116 115 2
+116 119 3
+117 115 0
+117 122 2
+117 123 9
+117 124 6
+117 127 8
+118 116 2
+118 121 0
+119 123 2
+120 113 1
+120 128 9
+121 127 2
+122 126 7
+123 112 7
+124 128 2
+125 114 0
+125 119 0
+125 122 6
+125 126 7
+126 117 5
+126 120 6
+126 125 0
+127 113 0
+128 110 3
+128 118 6
+128 119 0
+128 126 6
+129 122 7
+129 128 0
@@ -0,0 +1,260 @@
+0 21 0
+0 27 2
+0 37 6
+0 86 9
+0 90 9
+1 20 8
+1 38 8
+1 73 4
+2 8 0
+2 41 8
+3 5 3
+3 27 2
+3 56 1
+4 10 3
+4 24 0
+4 28 5
+4 32 1
+4 41 1
+5 10 4
+5 17 0
+5 46 4
+5 50 9
+5 77 2
+5 95 2
+5 102 6
+6 25 2
+6 40 1
+6 78 8
+7 21 5
+7 94 0
+7 97 8
+7 107 2
+8 52 8
+8 80 6
+9 14 2
+9 37 3
+9 67 4
+9 105 7
+9 109 8
+10 36 1
+10 46 6
+10 69 2
+10 77 2
+11 19 4
+11 35 8
+11 47 6
+11 55 8
+12 41 4
+12 51 6
+12 56 5
+13 33 2
+13 92 6
+14 26 0
+14 50 6
+14 62 0
+14 72 4
+15 30 0
+15 69 4
+15 102 2
+15 106 1
+16 79 2
+17 32 1
+17 55 9
+18 41 0
+18 43 3
+18 50 3
+18 86 8
+19 41 0
+19 86 7
+20 42 8
+20 47 2
+20 57 7
+20 85 6
+21 24 5
+21 43 2
+21 58 8
+21 71 9
+21 76 3
+22 31 1
+22 36 7
+22 42 9
+22 90 5
+22 105 4
+23 35 6
+23 80 9
+24 52 0
+24 79 3
+24 85 4
+25 61 9
+25 71 9
+25 81 4
+25 83 7
+25 86 5
+26 54 1
+26 67 3
+26 73 5
+26 100 1
+27 63 0
+27 67 9
+27 102 5
+28 66 8
+28 70 7
+29 39 5
+29 90 1
+29 97 2
+29 98 0
+30 38 7
+30 56 8
+31 32 8
+31 60 9
+31 66 3
+31 74 0
+31 82 3
+32 71 1
+32 78 5
+32 98 9
+33 53 2
+33 69 4
+33 103 1
+33 104 8
+34 43 8
+34 98 0
+34 102 1
+35 66 3
+35 80 9
+35 97 4
+35 99 9
+36 41 0
+36 55 0
+37 39 0
+37 45 7
+37 56 2
+37 58 3
+37 67 5
+37 73 3
+37 84 5
+37 102 4
+38 107 6
+39 49 9
+39 72 6
+39 82 0
+39 108 2
+40 69 6
+40 82 7
+41 81 1
+42 77 8
+43 63 8
+43 84 4
+43 85 8
+44 107 4
+45 55 3
+45 89 6
+46 65 5
+46 68 2
+46 76 3
+46 100 0
+46 102 7
+48 58 6
+48 76 4
+48 100 5
+49 51 6
+49 63 6
+49 64 5
+50 61 9
+50 63 3
+51 70 4
+51 72 4
+52 62 8
+52 79 1
+52 99 0
+52 108 6
+53 55 4
+53 56 9
+53 104 4
+54 61 2
+54 76 9
+54 106 5
+56 78 1
+56 79 2
+56 80 9
+56 99 1
+59 72 3
+59 80 4
+59 100 3
+60 67 7
+60 89 1
+60 95 5
+60 102 0
+61 76 7
+62 69 9
+62 109 3
+64 100 2
+65 97 1
+66 98 3
+68 82 8
+70 104 1
+71 104 1
+73 90 5
+74 78 4
+75 95 9
+76 89 9
+77 99 2
+77 108 1
+79 102 2
+79 103 0
+80 93 2
+81 88 3
+82 106 4
+83 99 0
+83 102 9
+85 109 5
+86 94 5
+87 102 9
+87 104 5
+91 100 2
+91 101 2
+91 109 3
+98 103 0
+99 100 0
+108 109 2
+110 114 0
+110 126 4
+110 128 7
+110 129 1
+112 113 3
+112 114 2
+112 117 6
+112 118 7
+112 121 9
+112 122 8
+112 126 7
+112 129 8
+113 115 5
+114 119 5
+115 118 6
+115 119 6
+115 120 0
+115 125 0
+115 128 2
+116 121 2
+117 120 5
+117 125 3
+117 129 4
+119 120 3
+119 121 5
+119 122 9
+119 129 3
+120 121 9
+121 122 5
+121 124 6
+121 128 5
+122 124 8
+122 126 1
+122 129 3
+123 124 3
+124 127 5
+125 128 2
+125 129 8
+126 127 3
+127 129 0
@@ -0,0 +1,1357 @@
+0 1
+0 2
+0 3
+0 4
+0 5
+0 6
+0 7
+0 8
+1 9
+1 14
+1 18
+1 20
+1 22
+1 23
+1 24
+1 25
+1 28
+1 35
+1 39
+1 40
+1 47
+1 51
+1 53
+1 54
+1 55
+1 57
+1 61
+1 62
+1 65
+1 66
+1 67
+1 70
+1 78
+1 79
+1 81
+1 82
+1 83
+1 92
+1 95
+1 96
+1 97
+1 100
+1 102
+1 103
+1 107
+1 108
+1 111
+1 116
+1 118
+1 119
+1 123
+1 125
+1 126
+1 127
+1 129
+1 130
+1 132
+1 136
+1 138
+1 140
+1 142
+1 146
+1 149
+1 163
+1 164
+1 167
+1 169
+1 172
+1 180
+1 181
+1 182
+1 187
+1 188
+1 191
+1 194
+1 195
+1 197
+1 199
+1 200
+1 201
+1 204
+1 205
+1 206
+1 214
+1 216
+1 223
+1 225
+1 228
+1 229
+1 234
+1 236
+1 244
+1 248
+1 249
+1 251
+1 253
+1 256
+1 263
+1 264
+1 265
+1 268
+1 269
+1 270
+1 271
+1 279
+1 280
+1 284
+1 285
+1 286
+1 287
+1 288
+1 289
+1 292
+1 293
+1 294
+1 296
+1 304
+1 305
+1 306
+1 310
+1 313
+1 316
+1 321
+1 326
+1 327
+1 330
+1 334
+1 337
+2 10
+2 12
+2 13
+2 16
+2 17
+2 21
+2 22
+2 23
+2 24
+2 27
+2 28
+2 29
+2 30
+2 32
+2 39
+2 40
+2 45
+2 46
+2 54
+2 55
+2 56
+2 59
+2 62
+2 63
+2 68
+2 69
+2 71
+2 76
+2 78
+2 79
+2 88
+2 91
+2 92
+2 94
+2 100
+2 102
+2 105
+2 109
+2 110
+2 111
+2 113
+2 118
+2 120
+2 121
+2 126
+2 132
+2 133
+2 134
+2 135
+2 139
+2 141
+2 143
+2 145
+2 146
+2 147
+2 151
+2 152
+2 154
+2 157
+2 158
+2 162
+2 165
+2 168
+2 172
+2 174
+2 177
+2 182
+2 183
+2 184
+2 185
+2 186
+2 187
+2 188
+2 189
+2 190
+2 193
+2 197
+2 203
+2 206
+2 212
+2 216
+2 221
+2 222
+2 224
+2 229
+2 231
+2 233
+2 236
+2 238
+2 239
+2 248
+2 250
+2 253
+2 258
+2 259
+2 261
+2 263
+2 265
+2 266
+2 267
+2 272
+2 273
+2 275
+2 278
+2 288
+2 289
+2 293
+2 294
+2 300
+2 305
+2 307
+2 311
+2 319
+2 323
+2 324
+2 325
+2 326
+2 330
+2 333
+2 334
+3 12
+3 15
+3 17
+3 19
+3 22
+3 25
+3 32
+3 34
+3 35
+3 37
+3 38
+3 44
+3 50
+3 52
+3 55
+3 58
+3 59
+3 61
+3 63
+3 73
+3 74
+3 77
+3 78
+3 84
+3 87
+3 88
+3 92
+3 96
+3 100
+3 107
+3 111
+3 112
+3 121
+3 123
+3 124
+3 125
+3 131
+3 136
+3 137
+3 141
+3 142
+3 143
+3 151
+3 152
+3 153
+3 155
+3 160
+3 166
+3 168
+3 173
+3 176
+3 179
+3 182
+3 183
+3 188
+3 192
+3 193
+3 195
+3 196
+3 197
+3 198
+3 200
+3 202
+3 203
+3 206
+3 208
+3 210
+3 211
+3 215
+3 216
+3 217
+3 218
+3 219
+3 220
+3 222
+3 226
+3 228
+3 229
+3 230
+3 231
+3 232
+3 234
+3 236
+3 238
+3 242
+3 244
+3 246
+3 249
+3 253
+3 254
+3 257
+3 261
+3 262
+3 264
+3 265
+3 266
+3 273
+3 275
+3 282
+3 284
+3 286
+3 292
+3 294
+3 299
+3 305
+3 309
+3 312
+3 313
+3 314
+3 317
+3 318
+3 322
+3 326
+3 327
+3 330
+3 334
+3 336
+3 337
+3 338
+3 339
+4 12
+4 13
+4 15
+4 19
+4 20
+4 23
+4 24
+4 25
+4 35
+4 37
+4 39
+4 40
+4 41
+4 45
+4 52
+4 53
+4 58
+4 59
+4 61
+4 64
+4 66
+4 68
+4 71
+4 72
+4 73
+4 75
+4 77
+4 78
+4 80
+4 81
+4 88
+4 90
+4 95
+4 96
+4 101
+4 103
+4 106
+4 107
+4 109
+4 110
+4 111
+4 112
+4 114
+4 116
+4 120
+4 121
+4 125
+4 126
+4 127
+4 132
+4 133
+4 136
+4 146
+4 147
+4 151
+4 153
+4 159
+4 160
+4 161
+4 165
+4 167
+4 168
+4 170
+4 171
+4 179
+4 181
+4 187
+4 191
+4 194
+4 195
+4 196
+4 197
+4 199
+4 200
+4 202
+4 204
+4 207
+4 209
+4 210
+4 216
+4 220
+4 221
+4 223
+4 225
+4 227
+4 229
+4 234
+4 236
+4 238
+4 244
+4 248
+4 252
+4 256
+4 257
+4 258
+4 260
+4 261
+4 264
+4 267
+4 273
+4 276
+4 279
+4 283
+4 288
+4 289
+4 295
+4 303
+4 307
+4 311
+4 312
+4 313
+4 317
+4 318
+4 319
+4 322
+4 326
+4 328
+4 331
+4 335
+4 337
+5 21
+5 22
+5 28
+5 30
+5 32
+5 38
+5 40
+5 43
+5 45
+5 46
+5 47
+5 49
+5 54
+5 55
+5 58
+5 60
+5 62
+5 71
+5 75
+5 76
+5 78
+5 81
+5 83
+5 87
+5 88
+5 89
+5 92
+5 96
+5 97
+5 102
+5 105
+5 106
+5 108
+5 109
+5 113
+5 114
+5 116
+5 117
+5 124
+5 126
+5 128
+5 131
+5 132
+5 134
+5 137
+5 140
+5 142
+5 144
+5 148
+5 149
+5 150
+5 153
+5 156
+5 160
+5 162
+5 165
+5 167
+5 168
+5 174
+5 177
+5 178
+5 179
+5 180
+5 181
+5 182
+5 185
+5 188
+5 190
+5 193
+5 194
+5 196
+5 200
+5 202
+5 208
+5 209
+5 211
+5 212
+5 213
+5 221
+5 223
+5 233
+5 234
+5 236
+5 240
+5 241
+5 243
+5 244
+5 247
+5 254
+5 256
+5 257
+5 259
+5 261
+5 264
+5 265
+5 266
+5 273
+5 276
+5 278
+5 280
+5 284
+5 286
+5 287
+5 289
+5 299
+5 303
+5 304
+5 311
+5 314
+5 315
+5 318
+5 320
+5 325
+5 326
+5 327
+5 328
+5 330
+5 332
+5 335
+5 337
+6 11
+6 13
+6 14
+6 19
+6 20
+6 21
+6 26
+6 30
+6 32
+6 33
+6 38
+6 41
+6 46
+6 48
+6 50
+6 51
+6 52
+6 61
+6 64
+6 66
+6 67
+6 72
+6 73
+6 77
+6 81
+6 82
+6 83
+6 85
+6 86
+6 92
+6 94
+6 99
+6 100
+6 103
+6 104
+6 105
+6 112
+6 115
+6 119
+6 120
+6 121
+6 125
+6 126
+6 131
+6 134
+6 140
+6 142
+6 144
+6 146
+6 150
+6 152
+6 153
+6 154
+6 155
+6 162
+6 163
+6 165
+6 168
+6 178
+6 180
+6 186
+6 188
+6 189
+6 192
+6 195
+6 196
+6 199
+6 201
+6 202
+6 203
+6 204
+6 205
+6 210
+6 213
+6 217
+6 219
+6 221
+6 222
+6 232
+6 233
+6 236
+6 241
+6 249
+6 250
+6 259
+6 261
+6 265
+6 266
+6 267
+6 271
+6 272
+6 275
+6 276
+6 277
+6 279
+6 282
+6 287
+6 288
+6 289
+6 290
+6 291
+6 292
+6 295
+6 296
+6 299
+6 308
+6 309
+6 312
+6 317
+6 319
+6 320
+6 323
+6 328
+6 329
+6 330
+6 331
+6 334
+6 336
+6 338
+6 339
+7 13
+7 16
+7 19
+7 29
+7 31
+7 32
+7 35
+7 38
+7 42
+7 43
+7 44
+7 45
+7 46
+7 47
+7 49
+7 50
+7 52
+7 53
+7 55
+7 57
+7 67
+7 71
+7 72
+7 73
+7 75
+7 78
+7 79
+7 80
+7 82
+7 88
+7 92
+7 94
+7 95
+7 96
+7 98
+7 99
+7 100
+7 106
+7 109
+7 111
+7 112
+7 113
+7 118
+7 121
+7 124
+7 126
+7 128
+7 131
+7 135
+7 140
+7 141
+7 143
+7 146
+7 148
+7 149
+7 151
+7 152
+7 155
+7 161
+7 162
+7 164
+7 170
+7 171
+7 175
+7 176
+7 180
+7 181
+7 183
+7 186
+7 198
+7 200
+7 208
+7 209
+7 212
+7 219
+7 228
+7 229
+7 231
+7 232
+7 236
+7 237
+7 238
+7 239
+7 240
+7 241
+7 242
+7 246
+7 248
+7 249
+7 250
+7 254
+7 257
+7 261
+7 267
+7 272
+7 273
+7 280
+7 281
+7 282
+7 286
+7 288
+7 289
+7 292
+7 293
+7 294
+7 295
+7 301
+7 310
+7 311
+7 313
+7 316
+7 321
+7 323
+7 327
+7 328
+7 330
+7 333
+7 334
+7 336
+7 339
+8 9
+8 10
+8 11
+8 12
+8 13
+8 14
+8 18
+8 21
+8 22
+8 24
+8 25
+8 28
+8 29
+8 36
+8 40
+8 42
+8 43
+8 44
+8 49
+8 52
+8 53
+8 54
+8 56
+8 58
+8 59
+8 63
+8 64
+8 69
+8 70
+8 71
+8 73
+8 77
+8 79
+8 81
+8 85
+8 86
+8 88
+8 89
+8 90
+8 92
+8 93
+8 95
+8 96
+8 98
+8 99
+8 102
+8 106
+8 109
+8 111
+8 114
+8 115
+8 117
+8 126
+8 127
+8 135
+8 140
+8 143
+8 145
+8 149
+8 150
+8 152
+8 160
+8 162
+8 164
+8 168
+8 175
+8 176
+8 180
+8 183
+8 191
+8 192
+8 194
+8 195
+8 198
+8 199
+8 202
+8 206
+8 210
+8 213
+8 214
+8 215
+8 216
+8 217
+8 229
+8 231
+8 232
+8 233
+8 237
+8 238
+8 244
+8 253
+8 254
+8 255
+8 259
+8 264
+8 266
+8 268
+8 270
+8 273
+8 275
+8 276
+8 281
+8 283
+8 284
+8 287
+8 293
+8 294
+8 296
+8 297
+8 298
+8 299
+8 300
+8 306
+8 308
+8 310
+8 318
+8 319
+8 321
+8 331
+8 334
+9 78
+9 114
+11 157
+14 20
+15 283
+17 116
+18 231
+22 253
+23 79
+24 263
+25 227
+27 86
+28 236
+32 35
+32 38
+33 171
+35 93
+36 221
+36 330
+38 72
+40 39
+40 60
+41 225
+41 337
+42 279
+43 228
+43 263
+44 289
+45 76
+45 216
+46 309
+48 96
+48 177
+49 255
+50 278
+52 84
+53 326
+55 261
+56 123
+56 314
+57 92
+57 232
+58 185
+59 97
+59 172
+60 19
+60 98
+62 320
+63 219
+64 240
+65 329
+66 42
+66 231
+71 109
+75 205
+75 233
+77 31
+77 205
+78 188
+80 213
+82 335
+83 202
+84 209
+85 172
+86 64
+87 115
+88 241
+88 317
+89 90
+93 230
+94 71
+94 198
+95 290
+95 315
+96 230
+96 321
+98 83
+99 256
+100 69
+100 178
+101 9
+102 131
+103 323
+103 324
+104 53
+106 23
+106 272
+107 166
+108 85
+111 317
+111 321
+112 31
+112 186
+115 151
+116 77
+116 100
+117 200
+117 297
+120 169
+120 194
+121 123
+121 299
+122 68
+122 169
+123 160
+124 78
+124 211
+125 330
+126 42
+127 43
+128 82
+129 71
+129 168
+132 232
+133 81
+133 291
+134 174
+135 112
+135 231
+136 104
+137 144
+138 157
+139 140
+139 262
+140 147
+141 278
+142 274
+143 110
+144 14
+147 98
+147 243
+148 251
+150 286
+151 267
+152 216
+152 221
+153 197
+153 303
+154 196
+155 166
+155 322
+156 323
+158 98
+158 303
+159 237
+161 282
+162 222
+163 91
+164 326
+165 55
+166 80
+166 121
+167 311
+168 269
+169 12
+169 53
+170 294
+171 140
+171 263
+173 202
+174 152
+174 236
+175 322
+176 274
+178 295
+180 237
+182 253
+182 286
+184 249
+185 225
+185 301
+186 124
+186 132
+187 294
+188 162
+188 320
+189 144
+189 302
+191 183
+191 208
+193 49
+195 54
+196 272
+197 270
+200 125
+200 323
+201 290
+203 11
+204 193
+204 300
+205 270
+207 269
+208 32
+210 221
+211 19
+211 261
+212 231
+212 276
+213 205
+214 24
+215 287
+215 329
+216 209
+217 75
+217 195
+218 328
+219 295
+221 295
+222 38
+223 278
+224 123
+226 89
+228 34
+230 137
+231 20
+231 48
+232 196
+232 306
+233 58
+234 137
+235 272
+235 331
+237 195
+237 293
+238 174
+239 35
+239 264
+241 160
+241 282
+244 297
+246 167
+247 35
+248 125
+249 291
+250 223
+252 150
+252 186
+254 49
+255 49
+255 64
+257 248
+260 10
+260 291
+261 338
+262 178
+264 251
+265 240
+266 252
+267 97
+267 178
+268 21
+268 300
+269 319
+271 46
+272 204
+275 241
+276 66
+276 125
+277 241
+278 142
+279 33
+279 101
+280 57
+281 293
+282 272
+283 83
+284 189
+285 298
+286 193
+288 61
+288 279
+291 262
+292 138
+292 297
+293 260
+294 128
+295 130
+298 279
+299 288
+300 186
+301 225
+303 75
+303 310
+305 112
+305 195
+306 147
+306 210
+307 80
+308 103
+308 244
+309 171
+310 339
+314 328
+315 65
+315 296
+316 61
+318 180
+319 159
+320 302
+321 111
+322 231
+323 65
+324 305
+325 101
+325 270
+326 269
+327 210
+327 241
+328 254
+329 16
+330 23
+331 34
+332 113
+333 214
+334 93
+334 142
+335 269
+337 64
+339 90
+339 340
+340 341
+341 342
+342 343
+343 344
+344 345
+345 346
+346 347
+347 348
+348 349
+349 350
+350 351
+351 352
+352 353
+353 354
+354 355
+355 356
+356 357
+357 358
+358 359
+359 360
+360 361
+361 362
+362 363
+363 364
+364 365
+365 366
+366 367
+367 368
+368 369
+369 370
+370 371
+371 372
+372 373
+373 374
+374 375
+375 376
+376 377
+377 378
+378 379
+379 380
+380 381
+381 382
+382 383
+383 384
+384 385
+385 386
+386 387
+387 388
+388 389
+389 390
+390 391
+391 392
+392 393
+393 394
+394 395
+395 396
+396 397
+397 398
+398 399
+400 50
+401 154
+402 279
+403 294
+404 262
+405 58
+406 254
+407 199
+408 158
+409 72
@@ -0,0 +1,19 @@
+0 1
+0 2
+0 3
+1 4
+1 5
+1 6
+5 7
+1 8
+2 9
+4 10
+0 11
+7 12
+7 13
+13 14
+11 15
+3 16
+0 17
+16 18
+5 19
@@ -0,0 +1,19 @@
+0 1 8
+0 2 8
+0 3 5
+1 4 8
+1 5 2
+1 6 5
+5 7 3
+1 8 6
+2 9 5
+4 10 2
+0 11 9
+7 12 6
+7 13 1
+13 14 4
+11 15 6
+3 16 6
+0 17 2
+16 18 5
+5 19 2
@@ -0,0 +1,19 @@
+1 2
+0 4
+7 0
+0 6
+1 8
+3 1
+0 3
+6 5
+1 0
+0 2
+7 6
+3 4
+4 9
+2 3
+7 8
+5 4
+0 5
+5 7
+8 0
@@ -151,7 +151,17 @@ ALL_GROUPS=("unweighted/undirected/paths"		\
 			"weighted/undirected/distances"		\
 			"weighted/directed/paths"			\
 			"weighted/directed/distances"		\
-			"unweighted/undirected/metrics"		)
+			"unweighted/undirected/metrics"		\
+			"x/undirected/metrics"				\
+			"unweighted/undirected/csr"			\
+			"unweighted/directed/csr"			\
+			"weighted/undirected/csr"			\
+			"weighted/directed/csr"				\
+			"unweighted/undirected/checks"		\
+			"unweighted/directed/checks"		\
+			"weighted/undirected/checks"		\
+			"weighted/directed/checks"			\
+			"x/x/structures"					)
 
 EXE_FILE="cpptests-debug/cpptests"
 # Make sure that executable file exists.